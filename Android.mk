@@ -168,6 +168,7 @@ LOCAL_SRC_FILES := \
         src/armnn/BackendRegistry.cpp \
         src/armnn/Descriptors.cpp \
         src/armnn/Exceptions.cpp \
+        src/armnn/ExecutionPipeline.cpp \
         src/armnn/Graph.cpp \
         src/armnn/ILayerSupport.cpp \
         src/armnn/InternalTypes.cpp \
@@ -178,8 +179,10 @@ LOCAL_SRC_FILES := \
         src/armnn/Network.cpp \
         src/armnn/NetworkUtils.cpp \
         src/armnn/Observable.cpp \
+        src/armnn/OptimizedNetworkCache.cpp \
         src/armnn/Optimizer.cpp \
         src/armnn/OutputHandler.cpp \
+        src/armnn/ParallelWorkloadExecutor.cpp \
         src/armnn/ProfilingEvent.cpp \
         src/armnn/Profiling.cpp \
         src/armnn/Runtime.cpp \
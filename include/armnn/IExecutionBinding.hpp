@@ -0,0 +1,31 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+namespace armnn
+{
+
+using NetworkId = int;
+
+namespace experimental
+{
+
+/// A fixed set of input and output buffers bound to a loaded network. All validation and tensor handle wiring
+/// is done when the binding is created, so that executing the network on the same buffers again and again only
+/// runs its workloads. Create one with IRuntime::CreateExecutionBinding and execute it with
+/// IRuntime::EnqueueWorkload. The bound buffers must stay alive for as long as the binding is used.
+class IExecutionBinding
+{
+public:
+    virtual ~IExecutionBinding() {};
+
+    /// Returns the NetworkId of the Network that this IExecutionBinding is bound to.
+    virtual NetworkId GetNetworkId() = 0;
+};
+
+} // end experimental namespace
+
+} // end armnn namespace
@@ -310,6 +310,8 @@ public:
 
     armnn::ShapeInferenceMethod GetShapeInferenceMethod() const;
 
+    std::string GetOptimizedNetworkCacheDirectory() const;
+
     void SetImportEnabled(bool ImportState);
 
     void SetExportEnabled(bool ExportState);
@@ -328,6 +330,11 @@ public:
 
     void SetAllowExpandedDims(bool ExpandedDimsAllowed);
 
+    /// Optimized networks are saved to, and loaded from, this directory. When Optimize finds the network it is given
+    /// optimized before, for the same backends and with the same options, it loads it instead of optimizing it again.
+    /// Caching is disabled when the directory is empty, which it is by default.
+    void SetOptimizedNetworkCacheDirectory(const std::string& directory);
+
 private:
 
     std::unique_ptr<armnn::OptimizerOptionsOpaqueImpl> p_OptimizerOptionsImpl;
@@ -645,6 +652,20 @@ public:
     IConnectableLayer* AddConstantLayer(const ConstTensor& input,
                                         const char* name = nullptr);
 
+    /// Adds a layer with no inputs and a single output, which always corresponds to
+    /// the passed in constant tensor. Unlike AddConstantLayer, the tensor data is not copied.
+    /// @param input - Tensor to be provided as the only output of the layer. The layer, and the layers of the
+    ///                networks optimized from it, reference the memory of @a input directly.
+    /// @param memoryOwner - Keeps the memory referenced by @a input alive for as long as it is referenced, for
+    ///                      example a file mapping the tensor data is read from. May be empty when the caller
+    ///                      keeps the memory alive for the lifetime of the network and of any network optimized
+    ///                      or loaded from it.
+    /// @param name - Optional name for the layer.
+    /// @return - Interface for configuring the layer.
+    IConnectableLayer* AddImportedConstantLayer(const ConstTensor& input,
+                                                std::shared_ptr<const void> memoryOwner,
+                                                const char* name = nullptr);
+
     /// Adds a reshape layer to the network.
     /// @param reshapeDescriptor - Parameters for the reshape operation.
     /// @param name - Optional name for the layer.
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "BackendOptions.hpp"
+#include "IExecutionBinding.hpp"
 #include "INetwork.hpp"
 #include "IProfiler.hpp"
 #include "IWorkingMemHandle.hpp"
@@ -47,13 +48,17 @@ struct INetworkProperties
                        MemorySource outputSource,
                        bool profilingEnabled = false,
                        ProfilingDetailsMethod detailsMethod = ProfilingDetailsMethod::Undefined,
-                       bool externalMemoryManagementEnabled = false)
+                       bool externalMemoryManagementEnabled = false,
+                       unsigned int numLoadThreads = 1,
+                       unsigned int numExecutionThreads = 1)
         : m_AsyncEnabled(asyncEnabled),
           m_ProfilingEnabled(profilingEnabled),
           m_OutputNetworkDetailsMethod(detailsMethod),
           m_InputSource(inputSource),
           m_OutputSource(outputSource),
-          m_ExternalMemoryManagementEnabled(externalMemoryManagementEnabled)
+          m_ExternalMemoryManagementEnabled(externalMemoryManagementEnabled),
+          m_NumLoadThreads(numLoadThreads),
+          m_NumExecutionThreads(numExecutionThreads)
     {}
 
     const bool m_AsyncEnabled;
@@ -67,6 +72,20 @@ struct INetworkProperties
 
     const bool m_ExternalMemoryManagementEnabled;
 
+    /// The number of threads LoadNetwork may use to create the workloads, and to execute the constant workloads,
+    /// of the backends which declare the "ThreadSafeWorkloadCreation" capability. 1 loads the network on the
+    /// calling thread only and 0 uses as many threads as the hardware supports.
+    const unsigned int m_NumLoadThreads;
+
+    /// The number of threads an inference may use to execute independent branches of the graph at the same time.
+    /// Above 1 the workloads are ordered by their dependencies rather than executed one after another, and the
+    /// lifetimes of the intermediate tensors are extended so that concurrent workloads never share memory. Requires
+    /// every backend of the network to declare the "ConcurrentWorkloadExecution" capability. 1 executes the network
+    /// on the calling thread only and 0 uses as many threads as the hardware supports. The network falls back to
+    /// serial execution while the profiler or timeline reporting is enabled. Ignored for async enabled networks and
+    /// when external memory management is enabled, as its memory plan assumes serial execution.
+    const unsigned int m_NumExecutionThreads;
+
     virtual ~INetworkProperties() {}
 };
 
@@ -254,6 +273,22 @@ public:
                            std::vector<ImportedInputId> preImportedInputIds = {},
                            std::vector<ImportedOutputId> preImportedOutputIds = {});
 
+    /// Binds a fixed set of InputTensors and OutputTensors to a network. Validation and the wiring of the buffers
+    /// to the network are done here once, so that EnqueueWorkload(IExecutionBinding&) only executes the workloads.
+    /// The buffers must outlive the returned binding.
+    /// Throws an InvalidArgumentException if no network with the given id is loaded, if the network is AsyncEnabled,
+    /// or if the tensors do not match the inputs and outputs of the network.
+    std::unique_ptr<IExecutionBinding> CreateExecutionBinding(NetworkId networkId,
+                                                              const InputTensors& inputTensors,
+                                                              const OutputTensors& outputTensors);
+
+    /// Evaluates a network on the buffers of an IExecutionBinding created by CreateExecutionBinding.
+    /// Other bindings and EnqueueWorkload calls on the same network can be interleaved, the binding is then
+    /// rewired on its next use. Returns Status::Failure if the network of the binding has been unloaded.
+    /// Switching to another network, through either EnqueueWorkload, frees the working memory of the previous one.
+    /// Unlike EnqueueWorkload with tensors, this neither times nor logs the execution.
+    Status EnqueueWorkload(IExecutionBinding& executionBinding);
+
     /// This is an experimental function.
     /// Evaluates a network using input in inputTensors and outputs filled into outputTensors.
     /// This function performs a thread safe execution of the network. Returns once execution is complete.
@@ -265,6 +300,18 @@ public:
                    std::vector<ImportedInputId> preImportedInputs = {},
                    std::vector<ImportedOutputId> preImportedOutputs = {});
 
+    /// This is an experimental function.
+    /// Schedules an inference of an AsyncEnabled network on its execution pipeline and returns without waiting for it
+    /// to complete. The workloads of the network are split into stages of consecutive workloads assigned to the same
+    /// backend, each executed by its own thread, so that consecutive inferences overlap across the stages and the
+    /// throughput approaches that of the slowest stage. The pipeline is started by the first call and finishes the
+    /// scheduled inferences when the network is unloaded. Blocks while every stage is busy.
+    /// The tensors must stay valid until cb is notified with the status of the inference.
+    void SchedulePipelined(NetworkId networkId,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors,
+                           std::shared_ptr<IAsyncExecutionCallback> cb);
+
     /// Unloads a network from the IRuntime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021-2022 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021-2022, 2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #if !defined(ARMNN_DISABLE_THREADS)
@@ -10,6 +10,8 @@
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 #include <stdint.h>
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -27,6 +29,16 @@ namespace experimental
 class IAsyncExecutionCallback;
 class IWorkingMemHandle;
 
+/// Runs scheduled inferences on a fixed set of worker threads, each with its own working memory handle.
+///
+/// Every worker owns a bounded lock-free queue per priority. Schedule() places requests round robin on the
+/// workers' queues and idle workers steal from the queues of the others, so neither producers nor consumers
+/// share a lock in the common case. Workers pick requests from high to low priority, but after EXPIRE_RATE
+/// consecutive requests of one priority the next lower priority is served so that it cannot be starved.
+///
+/// Requests for a network with batching enabled (see EnableBatching()) are coalesced and executed together on a
+/// batched variant of the network. A batch only reaches the queues once it is full or its window has expired, so
+/// no worker is held up waiting for one.
 class Threadpool
 {
 public:
@@ -34,12 +46,11 @@ public:
                IRuntime* runtimePtr,
                std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles);
 
-    ~Threadpool()
-    {
-        TerminateThreadPool();
-    }
+    ~Threadpool();
 
     void LoadMemHandles(std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles);
+    /// Also disables batching for networkId and for the networks batched onto it. Requests still waiting to be
+    /// batched are notified with Status::Failure.
     void UnloadMemHandles(NetworkId networkId);
 
     /// Schedule an asynchronous execution on the loaded network
@@ -49,31 +60,71 @@ public:
                   const QosExecPriority priority,
                   std::shared_ptr<IAsyncExecutionCallback> cb);
 
+    /// Enables dynamic batching of the requests scheduled for networkId. Up to maxBatchSize pending requests are
+    /// coalesced into one execution of batchedNetworkId, which must be the same model loaded with a batch dimension
+    /// (dimension 0) maxBatchSize times larger for every input and output, and whose working memory handles must
+    /// have been loaded with LoadMemHandles(). A batch is executed once it is full or once batchWindow has passed
+    /// since its first request was scheduled, so batching adds at most batchWindow to a request's latency. The
+    /// inputs are copied into the batched network's input tensors and the outputs copied back before each
+    /// request's callback is notified. Partial batches fill the leading rows of the batched tensors and zero the
+    /// others; a single request runs directly on networkId. Must not be called while requests are scheduled for networkId.
+    void EnableBatching(NetworkId networkId,
+                        NetworkId batchedNetworkId,
+                        unsigned int maxBatchSize,
+                        std::chrono::microseconds batchWindow);
+
     void TerminateThreadPool() noexcept;
 
 private:
-    using ExecutionTuple = std::tuple<NetworkId,
-                                      InputTensors,
-                                      OutputTensors,
-                                      std::shared_ptr<IAsyncExecutionCallback>>;
-
-    using ExecutionQueue = std::queue<std::shared_ptr<ExecutionTuple>>;
+    struct ExecutionRequest;
+    struct RequestQueues;
+    struct BatchCollector;
+    struct BatchBuffers;
 
     void ProcessExecPriorities(uint32_t index);
 
+    void Enqueue(NetworkId networkId,
+                 const InputTensors& inputTensors,
+                 const OutputTensors& outputTensors,
+                 QosExecPriority priority,
+                 const std::shared_ptr<IAsyncExecutionCallback>& cb,
+                 bool isBatch);
+
+    bool TryTakeRequest(uint32_t index, QosExecPriority priority, ExecutionRequest& request);
+
+    /// Returns the BatchCollector of networkId, or nullptr if batching is not enabled for it.
+    std::shared_ptr<BatchCollector> FindBatchCollector(NetworkId networkId);
+
+    /// Starts the window of the requests pending in collector. Must be called with the collector's mutex held.
+    void AddWaitingBatch(const std::shared_ptr<BatchCollector>& collector);
+
+    /// Must be called with the collector's mutex held.
+    void RemoveWaitingBatch(const BatchCollector& collector);
+
+    /// Schedules the tickets of the waiting batches whose window has expired, or of all of them if dispatchAll is
+    /// set. dueBatches is scratch memory. Returns true if a ticket was scheduled.
+    bool DispatchDueBatches(bool dispatchAll, std::vector<std::shared_ptr<BatchCollector>>& dueBatches);
+
+    void ExecuteRequest(uint32_t index, const ExecutionRequest& request);
+
+    void ExecuteBatch(uint32_t index, BatchCollector& collector, std::vector<ExecutionRequest>& batch,
+                      BatchBuffers& buffers);
+
     IRuntime* m_RuntimePtr;
 
-    ExecutionQueue m_HighPriorityQueue;
-    ExecutionQueue m_MediumPriorityQueue;
-    ExecutionQueue m_LowPriorityQueue;
+    // The scheduled requests, created before the threads are started.
+    std::unique_ptr<RequestQueues> m_RequestQueues;
+
+    // Number of requests scheduled but not yet taken by a worker.
+    std::atomic<std::size_t> m_PendingRequests{0};
 
-    // Condition Variables require mutex which will guard the shared state.
-    // Has an event happened? Stop signal for example
+    // Idle workers sleep on the condition variable, which is only used to wake them up.
+    std::atomic<std::size_t> m_SleepingThreads{0};
     std::condition_variable m_ThreadPoolEvent;
     std::mutex m_ThreadPoolMutex;
 
-    // The shared state for conditional variable
-    bool m_TerminatePool = false;
+    // Stop signal, the workers finish the scheduled requests before stopping.
+    std::atomic<bool> m_TerminatePool{false};
 
     std::unordered_map<NetworkId, std::vector<std::shared_ptr<IWorkingMemHandle>>> m_WorkingMemHandleMap;
     std::vector<std::unique_ptr<std::thread>> m_Threads;
@@ -228,6 +228,27 @@ public:
         IgnoreUnused(workingMemDescriptor);
         throw armnn::Exception("UpdateExecutionData: Function has not been implemented in backend.");
     };
+
+    /// Serializes the pre-compiled object of a PreCompiled layer this backend created, so that the optimized network
+    /// it is part of can be cached by Optimize.
+    ///
+    /// \param preCompiledObject - The pre-compiled object, as given to AddPrecompiledLayer
+    /// \return - Returns the serialized object, or an empty vector if the backend cannot serialize it
+    virtual std::vector<uint8_t> SerializePreCompiledObject(const void* preCompiledObject) const
+    {
+        IgnoreUnused(preCompiledObject);
+        return {};
+    }
+
+    /// Recreates a pre-compiled object serialized by SerializePreCompiledObject
+    ///
+    /// \param data - The serialized object
+    /// \return - Returns the pre-compiled object, to be set on the PreCompiled layer
+    virtual CompiledBlobPtr DeserializePreCompiledObject(const std::vector<uint8_t>& data) const
+    {
+        IgnoreUnused(data);
+        throw armnn::Exception("DeserializePreCompiledObject: Function has not been implemented in backend.");
+    }
 };
 
 using IBackendInternalUniquePtr = std::unique_ptr<IBackendInternal>;
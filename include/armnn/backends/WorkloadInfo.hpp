@@ -21,6 +21,9 @@ struct WorkloadInfo
     Optional<TensorInfo> m_WeightsTensorInfo = EmptyOptional();
     Optional<TensorInfo> m_BiasTensorInfo = EmptyOptional();
     Optional<std::string> m_ConvolutionMethod = EmptyOptional();
+    /// One entry per input, true when the input is the output of a ConstantLayer and so holds the same values on
+    /// every execution. Empty when the workload is not created from a layer of a graph.
+    std::vector<bool> m_InputsFromConstantLayers = {};
 };
 
 struct MemoryInfo
@@ -33,6 +36,9 @@ struct MemoryInfo
 struct MemoryRequirements
 {
     armnn::Optional<std::vector<MemoryInfo>> m_IntraLayerTensors;
+    /// Bytes of temporary memory the workload takes from the ScratchArena during one execution. The arena grows if
+    /// this is too small, so an estimate is enough.
+    size_t m_ScratchMemorySize{ 0 };
 };
 
 } //namespace armnn
@@ -0,0 +1,93 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/IExecutionBinding.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/backends/ITensorHandle.hpp>
+#include <armnn/backends/Workload.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+class ExecutionBinding final : public IExecutionBinding
+{
+public:
+    using WorkloadQueue = std::vector<std::unique_ptr<IWorkload>>;
+
+    /// A user buffer wrapped in a tensor handle, kept alive for the lifetime of the binding.
+    struct BoundTensor
+    {
+        LayerBindingId m_LayerBindingId;
+        TensorInfo m_TensorInfo;
+        std::unique_ptr<ITensorHandle> m_TensorHandle;
+    };
+
+    ExecutionBinding(NetworkId networkId,
+                     unsigned int bindingId,
+                     std::vector<BoundTensor> inputs,
+                     std::vector<BoundTensor> outputs)
+        : m_NetworkId(networkId)
+        , m_BindingId(bindingId)
+        , m_Inputs(std::move(inputs))
+        , m_Outputs(std::move(outputs))
+    {}
+
+    NetworkId GetNetworkId() override
+    {
+        return m_NetworkId;
+    }
+
+    /// Identifies the binding within the LoadedNetwork that created it.
+    unsigned int GetBindingId() const
+    {
+        return m_BindingId;
+    }
+
+    /// The bound inputs, in the order of the input layers of the network.
+    const std::vector<BoundTensor>& GetInputs() const
+    {
+        return m_Inputs;
+    }
+
+    /// The bound outputs, in the order of the output layers of the network.
+    const std::vector<BoundTensor>& GetOutputs() const
+    {
+        return m_Outputs;
+    }
+
+    /// Workloads copying the bound inputs into the network. Empty for inputs that were imported.
+    WorkloadQueue& GetInputQueue()
+    {
+        return m_InputQueue;
+    }
+
+    /// Workloads copying or synchronising the network outputs into the bound outputs.
+    WorkloadQueue& GetOutputQueue()
+    {
+        return m_OutputQueue;
+    }
+
+private:
+    NetworkId m_NetworkId;
+    unsigned int m_BindingId;
+
+    std::vector<BoundTensor> m_Inputs;
+    std::vector<BoundTensor> m_Outputs;
+
+    WorkloadQueue m_InputQueue;
+    WorkloadQueue m_OutputQueue;
+};
+
+} // end experimental namespace
+
+} // end armnn namespace
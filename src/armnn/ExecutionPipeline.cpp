@@ -0,0 +1,211 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#if !defined(ARMNN_DISABLE_THREADS)
+
+#include "ExecutionPipeline.hpp"
+
+#include "LoadedNetwork.hpp"
+#include "Profiling.hpp"
+#include "WorkingMemHandle.hpp"
+
+#include <armnn/Logging.hpp>
+#include <armnn/utility/Timer.hpp>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+struct ExecutionPipeline::Request
+{
+    std::unique_ptr<IWorkingMemHandle> m_MemHandle;
+    OutputTensors m_OutputTensors;
+    std::shared_ptr<IAsyncExecutionCallback> m_Callback;
+    HighResolutionClock m_StartTime;
+    // Cleared by the first stage that fails, the later stages then only hand the request on.
+    bool m_Succeeded = true;
+};
+
+ExecutionPipeline::ExecutionPipeline(LoadedNetwork& network, NetworkId networkId)
+    : m_Network(network)
+{
+    std::unique_ptr<IWorkingMemHandle> firstMemHandle = m_Network.CreateWorkingMemHandle(networkId);
+    WorkingMemHandle& workingMemHandle = dynamic_cast<WorkingMemHandle&>(*firstMemHandle);
+
+    const unsigned int numWorkloads = m_Network.GetNumWorkloads();
+    for (unsigned int i = 0; i < numWorkloads; ++i)
+    {
+        const BackendId& backendId = workingMemHandle.GetExecutionDataAt(i).first;
+        if (m_Stages.empty() || m_Stages.back().m_BackendId != backendId)
+        {
+            m_Stages.push_back({ i, i, backendId });
+        }
+        m_Stages.back().m_EndWorkload = i + 1;
+    }
+    if (m_Stages.empty())
+    {
+        // Nothing to execute between copying the inputs and the outputs, which still needs a stage to happen on.
+        m_Stages.push_back({ 0, 0, BackendId() });
+    }
+
+    const size_t numRequests = m_Stages.size() + 1;
+    for (size_t i = 0; i < numRequests; ++i)
+    {
+        m_Requests.emplace_back(std::make_unique<Request>());
+        m_Requests.back()->m_MemHandle = i == 0 ? std::move(firstMemHandle)
+                                                : m_Network.CreateWorkingMemHandle(networkId);
+        m_FreeRequests.push_back(m_Requests.back().get());
+    }
+
+    for (size_t i = 0; i < m_Stages.size(); ++i)
+    {
+        m_StageQueues.emplace_back(std::make_unique<StageQueue>());
+    }
+    for (size_t i = 0; i < m_Stages.size(); ++i)
+    {
+        m_Threads.emplace_back(&ExecutionPipeline::RunStage, this, i);
+    }
+
+    ARMNN_LOG(info) << "Execution pipeline of network " << networkId << " has " << m_Stages.size() << " stages.";
+}
+
+ExecutionPipeline::~ExecutionPipeline()
+{
+    // Every stage finishes its queue before stopping, so stopping them in order lets all the scheduled inferences
+    // run to completion.
+    for (size_t i = 0; i < m_Stages.size(); ++i)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_StageQueues[i]->m_Mutex);
+            m_StageQueues[i]->m_Stop = true;
+        }
+        m_StageQueues[i]->m_Condition.notify_one();
+        m_Threads[i].join();
+    }
+}
+
+void ExecutionPipeline::Schedule(const InputTensors& inputTensors,
+                                 const OutputTensors& outputTensors,
+                                 std::shared_ptr<IAsyncExecutionCallback> cb)
+{
+    Request* request = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_FreeRequestsMutex);
+        m_FreeRequestsCondition.wait(lock, [this] { return !m_FreeRequests.empty(); });
+        request = m_FreeRequests.back();
+        m_FreeRequests.pop_back();
+    }
+
+    request->m_StartTime = armnn::GetTimeNow();
+    try
+    {
+        m_Network.PrepareExecution(inputTensors, outputTensors,
+                                   dynamic_cast<WorkingMemHandle&>(*request->m_MemHandle));
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_FreeRequestsMutex);
+            m_FreeRequests.push_back(request);
+        }
+        m_FreeRequestsCondition.notify_one();
+        throw;
+    }
+
+    request->m_OutputTensors = outputTensors;
+    request->m_Callback = std::move(cb);
+    request->m_Succeeded = true;
+    Push(0, *request);
+}
+
+void ExecutionPipeline::Push(size_t stageIndex, Request& request)
+{
+    StageQueue& queue = *m_StageQueues[stageIndex];
+    {
+        std::lock_guard<std::mutex> lock(queue.m_Mutex);
+        queue.m_Requests.push_back(&request);
+    }
+    queue.m_Condition.notify_one();
+}
+
+void ExecutionPipeline::RunStage(size_t stageIndex)
+{
+    // The profiler is per thread, the workloads of this stage report to the network's one.
+    ProfilerManager::GetInstance().RegisterProfiler(m_Network.GetProfiler().get());
+
+    const Stage& stage = m_Stages[stageIndex];
+    StageQueue& queue = *m_StageQueues[stageIndex];
+    while (true)
+    {
+        Request* request = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(queue.m_Mutex);
+            queue.m_Condition.wait(lock, [&queue] { return queue.m_Stop || !queue.m_Requests.empty(); });
+            if (queue.m_Requests.empty())
+            {
+                return;
+            }
+            request = queue.m_Requests.front();
+            queue.m_Requests.pop_front();
+        }
+
+        if (request->m_Succeeded)
+        {
+            request->m_Succeeded = m_Network.ExecuteWorkloads(dynamic_cast<WorkingMemHandle&>(*request->m_MemHandle),
+                                                              stage.m_FirstWorkload,
+                                                              stage.m_EndWorkload);
+        }
+
+        if (stageIndex + 1 < m_Stages.size())
+        {
+            Push(stageIndex + 1, *request);
+        }
+        else
+        {
+            Complete(*request);
+        }
+    }
+}
+
+void ExecutionPipeline::Complete(Request& request)
+{
+    if (request.m_Succeeded)
+    {
+        try
+        {
+            m_Network.FinishExecution(request.m_OutputTensors,
+                                      dynamic_cast<WorkingMemHandle&>(*request.m_MemHandle));
+        }
+        catch (const std::exception& error)
+        {
+            ARMNN_LOG(error) << "An error occurred attempting to copy the outputs of a pipelined inference: "
+                             << error.what();
+            request.m_Succeeded = false;
+        }
+    }
+
+    std::shared_ptr<IAsyncExecutionCallback> callback = std::move(request.m_Callback);
+    const InferenceTimingPair timeTaken(request.m_StartTime, armnn::GetTimeNow());
+    const Status status = request.m_Succeeded ? Status::Success : Status::Failure;
+
+    // The working memory can be reused as soon as the outputs have been copied out of it.
+    {
+        std::lock_guard<std::mutex> lock(m_FreeRequestsMutex);
+        m_FreeRequests.push_back(&request);
+    }
+    m_FreeRequestsCondition.notify_one();
+
+    if (callback)
+    {
+        callback->Notify(status, timeTaken);
+    }
+}
+
+} // namespace experimental
+
+} // namespace armnn
+
+#endif
@@ -0,0 +1,101 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#if !defined(ARMNN_DISABLE_THREADS)
+
+#pragma once
+
+#include <armnn/BackendId.hpp>
+#include <armnn/IAsyncExecutionCallback.hpp>
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+class LoadedNetwork;
+
+namespace experimental
+{
+
+class WorkingMemHandle;
+
+/// Executes the inferences of an async enabled LoadedNetwork as a pipeline, see IRuntime::SchedulePipelined.
+///
+/// The workload queue is split into stages of consecutive workloads assigned to the same backend and every stage is
+/// executed by its own thread. An inference is handed from one stage to the next along with the working memory
+/// holding its intermediate tensors. There is one more working memory than there are stages, so every stage can be
+/// busy with an inference while the next one is being scheduled, and consecutive inferences overlap across stages.
+class ExecutionPipeline
+{
+public:
+    /// The workloads [m_FirstWorkload, m_EndWorkload) of the workload queue, all assigned to m_BackendId.
+    struct Stage
+    {
+        unsigned int m_FirstWorkload;
+        unsigned int m_EndWorkload;
+        BackendId m_BackendId;
+    };
+
+    ExecutionPipeline(LoadedNetwork& network, NetworkId networkId);
+
+    /// Finishes the scheduled inferences and stops the threads of the stages.
+    ~ExecutionPipeline();
+
+    ExecutionPipeline(const ExecutionPipeline&) = delete;
+    ExecutionPipeline& operator=(const ExecutionPipeline&) = delete;
+
+    /// Validates the tensors and copies the inputs on the calling thread, then hands the inference to the first
+    /// stage. Blocks while all the working memory is in use by earlier inferences.
+    void Schedule(const InputTensors& inputTensors,
+                  const OutputTensors& outputTensors,
+                  std::shared_ptr<IAsyncExecutionCallback> cb);
+
+    const std::vector<Stage>& GetStages() const
+    {
+        return m_Stages;
+    }
+
+private:
+    struct Request;
+
+    struct StageQueue
+    {
+        std::mutex m_Mutex;
+        std::condition_variable m_Condition;
+        std::deque<Request*> m_Requests;
+        bool m_Stop = false;
+    };
+
+    void RunStage(size_t stageIndex);
+    void Push(size_t stageIndex, Request& request);
+    void Complete(Request& request);
+
+    LoadedNetwork& m_Network;
+    std::vector<Stage> m_Stages;
+
+    // One request, with its own working memory, for every inference that can be in flight.
+    std::vector<std::unique_ptr<Request>> m_Requests;
+
+    std::mutex m_FreeRequestsMutex;
+    std::condition_variable m_FreeRequestsCondition;
+    std::vector<Request*> m_FreeRequests;
+
+    std::vector<std::unique_ptr<StageQueue>> m_StageQueues;
+    std::vector<std::thread> m_Threads;
+};
+
+} // namespace experimental
+
+} // namespace armnn
+
+#endif
@@ -17,6 +17,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <unordered_map>
 #include <DotSerializer.hpp>
 #include <sstream>
@@ -204,7 +205,122 @@ Status Graph::SerializeToDot(std::ostream& stream)
     return Status::Success;
 }
 
-Status Graph::AllocateDynamicBuffers()
+namespace
+{
+
+/// Returns, for the layer at every position of the topologically sorted layers, the position from which all the
+/// layers that follow depend on it. Output layers are left out, as they only copy their input once the other layers
+/// have executed.
+///
+/// The descendants of each layer are gathered as a bitset, in reverse topological order, by OR-ing the bitsets of its
+/// consumers a word at a time. The bitset of a layer only covers the positions after it, and is released as soon as
+/// the first of its parents has been visited, so only the layers on the boundary of the visited part of the graph
+/// hold one at any time.
+std::vector<unsigned int> GetDependencyBarrierPositions(const std::list<Layer*>& layers)
+{
+    using Word = uint64_t;
+    constexpr size_t WordBits = 64;
+
+    std::unordered_map<const Layer*, unsigned int> positions;
+    for (auto&& layer : layers)
+    {
+        positions.emplace(layer, armnn::numeric_cast<unsigned int>(positions.size()));
+    }
+
+    const size_t numLayers = layers.size();
+    const size_t numWords = (numLayers + WordBits - 1) / WordBits;
+    std::vector<const Layer*> layersInOrder(layers.begin(), layers.end());
+
+    // The layers a barrier waits for, and the first parent of every layer, after which its bitset is not needed.
+    std::vector<Word> nonOutputLayers(numWords, 0);
+    std::vector<size_t> firstParents(numLayers, numLayers);
+    for (size_t position = 0; position < numLayers; ++position)
+    {
+        const Layer* layer = layersInOrder[position];
+        if (layer->GetType() != LayerType::Output)
+        {
+            nonOutputLayers[position / WordBits] |= Word(1) << (position % WordBits);
+        }
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+            if (connectedSlot != nullptr)
+            {
+                firstParents[position] = std::min<size_t>(firstParents[position],
+                                                          positions.at(&connectedSlot->GetOwningLayer()));
+            }
+        }
+    }
+
+    // The descendants of the layer at each position p, as the words [(p + 1) / WordBits, numWords) of a bitset.
+    std::vector<std::vector<Word>> descendants(numLayers);
+    std::vector<unsigned int> barrierPositions(numLayers);
+    for (size_t position = numLayers; position-- > 0;)
+    {
+        const size_t firstWord = (position + 1) / WordBits;
+        std::vector<Word>& layerDescendants = descendants[position];
+        layerDescendants.assign(numWords - firstWord, 0);
+
+        std::vector<unsigned int> consumers;
+        for (auto&& outputSlot : layersInOrder[position]->GetOutputSlots())
+        {
+            for (auto&& connection : outputSlot.GetConnections())
+            {
+                const unsigned int consumer = positions.at(&connection->GetOwningLayer());
+                consumers.push_back(consumer);
+
+                layerDescendants[consumer / WordBits - firstWord] |= Word(1) << (consumer % WordBits);
+                const std::vector<Word>& consumerDescendants = descendants[consumer];
+                const size_t consumerFirstWord = (consumer + 1) / WordBits;
+                for (size_t word = 0; word < consumerDescendants.size(); ++word)
+                {
+                    layerDescendants[consumerFirstWord + word - firstWord] |= consumerDescendants[word];
+                }
+            }
+        }
+
+        // The barrier follows the last layer after this one which does not depend on it.
+        size_t barrier = position + 1;
+        for (size_t word = numWords; word-- > firstWord;)
+        {
+            Word independentLayers = nonOutputLayers[word] & ~layerDescendants[word - firstWord];
+            if (word * WordBits <= position)
+            {
+                // Leaves out this layer and the ones before it, which share its first word.
+                independentLayers &= ~((Word(2) << (position % WordBits)) - 1);
+            }
+            if (independentLayers != 0)
+            {
+                size_t lastBit = 0;
+                while (independentLayers >>= 1)
+                {
+                    ++lastBit;
+                }
+                barrier = word * WordBits + lastBit + 1;
+                break;
+            }
+        }
+        barrierPositions[position] = armnn::numeric_cast<unsigned int>(barrier);
+
+        // The consumers whose first parent is this layer, and this layer if it has no parent, are done with.
+        for (unsigned int consumer : consumers)
+        {
+            if (firstParents[consumer] == position)
+            {
+                std::vector<Word>().swap(descendants[consumer]);
+            }
+        }
+        if (firstParents[position] == numLayers)
+        {
+            std::vector<Word>().swap(layerDescendants);
+        }
+    }
+    return barrierPositions;
+}
+
+} // anonymous namespace
+
+Status Graph::AllocateDynamicBuffers(bool concurrentExecution)
 {
     // Layers must be sorted in topological order
     ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(m_LayersInOrder, "layers must be in order.");
@@ -251,9 +367,47 @@ Status Graph::AllocateDynamicBuffers()
         }
     }
 
+    // The lifetime of a tensor handle ends once the layers from a certain position on may reuse its memory. When
+    // executing serially that is the position following its last consumer. When layers of independent branches can
+    // execute at the same time, it is the first position from which all the layers depend on all of its consumers.
+    std::vector<unsigned int> barrierPositions;
+    if (concurrentExecution)
+    {
+        barrierPositions = GetDependencyBarrierPositions(m_Layers);
+    }
+    std::unordered_map<const ITensorHandle*, unsigned int> handleReleasePositions;
+    std::vector<std::pair<unsigned int, ITensorHandle*>> pendingReleases;
+
+    auto EndLifetime = [&](ITensorHandle* tensorHandle, unsigned int releasePosition, unsigned int position)
+    {
+        if (releasePosition <= position + 1)
+        {
+            tensorHandle->Allocate();
+        }
+        else
+        {
+            pendingReleases.emplace_back(releasePosition, tensorHandle);
+        }
+    };
+
     // Iterate over the network in topological order
+    unsigned int position = 0;
     for (auto&& layer : m_Layers)
     {
+        const unsigned int layerReleasePosition = concurrentExecution ? barrierPositions[position] : position + 1;
+
+        // End the lifetimes which were waiting for this position.
+        auto released = std::partition(pendingReleases.begin(), pendingReleases.end(),
+                                       [position](const std::pair<unsigned int, ITensorHandle*>& pendingRelease)
+                                       {
+                                           return pendingRelease.first > position;
+                                       });
+        for (auto it = released; it != pendingReleases.end(); ++it)
+        {
+            it->second->Allocate();
+        }
+        pendingReleases.erase(released, pendingReleases.end());
+
         // Count the amount of times each output slot references a certain buffer (ITensorHandle).
         // The first time we encounter a new tensor handle, we start managing its lifetime.
         for (auto&& slot = layer->BeginOutputSlots(); slot != layer->EndOutputSlots(); ++slot)
@@ -270,7 +424,7 @@ Status Graph::AllocateDynamicBuffers()
                     if (handleReferenceCounts[tensorHandle] == 0u)
                     {
                           // if nobody consumes this tensor we call Allocate()
-                          tensorHandle->Allocate();
+                          EndLifetime(tensorHandle, layerReleasePosition, position);
                     }
                 }
                 else
@@ -291,14 +445,25 @@ Status Graph::AllocateDynamicBuffers()
             {
                 --handleReferenceCounts[tensorHandle];
 
+                unsigned int& releasePosition = handleReleasePositions[tensorHandle];
+                releasePosition = std::max(releasePosition, layerReleasePosition);
+
                 if (handleReferenceCounts[tensorHandle] == 0u)
                 {
                     // Stop managing lifetime of tensor handle
-                    tensorHandle->Allocate();
+                    EndLifetime(tensorHandle, releasePosition, position);
                     handleReferenceCounts.erase(tensorHandle);
+                    handleReleasePositions.erase(tensorHandle);
                 }
             }
         }
+        ++position;
+    }
+
+    // The remaining lifetimes last until the end of the network.
+    for (auto&& pendingRelease : pendingReleases)
+    {
+        pendingRelease.second->Allocate();
     }
 
     return Status::Success;
@@ -103,6 +103,14 @@ public:
         , m_Profiler(std::make_shared<IProfiler>())
         {}
 
+    /// Creates an empty graph sharing the profiler of another graph, such as the one an optimized graph is made from.
+    Graph(ShapeInferenceMethod shapeInferenceMethod, bool allowExpandedDims, std::shared_ptr<IProfiler> profiler)
+        : m_LayersInOrder(true)
+        , m_AllowExpandedDims(allowExpandedDims)
+        , m_ShapeInferenceMethod(shapeInferenceMethod)
+        , m_Profiler(std::move(profiler))
+        {}
+
     Graph(const Graph& other);
 
     Graph& operator=(const Graph& other) = delete;
@@ -205,7 +213,9 @@ public:
     size_t GetNumLayers() const { return m_Layers.size(); }
 
     /// Allocates memory for all tensors under output tensor handers of each layer.
-    Status AllocateDynamicBuffers();
+    /// With concurrentExecution the memory of a tensor is only reused once every layer left to execute depends on all
+    /// of its consumers, so that layers of independent branches executing at the same time never share memory.
+    Status AllocateDynamicBuffers(bool concurrentExecution = false);
 
     /// Modifies the graph in-place, removing edges connecting layers using different compute devices,
     /// and relinking them via an intermediary copy layers.
@@ -236,6 +246,9 @@ public:
 
     const std::shared_ptr<IProfiler>& GetProfiler() const;
 
+    ShapeInferenceMethod GetShapeInferenceMethod() const { return m_ShapeInferenceMethod; }
+    bool GetAllowExpandedDims() const { return m_AllowExpandedDims; }
+
     void SetLayersOutOfOrder();
 
 private:
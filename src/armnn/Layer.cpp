@@ -292,6 +292,16 @@ void Layer::CollectWorkloadInputs(WorkloadDataCollector& dataCollector) const
     }
 }
 
+void Layer::CollectInputsFromConstantLayers(WorkloadInfo& info) const
+{
+    info.m_InputsFromConstantLayers.reserve(GetNumInputSlots());
+    for (auto&& inputSlot : GetInputSlots())
+    {
+        info.m_InputsFromConstantLayers.push_back(
+            inputSlot.GetConnectedOutputSlot()->GetOwningLayer().GetType() == LayerType::Constant);
+    }
+}
+
 void Layer::CollectWorkloadOutputs(WorkloadDataCollector& dataCollector) const
 {
     for (auto&& outputHandler : m_OutputHandlers)
@@ -411,6 +411,7 @@ protected:
         WorkloadInfo info;
         CollectQueueDescriptorInputs(descriptor, info);
         CollectQueueDescriptorOutputs(descriptor, info);
+        CollectInputsFromConstantLayers(info);
         info.m_Name = GetName();
         return info;
     }
@@ -434,6 +435,7 @@ protected:
 
 private:
     void CollectWorkloadInputs(WorkloadDataCollector& dataCollector) const;
+    void CollectInputsFromConstantLayers(WorkloadInfo& info) const;
     void CollectWorkloadOutputs(WorkloadDataCollector& dataCollector) const;
 
 protected:
@@ -9,6 +9,7 @@
 #include "Profiling.hpp"
 #include "HeapProfiling.hpp"
 #include "WorkingMemHandle.hpp"
+#include "ExecutionBinding.hpp"
 #include "ExecutionData.hpp"
 
 #include <armnn/BackendHelper.hpp>
@@ -25,11 +26,18 @@
 #include <armnn/utility/Assert.hpp>
 
 #include <backendsCommon/MemSyncWorkload.hpp>
+#include <backendsCommon/TaskPool.hpp>
 
 #include <common/include/Processes.hpp>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+
+#if !defined(ARMNN_DISABLE_THREADS)
+#include <thread>
+#endif
+
 namespace armnn
 {
 
@@ -250,6 +258,7 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
         auto const& backendId = layer->GetBackendId();
         if (m_Backends.count(backendId) == 0)
         {
+            ARMNN_SCOPED_PROFILING_EVENT(backendId, "LoadNetwork_CreateWorkloadFactory");
             auto createBackend = BackendRegistryInstance().GetFactory(backendId);
             auto it = m_Backends.emplace(std::make_pair(backendId, createBackend()));
 
@@ -281,6 +290,9 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                 m_SupportsExternallyManagedMemory[backend->GetId()] = false;
                 useInternalMemoryManager = true;
             }
+            m_SupportsThreadSafeWorkloadCreation[backend->GetId()] =
+                HasMatchingCapability(BackendOptions::BackendOption{"ThreadSafeWorkloadCreation", true},
+                                      backend->GetCapabilities());
 
             IBackendInternal::IWorkloadFactoryPtr workloadFactory;
             if (backend->SupportsTensorAllocatorAPI())
@@ -303,6 +315,7 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
 
     if (!networkProperties.m_AsyncEnabled)
     {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_CreateTensorHandles");
         for (auto&& layer : order)
         {
             auto& workloadFactory = GetWorkloadFactory(*layer);
@@ -365,76 +378,156 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
         timelineUtils->MarkEntityWithLabel(networkGuid, ss.str(), LabelsAndEventClasses::PROCESS_ID_GUID);
     }
 
-    std::vector<IWorkload*> ConstWorkloads;
+    // Workloads are created, and constant workloads executed, in parallel where the backends allow it. The timeline
+    // and the layer details of the profiler are not thread safe, so they require the network to load serially.
+#if !defined(ARMNN_DISABLE_THREADS)
+    if (!timelineUtils && networkProperties.m_OutputNetworkDetailsMethod == ProfilingDetailsMethod::Undefined)
+    {
+        m_NumLoadThreads = networkProperties.m_NumLoadThreads != 0 ?
+                           networkProperties.m_NumLoadThreads : std::max(1u, std::thread::hardware_concurrency());
+    }
+#endif
+
+    std::vector<std::pair<const Layer*, IWorkload*>> ConstWorkloads;
+    // The layer of every workload of m_WorkloadQueue.
+    std::vector<const Layer*> workloadLayers;
 
     //Then create workloads.
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_CreateWorkloads");
-        for (auto&& layer: order)
+
+        std::vector<Layer*> layers(order.begin(), order.end());
+        std::vector<std::unique_ptr<IWorkload>> workloads(layers.size());
+
+        auto createWorkload = [&](size_t index)
+        {
+            Layer* layer = layers[index];
+            if (layer->GetType() == LayerType::Input || layer->GetType() == LayerType::Output)
+            {
+                // Inputs and outputs are treated in a special way - see EnqueueInput() and EnqueueOutput().
+                return;
+            }
+
+            auto workload = layer->CreateWorkload(GetWorkloadFactory(*layer));
+            if (!workload)
+            {
+                const char* const layerName =
+                        layer->GetNameStr().length() != 0 ? layer->GetName() : "<Unnamed>";
+                throw InvalidArgumentException(
+                        fmt::format("No workload created for layer (name: '{0}' type: '{1}') (compute '{2}')",
+                                    layerName, static_cast<int>(layer->GetType()), layer->GetBackendId().Get()
+                        ));
+            }
+
+            // release the constant data in the layer.
+            layer->ReleaseConstantData();
+            workloads[index] = std::move(workload);
+        };
+
+        std::vector<size_t> parallelIndices;
+        for (size_t index = 0; index < layers.size(); ++index)
+        {
+            if (m_NumLoadThreads > 1 && SupportsThreadSafeWorkloadCreation(*layers[index]))
+            {
+                parallelIndices.push_back(index);
+            }
+        }
+        // Workloads are handed out one at a time, as the cost of creating one varies a lot between layers.
+        TaskPool loadPool(m_NumLoadThreads);
+        loadPool.ParallelFor(static_cast<unsigned int>(parallelIndices.size()), 1,
+                             [&](unsigned int begin, unsigned int end)
         {
+            for (unsigned int i = begin; i < end; ++i)
+            {
+                createWorkload(parallelIndices[i]);
+            }
+        });
+
+        // Queue the workloads in topological order. The other workloads are created here, after their layer has been
+        // added to the timeline, so that the profiling GUIDs are generated in the same order as when loading serially.
+        for (size_t index = 0; index < layers.size(); ++index)
+        {
+            Layer* layer = layers[index];
             if (timelineUtils)
             {
                 // Add layer to the post-optimisation network structure
                 AddLayerStructure(timelineUtils, *layer, networkGuid);
             }
 
-            const IWorkloadFactory& workloadFactory = GetWorkloadFactory(*layer);
-
-            switch (layer->GetType())
+            auto& workload = workloads[index];
+            if (!workload)
             {
-                case LayerType::Input:
-                case LayerType::Output:
-                {
-                    // Inputs and outputs are treated in a special way - see EnqueueInput() and EnqueueOutput().
-                    break;
-                }
-                default:
-                {
-                    auto workload = layer->CreateWorkload(workloadFactory);
-
-                    if (!workload)
-                    {
-                        const char* const layerName =
-                                layer->GetNameStr().length() != 0 ? layer->GetName() : "<Unnamed>";
-                        throw InvalidArgumentException(
-                                fmt::format("No workload created for layer (name: '{0}' type: '{1}') (compute '{2}')",
-                                            layerName, static_cast<int>(layer->GetType()), layer->GetBackendId().Get()
-                                ));
-                    }
+                createWorkload(index);
+            }
+            if (!workload)
+            {
+                continue;
+            }
 
-                    if (timelineUtils)
-                    {
-                        // Add workload to the post-optimisation network structure
-                        AddWorkloadStructure(timelineUtils, workload, *layer);
-                    }
+            if (timelineUtils)
+            {
+                // Add workload to the post-optimisation network structure
+                AddWorkloadStructure(timelineUtils, workload, *layer);
+            }
 
-                    // For async networks ConstantWorkloads are managed exclusively by LoadedNetwork
-                    // and are separated out from the other workloads
-                    if((networkProperties.m_AsyncEnabled  || useExternalMemoryManager) &&
-                        layer->GetType() == LayerType::Constant)
-                    {
-                        m_ConstantTensorHandles[layer->GetGuid()] =
-                                layer->GetOutputSlot(0).GetOutputHandler().GetData();
-                        m_ConstantWorkloads[layer->GetGuid()] = std::move(workload);
-                    }
-                    else
-                    {
-                        m_WorkloadQueue.push_back(std::move(workload));
+            // For async networks ConstantWorkloads are managed exclusively by LoadedNetwork
+            // and are separated out from the other workloads
+            if((networkProperties.m_AsyncEnabled  || useExternalMemoryManager) &&
+                layer->GetType() == LayerType::Constant)
+            {
+                m_ConstantTensorHandles[layer->GetGuid()] =
+                        layer->GetOutputSlot(0).GetOutputHandler().GetData();
+                m_ConstantWorkloads[layer->GetGuid()] = std::move(workload);
+            }
+            else
+            {
+                m_WorkloadQueue.push_back(std::move(workload));
+                workloadLayers.push_back(layer);
 
-                        if (layer->GetType() == LayerType::Constant)
-                        {
-                            // Place the Constant Workloads into a queue so that they can be executed first
-                            ConstWorkloads.push_back(m_WorkloadQueue.back().get());
-                        }
-                    }
-                    // release the constant data in the layer.
-                    layer->ReleaseConstantData();
-                    break;
+                if (layer->GetType() == LayerType::Constant)
+                {
+                    // Place the Constant Workloads into a queue so that they can be executed first
+                    ConstWorkloads.emplace_back(layer, m_WorkloadQueue.back().get());
                 }
             }
         }
     }
 
+    // Size the scratch memory for the largest workload, as the workloads execute one after another.
+    for (auto& workload : m_WorkloadQueue)
+    {
+        Optional<MemoryRequirements> memoryRequirements = workload->GetMemoryRequirements();
+        if (memoryRequirements.has_value())
+        {
+            m_ScratchMemorySize = std::max(m_ScratchMemorySize, memoryRequirements.value().m_ScratchMemorySize);
+        }
+    }
+    if (!networkProperties.m_AsyncEnabled)
+    {
+        m_ScratchArena.Reserve(m_ScratchMemorySize);
+    }
+
+    // Executing independent branches at the same time extends the lifetimes of the intermediate tensors.
+    bool concurrentExecution = false;
+#if !defined(ARMNN_DISABLE_THREADS)
+    if (!networkProperties.m_AsyncEnabled && networkProperties.m_NumExecutionThreads != 1)
+    {
+        if (useExternalMemoryManager || networkProperties.m_ExternalMemoryManagementEnabled)
+        {
+            // The memory profile of external memory management plans the tensor lifetimes of serial execution, so
+            // workloads of independent branches could be given the same memory.
+            ARMNN_LOG(warning) << "Parallel execution disabled: it is not supported with external memory management.";
+        }
+        else
+        {
+            const unsigned int numExecutionThreads = networkProperties.m_NumExecutionThreads != 0 ?
+                networkProperties.m_NumExecutionThreads : std::max(1u, std::thread::hardware_concurrency());
+            concurrentExecution = numExecutionThreads > 1 &&
+                                  CreateParallelExecutor(workloadLayers, numExecutionThreads);
+        }
+    }
+#endif
+
     // Gather information about workloads for inputs & outputs
     if (!networkProperties.m_AsyncEnabled && m_WorkloadQueue.size() != 0)
     {
@@ -551,6 +644,7 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
 
     if (useExternalMemoryManager)
     {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_PlanMemory");
         if (networkProperties.m_AsyncEnabled)
         {
             CreateMemoryProfileAsync();
@@ -592,10 +686,11 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
     // do any post allocation configuration for each workload.
     if (!networkProperties.m_AsyncEnabled)
     {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_PostAllocationConfigure");
         if (useInternalMemoryManager)
         {
             // Set up memory.
-            m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph().AllocateDynamicBuffers();
+            m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph().AllocateDynamicBuffers(concurrentExecution);
         }
 
         for (auto &workload : m_WorkloadQueue)
@@ -618,22 +713,61 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
     // If synchronous, execute all constant layer workloads
     if (!networkProperties.m_AsyncEnabled)
     {
-        for (auto workload: ConstWorkloads)
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_ExecuteConstants");
+        ExecuteConstantWorkloads(ConstWorkloads);
+    }
+}
+
+bool LoadedNetwork::SupportsThreadSafeWorkloadCreation(const Layer& layer) const
+{
+    auto it = m_SupportsThreadSafeWorkloadCreation.find(layer.GetBackendId());
+    return it != m_SupportsThreadSafeWorkloadCreation.end() && it->second;
+}
+
+void LoadedNetwork::ExecuteConstantWorkloads(
+    const std::vector<std::pair<const Layer*, IWorkload*>>& constantWorkloads)
+{
+    std::vector<IWorkload*> parallelWorkloads;
+    for (auto& layerAndWorkload : constantWorkloads)
+    {
+        if (m_NumLoadThreads > 1 && SupportsThreadSafeWorkloadCreation(*layerAndWorkload.first))
         {
-            workload->Execute();
+            parallelWorkloads.push_back(layerAndWorkload.second);
+        }
+        else
+        {
+            layerAndWorkload.second->Execute();
         }
     }
+    if (!parallelWorkloads.empty())
+    {
+        TaskPool loadPool(m_NumLoadThreads);
+        loadPool.ParallelFor(static_cast<unsigned int>(parallelWorkloads.size()), 1,
+                             [&](unsigned int begin, unsigned int end)
+        {
+            for (unsigned int i = begin; i < end; ++i)
+            {
+                parallelWorkloads[i]->Execute();
+            }
+        });
+    }
 }
 
 void LoadedNetwork::AllocateAndExecuteConstantWorkloads()
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_AllocateAndExecuteConstants");
-    for (auto& pair : m_ConstantWorkloads)
+    std::vector<std::pair<const Layer*, IWorkload*>> constantWorkloads;
+    for (auto&& layer : m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph())
     {
-        auto tensorHandle = m_ConstantTensorHandles[pair.first];
-        tensorHandle->Allocate();
-        pair.second->Execute();
+        auto workload = m_ConstantWorkloads.find(layer->GetGuid());
+        if (workload != m_ConstantWorkloads.end())
+        {
+            // Allocating may go through a shared memory manager, so only the execution runs in parallel.
+            m_ConstantTensorHandles[layer->GetGuid()]->Allocate();
+            constantWorkloads.emplace_back(layer, workload->second.get());
+        }
     }
+    ExecuteConstantWorkloads(constantWorkloads);
 }
 
 void LoadedNetwork::AllocateAndExecuteConstantWorkloadsAsync()
@@ -893,6 +1027,9 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         throw InvalidArgumentException("Number of inputs provided does not match network.");
     }
 
+    // The inputs and outputs are about to be rewired, any execution binding has to be bound again before its next use.
+    m_BoundExecutionBindingId = 0;
+
     // For each input to the network, call EnqueueInput with the data passed by the user.
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareInputs");
@@ -923,22 +1060,11 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
             }
             else
             {
-                if (m_IsInputImported[inputIndex])
-                {
-                    OutputHandler& handler = const_cast<OutputHandler&>(inputLayer->GetOutputHandler(0));
-
-                    for (const auto& workloadInfo: m_InputWorkloadSlotPairs[inputLayer->GetBindingId()])
-                    {
-                        auto workload = m_WorkloadQueue[workloadInfo.m_WorkloadIndex].get();
-                        workload->ReplaceInputTensorHandle(handler.GetData(), workloadInfo.m_SlotIndex);
-                    }
-
-                    m_IsInputImported[inputIndex] = false;
-                }
+                RestoreInputTensorHandle(*inputLayer, inputIndex);
 
                 // InputTensorHandle is not imported yet, process to enqueue input
                 const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
-                EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+                EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(), m_InputQueue);
             }
             inputIndex++;
         }
@@ -1004,36 +1130,35 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
             }
             else
             {
-                if (m_IsOutputImported[outputIndex])
-                {
-                    const auto bindingId = outputLayer->GetBindingId();
-                    const auto& indices = m_OutputWorkloadSlotPairs[bindingId];
-
-                    auto outputWorkload = m_WorkloadQueue[indices.m_OutputSlotIndices.m_WorkloadIndex].get();
-                    const OutputHandler& outputHandler =
-                            outputLayer->GetInputSlot(0).GetConnectedOutputSlot()->GetOutputHandler();
-
-                    outputWorkload->ReplaceOutputTensorHandle(
-                            outputHandler.GetData(), indices.m_OutputSlotIndices.m_SlotIndex);
-
-                    for (const auto& workloadInfo: indices.m_InputSlotIndices)
-                    {
-                        auto inputWorkload = m_WorkloadQueue[workloadInfo.m_WorkloadIndex].get();
-                        inputWorkload->ReplaceInputTensorHandle(outputHandler.GetData(), workloadInfo.m_SlotIndex);
-                    }
-                    m_IsOutputImported[outputIndex] = false;
-                }
+                RestoreOutputTensorHandle(*outputLayer, outputIndex);
 
                 const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
                 // OutputTensorHandle is not imported yet, process to enqueue Output
-                EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+                EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(), m_OutputQueue);
             }
             outputIndex++;
         }
     }
 
+    return ExecuteQueues(m_InputQueue, m_OutputQueue);
+}
+
+Status LoadedNetwork::ExecuteQueues(WorkloadQueue& inputQueue, WorkloadQueue& outputQueue)
+{
     std::unique_ptr<TimelineUtilityMethods> timelineUtils =
                         TimelineUtilityMethods::GetTimelineUtils(*m_ProfilingService);
+
+#if !defined(ARMNN_DISABLE_THREADS)
+    if (m_ParallelExecutor && !timelineUtils && !GetProfiler()->IsProfilingEnabled())
+    {
+        if (m_ProfilingService->IsProfilingEnabled())
+        {
+            m_ProfilingService->IncrementCounterValue(INFERENCES_RUN);
+        }
+        return ExecuteParallel(inputQueue, outputQueue) ? Status::Success : Status::Failure;
+    }
+#endif
+
     ProfilingGuid inferenceGuid = m_ProfilingService->GetNextGuid();
     if (timelineUtils)
     {
@@ -1056,7 +1181,7 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         }
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
         ARMNN_SCOPED_HEAP_PROFILING("Executing");
-        executionSucceeded = Execute(timelineUtils, inferenceGuid);
+        executionSucceeded = Execute(timelineUtils, inferenceGuid, inputQueue, outputQueue);
     }
 
     if (timelineUtils)
@@ -1069,7 +1194,182 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
     return executionSucceeded ? Status::Success : Status::Failure;
 }
 
-void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+std::unique_ptr<IExecutionBinding> LoadedNetwork::CreateExecutionBinding(NetworkId networkId,
+                                                                         const InputTensors& inputTensors,
+                                                                         const OutputTensors& outputTensors)
+{
+    if (m_NetworkProperties.m_AsyncEnabled)
+    {
+        throw InvalidArgumentException("CreateExecutionBinding: Network is async enabled.");
+    }
+
+    const Graph& graph = m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph();
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("CreateExecutionBinding: Number of inputs provided does not match network.");
+    }
+    if (graph.GetNumOutputs() != outputTensors.size())
+    {
+        throw InvalidArgumentException("CreateExecutionBinding: Number of outputs provided does not match network.");
+    }
+
+    // Returns the tensor supplied for a layer after checking it can hold the tensor of the layer.
+    auto FindTensor = [](const BindableLayer& layer, const TensorInfo& layerInfo, const auto& tensors,
+                         const char* bindingPointDesc) -> const auto&
+    {
+        const LayerBindingId bindingId = layer.GetBindingId();
+        auto it = std::find_if(tensors.begin(), tensors.end(), [bindingId](const auto& tensorPair)
+        {
+            return tensorPair.first == bindingId;
+        });
+        if (it == tensors.end())
+        {
+            throw InvalidArgumentException(fmt::format("CreateExecutionBinding: No tensor supplied for {0} {1}",
+                                                       bindingPointDesc, bindingId));
+        }
+
+        const auto& tensor = it->second;
+        if (tensor.GetMemoryArea() == nullptr)
+        {
+            throw InvalidArgumentException(fmt::format("CreateExecutionBinding: The tensor supplied for {0} {1} "
+                                                       "has no memory", bindingPointDesc, bindingId));
+        }
+        if (tensor.GetInfo().GetNumBytes() != layerInfo.GetNumBytes())
+        {
+            throw InvalidArgumentException(fmt::format("CreateExecutionBinding: The tensor supplied for {0} {1} "
+                                                       "has {2} bytes but the network expects {3}",
+                                                       bindingPointDesc, bindingId,
+                                                       tensor.GetInfo().GetNumBytes(), layerInfo.GetNumBytes()));
+        }
+        return tensor;
+    };
+
+    std::vector<ExecutionBinding::BoundTensor> inputs;
+    inputs.reserve(graph.GetNumInputs());
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        const ConstTensor& tensor =
+            FindTensor(*inputLayer, inputLayer->GetOutputSlot(0).GetTensorInfo(), inputTensors, "input");
+        inputs.push_back({ inputLayer->GetBindingId(),
+                           tensor.GetInfo(),
+                           std::make_unique<ConstPassthroughTensorHandle>(tensor.GetInfo(), tensor.GetMemoryArea()) });
+    }
+
+    std::vector<ExecutionBinding::BoundTensor> outputs;
+    outputs.reserve(graph.GetNumOutputs());
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        const Tensor& tensor =
+            FindTensor(*outputLayer, outputLayer->GetInputSlot(0).GetTensorInfo(), outputTensors, "output");
+        outputs.push_back({ outputLayer->GetBindingId(),
+                            tensor.GetInfo(),
+                            std::make_unique<PassthroughTensorHandle>(tensor.GetInfo(), tensor.GetMemoryArea()) });
+    }
+
+    auto executionBinding = std::make_unique<ExecutionBinding>(networkId,
+                                                               ++m_CurExecutionBindingId,
+                                                               std::move(inputs),
+                                                               std::move(outputs));
+    BindExecution(*executionBinding);
+
+    return executionBinding;
+}
+
+void LoadedNetwork::BindExecution(ExecutionBinding& executionBinding)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "BindExecution");
+
+    const Graph& graph = m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph();
+
+    WorkloadQueue& inputQueue = executionBinding.GetInputQueue();
+    inputQueue.clear();
+    inputQueue.reserve(graph.GetNumInputs());
+
+    unsigned int inputIndex = 0;
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        RestoreInputTensorHandle(*inputLayer, inputIndex);
+
+        const ExecutionBinding::BoundTensor& input = executionBinding.GetInputs()[inputIndex];
+        EnqueueInput(*inputLayer, input.m_TensorHandle.get(), input.m_TensorInfo, inputQueue);
+        inputIndex++;
+    }
+
+    WorkloadQueue& outputQueue = executionBinding.GetOutputQueue();
+    outputQueue.clear();
+    outputQueue.reserve(graph.GetNumOutputs());
+
+    unsigned int outputIndex = 0;
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        RestoreOutputTensorHandle(*outputLayer, outputIndex);
+
+        const ExecutionBinding::BoundTensor& output = executionBinding.GetOutputs()[outputIndex];
+        EnqueueOutput(*outputLayer, output.m_TensorHandle.get(), output.m_TensorInfo, outputQueue);
+        outputIndex++;
+    }
+
+    m_BoundExecutionBindingId = executionBinding.GetBindingId();
+}
+
+Status LoadedNetwork::EnqueueWorkload(ExecutionBinding& executionBinding)
+{
+    // Only wire the bound buffers again if another binding or EnqueueWorkload call used the network since.
+    if (m_BoundExecutionBindingId != executionBinding.GetBindingId())
+    {
+        BindExecution(executionBinding);
+    }
+
+    return ExecuteQueues(executionBinding.GetInputQueue(), executionBinding.GetOutputQueue());
+}
+
+void LoadedNetwork::RestoreInputTensorHandle(const BindableLayer& inputLayer, unsigned int inputIndex)
+{
+    if (!m_IsInputImported[inputIndex])
+    {
+        return;
+    }
+
+    OutputHandler& handler = const_cast<OutputHandler&>(inputLayer.GetOutputHandler(0));
+
+    for (const auto& workloadInfo: m_InputWorkloadSlotPairs[inputLayer.GetBindingId()])
+    {
+        auto workload = m_WorkloadQueue[workloadInfo.m_WorkloadIndex].get();
+        workload->ReplaceInputTensorHandle(handler.GetData(), workloadInfo.m_SlotIndex);
+    }
+
+    m_IsInputImported[inputIndex] = false;
+}
+
+void LoadedNetwork::RestoreOutputTensorHandle(const BindableLayer& outputLayer, unsigned int outputIndex)
+{
+    if (!m_IsOutputImported[outputIndex])
+    {
+        return;
+    }
+
+    const auto bindingId = outputLayer.GetBindingId();
+    const auto& indices = m_OutputWorkloadSlotPairs[bindingId];
+
+    auto outputWorkload = m_WorkloadQueue[indices.m_OutputSlotIndices.m_WorkloadIndex].get();
+    const OutputHandler& outputHandler = outputLayer.GetInputSlot(0).GetConnectedOutputSlot()->GetOutputHandler();
+
+    outputWorkload->ReplaceOutputTensorHandle(outputHandler.GetData(), indices.m_OutputSlotIndices.m_SlotIndex);
+
+    for (const auto& workloadInfo: indices.m_InputSlotIndices)
+    {
+        auto inputWorkload = m_WorkloadQueue[workloadInfo.m_WorkloadIndex].get();
+        inputWorkload->ReplaceInputTensorHandle(outputHandler.GetData(), workloadInfo.m_SlotIndex);
+    }
+
+    m_IsOutputImported[outputIndex] = false;
+}
+
+void LoadedNetwork::EnqueueInput(const BindableLayer& layer,
+                                 ITensorHandle* tensorHandle,
+                                 const TensorInfo& tensorInfo,
+                                 WorkloadQueue& inputQueue)
 {
     if (layer.GetType() != LayerType::Input)
     {
@@ -1141,11 +1441,14 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
             timelineUtils->Commit();
         }
 
-        m_InputQueue.push_back(std::move(inputWorkload));
+        inputQueue.push_back(std::move(inputWorkload));
     }
 }
 
-void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+void LoadedNetwork::EnqueueOutput(const BindableLayer& layer,
+                                  ITensorHandle* tensorHandle,
+                                  const TensorInfo& tensorInfo,
+                                  WorkloadQueue& outputQueue)
 {
     if (layer.GetType() != LayerType::Output)
     {
@@ -1210,7 +1513,7 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
                     {
                         throw armnn::NullPointerException("No sync workload created");
                     }
-                    m_OutputQueue.push_back(std::move(syncWorkload));
+                    outputQueue.push_back(std::move(syncWorkload));
                 }
                 else
                 {
@@ -1241,7 +1544,7 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
             timelineUtils->Commit();
         }
 
-        m_OutputQueue.push_back(std::move(outputWorkload));
+        outputQueue.push_back(std::move(outputWorkload));
     }
 }
 
@@ -1312,7 +1615,9 @@ void LoadedNetwork::FreeWorkingMemory()
 }
 
 bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
-                           ProfilingGuid inferenceGuid)
+                            ProfilingGuid inferenceGuid,
+                            WorkloadQueue& inputQueue,
+                            WorkloadQueue& outputQueue)
 {
     bool success = true;
 
@@ -1332,7 +1637,7 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
 #endif
 
         ProfilingDynamicGuid workloadInferenceID(0);
-        auto ExecuteQueue = [&timelineUtils, &workloadInferenceID, &inferenceGuid](WorkloadQueue& queue)
+        auto ExecuteQueue = [this, &timelineUtils, &workloadInferenceID, &inferenceGuid](WorkloadQueue& queue)
         {
             for (auto& workload : queue)
             {
@@ -1341,6 +1646,7 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
                     workloadInferenceID = timelineUtils->RecordWorkloadInferenceAndStartOfLifeEvent(workload->GetGuid(),
                                                                                                     inferenceGuid);
                 }
+                ScratchArena::Scope scratchScope(m_ScratchArena);
                 workload->Execute();
                 if(timelineUtils)
                 {
@@ -1349,9 +1655,9 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
             }
         };
 
-        ExecuteQueue(m_InputQueue);
+        ExecuteQueue(inputQueue);
         ExecuteQueue(m_WorkloadQueue);
-        ExecuteQueue(m_OutputQueue);
+        ExecuteQueue(outputQueue);
     }
     catch (const RuntimeException& error)
     {
@@ -1365,6 +1671,86 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
     return success;
 }
 
+#if !defined(ARMNN_DISABLE_THREADS)
+bool LoadedNetwork::CreateParallelExecutor(const std::vector<const Layer*>& workloadLayers, unsigned int numThreads)
+{
+    for (auto&& backend : m_Backends)
+    {
+        if (!HasMatchingCapability(BackendOptions::BackendOption{"ConcurrentWorkloadExecution", true},
+                                   backend.second->GetCapabilities()))
+        {
+            ARMNN_LOG(warning) << "Parallel execution disabled: backend " << backend.first
+                               << " does not support ConcurrentWorkloadExecution.";
+            return false;
+        }
+    }
+
+    std::unordered_map<const Layer*, unsigned int> nodeIndices;
+    for (unsigned int i = 0; i < workloadLayers.size(); ++i)
+    {
+        nodeIndices.emplace(workloadLayers[i], i);
+    }
+
+    // A workload depends on the workloads of the layers its inputs are connected to. Inputs connected to Input
+    // layers are ready before any workload executes.
+    std::vector<ParallelWorkloadExecutor::Node> nodes;
+    nodes.reserve(workloadLayers.size());
+    for (unsigned int i = 0; i < workloadLayers.size(); ++i)
+    {
+        nodes.push_back({ m_WorkloadQueue[i].get(), {}, 0 });
+    }
+    for (unsigned int i = 0; i < workloadLayers.size(); ++i)
+    {
+        for (auto&& inputSlot : workloadLayers[i]->GetInputSlots())
+        {
+            auto producer = nodeIndices.find(&inputSlot.GetConnectedOutputSlot()->GetOwningLayer());
+            if (producer != nodeIndices.end())
+            {
+                nodes[producer->second].m_Successors.push_back(i);
+                ++nodes[i].m_NumPredecessors;
+            }
+        }
+    }
+
+    m_ParallelExecutor = std::make_unique<ParallelWorkloadExecutor>(std::move(nodes), numThreads, m_ScratchMemorySize);
+    ARMNN_LOG(info) << "Network executes on " << m_ParallelExecutor->GetNumThreads() << " threads.";
+    return true;
+}
+
+bool LoadedNetwork::ExecuteParallel(WorkloadQueue& inputQueue, WorkloadQueue& outputQueue)
+{
+    try
+    {
+        std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+        AllocateWorkingMemory(lockGuard);
+
+        for (auto& workload : inputQueue)
+        {
+            workload->Execute();
+        }
+
+        m_ParallelExecutor->Execute(m_ScratchArena);
+
+        for (auto& workload : outputQueue)
+        {
+            workload->Execute();
+        }
+    }
+    catch (const RuntimeException& error)
+    {
+        ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
+        return false;
+    }
+    catch (const std::runtime_error& error)
+    {
+        ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
+        return false;
+    }
+
+    return true;
+}
+#endif
+
 void LoadedNetwork::EnqueueInput(const ConstTensor& inputTensor, ITensorHandle* inputTensorHandle)
 {
     if (m_NetworkProperties.m_InputSource != MemorySource::Undefined)  // Try import the input tensor
@@ -1978,6 +2364,7 @@ Status LoadedNetwork::Execute(const InputTensors& inputTensors,
                                                                                                 inferenceGuid);
             }
 
+            ScratchArena::Scope scratchScope(workingMemHandle.GetScratchArena());
             workload->ExecuteAsync(workingMemHandle.GetExecutionDataAt(i).second);
 
             if (timelineUtils)
@@ -2020,6 +2407,116 @@ Status LoadedNetwork::Execute(const InputTensors& inputTensors,
     return executionSucceeded ? Status::Success : Status::Failure;
 }
 
+void LoadedNetwork::SchedulePipelined(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      std::shared_ptr<IAsyncExecutionCallback> cb)
+{
+#if !defined(ARMNN_DISABLE_THREADS)
+    ExecutionPipeline* executionPipeline = nullptr;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_ExecutionPipelineMutex);
+        if (!m_ExecutionPipeline)
+        {
+            m_ExecutionPipeline = std::make_unique<ExecutionPipeline>(*this, networkId);
+        }
+        executionPipeline = m_ExecutionPipeline.get();
+    }
+    executionPipeline->Schedule(inputTensors, outputTensors, std::move(cb));
+#else
+    IgnoreUnused(networkId, inputTensors, outputTensors, cb);
+    throw RuntimeException("LoadedNetwork::SchedulePipelined: Pipelined execution requires threads.");
+#endif
+}
+
+void LoadedNetwork::PrepareExecution(const InputTensors& inputTensors,
+                                     const OutputTensors& outputTensors,
+                                     WorkingMemHandle& workingMemHandle)
+{
+    const Graph& graph = m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph();
+
+    if (inputTensors.size() != graph.GetNumInputs())
+    {
+        throw InvalidArgumentException("LoadedNetwork::PrepareExecution: "
+                                       "Number of inputs provided does not match network.");
+    }
+    if (outputTensors.size() != graph.GetNumOutputs())
+    {
+        throw InvalidArgumentException("LoadedNetwork::PrepareExecution: "
+                                       "Number of outputs provided does not match network.");
+    }
+
+    std::vector<LayerBindingId>& bindingIds = workingMemHandle.GetBindingIdVector();
+    unsigned int index = 0;
+    for (auto pair : inputTensors)
+    {
+        bindingIds[index++] = pair.first;
+    }
+    for (auto pair : outputTensors)
+    {
+        bindingIds[index++] = pair.first;
+    }
+    workingMemHandle.ValidateBindingIds();
+
+    if (!workingMemHandle.IsAllocated())
+    {
+        workingMemHandle.Allocate();
+    }
+
+    for (auto pair : inputTensors)
+    {
+        EnqueueInput(pair.second, workingMemHandle.GetInputHandle(pair.first));
+    }
+    if (m_NetworkProperties.m_OutputSource != MemorySource::Undefined)
+    {
+        for (auto pair : outputTensors)
+        {
+            ImportOutputTensor(pair.second, workingMemHandle.GetOutputHandle(pair.first));
+        }
+    }
+}
+
+bool LoadedNetwork::ExecuteWorkloads(WorkingMemHandle& workingMemHandle,
+                                     unsigned int firstWorkload,
+                                     unsigned int endWorkload)
+{
+    try
+    {
+        for (unsigned int i = firstWorkload; i < endWorkload; ++i)
+        {
+            ScratchArena::Scope scratchScope(workingMemHandle.GetScratchArena());
+            m_WorkloadQueue[i]->ExecuteAsync(workingMemHandle.GetExecutionDataAt(i).second);
+        }
+    }
+    catch (const armnn::Exception& error)
+    {
+        ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
+        return false;
+    }
+    catch (const std::exception& error)
+    {
+        ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
+        return false;
+    }
+    return true;
+}
+
+void LoadedNetwork::FinishExecution(const OutputTensors& outputTensors, WorkingMemHandle& workingMemHandle)
+{
+    if (m_NetworkProperties.m_OutputSource == MemorySource::Undefined)
+    {
+        for (auto pair : outputTensors)
+        {
+            CopyToOutputTensor(pair.second, workingMemHandle.GetOutputHandle(pair.first));
+        }
+    }
+    else
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "SyncMemGeneric_Execute");
+        workingMemHandle.MemSyncOutputs();
+    }
+}
+
 /// Create a new unique WorkingMemHandle object. Create multiple handles if you wish to have
 /// overlapped Execution by calling this function from different threads.
 std::unique_ptr<IWorkingMemHandle> LoadedNetwork::CreateWorkingMemHandle(NetworkId networkId)
@@ -2290,7 +2787,8 @@ std::unique_ptr<IWorkingMemHandle> LoadedNetwork::CreateWorkingMemHandle(Network
                                               std::move(managedTensorHandles),
                                               std::move(unmanagedTensorHandles),
                                               executionDataVec,
-                                              &m_Backends);
+                                              &m_Backends,
+                                              m_ScratchMemorySize);
 }
 
 void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
@@ -5,7 +5,9 @@
 #pragma once
 
 #include "Network.hpp"
+#include "ExecutionPipeline.hpp"
 #include "LayerFwd.hpp"
+#include "ParallelWorkloadExecutor.hpp"
 #include "Profiling.hpp"
 
 #include <armnn/Tensor.hpp>
@@ -17,6 +19,7 @@
 
 #include <backendsCommon/DefaultAllocator.hpp>
 #include <backendsCommon/MemoryManager.hpp>
+#include <backendsCommon/ScratchArena.hpp>
 #include <backendsCommon/TensorHandleFactoryRegistry.hpp>
 #include <backendsCommon/memoryOptimizerStrategyLibrary/strategies/SingleAxisPriorityList.hpp>
 
@@ -39,6 +42,12 @@ class Device;
 namespace armnn
 {
 
+namespace experimental
+{
+class ExecutionBinding;
+class WorkingMemHandle;
+}
+
 class LoadedNetwork
 {
 public:
@@ -46,6 +55,10 @@ public:
 
     ~LoadedNetwork()
     {
+#if !defined(ARMNN_DISABLE_THREADS)
+        // Finish the pipelined inferences while the network can still execute them.
+        m_ExecutionPipeline.reset();
+#endif
         FreeWorkingMemory();
     }
 
@@ -69,6 +82,14 @@ public:
                            std::vector<ImportedInputId> preImportedInputIds = {},
                            std::vector<ImportedOutputId> preImportedOutputIds = {});
 
+    /// Validates the given buffers and wires them to the network once, see IRuntime::CreateExecutionBinding.
+    std::unique_ptr<IExecutionBinding> CreateExecutionBinding(NetworkId networkId,
+                                                              const InputTensors& inputTensors,
+                                                              const OutputTensors& outputTensors);
+
+    /// Single thread execution of the loaded network on the buffers of an execution binding
+    Status EnqueueWorkload(experimental::ExecutionBinding& executionBinding);
+
     /// Thread safe execution of the loaded network
     Status Execute(const InputTensors& inputTensors,
                    const OutputTensors& outputTensors,
@@ -76,6 +97,27 @@ public:
                    std::vector<ImportedInputId> preImportedInputs = {},
                    std::vector<ImportedOutputId> preImportedOutputs = {});
 
+    /// Schedules an inference on the execution pipeline of the network, see IRuntime::SchedulePipelined.
+    void SchedulePipelined(NetworkId networkId,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors,
+                           std::shared_ptr<IAsyncExecutionCallback> cb);
+
+    /// The steps of a pipelined inference on workingMemHandle: validating the tensors and copying the inputs,
+    /// executing the workloads [firstWorkload, endWorkload), and copying the outputs.
+    void PrepareExecution(const InputTensors& inputTensors,
+                          const OutputTensors& outputTensors,
+                          experimental::WorkingMemHandle& workingMemHandle);
+    bool ExecuteWorkloads(experimental::WorkingMemHandle& workingMemHandle,
+                          unsigned int firstWorkload,
+                          unsigned int endWorkload);
+    void FinishExecution(const OutputTensors& outputTensors, experimental::WorkingMemHandle& workingMemHandle);
+
+    unsigned int GetNumWorkloads() const
+    {
+        return static_cast<unsigned int>(m_WorkloadQueue.size());
+    }
+
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                                                             std::string& errorMessage,
                                                             const INetworkProperties& networkProperties,
@@ -97,6 +139,16 @@ public:
         return m_NetworkProperties.m_AsyncEnabled;
     }
 
+    /// True when inferences may execute independent branches of the network at the same time.
+    bool IsParallelExecutionEnabled() const
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        return m_ParallelExecutor != nullptr;
+#else
+        return false;
+#endif
+    }
+
     arm::pipe::ProfilingGuid GetNetworkGuid();
 
 private:
@@ -110,6 +162,11 @@ private:
     void AllocateAndExecuteConstantWorkloads();
     void AllocateAndExecuteConstantWorkloadsAsync();
 
+    /// Executes the given constant workloads, those of backends with thread safe workload creation in parallel.
+    void ExecuteConstantWorkloads(const std::vector<std::pair<const Layer*, IWorkload*>>& constantWorkloads);
+
+    bool SupportsThreadSafeWorkloadCreation(const Layer& layer) const;
+
     std::unordered_map<LayerGuid, std::unique_ptr<IWorkload>> m_ConstantWorkloads;
     std::unordered_map<LayerGuid, ITensorHandle*> m_ConstantTensorHandles;
 
@@ -119,16 +176,45 @@ private:
                   const INetworkProperties& networkProperties,
                   arm::pipe::IProfilingService* profilingService);
 
-    void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    void EnqueueInput(const BindableLayer& layer,
+                      ITensorHandle* tensorHandle,
+                      const TensorInfo& tensorInfo,
+                      WorkloadQueue& inputQueue);
 
-    void EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    void EnqueueOutput(const BindableLayer& layer,
+                       ITensorHandle* tensorHandle,
+                       const TensorInfo& tensorInfo,
+                       WorkloadQueue& outputQueue);
+
+    /// Points the workloads reading an input back at the tensor handle of the network if it was pre-imported.
+    void RestoreInputTensorHandle(const BindableLayer& inputLayer, unsigned int inputIndex);
+    /// Points the workloads writing an output back at the tensor handle of the network if it was pre-imported.
+    void RestoreOutputTensorHandle(const BindableLayer& outputLayer, unsigned int outputIndex);
+
+    /// Builds the input and output queues of an execution binding and makes it the bound one.
+    void BindExecution(experimental::ExecutionBinding& executionBinding);
 
     void EnqueueInput(const ConstTensor& inputTensor, ITensorHandle* inputTensorHandle);
 
     void ImportOutputTensor(const Tensor& outputTensor, ITensorHandle* outputTensorHandle);
 
     bool Execute(std::unique_ptr<arm::pipe::TimelineUtilityMethods>& timelineUtils,
-                 arm::pipe::ProfilingGuid inferenceGuid);
+                 arm::pipe::ProfilingGuid inferenceGuid,
+                 WorkloadQueue& inputQueue,
+                 WorkloadQueue& outputQueue);
+
+    /// Runs one inference of the given input and output queues around m_WorkloadQueue.
+    Status ExecuteQueues(WorkloadQueue& inputQueue, WorkloadQueue& outputQueue);
+
+#if !defined(ARMNN_DISABLE_THREADS)
+    /// Creates m_ParallelExecutor from the dependencies between the layers of m_WorkloadQueue, given in the same
+    /// order, if every backend of the network supports concurrent workload execution. Returns whether it did.
+    bool CreateParallelExecutor(const std::vector<const Layer*>& workloadLayers, unsigned int numThreads);
+
+    /// Runs the given input and output queues around m_WorkloadQueue executed by m_ParallelExecutor, without any
+    /// profiling.
+    bool ExecuteParallel(WorkloadQueue& inputQueue, WorkloadQueue& outputQueue);
+#endif
 
     const IWorkloadFactory& GetWorkloadFactory(const Layer& layer) const;
 
@@ -155,6 +241,17 @@ private:
     WorkloadQueue                      m_WorkloadQueue;
     WorkloadQueue                      m_OutputQueue;
 
+#if !defined(ARMNN_DISABLE_THREADS)
+    // Executes m_WorkloadQueue following the dependencies between its workloads, only created when
+    // INetworkProperties::m_NumExecutionThreads allows more than one thread.
+    std::unique_ptr<ParallelWorkloadExecutor> m_ParallelExecutor;
+#endif
+
+    // Largest amount of scratch memory any one workload asked for, used to size the ScratchArena of synchronous
+    // execution and of every WorkingMemHandle.
+    size_t m_ScratchMemorySize = 0;
+    ScratchArena m_ScratchArena;
+
 #if !defined(ARMNN_DISABLE_THREADS)
     mutable std::mutex m_WorkingMemMutex;
 #endif
@@ -210,6 +307,11 @@ private:
 
     std::unordered_map<BackendId, bool> m_SupportsExternallyManagedMemory;
 
+    std::unordered_map<BackendId, bool> m_SupportsThreadSafeWorkloadCreation;
+
+    // Number of threads used while loading the network, see INetworkProperties::m_NumLoadThreads.
+    unsigned int m_NumLoadThreads = 1;
+
     // A set of vectors to record the workload queue indexes and their corresponding Input/Output Slot indexes
     // which are connected to Inputs and Outputs for the network.
     struct WorkloadIndices
@@ -228,6 +330,17 @@ private:
     std::vector<bool> m_IsInputImported;
     std::vector<bool> m_IsOutputImported;
 
+    // Id of the last created execution binding, and of the one whose queues currently match the wiring of the
+    // network. 0 when no binding is bound.
+    unsigned int m_CurExecutionBindingId = 0;
+    unsigned int m_BoundExecutionBindingId = 0;
+
+#if !defined(ARMNN_DISABLE_THREADS)
+    // Created by the first SchedulePipelined call.
+    std::mutex m_ExecutionPipelineMutex;
+    std::unique_ptr<experimental::ExecutionPipeline> m_ExecutionPipeline;
+#endif
+
 };
 
 }
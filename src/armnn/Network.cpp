@@ -7,6 +7,7 @@
 #include "Graph.hpp"
 #include "Layer.hpp"
 #include "DeviceSpec.hpp"
+#include "OptimizedNetworkCache.hpp"
 #include "Optimizer.hpp"
 #include "SubgraphViewSelector.hpp"
 #include "BackendSettings.hpp"
@@ -148,6 +149,11 @@ void OptimizerOptionsOpaque::SetAllowExpandedDims(bool ExpandedDimsAllowed)
     p_OptimizerOptionsImpl->m_AllowExpandedDims = ExpandedDimsAllowed;
 }
 
+void OptimizerOptionsOpaque::SetOptimizedNetworkCacheDirectory(const std::string& directory)
+{
+    p_OptimizerOptionsImpl->m_OptimizedNetworkCacheDirectory = directory;
+}
+
 void OptimizerOptionsOpaque::AddModelOption(armnn::BackendOptions NewModelOption)
 {
     p_OptimizerOptionsImpl->m_ModelOptions.push_back(NewModelOption);
@@ -203,6 +209,11 @@ armnn::ShapeInferenceMethod OptimizerOptionsOpaque::GetShapeInferenceMethod() co
     return p_OptimizerOptionsImpl->m_shapeInferenceMethod;
 }
 
+std::string OptimizerOptionsOpaque::GetOptimizedNetworkCacheDirectory() const
+{
+    return p_OptimizerOptionsImpl->m_OptimizedNetworkCacheDirectory;
+}
+
 const std::string OptimizerOptionsOpaque::ToString() const
 {
     std::stringstream stream;
@@ -218,6 +229,7 @@ const std::string OptimizerOptionsOpaque::ToString() const
     stream << "\tExportEnabled: " << p_OptimizerOptionsImpl->m_ExportEnabled << "\n";
     stream << "\tProfilingEnabled: " << p_OptimizerOptionsImpl->m_ProfilingEnabled << "\n";
     stream << "\tAllowExpandedDims: " << p_OptimizerOptionsImpl->m_AllowExpandedDims << "\n";
+    stream << "\tOptimizedNetworkCacheDirectory: " << p_OptimizerOptionsImpl->m_OptimizedNetworkCacheDirectory << "\n";
 
     stream << "\tModelOptions: \n";
     for (auto optionsGroup : p_OptimizerOptionsImpl->m_ModelOptions)
@@ -471,6 +483,13 @@ IConnectableLayer* INetwork::AddConstantLayer(const ConstTensor& input,
     return pNetworkImpl->AddConstantLayer(input, name);
 }
 
+IConnectableLayer* INetwork::AddImportedConstantLayer(const ConstTensor& input,
+                                                      std::shared_ptr<const void> memoryOwner,
+                                                      const char* name)
+{
+    return pNetworkImpl->AddImportedConstantLayer(input, std::move(memoryOwner), name);
+}
+
 IConnectableLayer* INetwork::AddReshapeLayer(const ReshapeDescriptor& reshapeDescriptor,
                                             const char* name)
 {
@@ -783,6 +802,18 @@ void ReportWarning(const std::string& warningMessage,
     }
 }
 
+void ReportInfo(const std::string& infoMessage,
+                Optional<std::vector<std::string>&> infoMessages)
+{
+    std::stringstream fullInfoMessage;
+    fullInfoMessage << "INFO: " << infoMessage;
+    ARMNN_LOG(info) << fullInfoMessage.str();
+    if (infoMessages)
+    {
+        infoMessages.value().push_back(fullInfoMessage.str());
+    }
+}
+
 OptimizationResult ReturnWithError(OptimizationResult res,
                                    const Layer* layer,
                                    const BackendSettings& backendSettings,
@@ -1948,8 +1979,6 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
     // Ensure TensorInfo is set on all output slots of ConstantLayers in the graph
     inGraph.VerifyConstantLayerSetTensorInfo();
 
-    std::unique_ptr<Graph> graph = std::make_unique<Graph>(inGraph);
-
     // We need to pass on the information about whether import and export is enabled to the LoadNetwork phase.
     // The mechanism to do that is to add model options to the optimized network.
     armnn::BackendOptions importExport("Global",
@@ -1958,6 +1987,25 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
     ModelOptions optimizedOptions(options.GetModelOptions());
     optimizedOptions.push_back(importExport);
 
+    // If the network was optimized before, for the same backends and with the same options, skip all of the
+    // optimizations and load the optimized graph from the cache instead.
+    const OptimizedNetworkCache cache(options.GetOptimizedNetworkCacheDirectory());
+    Optional<std::string> cacheKey;
+    if (!options.GetOptimizedNetworkCacheDirectory().empty())
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Optimizer_LoadFromCache");
+        cacheKey = cache.GetKey(inGraph, backendPreferences, deviceSpec, options);
+        std::unique_ptr<Graph> cachedGraph = cacheKey.has_value() ? cache.Load(cacheKey.value(), inGraph) : nullptr;
+        if (cachedGraph)
+        {
+            ReportInfo("Loaded the optimized network " + cacheKey.value() + " from the cache", messages);
+            return IOptimizedNetworkPtr(new IOptimizedNetwork(std::move(cachedGraph), optimizedOptions),
+                                        &IOptimizedNetwork::Destroy);
+        }
+    }
+
+    std::unique_ptr<Graph> graph = std::make_unique<Graph>(inGraph);
+
     auto optNet = IOptimizedNetworkPtr(new IOptimizedNetwork(std::move(graph), optimizedOptions),
                                        &IOptimizedNetwork::Destroy);
 
@@ -1995,6 +2043,13 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
     // ConvertConstDequantisationLayersToConstLayers must happen before FoldPadIntoConvolution2d
     Optimizer::Pass(optGraph, MakeOptimizations(FusePermuteIntoConstLayer(),
                                                 ConvertConstDequantisationLayersToConstLayers()));
+    // Evaluate whatever is left computed from constants alone once, now, rather than at every inference. This must
+    // happen before the optimisations below, so they see the folded weights as ConstantLayers.
+    Optimizer::Pass(optGraph, MakeOptimizations(FoldConstants()));
+
+    // Merge the duplicated computations, such as the ones multi-head models are often exported with, before the
+    // sibling optimisations below look at what is left.
+    EliminateCommonSubexpressions::Run(optGraph);
     // Perform optimisation passes
     Optimizer::Pass(optGraph, MakeOptimizations(SquashEqualPermuteSiblings(),
                                                 SquashEqualTransposeSiblings(),
@@ -2029,6 +2084,16 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
         throw InvalidArgumentException(failureMsg.str());
     }
 
+    // Choose the data layout of each region of the graph so that the fewest transposes are left between them, now that
+    // the optimisations above have removed or moved the transposes they could, and only where the preferred backends
+    // support the layers in their new layout.
+    const unsigned int numEliminatedTransposes = PropagateDataLayouts::Run(optGraph, availablePreferredBackends);
+    if (numEliminatedTransposes > 0)
+    {
+        ReportInfo("Layout propagation eliminated " + std::to_string(numEliminatedTransposes) +
+                   " Transpose/Permute layers", messages);
+    }
+
     // Create a map to temporarily hold initialized backend objects
     TensorHandleFactoryRegistry tensorHandleFactoryRegistry;
     BackendsMap backends = CreateSupportedBackends(tensorHandleFactoryRegistry, backendSettings);
@@ -2125,6 +2190,12 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
         optGraph.AddCompatibilityLayers(backends, tensorHandleFactoryRegistry);
     }
 
+    if (cacheKey.has_value())
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Optimizer_SaveToCache");
+        cache.Save(cacheKey.value(), optGraph);
+    }
+
     return optNet;
 }
 
@@ -2450,6 +2521,35 @@ IConnectableLayer* NetworkImpl::AddConstantLayer(const ConstTensor& input, const
     return layer;
 }
 
+namespace
+{
+
+/// A ConstPassthroughTensorHandle which keeps the memory it wraps alive.
+class ImportedConstTensorHandle : public ConstPassthroughTensorHandle
+{
+public:
+    ImportedConstTensorHandle(const ConstTensor& tensor, std::shared_ptr<const void> memoryOwner)
+        : ConstPassthroughTensorHandle(tensor.GetInfo(), tensor.GetMemoryArea())
+        , m_MemoryOwner(std::move(memoryOwner))
+    {}
+
+private:
+    std::shared_ptr<const void> m_MemoryOwner;
+};
+
+} // anonymous namespace
+
+IConnectableLayer* NetworkImpl::AddImportedConstantLayer(const ConstTensor& input,
+                                                         std::shared_ptr<const void> memoryOwner,
+                                                         const char* name)
+{
+    auto layer = m_Graph->AddLayer<ConstantLayer>(name);
+
+    layer->m_LayerOutput = std::make_shared<ImportedConstTensorHandle>(input, std::move(memoryOwner));
+
+    return layer;
+}
+
 IConnectableLayer* NetworkImpl::AddReshapeLayer(const ReshapeDescriptor& reshapeDescriptor,
                                             const char* name)
 {
@@ -85,6 +85,10 @@ public:
 
     IConnectableLayer* AddConstantLayer(const ConstTensor& input, const char* name = nullptr);
 
+    IConnectableLayer* AddImportedConstantLayer(const ConstTensor& input,
+                                                std::shared_ptr<const void> memoryOwner,
+                                                const char* name = nullptr);
+
     IConnectableLayer* AddDepthToSpaceLayer(const DepthToSpaceDescriptor& depthToSpaceDescriptor,
                                             const char* name = nullptr);
 
@@ -394,6 +398,9 @@ struct OptimizerOptionsOpaqueImpl
 
     /// When calculating tensor sizes, dimensions of size == 1 will be ignored
     bool m_AllowExpandedDims = false;
+
+    /// Directory where optimized networks are cached, disabled when empty
+    std::string m_OptimizedNetworkCacheDirectory;
 };
 
 } // namespace armnn
@@ -0,0 +1,1345 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "OptimizedNetworkCache.hpp"
+#include "LayersFwd.hpp"
+
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/Exceptions.hpp>
+#include <armnn/Logging.hpp>
+#include <armnn/Version.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+#include <armnn/utility/IgnoreUnused.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+#include <armnnUtils/Filesystem.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace armnn
+{
+
+namespace
+{
+
+constexpr char FileIdentifier[] = "ArmNNOptimizedNetwork";
+
+/// Incremented whenever the layout of the cache files changes. It is part of the keys, so the files of other versions
+/// are never looked up.
+constexpr uint32_t FormatVersion = 2;
+
+/// Thrown while writing a network holding a layer which cannot be saved to the cache.
+class NotCacheableException : public Exception
+{
+public:
+    using Exception::Exception;
+};
+
+/// A 64-bit hash used both for the keys and for the checksums of the cache files. The data is mixed in eight bytes at
+/// a time rather than byte by byte, so that hashing the weights of a large network costs little more than reading
+/// them. The hash only depends on the bytes it is given, not on how they are split between calls to Update.
+class WordHash
+{
+public:
+    void Update(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        m_Size += size;
+
+        // Completes the word left over by the previous call first.
+        while (size > 0 && m_NumPendingBytes > 0)
+        {
+            AddPendingByte(*bytes++);
+            --size;
+        }
+        for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            m_Hash = Mix(m_Hash, word);
+        }
+        while (size > 0)
+        {
+            AddPendingByte(*bytes++);
+            --size;
+        }
+    }
+
+    uint64_t Get() const
+    {
+        uint64_t hash = m_Hash;
+        if (m_NumPendingBytes > 0)
+        {
+            hash = Mix(hash, m_PendingWord);
+        }
+        // The splitmix64 finalizer, over the hash and the number of bytes hashed.
+        hash ^= m_Size;
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+        return hash ^ (hash >> 31);
+    }
+
+private:
+    static uint64_t Mix(uint64_t hash, uint64_t word)
+    {
+        word *= 0x9e3779b97f4a7c15ull;
+        hash ^= (word << 31) | (word >> 33);
+        return ((hash << 27) | (hash >> 37)) * 0xff51afd7ed558ccdull + 0x52dce729ull;
+    }
+
+    void AddPendingByte(uint8_t byte)
+    {
+        m_PendingWord |= static_cast<uint64_t>(byte) << (8 * m_NumPendingBytes++);
+        if (m_NumPendingBytes == sizeof(uint64_t))
+        {
+            m_Hash = Mix(m_Hash, m_PendingWord);
+            m_PendingWord = 0;
+            m_NumPendingBytes = 0;
+        }
+    }
+
+    uint64_t m_Hash = 0x84222325cbf29ce4ull;
+    uint64_t m_Size = 0;
+    uint64_t m_PendingWord = 0;
+    unsigned int m_NumPendingBytes = 0;
+};
+
+// The fields of each descriptor, in the order they are saved. The same function both saves and loads a descriptor,
+// so the two cannot get out of step. OriginsDescriptor and ViewsDescriptor, whose arrays are private, have their own
+// functions in the archives. The Lstm descriptors have none, as the weights of the Lstm layers are not saved.
+template <typename Archive>
+void Fields(Archive& archive, ActivationDescriptor& descriptor)
+{
+    archive(descriptor.m_Function, descriptor.m_A, descriptor.m_B);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ArgMinMaxDescriptor& descriptor)
+{
+    archive(descriptor.m_Function, descriptor.m_Axis, descriptor.m_Output_Type);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, BatchMatMulDescriptor& descriptor)
+{
+    archive(descriptor.m_TransposeX, descriptor.m_TransposeY, descriptor.m_AdjointX, descriptor.m_AdjointY,
+            descriptor.m_DataLayoutX, descriptor.m_DataLayoutY);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, BatchNormalizationDescriptor& descriptor)
+{
+    archive(descriptor.m_Eps, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, BatchToSpaceNdDescriptor& descriptor)
+{
+    archive(descriptor.m_BlockShape, descriptor.m_Crops, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, BroadcastToDescriptor& descriptor)
+{
+    archive(descriptor.m_BroadcastToShape);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ChannelShuffleDescriptor& descriptor)
+{
+    archive(descriptor.m_NumGroups, descriptor.m_Axis);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ComparisonDescriptor& descriptor)
+{
+    archive(descriptor.m_Operation);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, Convolution2dDescriptor& descriptor)
+{
+    archive(descriptor.m_PadLeft, descriptor.m_PadRight, descriptor.m_PadTop, descriptor.m_PadBottom,
+            descriptor.m_StrideX, descriptor.m_StrideY, descriptor.m_DilationX, descriptor.m_DilationY,
+            descriptor.m_BiasEnabled, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, Convolution3dDescriptor& descriptor)
+{
+    archive(descriptor.m_PadLeft, descriptor.m_PadRight, descriptor.m_PadTop, descriptor.m_PadBottom,
+            descriptor.m_PadFront, descriptor.m_PadBack, descriptor.m_StrideX, descriptor.m_StrideY,
+            descriptor.m_StrideZ, descriptor.m_DilationX, descriptor.m_DilationY, descriptor.m_DilationZ,
+            descriptor.m_BiasEnabled, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, DepthwiseConvolution2dDescriptor& descriptor)
+{
+    archive(descriptor.m_PadLeft, descriptor.m_PadRight, descriptor.m_PadTop, descriptor.m_PadBottom,
+            descriptor.m_StrideX, descriptor.m_StrideY, descriptor.m_DilationX, descriptor.m_DilationY,
+            descriptor.m_BiasEnabled, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, DetectionPostProcessDescriptor& descriptor)
+{
+    archive(descriptor.m_MaxDetections, descriptor.m_MaxClassesPerDetection, descriptor.m_DetectionsPerClass,
+            descriptor.m_NmsScoreThreshold, descriptor.m_NmsIouThreshold, descriptor.m_NumClasses,
+            descriptor.m_UseRegularNms, descriptor.m_ScaleX, descriptor.m_ScaleY, descriptor.m_ScaleW,
+            descriptor.m_ScaleH);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ElementwiseBinaryDescriptor& descriptor)
+{
+    archive(descriptor.m_Operation);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ElementwiseUnaryDescriptor& descriptor)
+{
+    archive(descriptor.m_Operation);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, FakeQuantizationDescriptor& descriptor)
+{
+    archive(descriptor.m_Min, descriptor.m_Max);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, FillDescriptor& descriptor)
+{
+    archive(descriptor.m_Value);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, FullyConnectedDescriptor& descriptor)
+{
+    archive(descriptor.m_BiasEnabled, descriptor.m_TransposeWeightMatrix, descriptor.m_ConstantWeights);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, FusedDescriptor& descriptor)
+{
+    archive(descriptor.m_NumInputSlots, descriptor.m_NumOutputSlots, descriptor.m_FusedKernelType);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, GatherDescriptor& descriptor)
+{
+    archive(descriptor.m_Axis);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, InstanceNormalizationDescriptor& descriptor)
+{
+    archive(descriptor.m_Gamma, descriptor.m_Beta, descriptor.m_Eps, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, L2NormalizationDescriptor& descriptor)
+{
+    archive(descriptor.m_Eps, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, LogicalBinaryDescriptor& descriptor)
+{
+    archive(descriptor.m_Operation);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, MeanDescriptor& descriptor)
+{
+    archive(descriptor.m_Axis, descriptor.m_KeepDims);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, NormalizationDescriptor& descriptor)
+{
+    archive(descriptor.m_NormChannelType, descriptor.m_NormMethodType, descriptor.m_NormSize, descriptor.m_Alpha,
+            descriptor.m_Beta, descriptor.m_K, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, PadDescriptor& descriptor)
+{
+    archive(descriptor.m_PadList, descriptor.m_PadValue, descriptor.m_PaddingMode);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, PermuteDescriptor& descriptor)
+{
+    archive(descriptor.m_DimMappings);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, Pooling2dDescriptor& descriptor)
+{
+    archive(descriptor.m_PoolType, descriptor.m_PadLeft, descriptor.m_PadRight, descriptor.m_PadTop,
+            descriptor.m_PadBottom, descriptor.m_PoolWidth, descriptor.m_PoolHeight, descriptor.m_StrideX,
+            descriptor.m_StrideY, descriptor.m_OutputShapeRounding, descriptor.m_PaddingMethod,
+            descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, Pooling3dDescriptor& descriptor)
+{
+    archive(descriptor.m_PoolType, descriptor.m_PadLeft, descriptor.m_PadRight, descriptor.m_PadTop,
+            descriptor.m_PadBottom, descriptor.m_PadFront, descriptor.m_PadBack, descriptor.m_PoolWidth,
+            descriptor.m_PoolHeight, descriptor.m_PoolDepth, descriptor.m_StrideX, descriptor.m_StrideY,
+            descriptor.m_StrideZ, descriptor.m_OutputShapeRounding, descriptor.m_PaddingMethod,
+            descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, PreCompiledDescriptor& descriptor)
+{
+    archive(descriptor.m_NumInputSlots, descriptor.m_NumOutputSlots);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ReduceDescriptor& descriptor)
+{
+    archive(descriptor.m_KeepDims, descriptor.m_vAxis, descriptor.m_ReduceOperation);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ReshapeDescriptor& descriptor)
+{
+    archive(descriptor.m_TargetShape);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ResizeDescriptor& descriptor)
+{
+    archive(descriptor.m_TargetWidth, descriptor.m_TargetHeight, descriptor.m_Method, descriptor.m_DataLayout,
+            descriptor.m_AlignCorners, descriptor.m_HalfPixelCenters);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, ScatterNdDescriptor& descriptor)
+{
+    archive(descriptor.m_Function, descriptor.m_InputEnabled, descriptor.m_Axis, descriptor.m_AxisEnabled);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, SliceDescriptor& descriptor)
+{
+    archive(descriptor.m_Begin, descriptor.m_Size);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, SoftmaxDescriptor& descriptor)
+{
+    archive(descriptor.m_Beta, descriptor.m_Axis);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, SpaceToBatchNdDescriptor& descriptor)
+{
+    archive(descriptor.m_BlockShape, descriptor.m_PadList, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, SpaceToDepthDescriptor& descriptor)
+{
+    archive(descriptor.m_BlockSize, descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, StackDescriptor& descriptor)
+{
+    archive(descriptor.m_Axis, descriptor.m_NumInputs, descriptor.m_InputShape);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, StandInDescriptor& descriptor)
+{
+    archive(descriptor.m_NumInputs, descriptor.m_NumOutputs);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, StridedSliceDescriptor& descriptor)
+{
+    archive(descriptor.m_Begin, descriptor.m_End, descriptor.m_Stride, descriptor.m_BeginMask, descriptor.m_EndMask,
+            descriptor.m_ShrinkAxisMask, descriptor.m_EllipsisMask, descriptor.m_NewAxisMask,
+            descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, TileDescriptor& descriptor)
+{
+    archive(descriptor.m_Multiples);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, TransposeConvolution2dDescriptor& descriptor)
+{
+    archive(descriptor.m_PadLeft, descriptor.m_PadRight, descriptor.m_PadTop, descriptor.m_PadBottom,
+            descriptor.m_StrideX, descriptor.m_StrideY, descriptor.m_BiasEnabled, descriptor.m_DataLayout,
+            descriptor.m_OutputShapeEnabled, descriptor.m_OutputShape);
+}
+
+template <typename Archive>
+void Fields(Archive& archive, TransposeDescriptor& descriptor)
+{
+    archive(descriptor.m_DimMappings);
+}
+
+class CacheWriter;
+
+template <typename Descriptor, typename = void>
+struct HasFields : std::false_type {};
+
+template <typename Descriptor>
+struct HasFields<Descriptor, std::void_t<decltype(Fields(std::declval<CacheWriter&>(), std::declval<Descriptor&>()))>>
+    : std::true_type {};
+
+template <typename Descriptor>
+struct IsCacheableDescriptor : std::integral_constant<bool, HasFields<Descriptor>::value ||
+                                                            std::is_same<Descriptor, OriginsDescriptor>::value ||
+                                                            std::is_same<Descriptor, ViewsDescriptor>::value> {};
+
+template <typename LayerT, typename = void>
+struct HasParameters : std::false_type {};
+
+template <typename LayerT>
+struct HasParameters<LayerT, std::void_t<typename LayerT::DescriptorType>> : std::true_type {};
+
+/// Writes the values making up a cache file. The derived classes decide where their bytes go.
+class CacheWriter
+{
+public:
+    virtual ~CacheWriter() = default;
+
+    template <typename... Ts>
+    void operator()(const Ts&... values)
+    {
+        (Write(values), ...);
+    }
+
+protected:
+    virtual void WriteBytes(const void* data, size_t size) = 0;
+
+private:
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value> Write(const T& value)
+    {
+        WriteBytes(&value, sizeof(value));
+    }
+
+    void Write(bool value)
+    {
+        Write(static_cast<uint8_t>(value));
+    }
+
+    void Write(const std::string& value)
+    {
+        Write(static_cast<uint32_t>(value.size()));
+        WriteBytes(value.data(), value.size());
+    }
+
+    void Write(const BackendId& value)
+    {
+        Write(value.Get());
+    }
+
+    template <typename T>
+    void Write(const std::vector<T>& values)
+    {
+        Write(static_cast<uint32_t>(values.size()));
+        if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value)
+        {
+            WriteBytes(values.data(), values.size() * sizeof(T));
+        }
+        else
+        {
+            for (const T& value : values)
+            {
+                Write(value);
+            }
+        }
+    }
+
+    template <typename T, typename U>
+    void Write(const std::pair<T, U>& value)
+    {
+        Write(value.first);
+        Write(value.second);
+    }
+
+    template <typename T>
+    void Write(const Optional<T>& value)
+    {
+        Write(value.has_value());
+        if (value.has_value())
+        {
+            Write(value.value());
+        }
+    }
+
+    void Write(const TensorShape& shape)
+    {
+        Write(shape.GetDimensionality());
+        if (shape.GetDimensionality() != Dimensionality::Specified)
+        {
+            return;
+        }
+        Write(shape.GetNumDimensions());
+        for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+        {
+            const bool isSpecified = shape.GetDimensionSpecificity(i);
+            Write(isSpecified);
+            Write(isSpecified ? shape[i] : 0u);
+        }
+    }
+
+    void Write(const TensorInfo& info)
+    {
+        Write(info.GetShape());
+        Write(info.GetDataType());
+        Write(info.GetQuantizationScales());
+        Write(info.GetQuantizationOffset());
+        Write(info.GetQuantizationDim());
+        Write(info.IsConstant());
+    }
+
+    void Write(const std::shared_ptr<ConstTensorHandle>& tensor)
+    {
+        Write(tensor != nullptr);
+        if (tensor != nullptr)
+        {
+            Write(tensor->GetTensorInfo());
+            WriteBytes(tensor->GetConstTensor<void>(), tensor->GetTensorInfo().GetNumBytes());
+        }
+    }
+
+    void Write(const PermutationVector& permutation)
+    {
+        Write(permutation.GetSize());
+        for (unsigned int i = 0; i < permutation.GetSize(); ++i)
+        {
+            Write(permutation[i]);
+        }
+    }
+
+    void Write(const OriginsDescriptor& descriptor)
+    {
+        (*this)(descriptor.GetNumViews(), descriptor.GetNumDimensions(), descriptor.GetConcatAxis());
+        for (uint32_t view = 0; view < descriptor.GetNumViews(); ++view)
+        {
+            WriteBytes(descriptor.GetViewOrigin(view), descriptor.GetNumDimensions() * sizeof(uint32_t));
+        }
+    }
+
+    void Write(const ViewsDescriptor& descriptor)
+    {
+        (*this)(descriptor.GetNumViews(), descriptor.GetNumDimensions(), descriptor.HasAxis(), descriptor.GetAxis());
+        for (uint32_t view = 0; view < descriptor.GetNumViews(); ++view)
+        {
+            WriteBytes(descriptor.GetViewOrigin(view), descriptor.GetNumDimensions() * sizeof(uint32_t));
+            WriteBytes(descriptor.GetViewSizes(view), descriptor.GetNumDimensions() * sizeof(uint32_t));
+        }
+    }
+
+    template <typename Descriptor>
+    std::enable_if_t<HasFields<Descriptor>::value> Write(const Descriptor& descriptor)
+    {
+        // Fields only reads the descriptor when given a writer.
+        Fields(*this, const_cast<Descriptor&>(descriptor));
+    }
+};
+
+/// Hashes the values it is given into a key.
+class HashWriter : public CacheWriter
+{
+public:
+    std::string GetKey() const
+    {
+        std::stringstream stream;
+        stream << std::hex << std::setw(16) << std::setfill('0') << m_Hash.Get();
+        return stream.str();
+    }
+
+protected:
+    void WriteBytes(const void* data, size_t size) override
+    {
+        m_Hash.Update(data, size);
+    }
+
+private:
+    WordHash m_Hash;
+};
+
+/// Writes the values it is given to a file, followed by their checksum.
+class StreamWriter : public CacheWriter
+{
+public:
+    explicit StreamWriter(std::ostream& stream) : m_Stream(stream) {}
+
+    void WriteChecksum()
+    {
+        const uint64_t checksum = m_Hash.Get();
+        m_Stream.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+    }
+
+protected:
+    void WriteBytes(const void* data, size_t size) override
+    {
+        m_Hash.Update(data, size);
+        m_Stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+
+private:
+    std::ostream& m_Stream;
+    WordHash m_Hash;
+};
+
+/// Reads back the values written by a StreamWriter. Throws a ParseException if the file is truncated, or if its
+/// checksum does not match.
+class CacheReader
+{
+public:
+    CacheReader(std::istream& stream, uint64_t size) : m_Stream(stream), m_Remaining(size) {}
+
+    template <typename... Ts>
+    void operator()(Ts&... values)
+    {
+        (Read(values), ...);
+    }
+
+    void ReadChecksum()
+    {
+        const uint64_t expectedChecksum = m_Hash.Get();
+        uint64_t checksum = 0;
+        Read(checksum);
+        if (checksum != expectedChecksum || m_Remaining != 0)
+        {
+            throw ParseException("The checksum of the cached network does not match");
+        }
+    }
+
+private:
+    void ReadBytes(void* data, size_t size)
+    {
+        if (size > m_Remaining)
+        {
+            throw ParseException("The cached network is truncated");
+        }
+        m_Stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+        if (!m_Stream)
+        {
+            throw ParseException("Failed to read the cached network");
+        }
+        m_Remaining -= size;
+        m_Hash.Update(data, size);
+    }
+
+    /// Reads the number of elements of an array, making sure the file is large enough to hold them before anything
+    /// is allocated for them.
+    uint32_t ReadSize(size_t elementSize)
+    {
+        uint32_t size = 0;
+        Read(size);
+        if (size * std::max<uint64_t>(elementSize, 1) > m_Remaining)
+        {
+            throw ParseException("The cached network is truncated");
+        }
+        return size;
+    }
+
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value> Read(T& value)
+    {
+        ReadBytes(&value, sizeof(value));
+    }
+
+    void Read(bool& value)
+    {
+        uint8_t byte = 0;
+        Read(byte);
+        if (byte > 1)
+        {
+            throw ParseException("Invalid boolean in the cached network");
+        }
+        value = byte != 0;
+    }
+
+    void Read(std::string& value)
+    {
+        value.resize(ReadSize(sizeof(char)));
+        ReadBytes(&value[0], value.size());
+    }
+
+    void Read(BackendId& value)
+    {
+        std::string id;
+        Read(id);
+        value = BackendId(id);
+    }
+
+    template <typename T>
+    void Read(std::vector<T>& values)
+    {
+        values.resize(ReadSize(sizeof(T)));
+        if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value)
+        {
+            ReadBytes(values.data(), values.size() * sizeof(T));
+        }
+        else
+        {
+            for (T& value : values)
+            {
+                Read(value);
+            }
+        }
+    }
+
+    template <typename T, typename U>
+    void Read(std::pair<T, U>& value)
+    {
+        Read(value.first);
+        Read(value.second);
+    }
+
+    template <typename T>
+    void Read(Optional<T>& value)
+    {
+        bool hasValue = false;
+        Read(hasValue);
+        value = EmptyOptional();
+        if (hasValue)
+        {
+            T held{};
+            Read(held);
+            value = Optional<T>(held);
+        }
+    }
+
+    void Read(TensorShape& shape)
+    {
+        Dimensionality dimensionality = Dimensionality::NotSpecified;
+        Read(dimensionality);
+        if (dimensionality != Dimensionality::Specified)
+        {
+            shape = TensorShape(dimensionality);
+            return;
+        }
+
+        unsigned int numDimensions = 0;
+        Read(numDimensions);
+        if (numDimensions > MaxNumOfTensorDimensions)
+        {
+            throw ParseException("Invalid tensor shape in the cached network");
+        }
+        unsigned int dimensions[MaxNumOfTensorDimensions] = {};
+        bool specificity[MaxNumOfTensorDimensions] = {};
+        for (unsigned int i = 0; i < numDimensions; ++i)
+        {
+            (*this)(specificity[i], dimensions[i]);
+        }
+        shape = TensorShape(numDimensions, dimensions, specificity);
+    }
+
+    void Read(TensorInfo& info)
+    {
+        TensorShape shape;
+        DataType dataType = DataType::Float32;
+        std::vector<float> scales;
+        int32_t offset = 0;
+        Optional<unsigned int> quantizationDim;
+        bool isConstant = false;
+        (*this)(shape, dataType, scales, offset, quantizationDim, isConstant);
+
+        info = TensorInfo();
+        info.SetShape(shape);
+        info.SetDataType(dataType);
+        info.SetQuantizationScales(scales);
+        info.SetQuantizationOffset(offset);
+        info.SetQuantizationDim(quantizationDim);
+        info.SetConstant(isConstant);
+    }
+
+    void Read(std::shared_ptr<ConstTensorHandle>& tensor)
+    {
+        bool hasTensor = false;
+        Read(hasTensor);
+        tensor = nullptr;
+        if (hasTensor)
+        {
+            TensorInfo info;
+            Read(info);
+            if (info.GetNumBytes() > m_Remaining)
+            {
+                throw ParseException("The cached network is truncated");
+            }
+            auto scopedTensor = std::make_shared<ScopedTensorHandle>(info);
+            scopedTensor->Allocate();
+            ReadBytes(scopedTensor->GetTensor<void>(), info.GetNumBytes());
+            tensor = std::move(scopedTensor);
+        }
+    }
+
+    void Read(PermutationVector& permutation)
+    {
+        PermutationVector::SizeType size = 0;
+        Read(size);
+        if (size > MaxNumOfTensorDimensions)
+        {
+            throw ParseException("Invalid permutation in the cached network");
+        }
+        PermutationVector::ValueType mappings[MaxNumOfTensorDimensions] = {};
+        for (PermutationVector::SizeType i = 0; i < size; ++i)
+        {
+            Read(mappings[i]);
+        }
+        permutation = PermutationVector(mappings, size);
+    }
+
+    void Read(OriginsDescriptor& descriptor)
+    {
+        uint32_t numViews = 0;
+        uint32_t numDimensions = 0;
+        unsigned int concatAxis = 0;
+        (*this)(numViews, numDimensions, concatAxis);
+        CheckViewsSize(numViews, numDimensions, 1);
+
+        descriptor = OriginsDescriptor(numViews, numDimensions);
+        descriptor.SetConcatAxis(concatAxis);
+        for (uint32_t view = 0; view < numViews; ++view)
+        {
+            for (uint32_t coord = 0; coord < numDimensions; ++coord)
+            {
+                uint32_t value = 0;
+                Read(value);
+                descriptor.SetViewOriginCoord(view, coord, value);
+            }
+        }
+    }
+
+    void Read(ViewsDescriptor& descriptor)
+    {
+        uint32_t numViews = 0;
+        uint32_t numDimensions = 0;
+        bool hasAxis = false;
+        int32_t axis = 0;
+        (*this)(numViews, numDimensions, hasAxis, axis);
+        CheckViewsSize(numViews, numDimensions, 2);
+
+        descriptor = ViewsDescriptor(numViews, numDimensions);
+        if (hasAxis)
+        {
+            descriptor.SetAxis(axis);
+        }
+        for (uint32_t view = 0; view < numViews; ++view)
+        {
+            for (uint32_t coord = 0; coord < numDimensions; ++coord)
+            {
+                uint32_t value = 0;
+                Read(value);
+                descriptor.SetViewOriginCoord(view, coord, value);
+            }
+            for (uint32_t coord = 0; coord < numDimensions; ++coord)
+            {
+                uint32_t value = 0;
+                Read(value);
+                descriptor.SetViewSize(view, coord, value);
+            }
+        }
+    }
+
+    void CheckViewsSize(uint32_t numViews, uint32_t numDimensions, uint64_t numArrays) const
+    {
+        if (uint64_t(numViews) * numDimensions * numArrays * sizeof(uint32_t) > m_Remaining)
+        {
+            throw ParseException("The cached network is truncated");
+        }
+    }
+
+    template <typename Descriptor>
+    std::enable_if_t<HasFields<Descriptor>::value> Read(Descriptor& descriptor)
+    {
+        Fields(*this, descriptor);
+    }
+
+    std::istream& m_Stream;
+    uint64_t m_Remaining;
+    WordHash m_Hash;
+};
+
+// The data a layer holds besides its descriptor: the tensors of the layers which hold their own weights, and the
+// pre-compiled objects, which the backends which created them serialize.
+void WriteHeldData(CacheWriter&, const Layer&) {}
+
+void WriteHeldData(CacheWriter& writer, const BatchNormalizationLayer& layer)
+{
+    writer(layer.m_Mean, layer.m_Variance, layer.m_Beta, layer.m_Gamma);
+}
+
+void WriteHeldData(CacheWriter& writer, const DetectionPostProcessLayer& layer)
+{
+    writer(layer.m_Anchors);
+}
+
+void WriteHeldData(CacheWriter& writer, const TransposeConvolution2dLayer& layer)
+{
+    writer(layer.m_Weight, layer.m_Bias);
+}
+
+void WriteHeldData(CacheWriter& writer, const PreCompiledLayer& layer)
+{
+    auto backend = BackendRegistryInstance().GetFactory(layer.GetBackendId())();
+    const std::vector<uint8_t> data = backend->SerializePreCompiledObject(layer.GetPreCompiledObject());
+    if (data.empty())
+    {
+        throw NotCacheableException("The backend " + layer.GetBackendId().Get() +
+                                    " cannot serialize the pre-compiled object of " + layer.GetNameStr());
+    }
+    writer(data);
+}
+
+void ReadHeldData(CacheReader&, Layer&) {}
+
+void ReadHeldData(CacheReader& reader, BatchNormalizationLayer& layer)
+{
+    reader(layer.m_Mean, layer.m_Variance, layer.m_Beta, layer.m_Gamma);
+}
+
+void ReadHeldData(CacheReader& reader, DetectionPostProcessLayer& layer)
+{
+    reader(layer.m_Anchors);
+}
+
+void ReadHeldData(CacheReader& reader, TransposeConvolution2dLayer& layer)
+{
+    reader(layer.m_Weight, layer.m_Bias);
+}
+
+void ReadHeldData(CacheReader& reader, PreCompiledLayer& layer)
+{
+    std::vector<uint8_t> data;
+    reader(data);
+    auto backend = BackendRegistryInstance().GetFactory(layer.GetBackendId())();
+    layer.SetPreCompiledObject(backend->DeserializePreCompiledObject(data));
+}
+
+template <typename LayerT>
+void WriteLayerData(CacheWriter& writer, const LayerT& layer)
+{
+    if constexpr (std::is_same<LayerT, InputLayer>::value || std::is_same<LayerT, OutputLayer>::value)
+    {
+        writer(layer.GetBindingId());
+    }
+    else if constexpr (std::is_same<LayerT, ConstantLayer>::value)
+    {
+        writer(layer.m_LayerOutput);
+    }
+    else if constexpr (std::is_same<LayerT, DebugLayer>::value)
+    {
+        writer(layer.IsToFile());
+    }
+    else if constexpr (std::is_same<LayerT, QuantizedLstmLayer>::value)
+    {
+        throw NotCacheableException("The QuantizedLstm layer " + layer.GetNameStr() + " cannot be cached");
+    }
+    else if constexpr (HasParameters<LayerT>::value)
+    {
+        if constexpr (IsCacheableDescriptor<typename LayerT::DescriptorType>::value)
+        {
+            writer(layer.GetParameters());
+            WriteHeldData(writer, layer);
+        }
+        else
+        {
+            throw NotCacheableException(std::string("The ") + GetLayerTypeAsCString(layer.GetType()) + " layer " +
+                                        layer.GetNameStr() + " cannot be cached");
+        }
+    }
+    else
+    {
+        IgnoreUnused(writer, layer);
+    }
+}
+
+/// Adds the layer to the graph before its backend id is set, so the backend of a PreCompiled layer is passed in.
+template <typename LayerT>
+Layer* ReadLayerData(CacheReader& reader, Graph& graph, const char* name, const BackendId& backendId)
+{
+    if constexpr (std::is_same<LayerT, InputLayer>::value || std::is_same<LayerT, OutputLayer>::value)
+    {
+        LayerBindingId bindingId = 0;
+        reader(bindingId);
+        return graph.AddLayer<LayerT>(bindingId, name);
+    }
+    else if constexpr (std::is_same<LayerT, ConstantLayer>::value)
+    {
+        ConstantLayer* layer = graph.AddLayer<ConstantLayer>(name);
+        reader(layer->m_LayerOutput);
+        return layer;
+    }
+    else if constexpr (std::is_same<LayerT, DebugLayer>::value)
+    {
+        bool toFile = false;
+        reader(toFile);
+        return graph.AddLayer<DebugLayer>(name, toFile);
+    }
+    else if constexpr (HasParameters<LayerT>::value && !std::is_same<LayerT, QuantizedLstmLayer>::value)
+    {
+        if constexpr (IsCacheableDescriptor<typename LayerT::DescriptorType>::value)
+        {
+            typename LayerT::DescriptorType descriptor;
+            reader(descriptor);
+            LayerT* layer = graph.AddLayer<LayerT>(descriptor, name);
+            layer->SetBackendId(backendId);
+            ReadHeldData(reader, *layer);
+            return layer;
+        }
+        else
+        {
+            throw ParseException("Unexpected layer in the cached network");
+        }
+    }
+    else if constexpr (std::is_same<LayerT, QuantizedLstmLayer>::value)
+    {
+        throw ParseException("Unexpected layer in the cached network");
+    }
+    else
+    {
+        return graph.AddLayer<LayerT>(name);
+    }
+}
+
+void WriteLayer(CacheWriter& writer, const Layer& layer)
+{
+    writer(layer.GetType(), layer.GetNameStr(), layer.GetBackendId());
+    switch (layer.GetType())
+    {
+#define X(name)                                                                                  \
+        case LayerType::name:                                                                    \
+            WriteLayerData(writer, *PolymorphicDowncast<const LayerTypeOf<LayerType::name>*>(&layer)); \
+            break;
+        LIST_OF_LAYER_TYPE
+#undef X
+        default:
+            throw NotCacheableException("Unknown layer type");
+    }
+
+    writer(layer.GetBackendHint(), layer.GetShapeInferenceMethod(), layer.GetAllowExpandedDims(),
+           layer.GetNumInputSlots(), layer.GetNumOutputSlots());
+
+    // Backends only ever attach the activation they fused into a layer to it.
+    std::shared_ptr<ActivationDescriptor> fusedActivation = layer.GetAdditionalInformation<ActivationDescriptor>();
+    writer(fusedActivation != nullptr);
+    if (fusedActivation != nullptr)
+    {
+        writer(*fusedActivation);
+    }
+
+    for (const InputSlot& inputSlot : layer.GetInputSlots())
+    {
+        writer(inputSlot.IsTensorInfoOverridden());
+        if (inputSlot.IsTensorInfoOverridden())
+        {
+            writer(inputSlot.GetTensorInfo());
+        }
+    }
+    for (const OutputSlot& outputSlot : layer.GetOutputSlots())
+    {
+        writer(outputSlot.IsTensorInfoSet());
+        if (outputSlot.IsTensorInfoSet())
+        {
+            writer(outputSlot.GetTensorInfo());
+        }
+        writer(outputSlot.GetTensorHandleFactoryId());
+    }
+}
+
+Layer* ReadLayer(CacheReader& reader, Graph& graph)
+{
+    LayerType type = LayerType::FirstLayer;
+    std::string name;
+    BackendId backendId;
+    reader(type, name, backendId);
+
+    Layer* layer = nullptr;
+    switch (type)
+    {
+#define X(type)                                                                                      \
+        case LayerType::type:                                                                        \
+            layer = ReadLayerData<LayerTypeOf<LayerType::type>>(reader, graph, name.c_str(), backendId); \
+            break;
+        LIST_OF_LAYER_TYPE
+#undef X
+        default:
+            throw ParseException("Unknown layer type in the cached network");
+    }
+    layer->SetBackendId(backendId);
+
+    Optional<BackendId> backendHint;
+    ShapeInferenceMethod shapeInferenceMethod = ShapeInferenceMethod::ValidateOnly;
+    bool allowExpandedDims = false;
+    unsigned int numInputSlots = 0;
+    unsigned int numOutputSlots = 0;
+    reader(backendHint, shapeInferenceMethod, allowExpandedDims, numInputSlots, numOutputSlots);
+    if (numInputSlots != layer->GetNumInputSlots() || numOutputSlots != layer->GetNumOutputSlots())
+    {
+        throw ParseException("The layer " + name + " of the cached network has the wrong number of slots");
+    }
+    layer->BackendSelectionHint(backendHint);
+    layer->SetShapeInferenceMethod(shapeInferenceMethod);
+    layer->SetAllowExpandedDims(allowExpandedDims);
+
+    bool hasFusedActivation = false;
+    reader(hasFusedActivation);
+    if (hasFusedActivation)
+    {
+        ActivationDescriptor fusedActivation;
+        reader(fusedActivation);
+        layer->SetAdditionalInfoForObject(std::make_shared<ActivationDescriptor>(fusedActivation));
+    }
+
+    for (unsigned int i = 0; i < numInputSlots; ++i)
+    {
+        bool isTensorInfoOverridden = false;
+        reader(isTensorInfoOverridden);
+        if (isTensorInfoOverridden)
+        {
+            TensorInfo info;
+            reader(info);
+            layer->GetInputSlot(i).SetTensorInfo(info);
+        }
+    }
+    for (unsigned int i = 0; i < numOutputSlots; ++i)
+    {
+        bool isTensorInfoSet = false;
+        reader(isTensorInfoSet);
+        if (isTensorInfoSet)
+        {
+            TensorInfo info;
+            reader(info);
+            layer->GetOutputSlot(i).SetTensorInfo(info);
+        }
+        ITensorHandleFactory::FactoryId factoryId;
+        reader(factoryId);
+        layer->GetOutputSlot(i).SetTensorHandleFactory(factoryId);
+    }
+    return layer;
+}
+
+/// Writes the layers in topological order, followed by the connections of their output slots.
+void WriteGraph(CacheWriter& writer, const Graph& graph)
+{
+    std::vector<const Layer*> layers;
+    std::unordered_map<const Layer*, uint32_t> layerIndices;
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        layerIndices[layer] = static_cast<uint32_t>(layers.size());
+        layers.push_back(layer);
+    }
+
+    writer(graph.GetShapeInferenceMethod(), graph.GetAllowExpandedDims(), static_cast<uint32_t>(layers.size()));
+    for (const Layer* layer : layers)
+    {
+        WriteLayer(writer, *layer);
+    }
+
+    for (const Layer* layer : layers)
+    {
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            writer(outputSlot.GetNumConnections());
+            for (unsigned int i = 0; i < outputSlot.GetNumConnections(); ++i)
+            {
+                const InputSlot* connection = outputSlot.GetConnection(i);
+                writer(layerIndices.at(&connection->GetOwningLayer()),
+                       connection->GetSlotIndex(),
+                       outputSlot.GetEdgeStrategyForConnection(i));
+            }
+        }
+    }
+}
+
+std::unique_ptr<Graph> ReadGraph(CacheReader& reader, const Graph& inGraph)
+{
+    ShapeInferenceMethod shapeInferenceMethod = ShapeInferenceMethod::ValidateOnly;
+    bool allowExpandedDims = false;
+    uint32_t numLayers = 0;
+    reader(shapeInferenceMethod, allowExpandedDims, numLayers);
+    auto graph = std::make_unique<Graph>(shapeInferenceMethod, allowExpandedDims, inGraph.GetProfiler());
+
+    std::vector<Layer*> layers;
+    for (uint32_t i = 0; i < numLayers; ++i)
+    {
+        layers.push_back(ReadLayer(reader, *graph));
+    }
+
+    for (Layer* layer : layers)
+    {
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& outputSlot = layer->GetOutputSlot(i);
+            unsigned int numConnections = 0;
+            reader(numConnections);
+            for (unsigned int j = 0; j < numConnections; ++j)
+            {
+                uint32_t layerIndex = 0;
+                unsigned int slotIndex = 0;
+                EdgeStrategy edgeStrategy = EdgeStrategy::Undefined;
+                reader(layerIndex, slotIndex, edgeStrategy);
+                if (layerIndex >= layers.size() || slotIndex >= layers[layerIndex]->GetNumInputSlots() ||
+                    layers[layerIndex]->GetInputSlot(slotIndex).GetConnectedOutputSlot() != nullptr)
+                {
+                    throw ParseException("Invalid connection in the cached network");
+                }
+                const int connectionIndex = outputSlot.Connect(layers[layerIndex]->GetInputSlot(slotIndex));
+                outputSlot.SetEdgeStrategy(static_cast<unsigned int>(connectionIndex), edgeStrategy);
+            }
+        }
+    }
+    return graph;
+}
+
+} // anonymous namespace
+
+OptimizedNetworkCache::OptimizedNetworkCache(const std::string& directory)
+    : m_Directory(directory)
+{
+}
+
+Optional<std::string> OptimizedNetworkCache::GetKey(const Graph& graph,
+                                                    const std::vector<BackendId>& backendPreferences,
+                                                    const IDeviceSpec& deviceSpec,
+                                                    const OptimizerOptionsOpaque& options) const
+{
+    // Where the optimized networks are cached does not change them.
+    OptimizerOptionsOpaque keyOptions(options);
+    keyOptions.SetOptimizedNetworkCacheDirectory("");
+
+    std::vector<std::string> supportedBackends;
+    for (const BackendId& backend : deviceSpec.GetSupportedBackends())
+    {
+        supportedBackends.push_back(backend.Get());
+    }
+    std::sort(supportedBackends.begin(), supportedBackends.end());
+
+    HashWriter writer;
+    try
+    {
+        writer(std::string(ARMNN_VERSION), FormatVersion, backendPreferences, supportedBackends,
+               keyOptions.ToString());
+        WriteGraph(writer, graph);
+    }
+    catch (const NotCacheableException& e)
+    {
+        ARMNN_LOG(info) << "The optimized network cannot be cached: " << e.what();
+        return EmptyOptional();
+    }
+    return writer.GetKey();
+}
+
+std::unique_ptr<Graph> OptimizedNetworkCache::Load(const std::string& key, const Graph& inGraph) const
+{
+    const std::string path = GetPath(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return nullptr;
+    }
+    const std::streamoff size = file.tellg();
+    file.seekg(0);
+
+    try
+    {
+        if (size < 0)
+        {
+            throw ParseException("Cannot tell the size of the file");
+        }
+        CacheReader reader(file, static_cast<uint64_t>(size));
+
+        std::string identifier;
+        uint32_t formatVersion = 0;
+        std::string fileKey;
+        reader(identifier, formatVersion, fileKey);
+        if (identifier != FileIdentifier || formatVersion != FormatVersion || fileKey != key)
+        {
+            throw ParseException("Not an optimized network of this version of Arm NN");
+        }
+
+        std::unique_ptr<Graph> graph = ReadGraph(reader, inGraph);
+        reader.ReadChecksum();
+        return graph;
+    }
+    catch (const Exception& e)
+    {
+        ARMNN_LOG(warning) << "Ignoring the cached optimized network " << path << ": " << e.what();
+        return nullptr;
+    }
+}
+
+bool OptimizedNetworkCache::Save(const std::string& key, const Graph& optimizedGraph) const
+{
+    const std::string path = GetPath(key);
+    // Other processes may be saving the same network, so each writes a file of its own before renaming it.
+    const std::string temporaryPath = path + "." + std::to_string(std::random_device()()) + ".tmp";
+    try
+    {
+#if !defined(ARMNN_DISABLE_FILESYSTEM)
+        std::error_code error;
+        fs::create_directories(m_Directory, error);
+#endif
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            throw RuntimeException("Cannot open " + temporaryPath);
+        }
+
+        StreamWriter writer(file);
+        writer(std::string(FileIdentifier), FormatVersion, key);
+        WriteGraph(writer, optimizedGraph);
+        writer.WriteChecksum();
+
+        file.close();
+        if (!file)
+        {
+            throw RuntimeException("Failed to write " + temporaryPath);
+        }
+        // The file only gets its name once complete, so a partially written file is never loaded.
+        if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+        {
+            throw RuntimeException("Cannot rename " + temporaryPath + " to " + path);
+        }
+    }
+    catch (const NotCacheableException& e)
+    {
+        std::remove(temporaryPath.c_str());
+        ARMNN_LOG(info) << "The optimized network cannot be cached: " << e.what();
+        return false;
+    }
+    catch (const Exception& e)
+    {
+        std::remove(temporaryPath.c_str());
+        ARMNN_LOG(warning) << "Failed to cache the optimized network: " << e.what();
+        return false;
+    }
+    return true;
+}
+
+std::string OptimizedNetworkCache::GetPath(const std::string& key) const
+{
+    return m_Directory + "/" + key + ".armnn-optimized";
+}
+
+} // namespace armnn
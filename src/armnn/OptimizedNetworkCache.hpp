@@ -0,0 +1,54 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Graph.hpp"
+
+#include <armnn/BackendId.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/Optional.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+/// Saves optimized graphs to a directory, and loads them back, so that Optimize can skip optimizing a network it
+/// optimized before. Each graph is saved, with its backend assignments, tensor handle factories and edge strategies,
+/// in a file named after a key which hashes everything the optimized graph depends on: the version of Arm NN, the
+/// network, the preferred and the supported backends, and the optimizer options.
+///
+/// The pre-compiled objects of PreCompiled layers are saved by the backends which created them, see
+/// IBackendInternal::SerializePreCompiledObject. Networks holding a layer which cannot be saved, such as the Lstm
+/// layers or a PreCompiled layer of a backend which cannot serialize it, are not cached.
+class OptimizedNetworkCache
+{
+public:
+    explicit OptimizedNetworkCache(const std::string& directory);
+
+    /// Returns the key the optimized graph of the network is cached under, or an empty Optional if the network
+    /// cannot be cached.
+    Optional<std::string> GetKey(const Graph& graph,
+                                 const std::vector<BackendId>& backendPreferences,
+                                 const IDeviceSpec& deviceSpec,
+                                 const OptimizerOptionsOpaque& options) const;
+
+    /// Returns the optimized graph cached under the key, sharing the settings and the profiler of the network it was
+    /// optimized from. Returns nullptr if there is no such graph or if its file cannot be read.
+    std::unique_ptr<Graph> Load(const std::string& key, const Graph& inGraph) const;
+
+    /// Caches the optimized graph under the key. Returns false, leaving the cache as it was, if the graph cannot be
+    /// cached or its file cannot be written.
+    bool Save(const std::string& key, const Graph& optimizedGraph) const;
+
+private:
+    std::string GetPath(const std::string& key) const;
+
+    std::string m_Directory;
+};
+
+} // namespace armnn
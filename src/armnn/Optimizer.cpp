@@ -6,9 +6,237 @@
 #include "Observable.hpp"
 #include "optimizations/All.hpp"
 
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace armnn
 {
 
+namespace
+{
+
+/// Layers still to be visited by Optimizer::Pass, in reverse topological order.
+///
+/// The graph is only sorted once, at the start of the pass. Afterwards the worklist follows the layers added to and
+/// erased from the graph as it happens, and orders the layers by their depth (the length of the longest path to them
+/// from a layer without inputs) rather than by their position in the graph, so it never needs sorting again.
+class OptimizerWorklist
+{
+public:
+    explicit OptimizerWorklist(Graph& graph)
+        : m_AddedLayerObserver(graph, *this, GraphEvent::LayerAdded)
+        , m_ErasedLayerObserver(graph, *this, GraphEvent::LayerErased)
+    {
+        graph.TopologicalSort();
+
+        m_PendingLayers.reserve(graph.GetNumLayers());
+        m_Depths.reserve(graph.GetNumLayers());
+        for (Layer* layer : graph)
+        {
+            if (!layer)
+            {
+                throw armnn::NullPointerException("Layer must not be null.");
+            }
+            // The parents of every layer come before it, so their depths are already known.
+            m_Depths[layer] = ComputeDepth(*layer);
+            m_PendingLayers.insert(layer);
+            Push(*layer);
+        }
+    }
+
+    /// Returns the deepest layer still to be visited, or nullptr once all layers have been visited.
+    Layer* Pop()
+    {
+        while (!m_Queue.empty())
+        {
+            const Entry entry = m_Queue.top();
+            m_Queue.pop();
+
+            // Skips entries for layers which have been erased, visited, or moved deeper since they were queued.
+            auto depth = m_Depths.find(entry.m_Layer);
+            if (depth != m_Depths.end() && depth->second == entry.m_Depth && m_PendingLayers.erase(entry.m_Layer))
+            {
+                return entry.m_Layer;
+            }
+        }
+        return nullptr;
+    }
+
+    unsigned int GetDepth(const Layer& layer)
+    {
+        auto it = m_Depths.find(&layer);
+        if (it != m_Depths.end())
+        {
+            return it->second;
+        }
+
+        // New layers only connect to layers with known depths, or to other new layers.
+        const unsigned int depth = ComputeDepth(layer);
+        m_Depths[&layer] = depth;
+        return depth;
+    }
+
+    /// Recomputes the depth of a layer after an optimization may have inserted layers in front of it.
+    unsigned int UpdateDepth(const Layer& layer)
+    {
+        m_Depths.erase(&layer);
+        return GetDepth(layer);
+    }
+
+    bool WasErased(const Layer& layer) const
+    {
+        return m_ErasedLayers.count(&layer) != 0;
+    }
+
+    /// Queues the layers added since the last call which are less deep than the given limit. Deeper layers come after
+    /// the layer which was just visited, as do all the layers visited before it, so they are left alone.
+    void PushAddedLayers(unsigned int depthLimit)
+    {
+        std::vector<Layer*> addedLayers;
+        addedLayers.swap(m_AddedLayers);
+        m_ErasedLayers.clear();
+
+        for (Layer* layer : addedLayers)
+        {
+            if (GetDepth(*layer) < depthLimit)
+            {
+                m_PendingLayers.insert(layer);
+            }
+        }
+
+        for (Layer* layer : addedLayers)
+        {
+            if (m_PendingLayers.count(layer) != 0)
+            {
+                Push(*layer);
+                DeepenPendingChildren(*layer);
+            }
+        }
+    }
+
+private:
+    struct Entry
+    {
+        unsigned int m_Depth;
+        size_t m_Sequence;
+        Layer* m_Layer;
+
+        /// Deeper layers come first, then layers queued later: at the start of the pass, that is later in the
+        /// topological order.
+        bool operator<(const Entry& other) const
+        {
+            return m_Depth < other.m_Depth || (m_Depth == other.m_Depth && m_Sequence < other.m_Sequence);
+        }
+    };
+
+    class LayerObserver : public IGraphObservable
+    {
+    public:
+        LayerObserver(Graph& graph, OptimizerWorklist& worklist, GraphEvent event)
+            : m_Graph(graph), m_Worklist(worklist), m_Event(event)
+        {
+            m_Graph.AttachObservable(this, m_Event);
+        }
+
+        ~LayerObserver()
+        {
+            m_Graph.DetachObservable(this, m_Event);
+        }
+
+        void Update(Layer* graphLayer) override
+        {
+            if (m_Event == GraphEvent::LayerAdded)
+            {
+                m_Worklist.OnLayerAdded(graphLayer);
+            }
+            else
+            {
+                m_Worklist.OnLayerErased(graphLayer);
+            }
+        }
+
+    private:
+        Graph& m_Graph;
+        OptimizerWorklist& m_Worklist;
+        GraphEvent m_Event;
+    };
+
+    void OnLayerAdded(Layer* layer)
+    {
+        m_AddedLayers.push_back(layer);
+    }
+
+    void OnLayerErased(Layer* layer)
+    {
+        // Forgets everything about the layer straight away, as a layer added later may be given the same address.
+        m_PendingLayers.erase(layer);
+        m_Depths.erase(layer);
+        m_AddedLayers.erase(std::remove(m_AddedLayers.begin(), m_AddedLayers.end(), layer), m_AddedLayers.end());
+        m_ErasedLayers.insert(layer);
+    }
+
+    void Push(Layer& layer)
+    {
+        m_Queue.push({ GetDepth(layer), m_NextSequence++, &layer });
+    }
+
+    unsigned int ComputeDepth(const Layer& layer)
+    {
+        unsigned int depth = 0;
+        for (const InputSlot& inputSlot : layer.GetInputSlots())
+        {
+            const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+            if (connectedSlot != nullptr)
+            {
+                depth = std::max(depth, GetDepth(connectedSlot->GetOwningLayer()) + 1);
+            }
+        }
+        return depth;
+    }
+
+    /// Layers inserted in front of pending layers push them deeper, and they must still be visited first.
+    /// Only pending layers are updated: everything after them has been visited already.
+    void DeepenPendingChildren(const Layer& layer)
+    {
+        std::vector<const Layer*> parents{ &layer };
+        while (!parents.empty())
+        {
+            const Layer* parent = parents.back();
+            parents.pop_back();
+            const unsigned int childDepth = GetDepth(*parent) + 1;
+
+            for (const OutputSlot& outputSlot : parent->GetOutputSlots())
+            {
+                for (const InputSlot* connection : outputSlot.GetConnections())
+                {
+                    Layer& child = connection->GetOwningLayer();
+                    if (m_PendingLayers.count(&child) != 0 && GetDepth(child) < childDepth)
+                    {
+                        m_Depths[&child] = childDepth;
+                        Push(child);
+                        parents.push_back(&child);
+                    }
+                }
+            }
+        }
+    }
+
+    std::priority_queue<Entry> m_Queue;
+    size_t m_NextSequence = 0;
+    std::unordered_set<const Layer*> m_PendingLayers;
+    std::unordered_map<const Layer*, unsigned int> m_Depths;
+    std::vector<Layer*> m_AddedLayers;
+    std::unordered_set<const Layer*> m_ErasedLayers;
+
+    // Declared last so they are detached before the containers above are destroyed.
+    LayerObserver m_AddedLayerObserver;
+    LayerObserver m_ErasedLayerObserver;
+};
+
+} // anonymous namespace
+
 Optimizer::Optimizer()
 {
 }
@@ -20,28 +248,27 @@ void Optimizer::Pass(Graph& graph, const Optimizations& optimizations)
     AddedLayerObservable addedLayerObservable(graph);
     ErasedLayerNamesObservable erasedLayerNamesObservable(graph);
 
-    bool graphNeedsSorting = false;
-    auto it = graph.TopologicalSort().end();
-
-    // Calls TopologicalSort() for every iteration to re-order the list in case layers were added/removed.
-    while (it != graph.TopologicalSort().begin())
+    // Visits every layer once, from the outputs to the inputs. Layers added by an optimization are visited too when
+    // they come before the layer being optimized in topological order, so the graph never needs to be sorted again
+    // in the middle of the pass.
+    OptimizerWorklist worklist(graph);
+    while (Layer* layer = worklist.Pop())
     {
-        --it;
+        const unsigned int depth = worklist.GetDepth(*layer);
+        bool layerErased = false;
+
         for (auto&& optimization : optimizations)
         {
-            if (!*it)
+            optimization->Run(graph, *layer);
+
+            if (worklist.WasErased(*layer))
             {
-                throw armnn::NullPointerException("Layer must not be null.");
+                layerErased = true;
             }
-
-            optimization->Run(graph, **it);
-
-            if ((*it)->IsOutputUnconnected())
+            else if (layer->IsOutputUnconnected())
             {
-                auto next = std::next(graph.GetPosInGraph(**it));
-                graph.EraseLayer(it);
-                it = next;
-                graphNeedsSorting = true;
+                graph.EraseLayer(layer);
+                layerErased = true;
             }
 
             // Add the names of erased layers as related layers to the new added layers
@@ -56,13 +283,17 @@ void Optimizer::Pass(Graph& graph, const Optimizations& optimizations)
             erasedLayerNamesObservable.Clear();
             addedLayerObservable.Clear();
 
-            if (graphNeedsSorting)
+            if (layerErased)
             {
-                graphNeedsSorting = false;
                 break;
             }
         }
+
+        // A layer which replaces an erased one takes its place in topological order.
+        worklist.PushAddedLayers(layerErased ? depth + 1 : worklist.UpdateDepth(*layer));
     }
+
+    graph.TopologicalSort();
 }
 
 } // namespace armnn
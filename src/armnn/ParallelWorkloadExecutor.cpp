@@ -0,0 +1,139 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#if !defined(ARMNN_DISABLE_THREADS)
+
+#include "ParallelWorkloadExecutor.hpp"
+
+namespace armnn
+{
+
+ParallelWorkloadExecutor::ParallelWorkloadExecutor(std::vector<Node> nodes,
+                                                   unsigned int numThreads,
+                                                   size_t scratchMemorySize)
+    : m_Nodes(std::move(nodes))
+    , m_NumPendingPredecessors(m_Nodes.size())
+{
+    for (unsigned int i = 0; i < m_Nodes.size(); ++i)
+    {
+        if (m_Nodes[i].m_NumPredecessors == 0)
+        {
+            m_Roots.push_back(i);
+        }
+    }
+    m_Ready.reserve(m_Nodes.size());
+
+    for (unsigned int i = 1; i < numThreads; ++i)
+    {
+        m_ScratchArenas.emplace_back(std::make_unique<ScratchArena>(scratchMemorySize));
+        m_Threads.emplace_back(&ParallelWorkloadExecutor::RunThread, this, std::ref(*m_ScratchArenas.back()));
+    }
+}
+
+ParallelWorkloadExecutor::~ParallelWorkloadExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_Condition.notify_all();
+    for (auto& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void ParallelWorkloadExecutor::Execute(ScratchArena& scratchArena)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    for (size_t i = 0; i < m_Nodes.size(); ++i)
+    {
+        m_NumPendingPredecessors[i] = m_Nodes[i].m_NumPredecessors;
+    }
+    // Pushed in reverse so that the first root of the queue is the first to execute.
+    m_Ready.assign(m_Roots.rbegin(), m_Roots.rend());
+    m_NumFinished = 0;
+    m_Exception = nullptr;
+    m_Condition.notify_all();
+
+    while (m_NumFinished < m_Nodes.size())
+    {
+        if (m_Ready.empty())
+        {
+            m_Condition.wait(lock, [this]() { return !m_Ready.empty() || m_NumFinished == m_Nodes.size(); });
+            continue;
+        }
+        ExecuteReadyNode(lock, scratchArena);
+    }
+
+    if (m_Exception)
+    {
+        std::rethrow_exception(m_Exception);
+    }
+}
+
+void ParallelWorkloadExecutor::RunThread(ScratchArena& scratchArena)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_Condition.wait(lock, [this]() { return m_Stop || !m_Ready.empty(); });
+        if (m_Stop)
+        {
+            return;
+        }
+        ExecuteReadyNode(lock, scratchArena);
+    }
+}
+
+void ParallelWorkloadExecutor::ExecuteReadyNode(std::unique_lock<std::mutex>& lock, ScratchArena& scratchArena)
+{
+    const unsigned int index = m_Ready.back();
+    m_Ready.pop_back();
+    const Node& node = m_Nodes[index];
+
+    // After a failure the remaining workloads are only marked as finished.
+    if (!m_Exception)
+    {
+        lock.unlock();
+        std::exception_ptr exception;
+        try
+        {
+            ScratchArena::Scope scratchScope(scratchArena);
+            node.m_Workload->Execute();
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+        lock.lock();
+
+        if (exception && !m_Exception)
+        {
+            m_Exception = exception;
+        }
+    }
+
+    size_t numNewlyReady = 0;
+    for (unsigned int successor : node.m_Successors)
+    {
+        if (--m_NumPendingPredecessors[successor] == 0)
+        {
+            m_Ready.push_back(successor);
+            ++numNewlyReady;
+        }
+    }
+    ++m_NumFinished;
+
+    // The executing thread goes on with one of the workloads it made ready, the others are handed to the pool.
+    if (numNewlyReady > 1 || m_NumFinished == m_Nodes.size())
+    {
+        m_Condition.notify_all();
+    }
+}
+
+} // namespace armnn
+
+#endif
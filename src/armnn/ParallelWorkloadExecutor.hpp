@@ -0,0 +1,84 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#if !defined(ARMNN_DISABLE_THREADS)
+
+#pragma once
+
+#include <armnn/backends/IWorkload.hpp>
+
+#include <backendsCommon/ScratchArena.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// Executes the workload queue of a LoadedNetwork on a pool of threads, see INetworkProperties::m_NumExecutionThreads.
+///
+/// The workloads form a dependency graph built when the network is loaded. A workload becomes ready once all the
+/// workloads producing its inputs have executed, and ready workloads are executed by whichever thread of the pool is
+/// free, so independent branches of the network execute at the same time. The calling thread takes part in executing
+/// the workloads.
+class ParallelWorkloadExecutor
+{
+public:
+    struct Node
+    {
+        IWorkload* m_Workload;
+        /// Indices of the nodes consuming an output of this one.
+        std::vector<unsigned int> m_Successors;
+        unsigned int m_NumPredecessors;
+    };
+
+    /// Starts numThreads - 1 threads, each with a ScratchArena of scratchMemorySize bytes.
+    ParallelWorkloadExecutor(std::vector<Node> nodes, unsigned int numThreads, size_t scratchMemorySize);
+
+    /// Stops the threads of the pool.
+    ~ParallelWorkloadExecutor();
+
+    ParallelWorkloadExecutor(const ParallelWorkloadExecutor&) = delete;
+    ParallelWorkloadExecutor& operator=(const ParallelWorkloadExecutor&) = delete;
+
+    /// Executes every workload once, using the given arena for the workloads executed on the calling thread. Once a
+    /// workload throws, the workloads which have not started are skipped and the exception is rethrown after the
+    /// running ones have finished. Not thread safe.
+    void Execute(ScratchArena& scratchArena);
+
+    unsigned int GetNumThreads() const
+    {
+        return static_cast<unsigned int>(m_Threads.size()) + 1;
+    }
+
+private:
+    void RunThread(ScratchArena& scratchArena);
+
+    /// Executes the node at the back of m_Ready, unlocking the lock while the workload executes.
+    void ExecuteReadyNode(std::unique_lock<std::mutex>& lock, ScratchArena& scratchArena);
+
+    const std::vector<Node> m_Nodes;
+    std::vector<unsigned int> m_Roots;
+
+    // The state of the current inference, guarded by m_Mutex.
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::vector<unsigned int> m_NumPendingPredecessors;
+    std::vector<unsigned int> m_Ready;
+    size_t m_NumFinished = 0;
+    std::exception_ptr m_Exception;
+    bool m_Stop = false;
+
+    std::vector<std::unique_ptr<ScratchArena>> m_ScratchArenas;
+    std::vector<std::thread> m_Threads;
+};
+
+} // namespace armnn
+
+#endif
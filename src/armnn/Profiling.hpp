@@ -19,6 +19,8 @@
 #include <vector>
 #include <stack>
 #include <map>
+#include <string>
+#include <type_traits>
 
 namespace armnn
 {
@@ -149,6 +151,26 @@ public:
         }
     }
 
+    /// Takes a function returning the name of the event instead of the name, so that names built at run time are
+    /// only built when profiling is enabled.
+    template<typename NameFunction, typename... Args,
+             typename = std::enable_if_t<std::is_invocable_r_v<std::string, NameFunction&>>>
+    ScopedProfilingEvent(const BackendId& backendId,
+                         const Optional<arm::pipe::ProfilingGuid>& guid,
+                         NameFunction&& nameFunction,
+                         Args&& ... args)
+        : m_Event(nullptr)
+        , m_Profiler(ProfilerManager::GetInstance().GetProfiler())
+    {
+        if (m_Profiler && m_Profiler->IsProfilingEnabled())
+        {
+            std::vector<InstrumentPtr> instruments(0);
+            instruments.reserve(sizeof...(args)); //One allocation
+            ConstructNextInVector(instruments, std::forward<Args>(args)...);
+            m_Event = m_Profiler->BeginEvent(backendId, nameFunction(), std::move(instruments), guid);
+        }
+    }
+
     ~ScopedProfilingEvent()
     {
         if (m_Profiler && m_Event)
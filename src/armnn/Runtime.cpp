@@ -5,6 +5,7 @@
 
 #include "ArmNNProfilingServiceInitialiser.hpp"
 #include "Runtime.hpp"
+#include "ExecutionBinding.hpp"
 
 #include <ProfilingOptionsConverter.hpp>
 
@@ -120,6 +121,18 @@ Status IRuntime::EnqueueWorkload(NetworkId networkId,
                                          preImportedInputIds, preImportedOutputIds);
 }
 
+std::unique_ptr<IExecutionBinding> IRuntime::CreateExecutionBinding(NetworkId networkId,
+                                                                    const InputTensors& inputTensors,
+                                                                    const OutputTensors& outputTensors)
+{
+    return pRuntimeImpl->CreateExecutionBinding(networkId, inputTensors, outputTensors);
+}
+
+Status IRuntime::EnqueueWorkload(IExecutionBinding& executionBinding)
+{
+    return pRuntimeImpl->EnqueueWorkload(executionBinding);
+}
+
 Status IRuntime::Execute(IWorkingMemHandle& workingMemHandle,
                          const InputTensors& inputTensors,
                          const OutputTensors& outputTensors,
@@ -133,6 +146,14 @@ Status IRuntime::Execute(IWorkingMemHandle& workingMemHandle,
                                  preImportedOutputs);
 }
 
+void IRuntime::SchedulePipelined(NetworkId networkId,
+                                 const InputTensors& inputTensors,
+                                 const OutputTensors& outputTensors,
+                                 std::shared_ptr<IAsyncExecutionCallback> cb)
+{
+    pRuntimeImpl->SchedulePipelined(networkId, inputTensors, outputTensors, std::move(cb));
+}
+
 Status IRuntime::UnloadNetwork(NetworkId networkId)
 {
     return pRuntimeImpl->UnloadNetwork(networkId);
@@ -668,15 +689,7 @@ Status RuntimeImpl::EnqueueWorkload(NetworkId networkId,
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
 
-    static thread_local NetworkId lastId = networkId;
-    if (lastId != networkId)
-    {
-        LoadedNetworkFuncSafe(lastId, [](LoadedNetwork* network)
-            {
-                network->FreeWorkingMemory();
-            });
-    }
-    lastId=networkId;
+    FreeWorkingMemoryOfPreviousNetwork(networkId);
 
     auto status = loadedNetwork->EnqueueWorkload(inputTensors, outputTensors,
                                                  preImportedInputIds, preImportedOutputIds);
@@ -696,6 +709,75 @@ Status RuntimeImpl::EnqueueWorkload(NetworkId networkId,
     return status;
 }
 
+void RuntimeImpl::FreeWorkingMemoryOfPreviousNetwork(NetworkId networkId)
+{
+    static thread_local NetworkId lastId = networkId;
+    if (lastId != networkId)
+    {
+        LoadedNetworkFuncSafe(lastId, [](LoadedNetwork* network)
+            {
+                network->FreeWorkingMemory();
+            });
+    }
+    lastId=networkId;
+}
+
+std::unique_ptr<IExecutionBinding> RuntimeImpl::CreateExecutionBinding(NetworkId networkId,
+                                                                       const InputTensors& inputTensors,
+                                                                       const OutputTensors& outputTensors)
+{
+    LoadedNetwork* loadedNetwork = nullptr;
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+#endif
+        auto it = m_LoadedNetworks.find(networkId);
+        if (it == m_LoadedNetworks.end())
+        {
+            throw InvalidArgumentException("CreateExecutionBinding: A Network with an id of " +
+                                           std::to_string(networkId) + " does not exist.");
+        }
+        loadedNetwork = it->second.get();
+    }
+    ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler().get());
+
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "CreateExecutionBinding");
+
+    return loadedNetwork->CreateExecutionBinding(networkId, inputTensors, outputTensors);
+}
+
+Status RuntimeImpl::EnqueueWorkload(IExecutionBinding& iExecutionBinding)
+{
+    // Unlike EnqueueWorkload(InputTensors, ...) this path neither times nor logs a successful execution.
+    auto executionBinding = PolymorphicDowncast<experimental::ExecutionBinding*>(&iExecutionBinding);
+    NetworkId networkId = executionBinding->GetNetworkId();
+
+    LoadedNetwork* loadedNetwork = nullptr;
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+#endif
+        auto it = m_LoadedNetworks.find(networkId);
+        if (it == m_LoadedNetworks.end())
+        {
+            ARMNN_LOG(error) << "A Network with an id of " << networkId << " does not exist.";
+            return Status::Failure;
+        }
+        loadedNetwork = it->second.get();
+    }
+
+    FreeWorkingMemoryOfPreviousNetwork(networkId);
+
+    IProfiler* profiler = loadedNetwork->GetProfiler().get();
+    if (profiler->IsProfilingEnabled())
+    {
+        ProfilerManager::GetInstance().RegisterProfiler(profiler);
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
+        return loadedNetwork->EnqueueWorkload(*executionBinding);
+    }
+    return loadedNetwork->EnqueueWorkload(*executionBinding);
+}
+
 Status RuntimeImpl::Execute(IWorkingMemHandle& iWorkingMemHandle,
                             const InputTensors& inputTensors,
                             const OutputTensors& outputTensors,
@@ -733,6 +815,25 @@ Status RuntimeImpl::Execute(IWorkingMemHandle& iWorkingMemHandle,
     return status;
 }
 
+void RuntimeImpl::SchedulePipelined(NetworkId networkId,
+                                    const InputTensors& inputTensors,
+                                    const OutputTensors& outputTensors,
+                                    std::shared_ptr<IAsyncExecutionCallback> cb)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+
+    if (!loadedNetwork)
+    {
+        throw InvalidArgumentException("A Network with an id of " + std::to_string(networkId) + " does not exist.");
+    }
+    if (!loadedNetwork->IsAsyncEnabled())
+    {
+        throw InvalidArgumentException("Network " + std::to_string(networkId) + " is not async enabled.");
+    }
+
+    loadedNetwork->SchedulePipelined(networkId, inputTensors, outputTensors, std::move(cb));
+}
+
 /// Create a new unique WorkingMemHandle object. Create multiple handles if you wish to have
 /// overlapped Execution by calling this function from different threads.
 std::unique_ptr<IWorkingMemHandle> RuntimeImpl::CreateWorkingMemHandle(NetworkId networkId)
@@ -70,6 +70,13 @@ public:
                            std::vector<ImportedInputId> preImportedInputIds = {},
                            std::vector<ImportedOutputId> preImportedOutputIds = {});
 
+    std::unique_ptr<IExecutionBinding> CreateExecutionBinding(NetworkId networkId,
+                                                              const InputTensors& inputTensors,
+                                                              const OutputTensors& outputTensors);
+
+    // Evaluates network using the buffers bound by executionBinding.
+    Status EnqueueWorkload(IExecutionBinding& executionBinding);
+
     /// This is an experimental function.
     /// Evaluates a network using input in inputTensors and outputs filled into outputTensors.
     /// This function performs a thread safe execution of the network. Returns once execution is complete.
@@ -80,6 +87,13 @@ public:
                    std::vector<ImportedInputId> preImportedInputs,
                    std::vector<ImportedOutputId> preImportedOutputs);
 
+    /// This is an experimental function.
+    /// Schedules an inference of an AsyncEnabled network on its execution pipeline.
+    void SchedulePipelined(NetworkId networkId,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors,
+                           std::shared_ptr<IAsyncExecutionCallback> cb);
+
     /// Unloads a network from the Runtime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -136,6 +150,10 @@ private:
         }
     }
 
+    /// Frees the working memory of the network the calling thread last enqueued, if that is not the given network.
+    /// Both EnqueueWorkload overloads share the record of the last network.
+    void FreeWorkingMemoryOfPreviousNetwork(NetworkId networkId);
+
     /// Loads any available/compatible dynamic backend in the runtime.
     void LoadDynamicBackends(const std::string& overrideBackendPath);
 
@@ -8,15 +8,249 @@
 
 #include <armnn/utility/Timer.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <limits>
+
 namespace armnn
 {
 namespace experimental
 {
 
+namespace
+{
+
+// Capacity of each worker's queue per priority, must be a power of two. Requests that do not fit in any worker's
+// queue go to a locked overflow queue.
+constexpr std::size_t RequestQueueCapacity = 256;
+
+constexpr std::size_t NumPriorities = 3;
+
+// Number of times an idle worker looks for work before it goes to sleep.
+constexpr unsigned int IdleSpinsBeforeSleep = 64;
+
+// Cache line size used to keep the queue indices of different producers and consumers apart.
+constexpr std::size_t CacheLineSize = 64;
+
+std::size_t GetPriorityIndex(QosExecPriority priority)
+{
+    switch (priority)
+    {
+        case QosExecPriority::High:
+            return 0;
+        case QosExecPriority::Low:
+            return 2;
+        case QosExecPriority::Medium:
+        default:
+            return 1;
+    }
+}
+
+} // anonymous namespace
+
+struct Threadpool::ExecutionRequest
+{
+    NetworkId m_NetworkId = 0;
+    InputTensors m_InputTensors;
+    OutputTensors m_OutputTensors;
+    std::shared_ptr<IAsyncExecutionCallback> m_Callback;
+    // Set for the ticket of a batch: the requests themselves wait in the network's BatchCollector.
+    bool m_IsBatch = false;
+};
+
+struct Threadpool::BatchCollector
+{
+    NetworkId m_NetworkId;
+    NetworkId m_BatchedNetworkId;
+    unsigned int m_MaxBatchSize;
+    std::chrono::microseconds m_BatchWindow;
+
+    std::mutex m_Mutex;
+    // The requests waiting to be batched. Only the first m_NumPending are in use, the rest keep their capacity.
+    std::vector<ExecutionRequest> m_Pending;
+    std::size_t m_NumPending = 0;
+    // Whether a ticket for the pending requests is in the queues or being processed. Until then the pending requests
+    // are in RequestQueues::m_WaitingBatches.
+    bool m_TicketScheduled = false;
+    QosExecPriority m_TicketPriority = QosExecPriority::Medium;
+};
+
+// Staging memory a worker reuses to gather the inputs and scatter the outputs of a batch.
+struct Threadpool::BatchBuffers
+{
+    std::vector<std::vector<uint8_t>> m_Inputs;
+    std::vector<std::vector<uint8_t>> m_Outputs;
+    InputTensors m_InputTensors;
+    OutputTensors m_OutputTensors;
+};
+
+namespace
+{
+
+// Bounded multi-producer multi-consumer queue after Dmitry Vyukov's design: every slot carries a sequence number
+// that tells producers and consumers whether it is free or filled, so pushes and pops only need one compare and
+// swap on the queue index. The slots own their requests, so the tensor vectors keep their capacity from one
+// request to the next and scheduling does not allocate once the queue has warmed up.
+template<typename Request>
+class RequestQueue
+{
+public:
+    RequestQueue()
+        : m_Slots(RequestQueueCapacity)
+    {
+        for (std::size_t i = 0; i < RequestQueueCapacity; ++i)
+        {
+            m_Slots[i].m_Sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(NetworkId networkId,
+                 const InputTensors& inputTensors,
+                 const OutputTensors& outputTensors,
+                 const std::shared_ptr<IAsyncExecutionCallback>& cb,
+                 bool isBatch)
+    {
+        std::size_t position = m_EnqueuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_Slots[position & (RequestQueueCapacity - 1)];
+            const std::size_t sequence = slot.m_Sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0)
+            {
+                if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.m_Request.m_NetworkId = networkId;
+                    slot.m_Request.m_InputTensors.assign(inputTensors.begin(), inputTensors.end());
+                    slot.m_Request.m_OutputTensors.assign(outputTensors.begin(), outputTensors.end());
+                    slot.m_Request.m_Callback = cb;
+                    slot.m_Request.m_IsBatch = isBatch;
+                    slot.m_Sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // Full
+            }
+            else
+            {
+                position = m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Swaps the contents of the oldest request into request, handing request's vectors to the slot for reuse.
+    bool TryPop(Request& request)
+    {
+        std::size_t position = m_DequeuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = m_Slots[position & (RequestQueueCapacity - 1)];
+            const std::size_t sequence = slot.m_Sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0)
+            {
+                if (m_DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    request.m_NetworkId = slot.m_Request.m_NetworkId;
+                    request.m_InputTensors.swap(slot.m_Request.m_InputTensors);
+                    request.m_OutputTensors.swap(slot.m_Request.m_OutputTensors);
+                    request.m_Callback = std::move(slot.m_Request.m_Callback);
+                    request.m_IsBatch = slot.m_Request.m_IsBatch;
+                    slot.m_Sequence.store(position + RequestQueueCapacity, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // Empty
+            }
+            else
+            {
+                position = m_DequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct alignas(CacheLineSize) Slot
+    {
+        std::atomic<std::size_t> m_Sequence;
+        Request m_Request;
+    };
+
+    std::vector<Slot> m_Slots;
+    alignas(CacheLineSize) std::atomic<std::size_t> m_EnqueuePosition{0};
+    alignas(CacheLineSize) std::atomic<std::size_t> m_DequeuePosition{0};
+};
+
+} // anonymous namespace
+
+struct Threadpool::RequestQueues
+{
+    explicit RequestQueues(std::size_t numThreads)
+    {
+        for (std::size_t i = 0; i < numThreads; ++i)
+        {
+            m_WorkerQueues.emplace_back(std::make_unique<WorkerQueues>());
+        }
+    }
+
+    struct WorkerQueues
+    {
+        RequestQueue<ExecutionRequest> m_Queues[NumPriorities];
+    };
+
+    std::vector<std::unique_ptr<WorkerQueues>> m_WorkerQueues;
+
+    // Round robin counter used to spread the scheduled requests over the workers' queues.
+    std::atomic<std::size_t> m_NextWorker{0};
+
+    // Requests that did not fit in any worker's queue.
+    std::mutex m_OverflowMutex;
+    std::deque<ExecutionRequest> m_Overflow[NumPriorities];
+    std::atomic<std::size_t> m_OverflowSize{0};
+
+    // Networks with batching enabled. The workers hold on to a collector while they execute one of its batches.
+    std::mutex m_BatchCollectorsMutex;
+    std::unordered_map<NetworkId, std::shared_ptr<BatchCollector>> m_BatchCollectors;
+
+    // Batches waiting for their window to expire. They have no ticket in the queues yet, so they do not hold a
+    // worker: the workers schedule the tickets of the batches which are due, and Schedule() those of full batches.
+    struct WaitingBatch
+    {
+        HighResolutionClock m_Deadline;
+        std::shared_ptr<BatchCollector> m_Collector;
+    };
+    std::mutex m_WaitingBatchesMutex;
+    std::vector<WaitingBatch> m_WaitingBatches;
+    // Copies of the size and earliest deadline of m_WaitingBatches, which the workers check without locking.
+    std::atomic<std::size_t> m_NumWaitingBatches{0};
+    std::atomic<HighResolutionClock::rep> m_NextBatchDeadline{std::numeric_limits<HighResolutionClock::rep>::max()};
+    // Incremented whenever a batch starts waiting, so that a sleeping worker wakes up and waits for its deadline.
+    std::atomic<std::size_t> m_WaitingBatchesEpoch{0};
+
+    /// Must be called with m_WaitingBatchesMutex held.
+    void UpdateWaitingBatches()
+    {
+        HighResolutionClock::rep nextDeadline = std::numeric_limits<HighResolutionClock::rep>::max();
+        for (const WaitingBatch& waitingBatch : m_WaitingBatches)
+        {
+            nextDeadline = std::min(nextDeadline, waitingBatch.m_Deadline.time_since_epoch().count());
+        }
+        m_NextBatchDeadline.store(nextDeadline);
+        m_NumWaitingBatches.store(m_WaitingBatches.size());
+    }
+};
+
 Threadpool::Threadpool(std::size_t numThreads,
                        IRuntime* runtimePtr,
                        std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles)
     : m_RuntimePtr(runtimePtr)
+    , m_RequestQueues(std::make_unique<RequestQueues>(numThreads))
 {
     for (auto i = 0u; i < numThreads; ++i)
     {
@@ -64,6 +298,50 @@ void Threadpool::UnloadMemHandles(NetworkId networkId)
     {
        throw armnn::RuntimeException("Threadpool::UnloadMemHandles: Unknown NetworkId");
     }
+
+    std::vector<std::shared_ptr<BatchCollector>> removedCollectors;
+    {
+        std::lock_guard<std::mutex> lock(m_RequestQueues->m_BatchCollectorsMutex);
+        auto& collectors = m_RequestQueues->m_BatchCollectors;
+        for (auto it = collectors.begin(); it != collectors.end();)
+        {
+            if (it->first == networkId || it->second->m_BatchedNetworkId == networkId)
+            {
+                removedCollectors.push_back(std::move(it->second));
+                it = collectors.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    // A worker already holding the ticket of a removed collector finds no pending request and skips it.
+    for (auto& collector : removedCollectors)
+    {
+        std::lock_guard<std::mutex> lock(collector->m_Mutex);
+        for (std::size_t i = 0; i < collector->m_NumPending; ++i)
+        {
+            HighResolutionClock now = armnn::GetTimeNow();
+            collector->m_Pending[i].m_Callback->Notify(Status::Failure, std::make_pair(now, now));
+            collector->m_Pending[i].m_Callback.reset();
+        }
+        collector->m_NumPending = 0;
+        collector->m_TicketScheduled = false;
+        RemoveWaitingBatch(*collector);
+    }
+}
+
+std::shared_ptr<Threadpool::BatchCollector> Threadpool::FindBatchCollector(NetworkId networkId)
+{
+    std::lock_guard<std::mutex> lock(m_RequestQueues->m_BatchCollectorsMutex);
+    auto collector = m_RequestQueues->m_BatchCollectors.find(networkId);
+    if (collector == m_RequestQueues->m_BatchCollectors.end())
+    {
+        return nullptr;
+    }
+    return collector->second;
 }
 
 void Threadpool::Schedule(NetworkId networkId,
@@ -77,129 +355,579 @@ void Threadpool::Schedule(NetworkId networkId,
         throw armnn::RuntimeException("Threadpool::UnloadMemHandles: Unknown NetworkId");
     }
 
-    // Group execution parameters so that they can be easily added to the queue
-    ExecutionTuple groupExecParams = std::make_tuple(networkId, inputTensors, outputTensors, cb);
+    std::shared_ptr<BatchCollector> collector = FindBatchCollector(networkId);
+    if (!collector)
+    {
+        Enqueue(networkId, inputTensors, outputTensors, priority, cb, false);
+        return;
+    }
 
-    std::shared_ptr<ExecutionTuple> operation = std::make_shared<ExecutionTuple>(groupExecParams);
+    // Add the request to the pending batch. The first request of a batch starts its window, the request filling it
+    // schedules its ticket straight away.
+    BatchCollector& batch = *collector;
+    bool scheduleTicket = false;
+    QosExecPriority ticketPriority = priority;
+    {
+        std::lock_guard<std::mutex> lock(batch.m_Mutex);
+        if (batch.m_NumPending == batch.m_Pending.size())
+        {
+            batch.m_Pending.emplace_back();
+        }
+        ExecutionRequest& request = batch.m_Pending[batch.m_NumPending++];
+        request.m_NetworkId = networkId;
+        request.m_InputTensors.assign(inputTensors.begin(), inputTensors.end());
+        request.m_OutputTensors.assign(outputTensors.begin(), outputTensors.end());
+        request.m_Callback = cb;
 
-    // Add a message to the queue and notify the request thread
-    std::unique_lock<std::mutex> lock(m_ThreadPoolMutex);
-    switch (priority)
+        if (!batch.m_TicketScheduled)
+        {
+            if (batch.m_NumPending == 1)
+            {
+                batch.m_TicketPriority = priority;
+            }
+            if (batch.m_NumPending >= batch.m_MaxBatchSize)
+            {
+                batch.m_TicketScheduled = true;
+                ticketPriority = batch.m_TicketPriority;
+                scheduleTicket = true;
+                RemoveWaitingBatch(batch);
+            }
+            else if (batch.m_NumPending == 1)
+            {
+                AddWaitingBatch(collector);
+            }
+        }
+    }
+
+    if (scheduleTicket)
     {
-        case QosExecPriority::High:
-            m_HighPriorityQueue.push(operation);
-            break;
-        case QosExecPriority::Low:
-            m_LowPriorityQueue.push(operation);
-            break;
-        case QosExecPriority::Medium:
-        default:
-            m_MediumPriorityQueue.push(operation);
+        Enqueue(networkId, {}, {}, ticketPriority, nullptr, true);
+    }
+}
+
+void Threadpool::AddWaitingBatch(const std::shared_ptr<BatchCollector>& collector)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_RequestQueues->m_WaitingBatchesMutex);
+        m_RequestQueues->m_WaitingBatches.push_back({ armnn::GetTimeNow() + collector->m_BatchWindow, collector });
+        m_RequestQueues->UpdateWaitingBatches();
+    }
+    m_RequestQueues->m_WaitingBatchesEpoch.fetch_add(1);
+
+    // A worker sleeping without a deadline has to wake up to wait for this one. As in Enqueue(), either it sees the
+    // new epoch or this sees the sleeping worker.
+    if (m_SleepingThreads.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_ThreadPoolMutex);
+        m_ThreadPoolEvent.notify_one();
+    }
+}
+
+void Threadpool::RemoveWaitingBatch(const BatchCollector& collector)
+{
+    std::lock_guard<std::mutex> lock(m_RequestQueues->m_WaitingBatchesMutex);
+    auto& waitingBatches = m_RequestQueues->m_WaitingBatches;
+    waitingBatches.erase(std::remove_if(waitingBatches.begin(), waitingBatches.end(),
+                                        [&collector](const RequestQueues::WaitingBatch& waitingBatch)
+                                        {
+                                            return waitingBatch.m_Collector.get() == &collector;
+                                        }),
+                         waitingBatches.end());
+    m_RequestQueues->UpdateWaitingBatches();
+}
+
+bool Threadpool::DispatchDueBatches(bool dispatchAll, std::vector<std::shared_ptr<BatchCollector>>& dueBatches)
+{
+    if (m_RequestQueues->m_NumWaitingBatches.load() == 0)
+    {
+        return false;
+    }
+    const HighResolutionClock now = armnn::GetTimeNow();
+    if (!dispatchAll && now.time_since_epoch().count() < m_RequestQueues->m_NextBatchDeadline.load())
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_RequestQueues->m_WaitingBatchesMutex);
+        auto& waitingBatches = m_RequestQueues->m_WaitingBatches;
+        for (auto it = waitingBatches.begin(); it != waitingBatches.end();)
+        {
+            if (dispatchAll || it->m_Deadline <= now)
+            {
+                dueBatches.push_back(std::move(it->m_Collector));
+                it = waitingBatches.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        m_RequestQueues->UpdateWaitingBatches();
+    }
+
+    bool dispatched = false;
+    for (auto& collector : dueBatches)
+    {
+        QosExecPriority ticketPriority;
+        {
+            std::lock_guard<std::mutex> lock(collector->m_Mutex);
+            // The batch filled up or batching was disabled since it was taken off the list.
+            if (collector->m_TicketScheduled || collector->m_NumPending == 0)
+            {
+                continue;
+            }
+            collector->m_TicketScheduled = true;
+            ticketPriority = collector->m_TicketPriority;
+        }
+        Enqueue(collector->m_NetworkId, {}, {}, ticketPriority, nullptr, true);
+        dispatched = true;
     }
-    m_ThreadPoolEvent.notify_one();
+    dueBatches.clear();
+    return dispatched;
+}
+
+void Threadpool::EnableBatching(NetworkId networkId,
+                                NetworkId batchedNetworkId,
+                                unsigned int maxBatchSize,
+                                std::chrono::microseconds batchWindow)
+{
+    if (maxBatchSize < 2)
+    {
+        throw armnn::InvalidArgumentException("Threadpool::EnableBatching: maxBatchSize must be at least 2");
+    }
+    if (m_WorkingMemHandleMap.find(networkId) == m_WorkingMemHandleMap.end() ||
+        m_WorkingMemHandleMap.find(batchedNetworkId) == m_WorkingMemHandleMap.end())
+    {
+        throw armnn::RuntimeException("Threadpool::EnableBatching: Unknown NetworkId");
+    }
+
+    auto collector = std::make_shared<BatchCollector>();
+    collector->m_NetworkId = networkId;
+    collector->m_BatchedNetworkId = batchedNetworkId;
+    collector->m_MaxBatchSize = maxBatchSize;
+    collector->m_BatchWindow = batchWindow;
+    collector->m_Pending.resize(maxBatchSize);
+    std::lock_guard<std::mutex> lock(m_RequestQueues->m_BatchCollectorsMutex);
+    m_RequestQueues->m_BatchCollectors[networkId] = std::move(collector);
+}
+
+void Threadpool::Enqueue(NetworkId networkId,
+                         const InputTensors& inputTensors,
+                         const OutputTensors& outputTensors,
+                         QosExecPriority priority,
+                         const std::shared_ptr<IAsyncExecutionCallback>& cb,
+                         bool isBatch)
+{
+    const std::size_t priorityIndex = GetPriorityIndex(priority);
+
+    // Counted before the push so that a worker taking the request never sees the count drop below zero.
+    m_PendingRequests.fetch_add(1);
+
+    auto& workerQueues = m_RequestQueues->m_WorkerQueues;
+    const std::size_t firstWorker = m_RequestQueues->m_NextWorker.fetch_add(1, std::memory_order_relaxed);
+    bool pushed = false;
+    for (std::size_t i = 0; i < workerQueues.size() && !pushed; ++i)
+    {
+        auto& queue = workerQueues[(firstWorker + i) % workerQueues.size()]->m_Queues[priorityIndex];
+        pushed = queue.TryPush(networkId, inputTensors, outputTensors, cb, isBatch);
+    }
+
+    if (!pushed)
+    {
+        std::lock_guard<std::mutex> lock(m_RequestQueues->m_OverflowMutex);
+        m_RequestQueues->m_Overflow[priorityIndex].push_back({networkId, inputTensors, outputTensors, cb, isBatch});
+        m_RequestQueues->m_OverflowSize.fetch_add(1);
+    }
+
+    // Wake up a sleeping worker. A worker going to sleep checks m_PendingRequests after announcing itself in
+    // m_SleepingThreads, so either it sees the new request or this sees the sleeping worker.
+    if (m_SleepingThreads.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_ThreadPoolMutex);
+        m_ThreadPoolEvent.notify_one();
+    }
+}
+
+Threadpool::~Threadpool()
+{
+    TerminateThreadPool();
 }
 
 void Threadpool::TerminateThreadPool() noexcept
 {
     {
         std::unique_lock<std::mutex> threadPoolLock(m_ThreadPoolMutex);
-        m_TerminatePool = true;
+        m_TerminatePool.store(true);
     }
 
     m_ThreadPoolEvent.notify_all();
 
     for (auto &thread : m_Threads)
     {
-        thread->join();
+        if (thread->joinable())
+        {
+            thread->join();
+        }
     }
 }
 
+bool Threadpool::TryTakeRequest(uint32_t index, QosExecPriority priority, ExecutionRequest& request)
+{
+    const std::size_t priorityIndex = GetPriorityIndex(priority);
+    auto& workerQueues = m_RequestQueues->m_WorkerQueues;
+
+    // The worker's own queue first, then steal from the other workers.
+    for (std::size_t i = 0; i < workerQueues.size(); ++i)
+    {
+        if (workerQueues[(index + i) % workerQueues.size()]->m_Queues[priorityIndex].TryPop(request))
+        {
+            m_PendingRequests.fetch_sub(1);
+            return true;
+        }
+    }
+
+    if (m_RequestQueues->m_OverflowSize.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_RequestQueues->m_OverflowMutex);
+        auto& overflow = m_RequestQueues->m_Overflow[priorityIndex];
+        if (!overflow.empty())
+        {
+            request = std::move(overflow.front());
+            overflow.pop_front();
+            m_RequestQueues->m_OverflowSize.fetch_sub(1);
+            m_PendingRequests.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
 void Threadpool::ProcessExecPriorities(uint32_t index)
 {
     int expireRate = EXPIRE_RATE;
     int highPriorityCount = 0;
     int mediumPriorityCount = 0;
+    unsigned int idleSpins = 0;
+
+    // Reused for every request so that its tensor vectors keep their capacity.
+    ExecutionRequest request;
+    std::vector<ExecutionRequest> batch;
+    BatchBuffers batchBuffers;
+    std::vector<std::shared_ptr<BatchCollector>> dueBatches;
 
     while (true)
     {
-        std::shared_ptr<ExecutionTuple> currentExecInProgress(nullptr);
+        // Schedule the tickets of the batches whose window has expired, so they are picked up below.
+        DispatchDueBatches(false, dueBatches);
+
+        // Get high priority first if it does not exceed the expire rate
+        bool found = false;
+        if (highPriorityCount < expireRate && TryTakeRequest(index, QosExecPriority::High, request))
+        {
+            found = true;
+            highPriorityCount += 1;
+        }
+        // If there is no high priority request or the count exceeds the expire rate, get a medium priority one
+        else if (mediumPriorityCount < expireRate && TryTakeRequest(index, QosExecPriority::Medium, request))
+        {
+            found = true;
+            mediumPriorityCount += 1;
+            // Reset high priority count
+            highPriorityCount = 0;
+        }
+        // If there is no medium priority request or the count exceeds the expire rate, get a low priority one
+        else if (TryTakeRequest(index, QosExecPriority::Low, request))
         {
-            // Wait for a message to be added to the queue
-            // This is in a separate scope to minimise the lifetime of the lock
+            found = true;
+            // Reset high and medium priority count
+            highPriorityCount = 0;
+            mediumPriorityCount = 0;
+        }
+        else
+        {
+            // Reset high and medium priority count
+            highPriorityCount = 0;
+            mediumPriorityCount = 0;
+        }
+
+        if (!found)
+        {
+            if (m_PendingRequests.load() > 0)
+            {
+                // A request is being pushed or was skipped because of the expire rate, look again.
+                std::this_thread::yield();
+                continue;
+            }
+            if (m_TerminatePool.load())
+            {
+                // Requests still waiting for their batch are executed rather than dropped.
+                if (DispatchDueBatches(true, dueBatches))
+                {
+                    continue;
+                }
+                break;
+            }
+            if (++idleSpins < IdleSpinsBeforeSleep)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Wait for a request to be scheduled, or for the window of a waiting batch to expire
             std::unique_lock<std::mutex> lock(m_ThreadPoolMutex);
+            m_SleepingThreads.fetch_add(1);
+            const std::size_t waitingBatchesEpoch = m_RequestQueues->m_WaitingBatchesEpoch.load();
+            auto wakeUp = [this, waitingBatchesEpoch]
+            {
+                return m_TerminatePool.load() || m_PendingRequests.load() > 0 ||
+                       m_RequestQueues->m_WaitingBatchesEpoch.load() != waitingBatchesEpoch;
+            };
+            if (m_RequestQueues->m_NumWaitingBatches.load() > 0)
+            {
+                const HighResolutionClock nextDeadline(
+                    HighResolutionClock::duration(m_RequestQueues->m_NextBatchDeadline.load()));
+                m_ThreadPoolEvent.wait_until(lock, nextDeadline, wakeUp);
+            }
+            else
+            {
+                m_ThreadPoolEvent.wait(lock, wakeUp);
+            }
+            m_SleepingThreads.fetch_sub(1);
+            idleSpins = 0;
+            continue;
+        }
+        idleSpins = 0;
+
+        if (!request.m_IsBatch)
+        {
+            ExecuteRequest(index, request);
+            // Do not keep the callback alive until the next request.
+            request.m_Callback.reset();
+            continue;
+        }
 
-            m_ThreadPoolEvent.wait(lock,
-                                   [=]
-                                   {
-                                       return m_TerminatePool || !m_HighPriorityQueue.empty() ||
-                                              !m_MediumPriorityQueue.empty() || !m_LowPriorityQueue.empty();
-                                   });
+        // Batching was disabled since the ticket was scheduled, its requests have been notified already.
+        std::shared_ptr<BatchCollector> collectorPtr = FindBatchCollector(request.m_NetworkId);
+        if (!collectorPtr)
+        {
+            continue;
+        }
 
-            if (m_TerminatePool && m_HighPriorityQueue.empty() && m_MediumPriorityQueue.empty() &&
-                m_LowPriorityQueue.empty())
+        // The batch is full or its window has expired, take up to m_MaxBatchSize requests.
+        BatchCollector& collector = *collectorPtr;
+        bool scheduleTicket = false;
+        QosExecPriority ticketPriority = QosExecPriority::Medium;
+        {
+            std::lock_guard<std::mutex> lock(collector.m_Mutex);
+            const std::size_t batchSize = std::min<std::size_t>(collector.m_NumPending, collector.m_MaxBatchSize);
+            batch.resize(batchSize);
+            for (std::size_t i = 0; i < batchSize; ++i)
             {
-                break;
+                std::swap(batch[i], collector.m_Pending[i]);
+            }
+            // Requests beyond the batch move to the front and form the next batch, which waits for a window of its
+            // own unless it is full already.
+            for (std::size_t i = batchSize; i < collector.m_NumPending; ++i)
+            {
+                std::swap(collector.m_Pending[i - batchSize], collector.m_Pending[i]);
             }
+            collector.m_NumPending -= batchSize;
 
-            // Get the message to process from the front of each queue based on priority from high to low
-            // Get high priority first if it does not exceed the expire rate
-            if (!m_HighPriorityQueue.empty() && highPriorityCount < expireRate)
+            if (collector.m_NumPending >= collector.m_MaxBatchSize)
             {
-                currentExecInProgress = m_HighPriorityQueue.front();
-                m_HighPriorityQueue.pop();
-                highPriorityCount += 1;
+                ticketPriority = collector.m_TicketPriority;
+                scheduleTicket = true;
             }
-                // If high priority queue is empty or the count exceeds the expire rate, get medium priority message
-            else if (!m_MediumPriorityQueue.empty() && mediumPriorityCount < expireRate)
+            else
             {
-                currentExecInProgress = m_MediumPriorityQueue.front();
-                m_MediumPriorityQueue.pop();
-                mediumPriorityCount += 1;
-                // Reset high priority count
-                highPriorityCount = 0;
+                collector.m_TicketScheduled = false;
+                if (collector.m_NumPending > 0)
+                {
+                    AddWaitingBatch(collectorPtr);
+                }
             }
-                // If medium priority queue is empty or the count exceeds the expire rate, get low priority message
-            else if (!m_LowPriorityQueue.empty())
+        }
+        if (scheduleTicket)
+        {
+            Enqueue(request.m_NetworkId, {}, {}, ticketPriority, nullptr, true);
+        }
+        if (batch.empty())
+        {
+            continue;
+        }
+
+        ExecuteBatch(index, collector, batch, batchBuffers);
+        for (auto& batchRequest : batch)
+        {
+            batchRequest.m_Callback.reset();
+        }
+    }
+}
+
+void Threadpool::ExecuteRequest(uint32_t index, const ExecutionRequest& request)
+{
+    // Get time at start of inference
+    HighResolutionClock startTime = armnn::GetTimeNow();
+
+    try // executing the inference
+    {
+        IWorkingMemHandle& memHandle = *(m_WorkingMemHandleMap.at(request.m_NetworkId))[index];
+ARMNN_NO_DEPRECATE_WARN_BEGIN
+        // Execute and populate the time at end of inference in the callback
+        m_RuntimePtr->Execute(memHandle, request.m_InputTensors, request.m_OutputTensors) == Status::Success ?
+        request.m_Callback->Notify(Status::Success, std::make_pair(startTime, armnn::GetTimeNow())) :
+        request.m_Callback->Notify(Status::Failure, std::make_pair(startTime, armnn::GetTimeNow()));
+ARMNN_NO_DEPRECATE_WARN_END
+    }
+    catch (const RuntimeException&)
+    {
+        request.m_Callback->Notify(Status::Failure, std::make_pair(startTime, armnn::GetTimeNow()));
+    }
+}
+
+void Threadpool::ExecuteBatch(uint32_t index,
+                              BatchCollector& collector,
+                              std::vector<ExecutionRequest>& batch,
+                              BatchBuffers& buffers)
+{
+    if (batch.size() == 1)
+    {
+        ExecuteRequest(index, batch[0]);
+        return;
+    }
+
+    HighResolutionClock startTime = armnn::GetTimeNow();
+    const NetworkId batchedNetworkId = collector.m_BatchedNetworkId;
+
+    // Returns the memory of each request's tensor with the given binding id, or an empty vector if a request
+    // does not bind it or does not hold exactly one batch row of the batched tensor.
+    auto getRows = [&batch, &collector](LayerBindingId bindingId, unsigned int batchedNumBytes, bool isInput)
+    {
+        std::vector<void*> rows;
+        for (const auto& request : batch)
+        {
+            void* memory = nullptr;
+            unsigned int numBytes = 0;
+            if (isInput)
             {
-                currentExecInProgress = m_LowPriorityQueue.front();
-                m_LowPriorityQueue.pop();
-                // Reset high and medium priority count
-                highPriorityCount = 0;
-                mediumPriorityCount = 0;
+                for (const auto& input : request.m_InputTensors)
+                {
+                    if (input.first == bindingId)
+                    {
+                        memory = const_cast<void*>(input.second.GetMemoryArea());
+                        numBytes = input.second.GetNumBytes();
+                    }
+                }
             }
             else
             {
-                // Reset high and medium priority count
-                highPriorityCount = 0;
-                mediumPriorityCount = 0;
-                continue;
+                for (const auto& output : request.m_OutputTensors)
+                {
+                    if (output.first == bindingId)
+                    {
+                        memory = output.second.GetMemoryArea();
+                        numBytes = output.second.GetNumBytes();
+                    }
+                }
+            }
+            if (!memory || numBytes * collector.m_MaxBatchSize != batchedNumBytes)
+            {
+                return std::vector<void*>();
             }
+            rows.push_back(memory);
         }
+        return rows;
+    };
+
+    bool batchable = true;
+    try
+    {
+        const ExecutionRequest& first = batch[0];
+        buffers.m_InputTensors.clear();
+        buffers.m_OutputTensors.clear();
+        buffers.m_Inputs.resize(std::max(buffers.m_Inputs.size(), first.m_InputTensors.size()));
+        buffers.m_Outputs.resize(std::max(buffers.m_Outputs.size(), first.m_OutputTensors.size()));
 
-        // invoke the asynchronous execution method
-        auto networkId = std::get<0>(*currentExecInProgress);
-        auto inputTensors = std::get<1>(*currentExecInProgress);
-        auto outputTensors = std::get<2>(*currentExecInProgress);
-        auto cb = std::get<3>(*currentExecInProgress);
+        // Gather the inputs into the batched tensors.
+        for (std::size_t i = 0; i < first.m_InputTensors.size() && batchable; ++i)
+        {
+            const LayerBindingId bindingId = first.m_InputTensors[i].first;
+            TensorInfo info = m_RuntimePtr->GetInputTensorInfo(batchedNetworkId, bindingId);
+            info.SetConstant(true);
+            const std::vector<void*> rows = getRows(bindingId, info.GetNumBytes(), true);
+            batchable = !rows.empty();
 
-        // Get time at start of inference
-        HighResolutionClock startTime = armnn::GetTimeNow();
+            const std::size_t rowBytes = info.GetNumBytes() / collector.m_MaxBatchSize;
+            std::vector<uint8_t>& staging = buffers.m_Inputs[i];
+            staging.resize(info.GetNumBytes());
+            for (std::size_t row = 0; row < rows.size(); ++row)
+            {
+                std::memcpy(staging.data() + row * rowBytes, rows[row], rowBytes);
+            }
+            // The staging memory still holds the rows of earlier batches.
+            std::fill(staging.begin() + static_cast<std::ptrdiff_t>(rows.size() * rowBytes), staging.end(), 0);
+            buffers.m_InputTensors.emplace_back(bindingId, ConstTensor(info, staging.data()));
+        }
+
+        for (std::size_t i = 0; i < first.m_OutputTensors.size() && batchable; ++i)
+        {
+            const LayerBindingId bindingId = first.m_OutputTensors[i].first;
+            const TensorInfo info = m_RuntimePtr->GetOutputTensorInfo(batchedNetworkId, bindingId);
+            batchable = !getRows(bindingId, info.GetNumBytes(), false).empty();
+            buffers.m_Outputs[i].resize(info.GetNumBytes());
+            buffers.m_OutputTensors.emplace_back(bindingId, Tensor(info, buffers.m_Outputs[i].data()));
+        }
+    }
+    catch (const InvalidArgumentException&)
+    {
+        // A binding id the batched network does not have.
+        batchable = false;
+    }
 
-        try // executing the inference
+    if (!batchable)
+    {
+        // The requests do not match the batched network, so run them one by one.
+        for (const auto& request : batch)
         {
-            IWorkingMemHandle& memHandle = *(m_WorkingMemHandleMap.at(networkId))[index];
+            ExecuteRequest(index, request);
+        }
+        return;
+    }
+
+    Status status = Status::Failure;
+    try
+    {
+        IWorkingMemHandle& memHandle = *(m_WorkingMemHandleMap.at(batchedNetworkId))[index];
 ARMNN_NO_DEPRECATE_WARN_BEGIN
-            // Execute and populate the time at end of inference in the callback
-            m_RuntimePtr->Execute(memHandle, inputTensors, outputTensors) == Status::Success ?
-            cb->Notify(Status::Success, std::make_pair(startTime, armnn::GetTimeNow())) :
-            cb->Notify(Status::Failure, std::make_pair(startTime, armnn::GetTimeNow()));
+        status = m_RuntimePtr->Execute(memHandle, buffers.m_InputTensors, buffers.m_OutputTensors);
 ARMNN_NO_DEPRECATE_WARN_END
-        }
-        catch (const RuntimeException&)
+    }
+    catch (const RuntimeException&)
+    {
+        status = Status::Failure;
+    }
+
+    // Scatter the outputs back to the requests.
+    if (status == Status::Success)
+    {
+        for (std::size_t i = 0; i < buffers.m_OutputTensors.size(); ++i)
         {
-            cb->Notify(Status::Failure, std::make_pair(startTime, armnn::GetTimeNow()));
+            const Tensor& output = buffers.m_OutputTensors[i].second;
+            const std::vector<void*> rows = getRows(buffers.m_OutputTensors[i].first, output.GetNumBytes(), false);
+            const std::size_t rowBytes = output.GetNumBytes() / collector.m_MaxBatchSize;
+            for (std::size_t row = 0; row < rows.size(); ++row)
+            {
+                std::memcpy(rows[row], buffers.m_Outputs[i].data() + row * rowBytes, rowBytes);
+            }
         }
     }
+
+    const HighResolutionClock endTime = armnn::GetTimeNow();
+    for (const auto& request : batch)
+    {
+        request.m_Callback->Notify(status, std::make_pair(startTime, endTime));
+    }
 }
 
 } // namespace experimental
@@ -24,7 +24,8 @@ WorkingMemHandle::WorkingMemHandle(NetworkId networkId,
         std::vector<std::unique_ptr<ITensorHandle>> managedTensorHandles,
         std::vector<std::unique_ptr<ITensorHandle>> unmanagedTensorHandles,
         std::vector<std::pair<BackendId, ExecutionData>> executionDataVec,
-        BackendPtrMap* backends)
+        BackendPtrMap* backends,
+        size_t scratchMemorySize)
     : m_NetworkId(networkId)
     , m_WorkingMemDescriptors(workingMemDescriptors)
     , m_MemoryManager(std::move(memoryManager))
@@ -35,6 +36,7 @@ WorkingMemHandle::WorkingMemHandle(NetworkId networkId,
     , m_IsAllocated(false)
     , m_ExecutionDataVec(executionDataVec)
     , m_Backends(backends)
+    , m_ScratchMemorySize(scratchMemorySize)
 {
     for (const auto& inputInfo : inputLayerInfo)
     {
@@ -106,6 +108,7 @@ void WorkingMemHandle::Allocate()
     m_IsAllocated = true;
 
     m_MemoryManager->Allocate();
+    m_ScratchArena.Reserve(m_ScratchMemorySize);
 
     for (unsigned int i = 0; i < m_TensorMemory.size(); ++i)
     {
@@ -131,6 +134,7 @@ void WorkingMemHandle::Free()
     m_IsAllocated = false;
 
     m_MemoryManager->Deallocate();
+    m_ScratchArena.Release();
 }
 
 void WorkingMemHandle::MemSyncOutputs()
@@ -17,6 +17,7 @@
 #include <unordered_map>
 #include <mutex>
 #include <backendsCommon/MemoryManager.hpp>
+#include <backendsCommon/ScratchArena.hpp>
 
 namespace armnn
 {
@@ -56,7 +57,8 @@ public:
                      std::vector<std::unique_ptr<ITensorHandle>> managedTensorHandles,
                      std::vector<std::unique_ptr<ITensorHandle>> unmanagedTensorHandles,
                      std::vector<std::pair<BackendId, ExecutionData>> executionDataVec,
-                     BackendPtrMap* backends);
+                     BackendPtrMap* backends,
+                     size_t scratchMemorySize = 0);
 
     ~WorkingMemHandle()
     { Free(); }
@@ -116,6 +118,12 @@ public:
 
     void MemSyncOutputs();
 
+    /// Get the arena the workloads take their temporary memory from when executing with this handle.
+    ScratchArena& GetScratchArena()
+    {
+        return m_ScratchArena;
+    }
+
     std::vector<LayerBindingId>& GetBindingIdVector()
     {
         return m_BindingIdVec;
@@ -157,6 +165,10 @@ private:
     std::vector<std::pair<BackendId, ExecutionData>> m_ExecutionDataVec;
 
     BackendPtrMap* m_Backends;
+
+    // Largest amount of scratch memory any one workload asked for at load time.
+    size_t m_ScratchMemorySize = 0;
+    ScratchArena m_ScratchArena;
 };
 
 } // end experimental namespace
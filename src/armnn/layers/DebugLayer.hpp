@@ -30,6 +30,9 @@ public:
 
     void ExecuteStrategy(IStrategy& strategy) const override;
 
+    /// Returns true if the layer writes the tensors flowing through it to files rather than to the console.
+    bool IsToFile() const { return m_ToFile; }
+
 protected:
     /// Constructor to create a DebugLayer.
     /// @param [in] name Optional name for the layer.
@@ -33,6 +33,8 @@ public:
 
     void SetPreCompiledObject(PreCompiledObjectPtr preCompiledObject);
 
+    const void* GetPreCompiledObject() const { return m_PreCompiledObject.get(); }
+
     void ExecuteStrategy(IStrategy& strategy) const override;
 
 private:
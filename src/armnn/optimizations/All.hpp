@@ -11,6 +11,8 @@
 #include "ConvertConstPermuteLayersToConstLayers.hpp"
 #include "ConvertFp32NetworkToFp16.hpp"
 #include "DeleteBroadcastTo.hpp"
+#include "EliminateCommonSubexpressions.hpp"
+#include "FoldConstants.hpp"
 #include "FoldPadIntoLayer2d.hpp"
 #include "FuseBatchNorm.hpp"
 #include "MaxMinIntoBoundedRelu.hpp"
@@ -22,5 +24,6 @@
 #include "PermuteAsReshape.hpp"
 #include "PermuteAndBatchToSpaceAsDepthToSpace.hpp"
 #include "PermuteDepthwiseConv2dWeights.hpp"
+#include "PropagateDataLayouts.hpp"
 #include "SquashEqualSiblings.hpp"
 #include "TransposeAsReshape.hpp"
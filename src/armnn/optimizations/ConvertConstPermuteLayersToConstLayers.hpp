@@ -1,5 +1,5 @@
 //
-// Copyright © 2022 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022,2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -92,7 +92,6 @@ private:
                                          ConstantLayer* constantLayer,
                                          PermuteLayer* permuteLayer)
     {
-        IgnoreUnused(graph);
         /**
          * This optimisation is to find situations where a constant set of inputs is being provided to a Permute
          * layer. In this case we don't want the overhead of Permuting the values on every inference, instead we
@@ -107,6 +106,11 @@ private:
         TensorInfo newInfo = outputPermuteInfo;
         newInfo.SetConstant(true);
         ConstTensor newInput(newInfo, newValues);
+        if (constantLayer->GetOutputSlot(0).GetNumConnections() > 1)
+        {
+            // Other layers still use the values the constant layer holds, so the permuted ones go in a new layer.
+            constantLayer = graph.AddLayer<ConstantLayer>(permuteLayer->GetName());
+        }
         constantLayer->m_LayerOutput.reset(new ScopedTensorHandle(newInput));
 
         // Moves connections in permute output to the constant layer.
@@ -0,0 +1,220 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+
+#include <armnn/Logging.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Merges the layers which compute the same thing: layers of the same type, with equal parameters, equal output
+/// tensor infos and the same input connections, and ConstantLayers holding the same values. The consumers of each
+/// duplicate are moved over to the first of its equals in topological order and the duplicate is erased. This
+/// generalises SquashEqualSiblings to all layer types.
+///
+/// Unlike the optimizations run by Optimizer::Pass, this goes through the graph from its inputs to its outputs, so
+/// the consumers of merged layers are found to be duplicates themselves in the same run: a whole repeated subgraph
+/// collapses in one go.
+class EliminateCommonSubexpressions
+{
+public:
+    /// Returns the number of layers erased from the graph.
+    static unsigned int Run(Graph& graph)
+    {
+        Graph& sortedGraph = graph.TopologicalSort();
+        const std::vector<Layer*> layers(sortedGraph.begin(), sortedGraph.end());
+
+        std::unordered_map<size_t, std::vector<Layer*>> uniqueLayers;
+        std::vector<Layer*> duplicates;
+        for (Layer* layer : layers)
+        {
+            if (!CanBeMerged(*layer))
+            {
+                continue;
+            }
+
+            std::vector<Layer*>& candidates = uniqueLayers[Hash(*layer)];
+            auto equal = std::find_if(candidates.begin(), candidates.end(), [layer](const Layer* candidate)
+            {
+                return AreEqual(*candidate, *layer);
+            });
+            if (equal == candidates.end())
+            {
+                candidates.push_back(layer);
+                continue;
+            }
+
+            // Bypasses the duplicate. It is erased below, once it has been left unconnected.
+            for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+            {
+                layer->GetOutputSlot(i).MoveAllConnections((*equal)->GetOutputSlot(i));
+            }
+            (*equal)->AddRelatedLayerName(layer->GetNameStr());
+            duplicates.push_back(layer);
+        }
+
+        for (Layer* duplicate : duplicates)
+        {
+            graph.EraseLayer(duplicate);
+        }
+
+        if (!duplicates.empty())
+        {
+            ARMNN_LOG(debug) << "EliminateCommonSubexpressions: merged " << duplicates.size() << " layers";
+        }
+        return static_cast<unsigned int>(duplicates.size());
+    }
+
+private:
+    template <typename Parameters, typename = void>
+    struct HasEqualityOperator : std::false_type {};
+
+    template <typename Parameters>
+    struct HasEqualityOperator<Parameters, std::void_t<decltype(std::declval<const Parameters&>() ==
+                                                                std::declval<const Parameters&>())>>
+        : std::true_type {};
+
+    /// Layers whose outputs depend on more than their type, parameters and inputs, or which must stay as they are.
+    static bool CanBeMerged(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Debug:
+            case LayerType::Input:
+            case LayerType::Map:
+            case LayerType::MemCopy:
+            case LayerType::MemImport:
+            case LayerType::Output:
+            case LayerType::PreCompiled:
+            case LayerType::StandIn:
+            case LayerType::Unmap:
+                return false;
+            case LayerType::Constant:
+                return PolymorphicDowncast<const ConstantLayer*>(&layer)->m_LayerOutput != nullptr;
+            default:
+                // Layers holding their own weights, like Lstm, are left alone rather than comparing every tensor.
+                return layer.GetNumOutputSlots() > 0 &&
+                       layer.GetAdditionalInformation<void>() == nullptr &&
+                       static_cast<const IConnectableLayer&>(layer).GetConstantTensorsByRef().empty();
+        }
+    }
+
+    static std::string_view GetConstantBytes(const ConstantLayer& layer)
+    {
+        return std::string_view(static_cast<const char*>(layer.m_LayerOutput->Map(true)),
+                                layer.m_LayerOutput->GetTensorInfo().GetNumBytes());
+    }
+
+    static size_t Hash(const Layer& layer)
+    {
+        size_t hash = std::hash<unsigned int>()(static_cast<unsigned int>(layer.GetType()));
+        auto combine = [&hash](size_t value)
+        {
+            hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        };
+
+        if (layer.GetType() == LayerType::Constant)
+        {
+            const ConstantLayer& constantLayer = *PolymorphicDowncast<const ConstantLayer*>(&layer);
+            combine(std::hash<std::string_view>()(GetConstantBytes(constantLayer)));
+        }
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            combine(std::hash<const OutputSlot*>()(layer.GetInputSlot(i).GetConnectedOutputSlot()));
+        }
+        return hash;
+    }
+
+    template <typename Parameters>
+    static bool AreParametersEqual(const LayerWithParameters<Parameters>& layer, const Layer& other)
+    {
+        if constexpr (HasEqualityOperator<Parameters>::value)
+        {
+            return layer.GetParameters() ==
+                   PolymorphicDowncast<const LayerWithParameters<Parameters>*>(&other)->GetParameters();
+        }
+        else
+        {
+            // Without a way to compare the parameters, the layers cannot be told to be equal.
+            return false;
+        }
+    }
+
+    static bool AreParametersEqual(const Layer&, const Layer&)
+    {
+        return true;
+    }
+
+    static bool AreParametersEqual(const ConstantLayer& layer, const Layer& other)
+    {
+        const ConstantLayer& otherConstant = *PolymorphicDowncast<const ConstantLayer*>(&other);
+        return layer.m_LayerOutput->GetTensorInfo() == otherConstant.m_LayerOutput->GetTensorInfo() &&
+               GetConstantBytes(layer) == GetConstantBytes(otherConstant);
+    }
+
+    static bool AreEqual(const Layer& layer, const Layer& other)
+    {
+        if (layer.GetType() != other.GetType() ||
+            layer.GetNumInputSlots() != other.GetNumInputSlots() ||
+            layer.GetNumOutputSlots() != other.GetNumOutputSlots())
+        {
+            return false;
+        }
+
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            const InputSlot& inputSlot = layer.GetInputSlot(i);
+            const InputSlot& otherInputSlot = other.GetInputSlot(i);
+            if (inputSlot.GetConnectedOutputSlot() != otherInputSlot.GetConnectedOutputSlot())
+            {
+                return false;
+            }
+            if (inputSlot.GetConnectedOutputSlot() != nullptr &&
+                (inputSlot.IsTensorInfoOverridden() != otherInputSlot.IsTensorInfoOverridden() ||
+                 !(inputSlot.GetTensorInfo() == otherInputSlot.GetTensorInfo())))
+            {
+                return false;
+            }
+        }
+
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            if (!(layer.GetOutputSlot(i).GetTensorInfo() == other.GetOutputSlot(i).GetTensorInfo()))
+            {
+                return false;
+            }
+        }
+
+        switch (layer.GetType())
+        {
+#define X(name)                                                                                           \
+            case LayerType::name:                                                                         \
+                return AreParametersEqual(*PolymorphicDowncast<const LayerTypeOf<LayerType::name>*>(&layer), \
+                                          other);
+            LIST_OF_LAYER_TYPE
+#undef X
+            default:
+                return false;
+        }
+    }
+};
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,321 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/Logging.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+#include <armnn/backends/WorkloadFactory.hpp>
+#include <backendsCommon/TensorHandleFactoryRegistry.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Replaces every layer whose inputs can all be computed from ConstantLayers by ConstantLayers holding its outputs.
+/// The constant subgraph in front of the layer is evaluated once, at optimization time, with the CpuRef workloads, so
+/// the optimization does nothing when CpuRef is not built or does not support one of the layers of the subgraph.
+/// Shape layers are folded too, as long as the shape of their input is fully known, whatever that input is.
+///
+/// The optimizer visits the deepest layers first, so a whole constant subgraph is folded in one go by its last layer,
+/// and the layers in front of it are removed once they are left unconnected. The layers found not to be constant are
+/// remembered for the rest of the pass, so a long chain of layers is not searched again from each of its layers.
+///
+/// Layers such as Tile, Gather or Resize can output much more data than they take in. They are only folded while
+/// their outputs stay below MaxExpandedOutputBytes, so folding does not blow up the constant data of the model.
+class FoldConstantsImpl
+{
+public:
+    /// The largest output, in bytes, folded for a subgraph whose outputs are larger than the constants it reads.
+    static constexpr unsigned int MaxExpandedOutputBytes = 64 * 1024;
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        if ((!CanBeFolded(layer) && layer.GetType() != LayerType::Shape) || layer.IsOutputUnconnected())
+        {
+            return;
+        }
+
+        std::unordered_map<const Layer*, bool> visitedLayers;
+        std::vector<Layer*> subgraph;
+        if (!IsConstantSubgraph(layer, visitedLayers, subgraph) || !IsWorthFolding(subgraph))
+        {
+            return;
+        }
+
+        std::vector<std::shared_ptr<ConstTensorHandle>> outputs;
+        try
+        {
+            outputs = Evaluate(subgraph);
+        }
+        catch (const armnn::Exception& e)
+        {
+            ARMNN_LOG(warning) << "FoldConstants: could not evaluate the constant layer " << layer.GetName()
+                               << ": " << e.what();
+            return;
+        }
+
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& outputSlot = layer.GetOutputSlot(i);
+            if (outputSlot.GetNumConnections() == 0)
+            {
+                continue;
+            }
+
+            TensorInfo info = outputSlot.GetTensorInfo();
+            info.SetConstant(true);
+
+            auto constantLayer = graph.AddLayer<ConstantLayer>(layer.GetName());
+            constantLayer->m_LayerOutput = outputs[i];
+            // Moving the connections copies the tensor info over, so the constant flag is set afterwards.
+            outputSlot.MoveAllConnections(constantLayer->GetOutputSlot(0));
+            constantLayer->GetOutputSlot(0).SetTensorInfo(info);
+        }
+
+        ARMNN_LOG(debug) << "FoldConstants: folded " << subgraph.size() << " layers into the outputs of "
+                         << layer.GetName();
+    }
+
+protected:
+    FoldConstantsImpl() = default;
+    ~FoldConstantsImpl() = default;
+
+private:
+    /// Layers which either have no inputs, have side effects, or can only run on the backend they were made for.
+    static bool CanBeFolded(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Constant:
+            case LayerType::Debug:
+            case LayerType::Input:
+            case LayerType::Map:
+            case LayerType::MemCopy:
+            case LayerType::MemImport:
+            case LayerType::Output:
+            case LayerType::PreCompiled:
+            case LayerType::Shape:
+            case LayerType::StandIn:
+            case LayerType::Unmap:
+                return false;
+            default:
+                return layer.GetNumInputSlots() > 0;
+        }
+    }
+
+    static bool IsShapeKnown(const TensorShape& shape)
+    {
+        return shape.GetDimensionality() == Dimensionality::Scalar ||
+               (shape.GetDimensionality() == Dimensionality::Specified && shape.AreAllDimensionsSpecified());
+    }
+
+    /// Returns true when the outputs of the layer only depend on constants. The layers they are computed from are
+    /// appended to the subgraph in topological order, the layer itself last.
+    bool IsConstantSubgraph(Layer& layer,
+                            std::unordered_map<const Layer*, bool>& visitedLayers,
+                            std::vector<Layer*>& subgraph) const
+    {
+        if (m_NonConstantLayers.count(layer.GetGuid()) != 0)
+        {
+            return false;
+        }
+        auto visited = visitedLayers.find(&layer);
+        if (visited != visitedLayers.end())
+        {
+            return visited->second;
+        }
+
+        bool isConstant = false;
+        if (layer.GetType() == LayerType::Constant)
+        {
+            isConstant = PolymorphicDowncast<ConstantLayer*>(&layer)->m_LayerOutput != nullptr;
+        }
+        else if (layer.GetType() == LayerType::Shape)
+        {
+            isConstant = layer.GetInputSlot(0).GetConnectedOutputSlot() != nullptr &&
+                         IsShapeKnown(layer.GetInputSlot(0).GetTensorInfo().GetShape());
+        }
+        else if (CanBeFolded(layer))
+        {
+            isConstant = true;
+            for (unsigned int i = 0; i < layer.GetNumOutputSlots() && isConstant; ++i)
+            {
+                isConstant = IsShapeKnown(layer.GetOutputSlot(i).GetTensorInfo().GetShape());
+            }
+            for (unsigned int i = 0; i < layer.GetNumInputSlots() && isConstant; ++i)
+            {
+                const OutputSlot* connectedSlot = layer.GetInputSlot(i).GetConnectedOutputSlot();
+                isConstant = connectedSlot != nullptr &&
+                             IsConstantSubgraph(connectedSlot->GetOwningLayer(), visitedLayers, subgraph);
+            }
+
+            std::string reasonIfUnsupported;
+            isConstant = isConstant && IWorkloadFactory::IsLayerSupported(Compute::CpuRef,
+                                                                          layer,
+                                                                          EmptyOptional(),
+                                                                          reasonIfUnsupported);
+        }
+
+        visitedLayers[&layer] = isConstant;
+        if (isConstant)
+        {
+            subgraph.push_back(&layer);
+        }
+        else
+        {
+            m_NonConstantLayers.insert(layer.GetGuid());
+        }
+        return isConstant;
+    }
+
+    /// Returns false when folding the subgraph would replace its constants by outputs which are both larger than them
+    /// and larger than MaxExpandedOutputBytes.
+    static bool IsWorthFolding(const std::vector<Layer*>& subgraph)
+    {
+        const Layer& root = *subgraph.back();
+        unsigned int outputBytes = 0;
+        for (unsigned int i = 0; i < root.GetNumOutputSlots(); ++i)
+        {
+            const OutputSlot& outputSlot = root.GetOutputSlot(i);
+            if (outputSlot.GetNumConnections() != 0)
+            {
+                outputBytes += outputSlot.GetTensorInfo().GetNumBytes();
+            }
+        }
+        if (outputBytes <= MaxExpandedOutputBytes)
+        {
+            return true;
+        }
+
+        unsigned int inputBytes = 0;
+        for (const Layer* layer : subgraph)
+        {
+            if (layer->GetType() == LayerType::Constant || layer->GetType() == LayerType::Shape)
+            {
+                inputBytes += layer->GetOutputSlot(0).GetTensorInfo().GetNumBytes();
+            }
+        }
+        if (outputBytes > inputBytes)
+        {
+            ARMNN_LOG(debug) << "FoldConstants: not folding " << root.GetName() << " as its outputs hold "
+                             << outputBytes << " bytes, more than the " << inputBytes << " bytes it is computed from";
+            return false;
+        }
+        return true;
+    }
+
+    /// The shape of the input of a Shape layer, as the Signed32 tensor it outputs.
+    static std::shared_ptr<ConstTensorHandle> GetShapeAsConstant(const Layer& shapeLayer)
+    {
+        const TensorShape& inputShape = shapeLayer.GetInputSlot(0).GetTensorInfo().GetShape();
+        TensorInfo info = shapeLayer.GetOutputSlot(0).GetTensorInfo();
+        info.SetConstant(true);
+
+        std::vector<int32_t> dimensions(info.GetNumElements(), 1);
+        for (unsigned int i = 0; i < inputShape.GetNumDimensions() && i < dimensions.size(); ++i)
+        {
+            dimensions[i] = static_cast<int32_t>(inputShape[i]);
+        }
+        return std::make_shared<ScopedTensorHandle>(ConstTensor(info, dimensions));
+    }
+
+    /// Runs the subgraph on CpuRef and returns copies of the outputs of its last layer.
+    static std::vector<std::shared_ptr<ConstTensorHandle>> Evaluate(const std::vector<Layer*>& subgraph)
+    {
+        const Layer& root = *subgraph.back();
+        if (root.GetType() == LayerType::Shape)
+        {
+            return { GetShapeAsConstant(root) };
+        }
+
+        auto backend = BackendRegistryInstance().GetFactory(Compute::CpuRef)();
+        IBackendInternal::IMemoryManagerSharedPtr memoryManager = backend->CreateMemoryManager();
+        IBackendInternal::IWorkloadFactoryPtr workloadFactory = backend->CreateWorkloadFactory(memoryManager);
+        TensorHandleFactoryRegistry tensorHandleFactoryRegistry;
+
+        // Copies the subgraph into a graph of its own, where the Shape layers become the constants they fold to.
+        Graph evaluationGraph;
+        std::unordered_map<const Layer*, Layer*> copies;
+        for (const Layer* layer : subgraph)
+        {
+            Layer* copy = nullptr;
+            if (layer->GetType() == LayerType::Shape)
+            {
+                auto constantLayer = evaluationGraph.AddLayer<ConstantLayer>(layer->GetName());
+                constantLayer->m_LayerOutput = GetShapeAsConstant(*layer);
+                copy = constantLayer;
+            }
+            else
+            {
+                copy = layer->Clone(evaluationGraph);
+                for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
+                {
+                    const OutputSlot* connectedSlot = layer->GetInputSlot(i).GetConnectedOutputSlot();
+                    copies.at(&connectedSlot->GetOwningLayer())->GetOutputSlot(connectedSlot->CalculateIndexOnOwner())
+                        .Connect(copy->GetInputSlot(i));
+                }
+            }
+
+            for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+            {
+                copy->GetOutputSlot(i).SetTensorInfo(layer->GetOutputSlot(i).GetTensorInfo());
+            }
+            copies[layer] = copy;
+        }
+
+        // The subgraph is in topological order, so every layer runs after the layers it takes its inputs from.
+        for (const Layer* layer : subgraph)
+        {
+            Layer* copy = copies.at(layer);
+            copy->CreateTensorHandles(tensorHandleFactoryRegistry, *workloadFactory, false);
+            for (unsigned int i = 0; i < copy->GetNumOutputSlots(); ++i)
+            {
+                copy->GetOutputHandler(i).GetData()->Allocate();
+            }
+
+            std::unique_ptr<IWorkload> workload = copy->CreateWorkload(*workloadFactory);
+            if (!workload)
+            {
+                throw RuntimeException(std::string("CpuRef has no workload for ") + GetLayerTypeAsCString(
+                    layer->GetType()));
+            }
+            workload->PostAllocationConfigure();
+            workload->Execute();
+        }
+
+        std::vector<std::shared_ptr<ConstTensorHandle>> outputs;
+        Layer* rootCopy = copies.at(&root);
+        for (unsigned int i = 0; i < root.GetNumOutputSlots(); ++i)
+        {
+            TensorInfo info = root.GetOutputSlot(i).GetTensorInfo();
+            info.SetConstant(true);
+
+            ITensorHandle* tensorHandle = rootCopy->GetOutputHandler(i).GetData();
+            outputs.push_back(std::make_shared<ScopedTensorHandle>(ConstTensor(info, tensorHandle->Map(true))));
+            tensorHandle->Unmap();
+        }
+        return outputs;
+    }
+
+    /// Folding a subgraph never makes a layer which was not constant become constant, so these stay valid for the
+    /// whole pass. They are keyed by guid rather than address: the pass erases layers, and a ConstantLayer added
+    /// later may be given the address of one of them.
+    mutable std::unordered_set<LayerGuid> m_NonConstantLayers;
+};
+
+using FoldConstants = OptimizeForType<Layer, FoldConstantsImpl>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2020,2022 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2020,2022,2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -174,6 +174,7 @@ public:
             {
                 // Remove old connection and connect to new layer2d
                 weightLayer->GetOutputSlot(0).Disconnect(base.GetInputSlot(1));
+                weightLayer = GetUnsharedConstantLayer(graph, weightLayer);
                 weightLayer->GetOutputSlot(0).Connect(newConv2dLayer.GetInputSlot(1));
                 weightLayer->m_LayerOutput = std::make_unique<ScopedTensorHandle>(fusedWeightsTensor);
 
@@ -185,6 +186,7 @@ public:
                         &base.GetInputSlot(2).GetConnectedOutputSlot()->GetOwningLayer());
                     // Remove old connection and connect to new layer2d
                     biasLayer->GetOutputSlot(0).Disconnect(base.GetInputSlot(2));
+                    biasLayer = GetUnsharedConstantLayer(graph, biasLayer);
                     biasLayer->GetOutputSlot(0).Connect(newConv2dLayer.GetInputSlot(2));
 
                 }
@@ -214,6 +216,20 @@ public:
 protected:
     FuseBatchNorm()  = default;
     ~FuseBatchNorm() = default;
+
+private:
+    /// The fused weights and bias replace the values of the constant layers they come from, so a constant layer which
+    /// other layers still use is copied instead of being changed.
+    static ConstantLayer* GetUnsharedConstantLayer(Graph& graph, ConstantLayer* constantLayer)
+    {
+        if (constantLayer->GetOutputSlot(0).GetNumConnections() == 0)
+        {
+            return constantLayer;
+        }
+        ConstantLayer* copy = graph.AddLayer<ConstantLayer>(constantLayer->GetName());
+        copy->GetOutputSlot(0).SetTensorInfo(constantLayer->GetOutputSlot(0).GetTensorInfo());
+        return copy;
+    }
 };
 
 using FuseBatchNormIntoConvolution2DFloat32 =
@@ -0,0 +1,704 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+
+#include <armnn/Logging.hpp>
+#include <armnn/Optional.hpp>
+#include <armnn/TypesUtils.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+#include <armnn/backends/WorkloadFactory.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+#include <armnnUtils/Transpose.hpp>
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Chooses the data layout of the regions of the graph so that the fewest Transpose and Permute layers are left.
+///
+/// A region is a maximal set of connected 4D layers which either do not care about the layout of their inputs, like
+/// activations and elementwise operations, or are told their layout by their descriptor, like Convolution2d or
+/// Pooling2d. Such a region can be switched from NCHW to NHWC, or back, as a whole: the layout-aware layers get the
+/// other layout in their descriptors, every output tensor is transposed, the constants it reads are transposed once
+/// now, and the transposes at its boundary which convert to or from the other layout are removed. The tensors coming
+/// from or going to anywhere else get a new transpose. Regions are switched one at a time, whichever removes the most
+/// transposes first, for as long as doing so removes more transposes than it adds. A region is only switched if the
+/// backend each of its layers would be assigned supports the layer in the other layout too.
+///
+/// Unlike the optimizations run by Optimizer::Pass, this looks at whole regions of the graph rather than at a layer and
+/// its neighbours, so it is not an Optimization.
+class PropagateDataLayouts
+{
+public:
+    /// Returns the number of Transpose and Permute layers removed from the graph. The backends are the available
+    /// preferred backends, in order of preference.
+    static unsigned int Run(Graph& graph, const std::vector<BackendId>& backends)
+    {
+        const unsigned int numTransposesBefore = CountTransposes(graph);
+
+        // Every switch removes more transposes than it adds, so this ends.
+        while (SwitchBestRegion(graph, backends))
+        {}
+
+        const unsigned int numTransposesAfter = CountTransposes(graph);
+        const unsigned int numEliminated =
+            numTransposesBefore > numTransposesAfter ? numTransposesBefore - numTransposesAfter : 0;
+        if (numEliminated > 0)
+        {
+            ARMNN_LOG(debug) << "PropagateDataLayouts: eliminated " << numEliminated << " transposes";
+        }
+        return numEliminated;
+    }
+
+private:
+    using Region = std::unordered_set<const Layer*>;
+
+    enum class ProducerKind
+    {
+        /// A ConstantLayer, which is replaced by a transposed copy of itself.
+        Constant,
+        /// A transpose from the layout the region switches to, which the region reads through.
+        InverseTranspose,
+        /// Anything else, which gets a new transpose.
+        Other
+    };
+
+    /// A tensor coming into the region from outside, and the region's inputs it is connected to.
+    struct RegionInput
+    {
+        OutputSlot* m_Producer;
+        ProducerKind m_Kind;
+        std::vector<InputSlot*> m_Consumers;
+    };
+
+    /// An output of the region, the transposes to the new layout it feeds and all its other consumers.
+    struct RegionOutput
+    {
+        OutputSlot* m_Output;
+        std::vector<Layer*> m_Transposes;
+        std::vector<InputSlot*> m_OtherConsumers;
+    };
+
+    struct Switch
+    {
+        PermutationVector m_Mappings;
+        DataLayout m_DataLayout;
+        int m_Gain = 0;
+        std::vector<Layer*> m_Layers;
+        std::vector<RegionInput> m_Inputs;
+        std::vector<RegionOutput> m_Outputs;
+    };
+
+    static const PermutationVector& GetNchwToNhwc()
+    {
+        static const PermutationVector nchwToNhwc({ 0, 2, 3, 1 });
+        return nchwToNhwc;
+    }
+
+    static const PermutationVector& GetNhwcToNchw()
+    {
+        static const PermutationVector nhwcToNchw({ 0, 3, 1, 2 });
+        return nhwcToNchw;
+    }
+
+    static PermutationVector GetInverse(const PermutationVector& mappings)
+    {
+        std::vector<PermutationVector::ValueType> inverse(mappings.GetSize());
+        for (unsigned int i = 0; i < mappings.GetSize(); ++i)
+        {
+            inverse[mappings[i]] = i;
+        }
+        return PermutationVector(inverse.data(), mappings.GetSize());
+    }
+
+    static unsigned int CountTransposes(const Graph& graph)
+    {
+        unsigned int numTransposes = 0;
+        for (const Layer* layer : graph)
+        {
+            if (layer->GetType() == LayerType::Transpose || layer->GetType() == LayerType::Permute)
+            {
+                ++numTransposes;
+            }
+        }
+        return numTransposes;
+    }
+
+    static bool Is4d(const TensorInfo& info)
+    {
+        const TensorShape& shape = info.GetShape();
+        return shape.GetDimensionality() == Dimensionality::Specified && shape.GetNumDimensions() == 4 &&
+               shape.AreAllDimensionsSpecified() && !info.HasPerAxisQuantization();
+    }
+
+    /// Returns the mappings of a 4D Transpose or Permute layer, as a Transpose, if it converts between NCHW and NHWC.
+    static Optional<PermutationVector> GetLayoutTransposeMappings(const Layer& layer)
+    {
+        Optional<PermutationVector> mappings;
+        if (layer.GetType() == LayerType::Transpose)
+        {
+            mappings = PolymorphicDowncast<const TransposeLayer*>(&layer)->GetPermutation();
+        }
+        else if (layer.GetType() == LayerType::Permute)
+        {
+            mappings = GetInverse(PolymorphicDowncast<const PermuteLayer*>(&layer)->GetPermutation());
+        }
+
+        if (mappings.has_value() &&
+            (mappings.value().IsEqual(GetNchwToNhwc()) || mappings.value().IsEqual(GetNhwcToNchw())) &&
+            layer.GetInputSlot(0).GetConnectedOutputSlot() != nullptr &&
+            !layer.GetInputSlot(0).IsTensorInfoOverridden() &&
+            Is4d(layer.GetInputSlot(0).GetTensorInfo()))
+        {
+            return mappings;
+        }
+        return EmptyOptional();
+    }
+
+    static bool IsLayoutAgnostic(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Activation:
+            case LayerType::Addition:
+            case LayerType::Cast:
+            case LayerType::Comparison:
+            case LayerType::Dequantize:
+            case LayerType::Division:
+            case LayerType::ElementwiseBinary:
+            case LayerType::ElementwiseUnary:
+            case LayerType::Floor:
+            case LayerType::LogicalBinary:
+            case LayerType::Maximum:
+            case LayerType::Minimum:
+            case LayerType::Multiplication:
+            case LayerType::Prelu:
+            case LayerType::Quantize:
+            case LayerType::Subtraction:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /// Calls the function with the layer downcast to its type if its descriptor has a data layout.
+    template <typename Function>
+    static bool VisitLayoutAwareLayer(const Layer& layer, Function&& function)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::BatchNormalization:
+                function(*PolymorphicDowncast<const BatchNormalizationLayer*>(&layer));
+                return true;
+            case LayerType::Convolution2d:
+                function(*PolymorphicDowncast<const Convolution2dLayer*>(&layer));
+                return true;
+            case LayerType::DepthToSpace:
+                function(*PolymorphicDowncast<const DepthToSpaceLayer*>(&layer));
+                return true;
+            case LayerType::DepthwiseConvolution2d:
+                function(*PolymorphicDowncast<const DepthwiseConvolution2dLayer*>(&layer));
+                return true;
+            case LayerType::InstanceNormalization:
+                function(*PolymorphicDowncast<const InstanceNormalizationLayer*>(&layer));
+                return true;
+            case LayerType::L2Normalization:
+                function(*PolymorphicDowncast<const L2NormalizationLayer*>(&layer));
+                return true;
+            case LayerType::Normalization:
+                function(*PolymorphicDowncast<const NormalizationLayer*>(&layer));
+                return true;
+            case LayerType::Pooling2d:
+                function(*PolymorphicDowncast<const Pooling2dLayer*>(&layer));
+                return true;
+            case LayerType::Resize:
+                function(*PolymorphicDowncast<const ResizeLayer*>(&layer));
+                return true;
+            case LayerType::SpaceToDepth:
+                function(*PolymorphicDowncast<const SpaceToDepthLayer*>(&layer));
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static Optional<DataLayout> GetDataLayout(const Layer& layer)
+    {
+        Optional<DataLayout> dataLayout;
+        VisitLayoutAwareLayer(layer, [&dataLayout](const auto& layoutAwareLayer)
+        {
+            dataLayout = layoutAwareLayer.GetParameters().m_DataLayout;
+        });
+        return dataLayout;
+    }
+
+    /// The inputs whose layout is that of the layer: all of them for layout agnostic layers, the data for the
+    /// layout-aware ones, and the weights of Convolution2d too, which are OIHW next to NCHW data and OHWI next to NHWC.
+    static bool IsFollowingInput(const Layer& layer, unsigned int inputIndex)
+    {
+        if (IsLayoutAgnostic(layer))
+        {
+            return true;
+        }
+        return inputIndex == 0 || (inputIndex == 1 && layer.GetType() == LayerType::Convolution2d);
+    }
+
+    static bool CanBeInRegion(const Layer& layer)
+    {
+        if (!IsLayoutAgnostic(layer) && !GetDataLayout(layer).has_value())
+        {
+            return false;
+        }
+        if (layer.GetNumOutputSlots() == 0)
+        {
+            return false;
+        }
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            if (!Is4d(layer.GetOutputSlot(i).GetTensorInfo()))
+            {
+                return false;
+            }
+        }
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            const InputSlot& inputSlot = layer.GetInputSlot(i);
+            if (IsFollowingInput(layer, i) &&
+                (inputSlot.GetConnectedOutputSlot() == nullptr ||
+                 inputSlot.IsTensorInfoOverridden() ||
+                 !Is4d(inputSlot.GetTensorInfo())))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static std::vector<std::vector<Layer*>> FindRegions(Graph& graph)
+    {
+        std::vector<std::vector<Layer*>> regions;
+        Region visited;
+        for (Layer* first : graph)
+        {
+            if (visited.count(first) != 0 || !CanBeInRegion(*first))
+            {
+                continue;
+            }
+
+            std::vector<Layer*> region;
+            std::vector<Layer*> toVisit{ first };
+            visited.insert(first);
+            auto visit = [&visited, &toVisit](Layer& layer)
+            {
+                if (visited.count(&layer) == 0 && CanBeInRegion(layer))
+                {
+                    visited.insert(&layer);
+                    toVisit.push_back(&layer);
+                }
+            };
+            while (!toVisit.empty())
+            {
+                Layer* layer = toVisit.back();
+                toVisit.pop_back();
+                region.push_back(layer);
+
+                for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
+                {
+                    if (IsFollowingInput(*layer, i))
+                    {
+                        visit(layer->GetInputSlot(i).GetConnectedOutputSlot()->GetOwningLayer());
+                    }
+                }
+                for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+                {
+                    for (InputSlot* consumer : layer->GetOutputSlot(i).GetConnections())
+                    {
+                        if (IsFollowingInput(consumer->GetOwningLayer(), consumer->GetSlotIndex()))
+                        {
+                            visit(consumer->GetOwningLayer());
+                        }
+                    }
+                }
+            }
+            regions.push_back(std::move(region));
+        }
+        return regions;
+    }
+
+    /// Works out what switching the region to the layout the mappings transpose to would take. Returns an empty
+    /// optional if a layout-aware layer of the region is not in the layout the mappings transpose from.
+    static Optional<Switch> PlanSwitch(const std::vector<Layer*>& layers, const PermutationVector& mappings)
+    {
+        const bool toNhwc = mappings.IsEqual(GetNchwToNhwc());
+        const Region region(layers.begin(), layers.end());
+        auto isInRegion = [&region](const Layer& layer)
+        {
+            return region.count(&layer) != 0;
+        };
+
+        Switch regionSwitch{ mappings, toNhwc ? DataLayout::NHWC : DataLayout::NCHW, 0, layers, {}, {} };
+        for (Layer* layer : layers)
+        {
+            const Optional<DataLayout> dataLayout = GetDataLayout(*layer);
+            if (dataLayout.has_value() && dataLayout.value() != (toNhwc ? DataLayout::NCHW : DataLayout::NHWC))
+            {
+                return EmptyOptional();
+            }
+
+            for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
+            {
+                OutputSlot* producer = layer->GetInputSlot(i).GetConnectedOutputSlot();
+                if (!IsFollowingInput(*layer, i) || isInRegion(producer->GetOwningLayer()))
+                {
+                    continue;
+                }
+
+                InputSlot* consumer = &layer->GetInputSlot(i);
+                auto input = std::find_if(regionSwitch.m_Inputs.begin(), regionSwitch.m_Inputs.end(),
+                                          [producer](const RegionInput& regionInput)
+                                          {
+                                              return regionInput.m_Producer == producer;
+                                          });
+                if (input != regionSwitch.m_Inputs.end())
+                {
+                    input->m_Consumers.push_back(consumer);
+                    continue;
+                }
+
+                const Layer& producerLayer = producer->GetOwningLayer();
+                const Optional<PermutationVector> producerMappings = GetLayoutTransposeMappings(producerLayer);
+                ProducerKind kind = ProducerKind::Other;
+                if (producerLayer.GetType() == LayerType::Constant &&
+                    PolymorphicDowncast<const ConstantLayer*>(&producerLayer)->m_LayerOutput != nullptr &&
+                    Is4d(PolymorphicDowncast<const ConstantLayer*>(&producerLayer)->m_LayerOutput->GetTensorInfo()))
+                {
+                    kind = ProducerKind::Constant;
+                }
+                else if (producerMappings.has_value() && producerMappings.value().IsInverse(mappings) &&
+                         !isInRegion(producerLayer.GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer()))
+                {
+                    kind = ProducerKind::InverseTranspose;
+                }
+                regionSwitch.m_Inputs.push_back({ producer, kind, { consumer } });
+            }
+
+            for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+            {
+                RegionOutput output{ &layer->GetOutputSlot(i), {}, {} };
+                for (InputSlot* consumer : output.m_Output->GetConnections())
+                {
+                    Layer& consumerLayer = consumer->GetOwningLayer();
+                    if (isInRegion(consumerLayer) && IsFollowingInput(consumerLayer, consumer->GetSlotIndex()))
+                    {
+                        continue;
+                    }
+
+                    const Optional<PermutationVector> consumerMappings = GetLayoutTransposeMappings(consumerLayer);
+                    if (consumerMappings.has_value() && consumerMappings.value().IsEqual(mappings) &&
+                        std::none_of(consumerLayer.GetOutputSlot(0).GetConnections().begin(),
+                                     consumerLayer.GetOutputSlot(0).GetConnections().end(),
+                                     [&isInRegion](const InputSlot* transposeConsumer)
+                                     {
+                                         return isInRegion(transposeConsumer->GetOwningLayer());
+                                     }))
+                    {
+                        output.m_Transposes.push_back(&consumerLayer);
+                    }
+                    else
+                    {
+                        output.m_OtherConsumers.push_back(consumer);
+                    }
+                }
+
+                regionSwitch.m_Gain += static_cast<int>(output.m_Transposes.size());
+                if (!output.m_OtherConsumers.empty())
+                {
+                    regionSwitch.m_Gain -= 1;
+                }
+                regionSwitch.m_Outputs.push_back(std::move(output));
+            }
+        }
+
+        for (const RegionInput& input : regionSwitch.m_Inputs)
+        {
+            if (input.m_Kind == ProducerKind::Other)
+            {
+                regionSwitch.m_Gain -= 1;
+            }
+            else if (input.m_Kind == ProducerKind::InverseTranspose &&
+                     input.m_Producer->GetNumConnections() == input.m_Consumers.size())
+            {
+                // The transpose goes if the region was all it fed.
+                regionSwitch.m_Gain += 1;
+            }
+        }
+        return regionSwitch;
+    }
+
+    static TransposeLayer* AddTranspose(Graph& graph,
+                                        OutputSlot& producer,
+                                        const PermutationVector& mappings,
+                                        const std::string& name)
+    {
+        TransposeLayer* transpose = graph.AddLayer<TransposeLayer>(TransposeDescriptor(mappings), name.c_str());
+        producer.Connect(transpose->GetInputSlot(0));
+        TensorInfo info = armnnUtils::TransposeTensorShape(producer.GetTensorInfo(), mappings);
+        info.SetConstant(false);
+        transpose->GetOutputSlot(0).SetTensorInfo(info);
+        return transpose;
+    }
+
+    static ConstantLayer* AddTransposedConstant(Graph& graph,
+                                                const ConstantLayer& constantLayer,
+                                                const PermutationVector& mappings)
+    {
+        const TensorInfo& info = constantLayer.m_LayerOutput->GetTensorInfo();
+        TensorInfo transposedInfo = armnnUtils::TransposeTensorShape(info, mappings);
+        transposedInfo.SetConstant(true);
+
+        std::vector<uint8_t> transposedData(info.GetNumBytes());
+        armnnUtils::Transpose(info.GetShape(), mappings, constantLayer.m_LayerOutput->Map(true),
+                              transposedData.data(), GetDataTypeSize(info.GetDataType()));
+        constantLayer.m_LayerOutput->Unmap();
+
+        ConstantLayer* transposedLayer = graph.AddLayer<ConstantLayer>(constantLayer.GetName());
+        transposedLayer->m_LayerOutput =
+            std::make_shared<ScopedTensorHandle>(ConstTensor(transposedInfo, transposedData.data()));
+        TensorInfo transposedOutputInfo =
+            armnnUtils::TransposeTensorShape(constantLayer.GetOutputSlot(0).GetTensorInfo(), mappings);
+        transposedLayer->GetOutputSlot(0).SetTensorInfo(transposedOutputInfo);
+        return transposedLayer;
+    }
+
+    /// Replaces a layout-aware layer by one of the same type whose descriptor has the given layout, and returns it.
+    static Layer* SetDataLayout(Graph& graph, Layer& layer, DataLayout dataLayout)
+    {
+        Layer* replacement = nullptr;
+        VisitLayoutAwareLayer(layer, [&graph, &layer, &replacement, dataLayout](const auto& layoutAwareLayer)
+        {
+            using LayerT = std::decay_t<decltype(layoutAwareLayer)>;
+            typename LayerT::DescriptorType descriptor = layoutAwareLayer.GetParameters();
+            descriptor.m_DataLayout = dataLayout;
+
+            LayerT* newLayer = graph.AddLayer<LayerT>(descriptor, layer.GetName());
+            replacement = newLayer;
+            if constexpr (std::is_same_v<LayerT, BatchNormalizationLayer>)
+            {
+                newLayer->m_Mean = layoutAwareLayer.m_Mean;
+                newLayer->m_Variance = layoutAwareLayer.m_Variance;
+                newLayer->m_Beta = layoutAwareLayer.m_Beta;
+                newLayer->m_Gamma = layoutAwareLayer.m_Gamma;
+            }
+
+            for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+            {
+                OutputSlot* producer = layer.GetInputSlot(i).GetConnectedOutputSlot();
+                if (producer != nullptr)
+                {
+                    producer->Disconnect(layer.GetInputSlot(i));
+                    producer->Connect(newLayer->GetInputSlot(i));
+                }
+            }
+            for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+            {
+                const TensorInfo info = layer.GetOutputSlot(i).GetTensorInfo();
+                layer.GetOutputSlot(i).MoveAllConnections(newLayer->GetOutputSlot(i));
+                newLayer->GetOutputSlot(i).SetTensorInfo(info);
+            }
+        });
+        Layer* replacedLayer = &layer;
+        graph.EraseLayer(replacedLayer);
+        return replacement;
+    }
+
+    /// Returns the first of the backends which supports the layer, or an empty optional if none does.
+    static Optional<BackendId> FindSupportingBackend(const Layer& layer, const std::vector<BackendId>& backends)
+    {
+        for (const BackendId& backend : backends)
+        {
+            std::string reasonIfUnsupported;
+            if (IWorkloadFactory::IsLayerSupported(backend, layer, EmptyOptional(), reasonIfUnsupported))
+            {
+                return backend;
+            }
+        }
+        return EmptyOptional();
+    }
+
+    /// Checks that the backend each layer of the region would be assigned now still supports it once switched, by
+    /// building the switched layer, fed with the switched tensors, in a graph of its own. Backends do not all support
+    /// every layout, TosaRef for instance has no NCHW Resize.
+    static bool IsSwitchSupported(const Switch& regionSwitch, const std::vector<BackendId>& backends)
+    {
+        for (const Layer* layer : regionSwitch.m_Layers)
+        {
+            const Optional<BackendId> backend = FindSupportingBackend(*layer, backends);
+            if (!backend.has_value())
+            {
+                // No backend supports the layer as it is either, so the switch does not make it worse.
+                continue;
+            }
+
+            Graph switchedGraph;
+            Layer* switchedLayer = layer->Clone(switchedGraph);
+            if (GetDataLayout(*layer).has_value())
+            {
+                switchedLayer = SetDataLayout(switchedGraph, *switchedLayer, regionSwitch.m_DataLayout);
+            }
+            for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
+            {
+                const InputSlot& inputSlot = layer->GetInputSlot(i);
+                if (inputSlot.GetConnectedOutputSlot() == nullptr)
+                {
+                    continue;
+                }
+                const TensorInfo& info = inputSlot.GetTensorInfo();
+                Layer* input = switchedGraph.AddLayer<InputLayer>(static_cast<LayerBindingId>(i), "");
+                input->GetOutputSlot(0).SetTensorInfo(IsFollowingInput(*layer, i) ?
+                    armnnUtils::TransposeTensorShape(info, regionSwitch.m_Mappings) : info);
+                input->GetOutputSlot(0).Connect(switchedLayer->GetInputSlot(i));
+            }
+            for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+            {
+                switchedLayer->GetOutputSlot(i).SetTensorInfo(
+                    armnnUtils::TransposeTensorShape(layer->GetOutputSlot(i).GetTensorInfo(), regionSwitch.m_Mappings));
+            }
+
+            std::string reasonIfUnsupported;
+            if (!IWorkloadFactory::IsLayerSupported(backend.value(), *switchedLayer, EmptyOptional(),
+                                                    reasonIfUnsupported))
+            {
+                ARMNN_LOG(debug) << "PropagateDataLayouts: not switching " << layer->GetNameStr() << " to "
+                                 << GetDataLayoutName(regionSwitch.m_DataLayout) << " as " << backend.value()
+                                 << " does not support it: " << reasonIfUnsupported;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void ApplySwitch(Graph& graph, const Switch& regionSwitch)
+    {
+        const PermutationVector& mappings = regionSwitch.m_Mappings;
+        const PermutationVector inverseMappings = GetInverse(mappings);
+        std::vector<Layer*> replacedLayers;
+
+        for (const RegionInput& input : regionSwitch.m_Inputs)
+        {
+            Layer& producerLayer = input.m_Producer->GetOwningLayer();
+            OutputSlot* newProducer = nullptr;
+            switch (input.m_Kind)
+            {
+                case ProducerKind::Constant:
+                    newProducer = &AddTransposedConstant(graph,
+                                                         *PolymorphicDowncast<ConstantLayer*>(&producerLayer),
+                                                         mappings)->GetOutputSlot(0);
+                    break;
+                case ProducerKind::InverseTranspose:
+                    newProducer = producerLayer.GetInputSlot(0).GetConnectedOutputSlot();
+                    break;
+                case ProducerKind::Other:
+                    newProducer = &AddTranspose(graph, *input.m_Producer, mappings,
+                                                producerLayer.GetNameStr() + "-to-" +
+                                                GetDataLayoutName(regionSwitch.m_DataLayout))->GetOutputSlot(0);
+                    break;
+            }
+
+            for (InputSlot* consumer : input.m_Consumers)
+            {
+                input.m_Producer->Disconnect(*consumer);
+                newProducer->Connect(*consumer);
+            }
+            if (input.m_Kind != ProducerKind::Other && input.m_Producer->GetNumConnections() == 0)
+            {
+                replacedLayers.push_back(&producerLayer);
+            }
+        }
+
+        for (const RegionOutput& output : regionSwitch.m_Outputs)
+        {
+            const TensorInfo info = output.m_Output->GetTensorInfo();
+            if (!output.m_OtherConsumers.empty())
+            {
+                const DataLayout originalLayout =
+                    regionSwitch.m_DataLayout == DataLayout::NHWC ? DataLayout::NCHW : DataLayout::NHWC;
+                TransposeLayer* transpose = graph.AddLayer<TransposeLayer>(
+                    TransposeDescriptor(inverseMappings),
+                    (output.m_Output->GetOwningLayer().GetNameStr() + "-to-" + GetDataLayoutName(originalLayout))
+                        .c_str());
+                transpose->GetOutputSlot(0).SetTensorInfo(info);
+                for (InputSlot* consumer : output.m_OtherConsumers)
+                {
+                    output.m_Output->Disconnect(*consumer);
+                    transpose->GetOutputSlot(0).Connect(*consumer);
+                }
+                output.m_Output->Connect(transpose->GetInputSlot(0));
+            }
+            for (Layer* transpose : output.m_Transposes)
+            {
+                transpose->GetOutputSlot(0).MoveAllConnections(*output.m_Output);
+                replacedLayers.push_back(transpose);
+            }
+            output.m_Output->SetTensorInfo(armnnUtils::TransposeTensorShape(info, mappings));
+        }
+
+        for (Layer* layer : regionSwitch.m_Layers)
+        {
+            if (GetDataLayout(*layer).has_value())
+            {
+                SetDataLayout(graph, *layer, regionSwitch.m_DataLayout);
+            }
+        }
+
+        for (Layer* layer : replacedLayers)
+        {
+            graph.EraseLayer(layer);
+        }
+    }
+
+    static bool SwitchBestRegion(Graph& graph, const std::vector<BackendId>& backends)
+    {
+        std::vector<Switch> switches;
+        for (const std::vector<Layer*>& region : FindRegions(graph))
+        {
+            for (const PermutationVector* mappings : { &GetNchwToNhwc(), &GetNhwcToNchw() })
+            {
+                Optional<Switch> regionSwitch = PlanSwitch(region, *mappings);
+                if (regionSwitch.has_value() && regionSwitch.value().m_Gain > 0)
+                {
+                    switches.push_back(std::move(regionSwitch.value()));
+                }
+            }
+        }
+
+        // The best switch the backends support, the first one found among equals.
+        std::stable_sort(switches.begin(), switches.end(), [](const Switch& lhs, const Switch& rhs)
+        {
+            return lhs.m_Gain > rhs.m_Gain;
+        });
+        for (const Switch& regionSwitch : switches)
+        {
+            if (IsSwitchSupported(regionSwitch, backends))
+            {
+                ApplySwitch(graph, regionSwitch);
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace optimizations
+} // namespace armnn
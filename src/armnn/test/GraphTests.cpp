@@ -641,4 +641,88 @@ TEST_CASE("IConnectableLayerConstantTensorsByRef")
 
 }
 
+
+namespace
+{
+
+/// Records the start (Manage) and end (Allocate) of its lifetime, without allocating any memory.
+class LifetimeRecordingTensorHandle : public armnn::ScopedTensorHandle
+{
+public:
+    LifetimeRecordingTensorHandle(const armnn::TensorInfo& info, std::string name, std::vector<std::string>& events)
+        : armnn::ScopedTensorHandle(info)
+        , m_Name(std::move(name))
+        , m_Events(events)
+    {}
+
+    void Manage() override { m_Events.push_back("Manage " + m_Name); }
+    void Allocate() override { m_Events.push_back("Allocate " + m_Name); }
+
+private:
+    std::string m_Name;
+    std::vector<std::string>& m_Events;
+};
+
+/// Returns the lifetime events of the tensors of two independent chains of two activations, a1 -> a2 and b1 -> b2,
+/// whose results are added together.
+std::vector<std::string> GetBranchLifetimeEvents(bool concurrentExecution)
+{
+    using namespace armnn;
+
+    Graph graph;
+    std::vector<std::string> events;
+    const TensorInfo info({ 4 }, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    Layer* a1 = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "a1");
+    Layer* a2 = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "a2");
+    Layer* b1 = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "b1");
+    Layer* b2 = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "b2");
+    Layer* add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add");
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot(0).Connect(a1->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(b1->GetInputSlot(0));
+    a1->GetOutputSlot(0).Connect(a2->GetInputSlot(0));
+    b1->GetOutputSlot(0).Connect(b2->GetInputSlot(0));
+    a2->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    b2->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    for (Layer* layer : { input, a1, a2, b1, b2, add })
+    {
+        layer->GetOutputHandler(0).SetData(
+            std::make_unique<LifetimeRecordingTensorHandle>(info, layer->GetNameStr(), events));
+    }
+
+    graph.TopologicalSort();
+    graph.AllocateDynamicBuffers(concurrentExecution);
+    return events;
+}
+
+/// Returns whether the tensors of a1 and b1 are both still alive once the tensors of a2 and b2 have been created.
+bool FirstActivationsOutliveBothBranches(const std::vector<std::string>& events)
+{
+    auto position = [&](const std::string& event)
+    {
+        return std::distance(events.begin(), std::find(events.begin(), events.end(), event));
+    };
+    const auto lastStart = std::max(position("Manage a2"), position("Manage b2"));
+    return position("Allocate a1") > lastStart && position("Allocate b1") > lastStart;
+}
+
+} // anonymous namespace
+
+TEST_CASE("AllocateDynamicBuffersForConcurrentExecution")
+{
+    // Executing serially, the memory of the first activation of one branch can be reused by the other branch.
+    CHECK(!FirstActivationsOutliveBothBranches(GetBranchLifetimeEvents(false)));
+
+    // When the branches can execute at the same time, the lifetimes are extended until both branches have finished.
+    const std::vector<std::string> events = GetBranchLifetimeEvents(true);
+    CHECK(FirstActivationsOutliveBothBranches(events));
+    CHECK(std::count_if(events.begin(), events.end(),
+                        [](const std::string& event) { return event.rfind("Allocate", 0) == 0; }) == 6);
+}
+
 }
@@ -7,6 +7,10 @@
 
 
 #include <Network.hpp>
+#include <layers/ConstantLayer.hpp>
+
+#include <armnn/backends/TensorHandle.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
 
 #include <doctest/doctest.h>
 
@@ -648,6 +652,32 @@ TEST_CASE("CheckNotNullDescriptor")
     CHECK(descriptor.IsNull() == false);
 }
 
+TEST_CASE("ImportedConstantLayerReferencesMemory")
+{
+    auto data = std::make_shared<std::vector<float>>(std::vector<float>{ 1.0f, 2.0f, 3.0f, 4.0f });
+    std::weak_ptr<std::vector<float>> weakData = data;
+    const armnn::TensorInfo info({ 4 }, armnn::DataType::Float32, 0.0f, 0, true);
+
+    std::unique_ptr<armnn::Graph> graphCopy;
+    {
+        armnn::NetworkImpl net;
+        armnn::IConnectableLayer* const layer =
+            net.AddImportedConstantLayer(armnn::ConstTensor(info, data->data()), data, "constant");
+        const auto constantLayer = armnn::PolymorphicDowncast<armnn::ConstantLayer*>(layer);
+        CHECK(constantLayer->m_LayerOutput->GetConstTensor<float>() == data->data());
+        CHECK(constantLayer->m_LayerOutput->GetTensorInfo() == info);
+
+        graphCopy = std::make_unique<armnn::Graph>(net.GetGraph());
+        data.reset();
+        CHECK(!weakData.expired());
+    }
+
+    // Like an optimized network, the copy of the graph keeps the memory alive.
+    CHECK(!weakData.expired());
+    graphCopy.reset();
+    CHECK(weakData.expired());
+}
+
 TEST_CASE("CheckNullDescriptor")
 {
     armnn::NetworkImpl net;
@@ -22,8 +22,16 @@
 #include <backendsCommon/LayerSupportBase.hpp>
 #include <armnn/backends/TensorHandle.hpp>
 
+#include <armnnUtils/Permute.hpp>
+#include <armnnUtils/Transpose.hpp>
+
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
 using namespace armnn;
 
 namespace
@@ -301,6 +309,152 @@ public:
     BackendCapabilities m_BackendCapabilities;
 };
 
+/// Records the name of every layer Optimizer::Pass visits, in order.
+class RecordVisitsImpl
+{
+public:
+    explicit RecordVisitsImpl(std::vector<std::string>* visits) : m_Visits(visits) {}
+
+    void Run(Graph&, Layer& layer) const
+    {
+        m_Visits->push_back(layer.GetNameStr());
+    }
+
+private:
+    std::vector<std::string>* m_Visits;
+};
+
+using RecordVisits = OptimizeForType<Layer, RecordVisitsImpl>;
+
+/// When the layer named target is visited, inserts a Floor layer named insertedName in front of the layer named
+/// insertBefore, once.
+class InsertFloorImpl
+{
+public:
+    InsertFloorImpl(std::string target, std::string insertBefore, std::string insertedName)
+        : m_Target(std::move(target)), m_InsertBefore(std::move(insertBefore)), m_InsertedName(std::move(insertedName))
+    {}
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        if (layer.GetNameStr() != m_Target || m_Done)
+        {
+            return;
+        }
+        m_Done = true;
+
+        Layer& insertBefore = GetLayerByName(graph, m_InsertBefore);
+        Layer* floor = graph.InsertNewLayer<FloorLayer>(insertBefore.GetInputSlot(0), m_InsertedName.c_str());
+        floor->GetOutputSlot(0).SetTensorInfo(floor->GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo());
+    }
+
+private:
+    static Layer& GetLayerByName(Graph& graph, const std::string& name)
+    {
+        for (Layer* layer : graph)
+        {
+            if (layer->GetNameStr() == name)
+            {
+                return *layer;
+            }
+        }
+        throw InvalidArgumentException("No layer named " + name);
+    }
+
+    std::string m_Target;
+    std::string m_InsertBefore;
+    std::string m_InsertedName;
+    mutable bool m_Done = false;
+};
+
+using InsertFloor = OptimizeForType<Layer, InsertFloorImpl>;
+
+/// When the layer named "b" is visited, erases its parent "a" and only then creates an Activation layer named
+/// "replacement" in its place, which the allocator is likely to give the address of "a".
+class ReplaceParentImpl
+{
+public:
+    explicit ReplaceParentImpl(bool* reusedAddress) : m_ReusedAddress(reusedAddress) {}
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        if (layer.GetNameStr() != "b")
+        {
+            return;
+        }
+
+        Layer* parent = &layer.GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+        OutputSlot& source = *parent->GetInputSlot(0).GetConnectedOutputSlot();
+        const TensorInfo info = parent->GetOutputSlot(0).GetTensorInfo();
+        const Layer* erasedAddress = parent;
+        source.Disconnect(parent->GetInputSlot(0));
+        parent->GetOutputSlot(0).Disconnect(layer.GetInputSlot(0));
+        graph.EraseLayer(parent);
+
+        Layer* replacement = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "replacement");
+        source.Connect(replacement->GetInputSlot(0));
+        replacement->GetOutputSlot(0).Connect(layer.GetInputSlot(0));
+        replacement->GetOutputSlot(0).SetTensorInfo(info);
+        *m_ReusedAddress = (replacement == erasedAddress);
+    }
+
+private:
+    bool* m_ReusedAddress;
+};
+
+using ReplaceParent = OptimizeForType<Layer, ReplaceParentImpl>;
+
+/// Adds Input "input" -> Activation "a" -> Activation "b" [-> Activation "c"] -> Output "output" to the graph.
+void CreateActivationChain(Graph& graph, const std::vector<std::string>& names)
+{
+    const TensorInfo info({ 1, 4 }, DataType::Float32);
+    Layer* previous = graph.AddLayer<InputLayer>(0, "input");
+    previous->GetOutputSlot(0).SetTensorInfo(info);
+    for (const std::string& name : names)
+    {
+        Layer* activation = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), name.c_str());
+        previous->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).SetTensorInfo(info);
+        previous = activation;
+    }
+    previous->GetOutputSlot(0).Connect(graph.AddLayer<OutputLayer>(0, "output")->GetInputSlot(0));
+}
+
+/// Checks that every layer of the graph was visited exactly once, after all the layers consuming its outputs.
+void CheckVisitedInReverseTopologicalOrder(const Graph& graph, const std::vector<std::string>& visits)
+{
+    CHECK(visits.size() == graph.GetNumLayers());
+    std::map<std::string, size_t> positions;
+    for (size_t i = 0; i < visits.size(); ++i)
+    {
+        CHECK_MESSAGE(positions.emplace(visits[i], i).second, visits[i], " visited twice");
+    }
+
+    for (const Layer* layer : graph)
+    {
+        REQUIRE_MESSAGE(positions.count(layer->GetNameStr()) == 1, layer->GetNameStr(), " not visited");
+        for (const OutputSlot& outputSlot : layer->GetOutputSlots())
+        {
+            for (const InputSlot* connection : outputSlot.GetConnections())
+            {
+                const std::string& child = connection->GetOwningLayer().GetNameStr();
+                CHECK_MESSAGE(positions.at(child) < positions.at(layer->GetNameStr()),
+                              child, " visited after its parent ", layer->GetNameStr());
+            }
+        }
+    }
+}
+
+std::vector<LayerType> GetLayerTypes(const Graph& graph)
+{
+    std::vector<LayerType> types;
+    for (const Layer* layer : graph)
+    {
+        types.push_back(layer->GetType());
+    }
+    return types;
+}
+
 }    // namespace
 
 TEST_SUITE("Optimizer")
@@ -996,4 +1150,130 @@ TEST_CASE("OptimizeForExclusiveConnectionsWithoutFuseTest")
                         &IsLayerOfType<armnn::OutputLayer>,
                         &IsLayerOfType<armnn::OutputLayer>));
 }
+
+TEST_CASE("OptimizerPassVisitsLayerInsertedBeforeCurrentLayer")
+{
+    Graph graph;
+    CreateActivationChain(graph, { "a", "b" });
+
+    std::vector<std::string> visits;
+    Optimizer::Pass(graph, MakeOptimizations(InsertFloor("b", "b", "inserted"), RecordVisits(&visits)));
+
+    CHECK(visits == std::vector<std::string>({ "output", "b", "inserted", "a", "input" }));
+    CheckVisitedInReverseTopologicalOrder(graph, visits);
+}
+
+TEST_CASE("OptimizerPassVisitsNewLayerAtAddressOfErasedLayer")
+{
+    Graph graph;
+    CreateActivationChain(graph, { "a", "b" });
+
+    std::vector<std::string> visits;
+    bool reusedAddress = false;
+    Optimizer::Pass(graph, MakeOptimizations(ReplaceParent(&reusedAddress), RecordVisits(&visits)));
+
+    // Whether the address is reused depends on the allocator, the replacement must be visited either way.
+    MESSAGE("The replacement layer reused the address of the erased layer: ", reusedAddress);
+    CHECK(visits == std::vector<std::string>({ "output", "b", "replacement", "input" }));
+    CheckVisitedInReverseTopologicalOrder(graph, visits);
+}
+
+TEST_CASE("OptimizerPassRequeuesLayerDeepenedByInsertion")
+{
+    Graph graph;
+    CreateActivationChain(graph, { "a", "b", "c" });
+
+    // Inserting "x" in front of "b" while "c" is visited pushes the pending "b" one level deeper, so it must now
+    // be visited before "x", which was queued at the depth "b" had.
+    std::vector<std::string> visits;
+    Optimizer::Pass(graph, MakeOptimizations(InsertFloor("c", "b", "x"), RecordVisits(&visits)));
+
+    CHECK(visits == std::vector<std::string>({ "output", "c", "b", "x", "a", "input" }));
+    CheckVisitedInReverseTopologicalOrder(graph, visits);
+}
+
+TEST_CASE("OptimizerPassReachesFixedPointWhenOptimizationsMutateUpstreamLayers")
+{
+    // MovePermuteUp and MoveTransposeUp move the second permute or transpose of each branch above the activation,
+    // next to the first one, which then cancel out with OptimizeInversePermutes and OptimizeInverseTransposes while
+    // the pass is visiting layers further down. The reshapes then cancel out too.
+    Graph graph;
+    const TensorInfo info({ 1, 2, 3, 4 }, DataType::Float32);
+    const PermutationVector permutation({ 0, 2, 3, 1 });
+    const PermutationVector inversePermutation({ 0, 3, 1, 2 });
+
+    Layer* input0 = graph.AddLayer<InputLayer>(0, "input0");
+    Layer* permute0 = graph.AddLayer<PermuteLayer>(PermuteDescriptor(permutation), "permute0");
+    Layer* activation0 = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "activation0");
+    Layer* permute1 = graph.AddLayer<PermuteLayer>(PermuteDescriptor(inversePermutation), "permute1");
+    Layer* output0 = graph.AddLayer<OutputLayer>(0, "output0");
+    input0->GetOutputSlot(0).Connect(permute0->GetInputSlot(0));
+    permute0->GetOutputSlot(0).Connect(activation0->GetInputSlot(0));
+    activation0->GetOutputSlot(0).Connect(permute1->GetInputSlot(0));
+    permute1->GetOutputSlot(0).Connect(output0->GetInputSlot(0));
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    permute0->GetOutputSlot(0).SetTensorInfo(armnnUtils::Permuted(info, permutation));
+    activation0->GetOutputSlot(0).SetTensorInfo(armnnUtils::Permuted(info, permutation));
+    permute1->GetOutputSlot(0).SetTensorInfo(info);
+
+    const TensorInfo transposedInfo = armnnUtils::TransposeTensorShape(info, permutation);
+    TensorInfo reshapedInfo = info;
+    reshapedInfo.SetShape({ 6, 4 });
+    Layer* input1 = graph.AddLayer<InputLayer>(1, "input1");
+    Layer* transpose0 = graph.AddLayer<TransposeLayer>(TransposeDescriptor(permutation), "transpose0");
+    Layer* activation1 = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "activation1");
+    Layer* transpose1 = graph.AddLayer<TransposeLayer>(TransposeDescriptor(inversePermutation), "transpose1");
+    Layer* reshape0 = graph.AddLayer<ReshapeLayer>(ReshapeDescriptor(reshapedInfo.GetShape()), "reshape0");
+    Layer* reshape1 = graph.AddLayer<ReshapeLayer>(ReshapeDescriptor(info.GetShape()), "reshape1");
+    Layer* output1 = graph.AddLayer<OutputLayer>(1, "output1");
+    input1->GetOutputSlot(0).Connect(transpose0->GetInputSlot(0));
+    transpose0->GetOutputSlot(0).Connect(activation1->GetInputSlot(0));
+    activation1->GetOutputSlot(0).Connect(transpose1->GetInputSlot(0));
+    transpose1->GetOutputSlot(0).Connect(reshape0->GetInputSlot(0));
+    reshape0->GetOutputSlot(0).Connect(reshape1->GetInputSlot(0));
+    reshape1->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+    input1->GetOutputSlot(0).SetTensorInfo(info);
+    transpose0->GetOutputSlot(0).SetTensorInfo(transposedInfo);
+    activation1->GetOutputSlot(0).SetTensorInfo(transposedInfo);
+    transpose1->GetOutputSlot(0).SetTensorInfo(info);
+    reshape0->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+    reshape1->GetOutputSlot(0).SetTensorInfo(info);
+
+    // The optimizations of the main pass of Optimize().
+    auto optimize = [&graph]()
+    {
+        Optimizer::Pass(graph, MakeOptimizations(SquashEqualPermuteSiblings(),
+                                                 SquashEqualTransposeSiblings(),
+                                                 SquashEqualReshapeSiblings(),
+                                                 OptimizeInversePermutes(),
+                                                 OptimizeInverseTransposes(),
+                                                 MovePermuteUp(),
+                                                 MoveTransposeUp(),
+                                                 PermuteAsReshape(),
+                                                 TransposeAsReshape(),
+                                                 OptimizeConsecutiveReshapes(),
+                                                 FoldPadIntoConvolution2d(),
+                                                 FoldPadIntoDepthwiseConvolution2d(),
+                                                 FoldPadIntoPooling2d(),
+                                                 BroadcastToOptimizationLayer(),
+                                                 PermuteAndBatchToSpaceAsDepthToSpace(),
+                                                 TransposeAndBatchToSpaceAsDepthToSpace(),
+                                                 FuseBatchNormIntoConvolution2DFloat32(),
+                                                 FuseBatchNormIntoConvolution2DFloat16(),
+                                                 FuseBatchNormIntoDepthwiseConvolution2DFloat32(),
+                                                 FuseBatchNormIntoDepthwiseConvolution2DFloat16()));
+    };
+
+    optimize();
+    const std::vector<LayerType> optimizedTypes = GetLayerTypes(graph);
+    CHECK(graph.GetNumLayers() == 6);
+    CHECK(std::count(optimizedTypes.begin(), optimizedTypes.end(), LayerType::Activation) == 2);
+    CHECK(std::count(optimizedTypes.begin(), optimizedTypes.end(), LayerType::Input) == 2);
+    CHECK(std::count(optimizedTypes.begin(), optimizedTypes.end(), LayerType::Output) == 2);
+
+    // A single pass is enough: a second one finds nothing left to optimize.
+    optimize();
+    CHECK(GetLayerTypes(graph) == optimizedTypes);
+}
+
 } // Optimizer TestSuite
@@ -4,6 +4,7 @@
 //
 
 #include <ArmNNProfilingServiceInitialiser.hpp>
+#include <LoadedNetwork.hpp>
 #include <ProfilingOptionsConverter.hpp>
 #include <Runtime.hpp>
 
@@ -480,6 +481,208 @@ TEST_CASE("RuntimeCpuRef")
     CHECK(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
 }
 
+TEST_CASE("RuntimeLoadNetworkInParallel")
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // A chain of additions, each with its own constant, so that there are several workloads and constant workloads
+    // to create and execute while loading. Signed32 keeps CpuRef from fusing the additions into one layer.
+    const int numAdditions = 16;
+    TensorInfo tensorInfo({ 4 }, DataType::Signed32);
+    TensorInfo constantInfo({ 4 }, DataType::Signed32, 0.0f, 0, true);
+    std::vector<std::vector<int>> constantData;
+    constantData.reserve(numAdditions);
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* previous = net->AddInputLayer(0);
+    previous->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    for (int i = 1; i <= numAdditions; ++i)
+    {
+        constantData.emplace_back(4, i);
+        IConnectableLayer* constant = net->AddConstantLayer(ConstTensor(constantInfo, constantData.back().data()));
+        constant->GetOutputSlot(0).SetTensorInfo(constantInfo);
+        IConnectableLayer* add = net->AddElementwiseBinaryLayer(BinaryOperation::Add);
+        add->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+        previous->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+        constant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+        previous = add;
+    }
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    previous->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    std::string errorMessage;
+    armnn::INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined,
+                                                false, ProfilingDetailsMethod::Undefined, false, 4);
+    armnn::NetworkId netId;
+    REQUIRE(runtime->LoadNetwork(netId, std::move(optNet), errorMessage, networkProperties) == Status::Success);
+
+    std::vector<int> inputData = { 1, 2, 3, 4 };
+    std::vector<int> outputData(4);
+    InputTensors inputTensors{ { 0, ConstTensor(constantInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(tensorInfo, outputData.data()) } };
+    REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+    // 1 + 2 + ... + 16 = 136 has been added to every element.
+    CHECK(outputData == std::vector<int>({ 137, 138, 139, 140 }));
+}
+
+// Creates a network of independent branches on a Signed32 { 4 } input, whose output is 18 times the input.
+armnn::INetworkPtr CreateIndependentBranchesNetwork()
+{
+    using namespace armnn;
+
+    // Independent branches, each a chain of additions of the input to itself, which are summed up at the end.
+    // Signed32 keeps CpuRef from fusing the additions into one layer.
+    const int numBranches = 4;
+    TensorInfo tensorInfo({ 4 }, DataType::Signed32);
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    IConnectableLayer* sum = nullptr;
+    for (int branch = 0; branch < numBranches; ++branch)
+    {
+        // Branch b computes (b + 3) * input.
+        IConnectableLayer* previous = input;
+        for (int i = 0; i < branch + 2; ++i)
+        {
+            IConnectableLayer* add = net->AddElementwiseBinaryLayer(BinaryOperation::Add);
+            add->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+            previous->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+            input->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+            previous = add;
+        }
+
+        if (sum == nullptr)
+        {
+            sum = previous;
+            continue;
+        }
+        IConnectableLayer* add = net->AddElementwiseBinaryLayer(BinaryOperation::Add);
+        add->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        sum->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+        previous->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+        sum = add;
+    }
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    sum->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    return net;
+}
+
+TEST_CASE("RuntimeParallelExecution")
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    TensorInfo tensorInfo({ 4 }, DataType::Signed32);
+    TensorInfo inputInfo({ 4 }, DataType::Signed32, 0.0f, 0, true);
+    INetworkPtr net = CreateIndependentBranchesNetwork();
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    std::string errorMessage;
+    armnn::INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined,
+                                                false, ProfilingDetailsMethod::Undefined, false, 1, 4);
+    armnn::NetworkId netId;
+    REQUIRE(runtime->LoadNetwork(netId, std::move(optNet), errorMessage, networkProperties) == Status::Success);
+
+    std::vector<int> inputData = { 1, 2, 3, 4 };
+    std::vector<int> outputData(4);
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(tensorInfo, outputData.data()) } };
+
+    // 3 + 4 + 5 + 6 times the input.
+    const std::vector<int> expectedOutput = { 18, 36, 54, 72 };
+    for (int i = 0; i < 10; ++i)
+    {
+        std::fill(outputData.begin(), outputData.end(), 0);
+        REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        CHECK(outputData == expectedOutput);
+    }
+
+    auto executionBinding = runtime->CreateExecutionBinding(netId, inputTensors, outputTensors);
+    std::fill(outputData.begin(), outputData.end(), 0);
+    REQUIRE(runtime->EnqueueWorkload(*executionBinding) == Status::Success);
+    CHECK(outputData == expectedOutput);
+
+    // With the profiler enabled the network is executed serially from the workload queue, recording its events.
+    runtime->GetProfiler(netId)->EnableProfiling(true);
+    std::fill(outputData.begin(), outputData.end(), 0);
+    REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == expectedOutput);
+
+    std::stringstream ss;
+    runtime->GetProfiler(netId)->Print(ss);
+    CHECK(ss.str().find("RefElementwiseBinaryWorkload_Execute") != std::string::npos);
+}
+
+TEST_CASE("RuntimeParallelExecutionWithExternalMemoryManagement")
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    TensorInfo tensorInfo({ 4 }, DataType::Signed32);
+    TensorInfo inputInfo({ 4 }, DataType::Signed32, 0.0f, 0, true);
+    INetworkPtr net = CreateIndependentBranchesNetwork();
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    // The memory plan of external memory management assumes serial execution, so the network executes serially.
+    std::string errorMessage;
+    armnn::INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined,
+                                                false, ProfilingDetailsMethod::Undefined, true, 1, 4);
+    armnn::NetworkId netId;
+    REQUIRE(runtime->LoadNetwork(netId, std::move(optNet), errorMessage, networkProperties) == Status::Success);
+
+    std::vector<int> inputData = { 1, 2, 3, 4 };
+    std::vector<int> outputData(4);
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(tensorInfo, outputData.data()) } };
+
+    const std::vector<int> expectedOutput = { 18, 36, 54, 72 };
+    for (int i = 0; i < 10; ++i)
+    {
+        std::fill(outputData.begin(), outputData.end(), 0);
+        REQUIRE(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        CHECK(outputData == expectedOutput);
+    }
+
+    // Only the same network without external memory management executes its branches in parallel.
+    RuntimeImpl runtimeImpl(options);
+    for (bool externalMemoryManagementEnabled : { true, false })
+    {
+        INetworkPtr branchesNet = CreateIndependentBranchesNetwork();
+        IOptimizedNetworkPtr branchesOptNet = Optimize(*branchesNet, backends, runtimeImpl.GetDeviceSpec());
+        const INetworkProperties properties(false, MemorySource::Undefined, MemorySource::Undefined, false,
+                                            ProfilingDetailsMethod::Undefined, externalMemoryManagementEnabled,
+                                            1, 4);
+        std::unique_ptr<LoadedNetwork> loadedNetwork = LoadedNetwork::MakeLoadedNetwork(
+            std::unique_ptr<IOptimizedNetwork>(branchesOptNet.release()), errorMessage, properties,
+            &GetProfilingService(&runtimeImpl));
+        REQUIRE_MESSAGE(loadedNetwork, errorMessage);
+#if !defined(ARMNN_DISABLE_THREADS)
+        CHECK(loadedNetwork->IsParallelExecutionEnabled() == !externalMemoryManagementEnabled);
+#else
+        CHECK(!loadedNetwork->IsParallelExecutionEnabled());
+#endif
+    }
+}
+
 TEST_CASE("RuntimeFallbackToCpuRef")
 {
     using namespace armnn;
@@ -1549,4 +1752,119 @@ TEST_CASE("SyncExecutePreImportInputsHappyPath")
                                         std::vector<ImportedOutputId>());
     REQUIRE(ret == Status::Success);
 }
+
+TEST_CASE("SyncExecuteExecutionBinding")
+{
+    // * Create a small network that takes two inputs.
+    // * Bind a fixed set of input and output buffers to it and execute the binding repeatedly, changing the
+    //   contents of the input buffers in between.
+    // * Interleave an EnqueueWorkload call using a pre-imported input, which rewires the network, and check the
+    //   binding still produces the right result afterwards.
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+    armnn::NetworkId networkId = 1;
+    armnn::INetworkPtr testNetwork(armnn::INetwork::Create());
+
+    auto inputLayer1 = testNetwork->AddInputLayer(0, "input 1 layer");
+    auto inputLayer2 = testNetwork->AddInputLayer(1, "input 2 layer");
+    auto addLayer    = testNetwork->AddElementwiseBinaryLayer(BinaryOperation::Add, "add layer");
+    auto outputLayer = testNetwork->AddOutputLayer(2, "output layer");
+
+    TensorInfo tensorInfo{ { 4 }, armnn::DataType::Signed32 };
+
+    inputLayer1->GetOutputSlot(0).Connect(addLayer->GetInputSlot(0));
+    inputLayer1->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    inputLayer2->GetOutputSlot(0).Connect(addLayer->GetInputSlot(1));
+    inputLayer2->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    addLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+    addLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+
+    std::string er;
+    armnn::INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined);
+    runtime->LoadNetwork(networkId, Optimize(*testNetwork, backends, runtime->GetDeviceSpec()), er, networkProperties);
+
+    std::vector<int> inputData1(4, 10);
+    std::vector<int> inputData2(4, 20);
+    std::vector<int> output(4);
+
+    TensorInfo constInfo{ { 4 }, armnn::DataType::Signed32, 0.0f, 0, true };
+    ConstTensor inputTensor1(constInfo, inputData1.data());
+    ConstTensor inputTensor2(constInfo, inputData2.data());
+    Tensor outputTensor(tensorInfo, output.data());
+
+    // Missing, unknown and wrongly sized tensors are rejected when the binding is created.
+    CHECK_THROWS_AS(runtime->CreateExecutionBinding(networkId, { { 0, inputTensor1 } }, { { 2, outputTensor } }),
+                    armnn::InvalidArgumentException);
+    CHECK_THROWS_AS(runtime->CreateExecutionBinding(networkId,
+                                                    { { 0, inputTensor1 }, { 3, inputTensor2 } },
+                                                    { { 2, outputTensor } }),
+                    armnn::InvalidArgumentException);
+    std::vector<int> smallInputData(2);
+    ConstTensor smallInputTensor({ { 2 }, armnn::DataType::Signed32, 0.0f, 0, true }, smallInputData.data());
+    CHECK_THROWS_AS(runtime->CreateExecutionBinding(networkId,
+                                                    { { 0, inputTensor1 }, { 1, smallInputTensor } },
+                                                    { { 2, outputTensor } }),
+                    armnn::InvalidArgumentException);
+
+    // So are unknown and async enabled networks.
+    CHECK_THROWS_AS(runtime->CreateExecutionBinding(networkId + 1,
+                                                    { { 0, inputTensor1 }, { 1, inputTensor2 } },
+                                                    { { 2, outputTensor } }),
+                    armnn::InvalidArgumentException);
+    armnn::NetworkId asyncNetworkId = networkId + 1;
+    armnn::INetworkProperties asyncNetworkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+    runtime->LoadNetwork(asyncNetworkId,
+                         Optimize(*testNetwork, backends, runtime->GetDeviceSpec()),
+                         er,
+                         asyncNetworkProperties);
+    CHECK_THROWS_AS(runtime->CreateExecutionBinding(asyncNetworkId,
+                                                    { { 0, inputTensor1 }, { 1, inputTensor2 } },
+                                                    { { 2, outputTensor } }),
+                    armnn::InvalidArgumentException);
+
+    auto executionBinding = runtime->CreateExecutionBinding(networkId,
+                                                            { { 0, inputTensor1 }, { 1, inputTensor2 } },
+                                                            { { 2, outputTensor } });
+    REQUIRE(executionBinding);
+    CHECK(executionBinding->GetNetworkId() == networkId);
+
+    REQUIRE(runtime->EnqueueWorkload(*executionBinding) == Status::Success);
+    CHECK(output == std::vector<int>(4, 30));
+
+    // The binding reads the current contents of the bound buffers on every execution.
+    std::fill(inputData1.begin(), inputData1.end(), 5);
+    REQUIRE(runtime->EnqueueWorkload(*executionBinding) == Status::Success);
+    CHECK(output == std::vector<int>(4, 25));
+
+    // Execute the network on other buffers with a pre-imported input in between.
+    std::vector<int> otherInputData1(4, 1);
+    std::vector<int> otherInputData2(4, 2);
+    std::vector<int> otherOutput(4);
+    std::vector<ImportedInputId> importedInputVec =
+        runtime->ImportInputs(networkId, { { 0, ConstTensor(constInfo, otherInputData1.data()) } },
+                              MemorySource::Malloc);
+    REQUIRE(importedInputVec.size() == 1);
+    REQUIRE(runtime->EnqueueWorkload(networkId,
+                                     { { 1, ConstTensor(constInfo, otherInputData2.data()) } },
+                                     { { 2, Tensor(tensorInfo, otherOutput.data()) } },
+                                     importedInputVec,
+                                     std::vector<ImportedOutputId>()) == Status::Success);
+    CHECK(otherOutput == std::vector<int>(4, 3));
+
+    std::fill(output.begin(), output.end(), 0);
+    REQUIRE(runtime->EnqueueWorkload(*executionBinding) == Status::Success);
+    CHECK(output == std::vector<int>(4, 25));
+    CHECK(otherOutput == std::vector<int>(4, 3));
+
+    // A binding whose network has been unloaded fails instead of touching the freed network.
+    REQUIRE(runtime->UnloadNetwork(networkId) == Status::Success);
+    std::fill(output.begin(), output.end(), 0);
+    CHECK(runtime->EnqueueWorkload(*executionBinding) == Status::Failure);
+    CHECK(output == std::vector<int>(4, 0));
+}
 }
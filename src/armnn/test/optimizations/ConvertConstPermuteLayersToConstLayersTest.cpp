@@ -1,5 +1,5 @@
 //
-// Copyright © 2022 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022,2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -57,4 +57,43 @@ TEST_CASE("ConvertConstPermuteToConst")
 
 }
 
+TEST_CASE("ConvertConstPermuteToConstKeepsSharedConstant")
+{
+    Graph graph;
+    const unsigned int shape[]  = {1, 2, 2, 3};
+
+    const TensorInfo constTensorInfo(4, shape, DataType::Float32, 1.0, 0, true);
+
+    ConstantLayer* constant = graph.AddLayer<ConstantLayer>("constant");
+    std::vector<float> constantValues(constTensorInfo.GetNumElements(), 4.5f);
+    ConstTensor constTensor(constTensorInfo, constantValues.data());
+    constant->m_LayerOutput = std::make_shared<ScopedTensorHandle>(constTensor);
+    constant->GetOutputSlot().SetTensorInfo(constTensorInfo);
+
+    PermuteDescriptor desc({ 0, 2, 3, 1 });
+    PermuteLayer* permuteLayer = graph.AddLayer<PermuteLayer>(desc, "permute");
+    TensorInfo infoPermuted = armnnUtils::Permuted(constTensorInfo, { 0, 2, 3, 1 });
+    permuteLayer->GetOutputSlot().SetTensorInfo(infoPermuted);
+
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+    OutputLayer* constantOutput = graph.AddLayer<OutputLayer>(1, "constantOutput");
+
+    // Connect up constant -> permute -> output, and constant -> constantOutput
+    constant->GetOutputSlot().Connect(permuteLayer->GetInputSlot(0));
+    constant->GetOutputSlot().Connect(constantOutput->GetInputSlot(0));
+    permuteLayer->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FusePermuteIntoConstLayer()));
+
+    // The constant still feeds constantOutput unpermuted, and output gets a permuted constant of its own.
+    CHECK(graph.GetNumLayers() == 4);
+    CHECK(&constantOutput->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == constant);
+    CHECK(constant->GetOutputSlot(0).GetTensorInfo().GetShape() == constTensorInfo.GetShape());
+
+    const Layer& permutedConstant = output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    CHECK(permutedConstant.GetType() == LayerType::Constant);
+    CHECK(&permutedConstant != constant);
+    CHECK(permutedConstant.GetOutputSlot(0).GetTensorInfo().GetShape() == infoPermuted.GetShape());
+}
+
 }
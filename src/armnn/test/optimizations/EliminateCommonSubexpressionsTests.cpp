@@ -0,0 +1,116 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayersFwd.hpp"
+#include <Network.hpp>
+#include <TestUtils.hpp>
+#include <doctest/doctest.h>
+#include <armnn/backends/TensorHandle.hpp>
+#include <Optimizer.hpp>
+
+#include <vector>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+ConstantLayer* AddConstantLayer(Graph& graph, const TensorInfo& info, const std::vector<float>& values)
+{
+    ConstantLayer* constantLayer = graph.AddLayer<ConstantLayer>("constant");
+    constantLayer->m_LayerOutput = std::make_shared<ScopedTensorHandle>(ConstTensor(info, values));
+    constantLayer->GetOutputSlot(0).SetTensorInfo(info);
+    return constantLayer;
+}
+
+/// input -> mul (by a constant) -> activation -> output, as one head of a multi-head model.
+Layer* AddHead(Graph& graph,
+               Layer* input,
+               const std::vector<float>& scale,
+               const ActivationDescriptor& activationDescriptor,
+               const TensorInfo& outputInfo,
+               LayerBindingId outputId)
+{
+    const TensorInfo scaleInfo({ 1, 4 }, DataType::Float32, 0.0f, 0, true);
+    Layer* mul = graph.AddLayer<ElementwiseBinaryLayer>(BinaryOperation::Mul, "mul");
+    mul->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    Layer* activation = graph.AddLayer<ActivationLayer>(activationDescriptor, "activation");
+    activation->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    Layer* output = graph.AddLayer<OutputLayer>(outputId, "output");
+
+    input->GetOutputSlot(0).Connect(mul->GetInputSlot(0));
+    AddConstantLayer(graph, scaleInfo, scale)->GetOutputSlot(0).Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    return output;
+}
+
+const Layer& GetProducer(const Layer* layer, unsigned int inputIndex = 0)
+{
+    return layer->GetInputSlot(inputIndex).GetConnectedOutputSlot()->GetOwningLayer();
+}
+
+} // anonymous namespace
+
+TEST_CASE("EliminateCommonSubexpressionsMergesRepeatedHeads")
+{
+    Graph graph;
+    const TensorInfo info({ 2, 4 }, DataType::Float32);
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(info);
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+    Layer* output0 = AddHead(graph, input, { 1, 2, 3, 4 }, reluDescriptor, info, 0);
+    Layer* output1 = AddHead(graph, input, { 1, 2, 3, 4 }, reluDescriptor, info, 1);
+    Layer* output2 = AddHead(graph, input, { 1, 2, 3, 4 }, reluDescriptor, info, 2);
+    CHECK(graph.GetNumLayers() == 13);
+
+    // The constants, the Muls and the activations of the last two heads all go.
+    CHECK(EliminateCommonSubexpressions::Run(graph) == 6);
+
+    CHECK(graph.GetNumLayers() == 7);
+    const Layer& activation = GetProducer(output0);
+    CHECK(&GetProducer(output1) == &activation);
+    CHECK(&GetProducer(output2) == &activation);
+    CHECK(GetProducer(&activation).GetType() == LayerType::ElementwiseBinary);
+    CHECK(GetProducer(&GetProducer(&activation), 1).GetOutputSlot(0).GetNumConnections() == 1);
+}
+
+TEST_CASE("EliminateCommonSubexpressionsKeepsDifferentLayers")
+{
+    Graph graph;
+    const TensorInfo info({ 2, 4 }, DataType::Float32);
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(info);
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+    ActivationDescriptor sigmoidDescriptor;
+    sigmoidDescriptor.m_Function = ActivationFunction::Sigmoid;
+
+    // Different constants, different activations, and different output tensor infos.
+    Layer* output0 = AddHead(graph, input, { 1, 2, 3, 4 }, reluDescriptor, info, 0);
+    Layer* output1 = AddHead(graph, input, { 1, 2, 3, 5 }, reluDescriptor, info, 1);
+    Layer* output2 = AddHead(graph, input, { 1, 2, 3, 4 }, sigmoidDescriptor, info, 2);
+    Layer* output3 = AddHead(graph, input, { 1, 2, 3, 4 }, reluDescriptor,
+                             TensorInfo({ 2, 4 }, DataType::Float32, 0.5f, 0), 3);
+
+    // Only the Mul of the third head equals that of the first head. The constant of the last head is merged too,
+    // but not its Mul, whose output is quantized differently.
+    CHECK(EliminateCommonSubexpressions::Run(graph) == 3);
+
+    CHECK(graph.GetNumLayers() == 14);
+    CHECK(&GetProducer(output0) != &GetProducer(output1));
+    CHECK(&GetProducer(output0) != &GetProducer(output2));
+    CHECK(&GetProducer(output0) != &GetProducer(output3));
+    CHECK(&GetProducer(&GetProducer(output0)) == &GetProducer(&GetProducer(output2)));
+    CHECK(&GetProducer(&GetProducer(output0)) != &GetProducer(&GetProducer(output1)));
+}
+
+}
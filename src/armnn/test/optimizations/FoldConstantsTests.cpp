@@ -0,0 +1,179 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayersFwd.hpp"
+#include <Network.hpp>
+#include <TestUtils.hpp>
+#include <doctest/doctest.h>
+#include <armnn/backends/TensorHandle.hpp>
+#include <Optimizer.hpp>
+
+#include <vector>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+ConstantLayer* AddConstantLayer(Graph& graph, const TensorInfo& info, const std::vector<float>& values,
+                                const char* name)
+{
+    ConstantLayer* constantLayer = graph.AddLayer<ConstantLayer>(name);
+    constantLayer->m_LayerOutput = std::make_shared<ScopedTensorHandle>(ConstTensor(info, values));
+    constantLayer->GetOutputSlot(0).SetTensorInfo(info);
+    return constantLayer;
+}
+
+template <typename T>
+std::vector<T> GetConstantValues(const Layer* layer)
+{
+    const auto constantLayer = PolymorphicDowncast<const ConstantLayer*>(layer);
+    const T* values = constantLayer->m_LayerOutput->GetConstTensor<T>();
+    return std::vector<T>(values, values + constantLayer->m_LayerOutput->GetTensorInfo().GetNumElements());
+}
+
+} // anonymous namespace
+
+#if defined(ARMNNREF_ENABLED)
+TEST_CASE("FoldConstantSubgraphIntoConstantLayer")
+{
+    // constant0 -> transpose -+
+    //                         +-> add -> reshape -> mul -> output
+    //               constant1 +                    ^
+    //                                   input -----+
+    Graph graph;
+    const TensorInfo constantInfo({ 2, 3 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo transposedInfo({ 3, 2 }, DataType::Float32);
+    const TensorInfo reshapedInfo({ 1, 6 }, DataType::Float32);
+
+    ConstantLayer* constant0 = AddConstantLayer(graph, constantInfo, { 1, 2, 3, 4, 5, 6 }, "constant0");
+    ConstantLayer* constant1 = AddConstantLayer(graph, TensorInfo({ 3, 2 }, DataType::Float32, 0.0f, 0, true),
+                                                { 10, 20, 30, 40, 50, 60 }, "constant1");
+
+    Layer* transpose = graph.AddLayer<TransposeLayer>(TransposeDescriptor({ 1, 0 }), "transpose");
+    transpose->GetOutputSlot(0).SetTensorInfo(transposedInfo);
+    Layer* add = graph.AddLayer<ElementwiseBinaryLayer>(BinaryOperation::Add, "add");
+    add->GetOutputSlot(0).SetTensorInfo(transposedInfo);
+    ReshapeDescriptor reshapeDescriptor;
+    reshapeDescriptor.m_TargetShape = reshapedInfo.GetShape();
+    Layer* reshape = graph.AddLayer<ReshapeLayer>(reshapeDescriptor, "reshape");
+    reshape->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+    Layer* mul = graph.AddLayer<ElementwiseBinaryLayer>(BinaryOperation::Mul, "mul");
+    mul->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    constant0->GetOutputSlot(0).Connect(transpose->GetInputSlot(0));
+    transpose->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    constant1->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot(0).Connect(mul->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    CHECK(graph.GetNumLayers() == 8);
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstants()));
+
+    CHECK(graph.GetNumLayers() == 4);
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<ElementwiseBinaryLayer>,
+                        &IsLayerOfType<OutputLayer>));
+
+    const Layer* folded = &mul->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    REQUIRE(folded->GetType() == LayerType::Constant);
+    CHECK(folded->GetOutputSlot(0).GetTensorInfo().GetShape() == reshapedInfo.GetShape());
+    CHECK(folded->GetOutputSlot(0).GetTensorInfo().IsConstant());
+    CHECK(GetConstantValues<float>(folded) == std::vector<float>({ 11, 24, 32, 45, 53, 66 }));
+}
+#endif
+
+TEST_CASE("FoldShapeOfInputIntoConstantLayer")
+{
+    Graph graph;
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 4, 5, 3 }, DataType::Float32));
+    Layer* shape = graph.AddLayer<ShapeLayer>("shape");
+    shape->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 4 }, DataType::Signed32));
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+    Layer* inputOutput = graph.AddLayer<OutputLayer>(1, "inputOutput");
+
+    input->GetOutputSlot(0).Connect(shape->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(inputOutput->GetInputSlot(0));
+    shape->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstants()));
+
+    CHECK(graph.GetNumLayers() == 4);
+    const Layer* folded = &output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    REQUIRE(folded->GetType() == LayerType::Constant);
+    CHECK(GetConstantValues<int32_t>(folded) == std::vector<int32_t>({ 1, 4, 5, 3 }));
+}
+
+TEST_CASE("DoNotFoldLayersWithNonConstantInputs")
+{
+    Graph graph;
+    const TensorInfo info({ 2, 2 }, DataType::Float32, 0.0f, 0, true);
+
+    ConstantLayer* constant = AddConstantLayer(graph, info, { 1, 2, 3, 4 }, "constant");
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 2 }, DataType::Float32));
+    Layer* add = graph.AddLayer<ElementwiseBinaryLayer>(BinaryOperation::Add, "add");
+    add->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 2 }, DataType::Float32));
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    constant->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstants()));
+
+    CHECK(graph.GetNumLayers() == 4);
+    CHECK(&add->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == constant);
+    CHECK(&output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == add);
+}
+
+#if defined(ARMNNREF_ENABLED)
+TEST_CASE("DoNotFoldLayersExpandingConstantsPastTheLimit")
+{
+    // constant -> smallTile -> output0
+    //          -> largeTile -> output1
+    Graph graph;
+    ConstantLayer* constant = AddConstantLayer(graph, TensorInfo({ 2 }, DataType::Float32, 0.0f, 0, true),
+                                               { 1, 2 }, "constant");
+
+    // The large tile outputs twice MaxExpandedOutputBytes, the small one 16 bytes.
+    const unsigned int largeMultiple = FoldConstantsImpl::MaxExpandedOutputBytes / sizeof(float);
+    Layer* smallTile = graph.AddLayer<TileLayer>(TileDescriptor({ 2 }), "smallTile");
+    smallTile->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 4 }, DataType::Float32));
+    Layer* largeTile = graph.AddLayer<TileLayer>(TileDescriptor({ largeMultiple }), "largeTile");
+    largeTile->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2 * largeMultiple }, DataType::Float32));
+    Layer* output0 = graph.AddLayer<OutputLayer>(0, "output0");
+    Layer* output1 = graph.AddLayer<OutputLayer>(1, "output1");
+
+    constant->GetOutputSlot(0).Connect(smallTile->GetInputSlot(0));
+    constant->GetOutputSlot(0).Connect(largeTile->GetInputSlot(0));
+    smallTile->GetOutputSlot(0).Connect(output0->GetInputSlot(0));
+    largeTile->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, MakeOptimizations(FoldConstants()));
+
+    const Layer* folded = &output0->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    REQUIRE(folded->GetType() == LayerType::Constant);
+    CHECK(GetConstantValues<float>(folded) == std::vector<float>({ 1, 2, 1, 2 }));
+
+    CHECK(&output1->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == largeTile);
+    CHECK(&largeTile->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == constant);
+}
+#endif
+
+}
@@ -1344,3 +1344,124 @@ TEST_CASE("LayerFollowedByActivationQAsymmU8GpuAccTest")
 }
 }
 #endif
+
+#if defined(ARMNNREF_ENABLED)
+TEST_SUITE("Optimizer")
+{
+// ReLu fused into Receiver Layers Float32
+TEST_CASE("FuseReLUIntoConvFloat32CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    FuseActivationIntoPreviousLayerTest<Convolution2dTest<DataType::Float32>, DataType::Float32>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+TEST_CASE("FuseReLUIntoDWConvFloat32CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    FuseActivationIntoPreviousLayerTest<DWConvolution2dTest<DataType::Float32>, DataType::Float32>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+TEST_CASE("FuseReLUIntoFullyConnectedFloat32CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    FuseActivationIntoPreviousLayerTest<FullyConnectedTest<DataType::Float32>, DataType::Float32>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+
+// BoundedReLu fused into Receiver Layers Float32
+TEST_CASE("FuseBoundedReLUIntoConvFloat32CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 1.0f;
+    activationDescriptor.m_B = -1.0f;
+
+    FuseActivationIntoPreviousLayerTest<Convolution2dTest<DataType::Float32>, DataType::Float32>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+TEST_CASE("FuseBoundedReLUIntoDWConvFloat32CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 1.0f;
+    activationDescriptor.m_B = -1.0f;
+
+    FuseActivationIntoPreviousLayerTest<DWConvolution2dTest<DataType::Float32>, DataType::Float32>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+TEST_CASE("FuseBoundedReLUIntoFullyConnectedFloat32CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 1.0f;
+    activationDescriptor.m_B = -1.0f;
+
+    FuseActivationIntoPreviousLayerTest<FullyConnectedTest<DataType::Float32>, DataType::Float32>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+
+// Sigmoid fused into Receiver Layers Float32
+TEST_CASE("FuseSigmoidIntoConvFloat32CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::Sigmoid;
+
+    FuseActivationIntoPreviousLayerTest<Convolution2dTest<DataType::Float32>, DataType::Float32>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+TEST_CASE("FuseSigmoidIntoFullyConnectedFloat32CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::Sigmoid;
+
+    FuseActivationIntoPreviousLayerTest<FullyConnectedTest<DataType::Float32>, DataType::Float32>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+
+// ReLU fused into Receiver Layers QAsymmU8
+TEST_CASE("FuseReLUIntoConvQAsymmU8CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    FuseActivationIntoPreviousLayerTest<Convolution2dTest<DataType::QAsymmU8>, DataType::QAsymmU8>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+TEST_CASE("FuseReLUIntoFullyConnectedQAsymmU8CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    FuseActivationIntoPreviousLayerTest<FullyConnectedTest<DataType::QAsymmU8>, DataType::QAsymmU8>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+
+// BoundedReLu fused into Receiver Layers QAsymmS8
+TEST_CASE("FuseBoundedReLUIntoConvQASymmS8CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 6.0f;
+    activationDescriptor.m_B = 0.0f;
+
+    FuseActivationIntoPreviousLayerTest<Convolution2dTest<DataType::QAsymmS8>, DataType::QAsymmS8>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+TEST_CASE("FuseBoundedReLUIntoDWConvQASymmS8CpuRefTest")
+{
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 6.0f;
+    activationDescriptor.m_B = 0.0f;
+
+    FuseActivationIntoPreviousLayerTest<DWConvolution2dTest<DataType::QAsymmS8>, DataType::QAsymmS8>
+        (activationDescriptor, 0.0001f, Compute::CpuRef);
+}
+}
+#endif
@@ -0,0 +1,293 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayersFwd.hpp"
+#include <Network.hpp>
+#include <TestUtils.hpp>
+#include <doctest/doctest.h>
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+#include <backendsCommon/LayerSupportBase.hpp>
+#include <Optimizer.hpp>
+
+#include <vector>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+ConstantLayer* AddConstantLayer(Graph& graph, const TensorInfo& info, const std::vector<float>& values,
+                                const char* name)
+{
+    ConstantLayer* constantLayer = graph.AddLayer<ConstantLayer>(name);
+    constantLayer->m_LayerOutput = std::make_shared<ScopedTensorHandle>(ConstTensor(info, values));
+    constantLayer->GetOutputSlot(0).SetTensorInfo(info);
+    return constantLayer;
+}
+
+Layer* AddTransposeLayer(Graph& graph, const PermutationVector& mappings, const TensorInfo& outputInfo,
+                         const char* name)
+{
+    Layer* transpose = graph.AddLayer<TransposeLayer>(TransposeDescriptor(mappings), name);
+    transpose->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    return transpose;
+}
+
+Layer& GetProducer(Layer* layer, unsigned int inputIndex = 0)
+{
+    return layer->GetInputSlot(inputIndex).GetConnectedOutputSlot()->GetOwningLayer();
+}
+
+std::vector<float> GetConstantValues(const Layer& layer)
+{
+    const auto constantLayer = PolymorphicDowncast<const ConstantLayer*>(&layer);
+    const float* values = constantLayer->m_LayerOutput->GetConstTensor<float>();
+    return std::vector<float>(values, values + constantLayer->m_LayerOutput->GetTensorInfo().GetNumElements());
+}
+
+// Supports every layer, but Pooling2d only in NHWC.
+class NhwcPoolingLayerSupport : public LayerSupportBase
+{
+public:
+    bool IsLayerSupported(const LayerType& type,
+                          const std::vector<TensorInfo>& /*infos*/,
+                          const BaseDescriptor& descriptor,
+                          const Optional<LstmInputParamsInfo>& /*lstmParamsInfo*/,
+                          const Optional<QuantizedLstmInputParamsInfo>& /*quantizedLstmParamsInfo*/,
+                          Optional<std::string&> /*reasonIfUnsupported*/) const override
+    {
+        return type != LayerType::Pooling2d ||
+               PolymorphicDowncast<const Pooling2dDescriptor*>(&descriptor)->m_DataLayout == DataLayout::NHWC;
+    }
+};
+
+class NhwcPoolingBackend : public IBackendInternal
+{
+public:
+    static const BackendId& GetIdStatic()
+    {
+        static const BackendId id = "NhwcPoolingBackend";
+        return id;
+    }
+    const BackendId& GetId() const override
+    {
+        return GetIdStatic();
+    }
+
+    IBackendInternal::IMemoryManagerUniquePtr CreateMemoryManager() const override
+    {
+        return nullptr;
+    }
+
+    IBackendInternal::IWorkloadFactoryPtr
+        CreateWorkloadFactory(const IBackendInternal::IMemoryManagerSharedPtr&) const override
+    {
+        return nullptr;
+    }
+
+    IBackendInternal::IBackendContextPtr CreateBackendContext(const IRuntime::CreationOptions&) const override
+    {
+        return nullptr;
+    }
+
+    IBackendInternal::ILayerSupportSharedPtr GetLayerSupport() const override
+    {
+        return std::make_shared<NhwcPoolingLayerSupport>();
+    }
+
+    OptimizationViews OptimizeSubgraphView(const SubgraphView&) const override
+    {
+        return {};
+    }
+};
+
+// Registers NhwcPoolingBackend for the lifetime of a test.
+struct NhwcPoolingBackendRegistration
+{
+    NhwcPoolingBackendRegistration()
+    {
+        BackendRegistryInstance().Register(NhwcPoolingBackend::GetIdStatic(), []()
+        {
+            return IBackendInternalUniquePtr(new NhwcPoolingBackend);
+        });
+    }
+    ~NhwcPoolingBackendRegistration()
+    {
+        BackendRegistryInstance().Deregister(NhwcPoolingBackend::GetIdStatic());
+    }
+    const std::vector<BackendId> m_Backends = { NhwcPoolingBackend::GetIdStatic() };
+};
+
+} // anonymous namespace
+
+TEST_CASE("PropagateDataLayoutsRemovesTransposesAroundElementwiseLayers")
+{
+    // input (NHWC) -> transpose (to NCHW) -> activation -> add -> transpose (to NHWC) -> output
+    //                                        constant (NCHW) -^
+    NhwcPoolingBackendRegistration registration;
+    Graph graph;
+    const TensorInfo nhwcInfo({ 1, 2, 2, 3 }, DataType::Float32);
+    const TensorInfo nchwInfo({ 1, 3, 2, 2 }, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(nhwcInfo);
+    Layer* toNchw = AddTransposeLayer(graph, { 0, 3, 1, 2 }, nchwInfo, "toNchw");
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+    Layer* activation = graph.AddLayer<ActivationLayer>(activationDescriptor, "activation");
+    activation->GetOutputSlot(0).SetTensorInfo(nchwInfo);
+    ConstantLayer* constant = AddConstantLayer(graph, TensorInfo({ 1, 3, 1, 1 }, DataType::Float32, 0.0f, 0, true),
+                                               { 1, 2, 3 }, "constant");
+    Layer* add = graph.AddLayer<ElementwiseBinaryLayer>(BinaryOperation::Add, "add");
+    add->GetOutputSlot(0).SetTensorInfo(nchwInfo);
+    Layer* toNhwc = AddTransposeLayer(graph, { 0, 2, 3, 1 }, nhwcInfo, "toNhwc");
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot(0).Connect(toNchw->GetInputSlot(0));
+    toNchw->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    constant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(toNhwc->GetInputSlot(0));
+    toNhwc->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    CHECK(PropagateDataLayouts::Run(graph, registration.m_Backends) == 2);
+
+    CHECK(graph.GetNumLayers() == 5);
+    CHECK(&GetProducer(output) == add);
+    CHECK(&GetProducer(activation) == input);
+    CHECK(&GetProducer(add) == activation);
+    CHECK(activation->GetOutputSlot(0).GetTensorInfo().GetShape() == nhwcInfo.GetShape());
+    CHECK(add->GetOutputSlot(0).GetTensorInfo().GetShape() == nhwcInfo.GetShape());
+
+    const Layer& transposedConstant = GetProducer(add, 1);
+    REQUIRE(transposedConstant.GetType() == LayerType::Constant);
+    CHECK(transposedConstant.GetOutputSlot(0).GetTensorInfo().GetShape() == TensorShape({ 1, 1, 1, 3 }));
+    CHECK(transposedConstant.GetOutputSlot(0).GetTensorInfo().IsConstant());
+    CHECK(GetConstantValues(transposedConstant) == std::vector<float>({ 1, 2, 3 }));
+}
+
+TEST_CASE("PropagateDataLayoutsSwitchesConvolution2dToNhwc")
+{
+    // input (NHWC) -> permute (to NCHW) -> conv2d (NCHW) -> transpose (to NHWC) -> output
+    //                   weights (OIHW) -^
+    NhwcPoolingBackendRegistration registration;
+    Graph graph;
+    const TensorInfo inputInfo({ 1, 3, 3, 2 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 3, 2, 2 }, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    // The Permute equivalent of the NHWC to NCHW transpose.
+    Layer* toNchw = graph.AddLayer<PermuteLayer>(PermuteDescriptor({ 0, 2, 3, 1 }), "toNchw");
+    toNchw->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 2, 3, 3 }, DataType::Float32));
+
+    ConstantLayer* weights = AddConstantLayer(graph, TensorInfo({ 2, 2, 1, 2 }, DataType::Float32, 0.0f, 0, true),
+                                              { 0, 1, 2, 3, 4, 5, 6, 7 }, "weights");
+    Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_BiasEnabled = false;
+    convolutionDescriptor.m_StrideX = 1;
+    convolutionDescriptor.m_StrideY = 1;
+    convolutionDescriptor.m_DataLayout = DataLayout::NCHW;
+    Layer* convolution = graph.AddLayer<Convolution2dLayer>(convolutionDescriptor, "conv2d");
+    convolution->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 2, 3, 2 }, DataType::Float32));
+    Layer* toNhwc = AddTransposeLayer(graph, { 0, 2, 3, 1 }, outputInfo, "toNhwc");
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot(0).Connect(toNchw->GetInputSlot(0));
+    toNchw->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+    weights->GetOutputSlot(0).Connect(convolution->GetInputSlot(1));
+    convolution->GetOutputSlot(0).Connect(toNhwc->GetInputSlot(0));
+    toNhwc->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    CHECK(PropagateDataLayouts::Run(graph, registration.m_Backends) == 2);
+
+    // The convolution is replaced by one with the new layout.
+    CHECK(graph.GetNumLayers() == 4);
+    Layer& newConvolution = GetProducer(output);
+    REQUIRE(newConvolution.GetType() == LayerType::Convolution2d);
+    CHECK(newConvolution.GetNameStr() == "conv2d");
+    CHECK(PolymorphicDowncast<Convolution2dLayer*>(&newConvolution)->GetParameters().m_DataLayout ==
+          DataLayout::NHWC);
+    CHECK(newConvolution.GetOutputSlot(0).GetTensorInfo().GetShape() == outputInfo.GetShape());
+    CHECK(&GetProducer(&newConvolution) == input);
+
+    // The weights are now OHWI.
+    const Layer& newWeights = GetProducer(&newConvolution, 1);
+    REQUIRE(newWeights.GetType() == LayerType::Constant);
+    CHECK(newWeights.GetOutputSlot(0).GetTensorInfo().GetShape() == TensorShape({ 2, 1, 2, 2 }));
+    CHECK(GetConstantValues(newWeights) == std::vector<float>({ 0, 2, 1, 3, 4, 6, 5, 7 }));
+}
+
+TEST_CASE("PropagateDataLayoutsKeepsLayoutWithoutGain")
+{
+    // Removing the transpose would only need one in front of the output instead.
+    NhwcPoolingBackendRegistration registration;
+    Graph graph;
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 2, 2, 3 }, DataType::Float32));
+    Layer* toNchw = AddTransposeLayer(graph, { 0, 3, 1, 2 }, TensorInfo({ 1, 3, 2, 2 }, DataType::Float32), "toNchw");
+    Layer* floor = graph.AddLayer<FloorLayer>("floor");
+    floor->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 3, 2, 2 }, DataType::Float32));
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot(0).Connect(toNchw->GetInputSlot(0));
+    toNchw->GetOutputSlot(0).Connect(floor->GetInputSlot(0));
+    floor->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    CHECK(PropagateDataLayouts::Run(graph, registration.m_Backends) == 0);
+
+    CHECK(graph.GetNumLayers() == 4);
+    CHECK(&GetProducer(floor) == toNchw);
+    CHECK(floor->GetOutputSlot(0).GetTensorInfo().GetShape() == TensorShape({ 1, 3, 2, 2 }));
+}
+
+TEST_CASE("PropagateDataLayoutsKeepsLayoutUnsupportedByBackend")
+{
+    // input (NCHW) -> transpose (to NHWC) -> pooling2d (NHWC) -> transpose (to NCHW) -> output
+    // Switching the pooling to NCHW would remove both transposes, but the backend only runs it in NHWC.
+    NhwcPoolingBackendRegistration registration;
+    Graph graph;
+    const TensorInfo nchwInfo({ 1, 3, 2, 2 }, DataType::Float32);
+    const TensorInfo nhwcInfo({ 1, 2, 2, 3 }, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(nchwInfo);
+    Layer* toNhwc = AddTransposeLayer(graph, { 0, 2, 3, 1 }, nhwcInfo, "toNhwc");
+    Pooling2dDescriptor poolingDescriptor;
+    poolingDescriptor.m_PoolType = PoolingAlgorithm::Max;
+    poolingDescriptor.m_PoolWidth = 1;
+    poolingDescriptor.m_PoolHeight = 1;
+    poolingDescriptor.m_StrideX = 1;
+    poolingDescriptor.m_StrideY = 1;
+    poolingDescriptor.m_DataLayout = DataLayout::NHWC;
+    Layer* pooling = graph.AddLayer<Pooling2dLayer>(poolingDescriptor, "pooling2d");
+    pooling->GetOutputSlot(0).SetTensorInfo(nhwcInfo);
+    Layer* toNchw = AddTransposeLayer(graph, { 0, 3, 1, 2 }, nchwInfo, "toNchw");
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot(0).Connect(toNhwc->GetInputSlot(0));
+    toNhwc->GetOutputSlot(0).Connect(pooling->GetInputSlot(0));
+    pooling->GetOutputSlot(0).Connect(toNchw->GetInputSlot(0));
+    toNchw->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    CHECK(PropagateDataLayouts::Run(graph, registration.m_Backends) == 0);
+
+    CHECK(graph.GetNumLayers() == 5);
+    CHECK(&GetProducer(pooling) == toNhwc);
+    CHECK(PolymorphicDowncast<Pooling2dLayer*>(pooling)->GetParameters().m_DataLayout == DataLayout::NHWC);
+
+#if defined(ARMNNREF_ENABLED)
+    // A backend running the pooling in either layout lets the switch go ahead.
+    CHECK(PropagateDataLayouts::Run(graph, { Compute::CpuRef }) == 2);
+    CHECK(graph.GetNumLayers() == 3);
+#endif
+}
+
+}
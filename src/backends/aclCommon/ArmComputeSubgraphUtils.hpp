@@ -13,62 +13,6 @@
 namespace armnn
 {
 
-namespace
-{
-
-//
-// this helper only works if all layers where the inputs connect to are not selected
-//
-
-bool checkDataTypeInputandOutput(const Layer& layer)
-{
-    auto inputInfo = layer.GetInputSlot(0).GetTensorInfo();
-    auto outputInfo = layer.GetOutputSlot(0).GetTensorInfo();
-    bool sameDataType = (inputInfo.GetDataType() == outputInfo.GetDataType());
-
-    // Check is same quantization info (same scale and offset)
-    if (sameDataType)
-    {
-        if (IsQuantizedType(inputInfo.GetDataType()))
-        {
-            bool sameScale = (inputInfo.GetQuantizationScale() == outputInfo.GetQuantizationScale());
-            bool sameOffset = (inputInfo.GetQuantizationOffset() == outputInfo.GetQuantizationOffset());
-
-            return (sameScale && sameOffset);
-        }
-        else
-        {
-            return true;
-        }
-    }
-    else
-    {
-        return false;
-    }
-}
-
-} // namespace
-
-template<typename LayerType>
-LayerType* FuseLayer(OptimizationViews& optimizationViews,
-                     LayerType* baseLayer,
-                     LayerType* replacementLayer,
-                     ActivationLayer* activationLayer,
-                     ActivationDescriptor& activationDesc)
-{
-    replacementLayer->SetAdditionalInfoForObject(
-        std::make_shared<ActivationDescriptor>(activationDesc));
-
-    SubgraphView substitutionSubgraph({baseLayer, activationLayer},
-                                      CreateIInputsFrom({baseLayer}),
-                                      CreateIOutputsFrom({activationLayer}));
-    SubgraphView replacementSubgraph(replacementLayer);
-
-    optimizationViews.AddSubstitution({substitutionSubgraph, replacementSubgraph});
-
-    return replacementLayer;
-}
-
 template<typename LayerType>
 LayerType* FuseAdditionLayer(OptimizationViews& optimizationViews,
                              LayerType* baseLayer,
@@ -204,72 +148,6 @@ LayerType* FuseBatchNormalizationLayer(OptimizationViews& optimizationViews,
     return replacementLayer;
 }
 
-template<typename LayerType>
-LayerType* FuseConvolution2dLayer(OptimizationViews& optimizationViews,
-                                  LayerType* baseLayer,
-                                  ActivationLayer* activationLayer,
-                                  ActivationDescriptor& activationDesc,
-                                  std::string name)
-{
-    IConnectableLayer* replacement = optimizationViews.GetINetwork()
-                                                      ->AddConvolution2dLayer(baseLayer->GetParameters(), name.c_str());
-
-    LayerType* replacementLayer = PolymorphicDowncast<LayerType*>(replacement);
-
-
-    FuseLayer(optimizationViews,
-              baseLayer,
-              replacementLayer,
-              activationLayer,
-              activationDesc);
-
-    return replacementLayer;
-}
-
-template<typename LayerType>
-LayerType* FuseDepthwiseConvolution2dLayer(OptimizationViews& optimizationViews,
-                                           LayerType* baseLayer,
-                                           ActivationLayer* activationLayer,
-                                           ActivationDescriptor& activationDesc,
-                                           std::string name)
-{
-    IConnectableLayer* replacement =
-        optimizationViews.GetINetwork()->AddDepthwiseConvolution2dLayer(baseLayer->GetParameters(), name.c_str());
-
-    LayerType* replacementLayer = PolymorphicDowncast<LayerType*>(replacement);
-
-
-    FuseLayer(optimizationViews,
-              baseLayer,
-              replacementLayer,
-              activationLayer,
-              activationDesc);
-
-    return replacementLayer;
-}
-
-template<typename LayerType>
-LayerType* FuseFullyConnectedLayer(OptimizationViews& optimizationViews,
-                                   LayerType* baseLayer,
-                                   ActivationLayer* activationLayer,
-                                   ActivationDescriptor& activationDesc,
-                                   std::string name)
-{
-    IConnectableLayer* replacement =
-        optimizationViews.GetINetwork()->AddFullyConnectedLayer(baseLayer->GetParameters(),
-                                                                name.c_str());
-    LayerType* replacementLayer = PolymorphicDowncast<LayerType*>(replacement);
-
-    FuseLayer(optimizationViews,
-              baseLayer,
-              replacementLayer,
-              activationLayer,
-              activationDesc);
-
-
-    return replacementLayer;
-}
-
 //
 // If reduce layer has multiple axes, add new layer for each axis to simulate the same behaviour
 // as currently only one axis is supported.
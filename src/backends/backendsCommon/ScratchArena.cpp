@@ -0,0 +1,140 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ScratchArena.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+thread_local ScratchArena* g_CurrentScratchArena = nullptr;
+
+uint8_t* AllocateAligned(size_t bytes)
+{
+    return static_cast<uint8_t*>(::operator new(bytes, std::align_val_t(ScratchArena::Alignment)));
+}
+
+void FreeAligned(void* memory) noexcept
+{
+    ::operator delete(memory, std::align_val_t(ScratchArena::Alignment));
+}
+
+} // anonymous namespace
+
+ScratchArena::ScratchArena(size_t capacity)
+{
+    Reserve(capacity);
+}
+
+ScratchArena::~ScratchArena()
+{
+    FreeAligned(m_Buffer);
+}
+
+void* ScratchArena::Allocate(size_t bytes)
+{
+    const size_t size = GetAllocationSize(bytes);
+
+    void* memory = nullptr;
+    if (size <= m_Capacity - m_Used)
+    {
+        memory = m_Buffer + m_Used;
+        m_Used += size;
+    }
+    else
+    {
+        memory = AllocateAligned(size);
+        m_HeapBytes += size;
+        ++m_NumHeapAllocations;
+    }
+
+    m_PeakUsage = std::max(m_PeakUsage, m_Used + m_HeapBytes);
+    return memory;
+}
+
+void ScratchArena::Deallocate(void* memory, size_t bytes) noexcept
+{
+    if (memory == nullptr)
+    {
+        return;
+    }
+
+    const size_t size = GetAllocationSize(bytes);
+    if (Owns(memory))
+    {
+        if (static_cast<uint8_t*>(memory) + size == m_Buffer + m_Used)
+        {
+            m_Used -= size;
+        }
+        return;
+    }
+
+    m_HeapBytes -= size;
+    FreeAligned(memory);
+}
+
+void ScratchArena::Reset()
+{
+    m_Used = 0;
+    if (m_PeakUsage > m_Capacity)
+    {
+        Reserve(m_PeakUsage);
+    }
+}
+
+void ScratchArena::Reserve(size_t capacity)
+{
+    if (capacity <= m_Capacity)
+    {
+        return;
+    }
+    if (m_Used != 0)
+    {
+        throw RuntimeException("ScratchArena: cannot grow the arena while its memory is in use.");
+    }
+
+    capacity = GetAllocationSize(capacity);
+    uint8_t* buffer = AllocateAligned(capacity);
+    FreeAligned(m_Buffer);
+    m_Buffer = buffer;
+    m_Capacity = capacity;
+}
+
+void ScratchArena::Release()
+{
+    if (m_Used != 0)
+    {
+        throw RuntimeException("ScratchArena: cannot release the arena while its memory is in use.");
+    }
+
+    FreeAligned(m_Buffer);
+    m_Buffer = nullptr;
+    m_Capacity = 0;
+}
+
+ScratchArena* ScratchArena::GetCurrent()
+{
+    return g_CurrentScratchArena;
+}
+
+ScratchArena::Scope::Scope(ScratchArena& arena)
+    : m_Previous(g_CurrentScratchArena)
+{
+    arena.Reset();
+    g_CurrentScratchArena = &arena;
+}
+
+ScratchArena::Scope::~Scope()
+{
+    g_CurrentScratchArena = m_Previous;
+}
+
+} // namespace armnn
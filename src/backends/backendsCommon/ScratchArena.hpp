@@ -0,0 +1,157 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace armnn
+{
+
+/// Bump allocator for the temporary memory workloads need while they execute.
+///
+/// One arena is owned by every LoadedNetwork (for synchronous execution) and every WorkingMemHandle (for
+/// asynchronous execution), and is sized at load time from the m_ScratchMemorySize the workloads report through
+/// IWorkload::GetMemoryRequirements(). The network makes the arena current on the executing thread with a Scope for
+/// each workload, so memory taken from it is only valid until that workload's execution finishes.
+///
+/// Allocations which do not fit fall back to the heap, and the arena grows to the largest amount seen at the next
+/// Reset(). After the first inference, executing a network therefore takes no scratch memory from the heap.
+class ScratchArena
+{
+public:
+    /// Alignment of every allocation handed out by the arena.
+    static constexpr size_t Alignment = 64;
+
+    ScratchArena() = default;
+    explicit ScratchArena(size_t capacity);
+    ~ScratchArena();
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    /// Returns the number of bytes of the arena an allocation of the given size takes up.
+    static size_t GetAllocationSize(size_t bytes)
+    {
+        return (bytes + Alignment - 1) / Alignment * Alignment;
+    }
+
+    void* Allocate(size_t bytes);
+
+    /// Memory is only given back to the arena when it is the most recent allocation; everything else is reclaimed by
+    /// Reset().
+    void Deallocate(void* memory, size_t bytes) noexcept;
+
+    /// Reclaims all allocations, first growing the arena if allocations had to fall back to the heap.
+    /// Nothing allocated from the arena may be in use when this is called.
+    void Reset();
+
+    /// Grows the arena to at least the given number of bytes. Must not be called while allocations are in use.
+    void Reserve(size_t capacity);
+
+    /// Frees the memory of the arena. The next Reset() grows it back to the largest amount used so far.
+    void Release();
+
+    size_t GetCapacity() const { return m_Capacity; }
+
+    /// Largest number of bytes which have been in use at once.
+    size_t GetPeakUsage() const { return m_PeakUsage; }
+
+    /// Number of allocations which did not fit in the arena and were taken from the heap.
+    size_t GetNumHeapAllocations() const { return m_NumHeapAllocations; }
+
+    /// Returns the arena made current on this thread by a Scope, or nullptr if there is none.
+    static ScratchArena* GetCurrent();
+
+    /// Resets the given arena and makes it current on this thread for the lifetime of the Scope.
+    class Scope
+    {
+    public:
+        explicit Scope(ScratchArena& arena);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ScratchArena* m_Previous;
+    };
+
+private:
+    bool Owns(const void* memory) const
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(memory);
+        return bytes >= m_Buffer && bytes < m_Buffer + m_Capacity;
+    }
+
+    uint8_t* m_Buffer = nullptr;
+    size_t m_Capacity = 0;
+    size_t m_Used = 0;
+    size_t m_HeapBytes = 0;
+    size_t m_PeakUsage = 0;
+    size_t m_NumHeapAllocations = 0;
+};
+
+/// Standard allocator which takes memory from the ScratchArena current on the thread constructing it, or from the heap
+/// when there is none (e.g. when a kernel is called directly rather than from a loaded network).
+template <typename T>
+class ScratchAllocator
+{
+public:
+    static_assert(alignof(T) <= ScratchArena::Alignment, "ScratchAllocator: type is over aligned");
+
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ScratchAllocator() noexcept
+        : m_Arena(ScratchArena::GetCurrent())
+    {}
+
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U>& other) noexcept
+        : m_Arena(other.GetArena())
+    {}
+
+    T* allocate(size_t count)
+    {
+        if (m_Arena)
+        {
+            return static_cast<T*>(m_Arena->Allocate(count * sizeof(T)));
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* memory, size_t count) noexcept
+    {
+        if (m_Arena)
+        {
+            m_Arena->Deallocate(memory, count * sizeof(T));
+            return;
+        }
+        ::operator delete(memory);
+    }
+
+    ScratchArena* GetArena() const noexcept { return m_Arena; }
+
+    template <typename U>
+    bool operator==(const ScratchAllocator<U>& other) const noexcept { return m_Arena == other.GetArena(); }
+
+    template <typename U>
+    bool operator!=(const ScratchAllocator<U>& other) const noexcept { return m_Arena != other.GetArena(); }
+
+private:
+    ScratchArena* m_Arena;
+};
+
+/// A std::vector for temporary data within a workload's execution.
+template <typename T>
+using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
+} // namespace armnn
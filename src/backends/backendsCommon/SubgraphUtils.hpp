@@ -217,6 +217,35 @@ inline bool IsNCHW(armnn::Layer& layer)
     return check.Result();
 }
 
+/// Checks that the input and output of a layer have the same data type and, if quantized, the same quantization
+/// info, so that the layer can be fused into the layer producing its input.
+inline bool checkDataTypeInputandOutput(const Layer& layer)
+{
+    auto inputInfo = layer.GetInputSlot(0).GetTensorInfo();
+    auto outputInfo = layer.GetOutputSlot(0).GetTensorInfo();
+    bool sameDataType = (inputInfo.GetDataType() == outputInfo.GetDataType());
+
+    // Check is same quantization info (same scale and offset)
+    if (sameDataType)
+    {
+        if (IsQuantizedType(inputInfo.GetDataType()))
+        {
+            bool sameScale = (inputInfo.GetQuantizationScale() == outputInfo.GetQuantizationScale());
+            bool sameOffset = (inputInfo.GetQuantizationOffset() == outputInfo.GetQuantizationOffset());
+
+            return (sameScale && sameOffset);
+        }
+        else
+        {
+            return true;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
 inline void ReportUntouchedLayers(OptimizationViews& optimizationViews, std::map<LayerGuid, Layer*> untouched)
 {
     std::vector<Layer*> untouchedVector;
@@ -246,6 +275,92 @@ LayerType* FoldPadLayer(OptimizationViews& optimizationViews,
     return replacementLayer;
 }
 
+template<typename LayerType>
+LayerType* FuseLayer(OptimizationViews& optimizationViews,
+                     LayerType* baseLayer,
+                     LayerType* replacementLayer,
+                     ActivationLayer* activationLayer,
+                     ActivationDescriptor& activationDesc)
+{
+    replacementLayer->SetAdditionalInfoForObject(
+        std::make_shared<ActivationDescriptor>(activationDesc));
+
+    SubgraphView substitutionSubgraph({baseLayer, activationLayer},
+                                      CreateIInputsFrom({baseLayer}),
+                                      CreateIOutputsFrom({activationLayer}));
+    SubgraphView replacementSubgraph(replacementLayer);
+
+    optimizationViews.AddSubstitution({substitutionSubgraph, replacementSubgraph});
+
+    return replacementLayer;
+}
+
+template<typename LayerType>
+LayerType* FuseConvolution2dLayer(OptimizationViews& optimizationViews,
+                                  LayerType* baseLayer,
+                                  ActivationLayer* activationLayer,
+                                  ActivationDescriptor& activationDesc,
+                                  std::string name)
+{
+    IConnectableLayer* replacement = optimizationViews.GetINetwork()
+                                                      ->AddConvolution2dLayer(baseLayer->GetParameters(), name.c_str());
+
+    LayerType* replacementLayer = PolymorphicDowncast<LayerType*>(replacement);
+
+
+    FuseLayer(optimizationViews,
+              baseLayer,
+              replacementLayer,
+              activationLayer,
+              activationDesc);
+
+    return replacementLayer;
+}
+
+template<typename LayerType>
+LayerType* FuseDepthwiseConvolution2dLayer(OptimizationViews& optimizationViews,
+                                           LayerType* baseLayer,
+                                           ActivationLayer* activationLayer,
+                                           ActivationDescriptor& activationDesc,
+                                           std::string name)
+{
+    IConnectableLayer* replacement =
+        optimizationViews.GetINetwork()->AddDepthwiseConvolution2dLayer(baseLayer->GetParameters(), name.c_str());
+
+    LayerType* replacementLayer = PolymorphicDowncast<LayerType*>(replacement);
+
+
+    FuseLayer(optimizationViews,
+              baseLayer,
+              replacementLayer,
+              activationLayer,
+              activationDesc);
+
+    return replacementLayer;
+}
+
+template<typename LayerType>
+LayerType* FuseFullyConnectedLayer(OptimizationViews& optimizationViews,
+                                   LayerType* baseLayer,
+                                   ActivationLayer* activationLayer,
+                                   ActivationDescriptor& activationDesc,
+                                   std::string name)
+{
+    IConnectableLayer* replacement =
+        optimizationViews.GetINetwork()->AddFullyConnectedLayer(baseLayer->GetParameters(),
+                                                                name.c_str());
+    LayerType* replacementLayer = PolymorphicDowncast<LayerType*>(replacement);
+
+    FuseLayer(optimizationViews,
+              baseLayer,
+              replacementLayer,
+              activationLayer,
+              activationDesc);
+
+
+    return replacementLayer;
+}
+
 /// Checks if the Layer is connected to any Layer that has an NCHW layout.
 inline bool ConnectedToLayerWithNCHW(Layer* baseLayer)
 {
@@ -0,0 +1,218 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "TaskPool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace armnn
+{
+
+#if !defined(ARMNN_DISABLE_THREADS)
+
+namespace
+{
+
+// Every thread may be given a few ranges so that uneven ranges still balance out.
+constexpr unsigned int RangesPerThread = 4;
+
+// Set while the current thread is running a ParallelFor() range, so that nested calls do not wait on the pool.
+thread_local bool tl_InParallelFor = false;
+
+} // anonymous namespace
+
+struct TaskPool::ParallelForState
+{
+    // Only dereferenced while ranges are left, i.e. while the caller of ParallelFor() is still waiting.
+    const std::function<void(unsigned int, unsigned int)>* m_Function;
+    unsigned int m_NumItems;
+    unsigned int m_NumRanges;
+    std::atomic<unsigned int> m_NextRange{0};
+    std::atomic<unsigned int> m_RemainingRanges;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Done;
+    std::exception_ptr m_Exception;
+};
+
+TaskPool::TaskPool(unsigned int numThreads)
+{
+    SetNumberOfThreads(numThreads);
+}
+
+TaskPool::~TaskPool()
+{
+    StopWorkers();
+}
+
+void TaskPool::SetNumberOfThreads(unsigned int numThreads)
+{
+    if (numThreads == 0)
+    {
+        return;
+    }
+    numThreads = std::min(numThreads, MaxNumberOfThreads);
+
+    std::lock_guard<std::mutex> lock(m_ResizeMutex);
+    if (numThreads == m_NumberOfThreads.load())
+    {
+        return;
+    }
+    StopWorkers();
+    StartWorkers(numThreads - 1);
+    m_NumberOfThreads.store(numThreads);
+}
+
+void TaskPool::ParallelFor(unsigned int numItems,
+                           unsigned int minItemsPerTask,
+                           const std::function<void(unsigned int, unsigned int)>& function)
+{
+    if (numItems == 0)
+    {
+        return;
+    }
+
+    const unsigned int numThreads = m_NumberOfThreads.load();
+    const unsigned int maxRanges = numItems / std::max(minItemsPerTask, 1u);
+    const unsigned int numRanges = std::min(maxRanges, numThreads * RangesPerThread);
+    if (numThreads <= 1 || numRanges <= 1 || tl_InParallelFor)
+    {
+        function(0, numItems);
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->m_Function = &function;
+    state->m_NumItems = numItems;
+    state->m_NumRanges = numRanges;
+    state->m_RemainingRanges.store(numRanges);
+
+    // The calling thread works through the ranges too, so it needs at most numRanges - 1 helpers. Should the
+    // workers be busy or being resized, the caller simply ends up running every range itself.
+    const unsigned int numHelpers = std::min(numThreads - 1, numRanges - 1);
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        for (unsigned int i = 0; i < numHelpers; ++i)
+        {
+            m_Queue.push_back(state);
+        }
+    }
+    m_QueueCondition.notify_all();
+
+    RunRanges(*state);
+
+    std::unique_lock<std::mutex> lock(state->m_Mutex);
+    state->m_Done.wait(lock, [&state]() { return state->m_RemainingRanges.load() == 0; });
+    if (state->m_Exception)
+    {
+        std::rethrow_exception(state->m_Exception);
+    }
+}
+
+void TaskPool::RunRanges(ParallelForState& state)
+{
+    const bool wasInParallelFor = tl_InParallelFor;
+    tl_InParallelFor = true;
+
+    for (unsigned int range = state.m_NextRange++; range < state.m_NumRanges; range = state.m_NextRange++)
+    {
+        const auto numItems = static_cast<unsigned long long>(state.m_NumItems);
+        const auto begin = static_cast<unsigned int>(numItems * range / state.m_NumRanges);
+        const auto end = static_cast<unsigned int>(numItems * (range + 1) / state.m_NumRanges);
+        try
+        {
+            (*state.m_Function)(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(state.m_Mutex);
+            if (!state.m_Exception)
+            {
+                state.m_Exception = std::current_exception();
+            }
+        }
+
+        if (--state.m_RemainingRanges == 0)
+        {
+            std::lock_guard<std::mutex> lock(state.m_Mutex);
+            state.m_Done.notify_all();
+        }
+    }
+
+    tl_InParallelFor = wasInParallelFor;
+}
+
+void TaskPool::StartWorkers(unsigned int numWorkers)
+{
+    for (unsigned int i = 0; i < numWorkers; ++i)
+    {
+        m_Workers.emplace_back(&TaskPool::WorkerLoop, this);
+    }
+}
+
+void TaskPool::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        m_Stop = true;
+    }
+    m_QueueCondition.notify_all();
+
+    for (auto& worker : m_Workers)
+    {
+        worker.join();
+    }
+    m_Workers.clear();
+
+    std::lock_guard<std::mutex> lock(m_QueueMutex);
+    m_Stop = false;
+}
+
+void TaskPool::WorkerLoop()
+{
+    while (true)
+    {
+        std::shared_ptr<ParallelForState> state;
+        {
+            std::unique_lock<std::mutex> lock(m_QueueMutex);
+            m_QueueCondition.wait(lock, [this]() { return m_Stop || !m_Queue.empty(); });
+            // Queued work is drained before stopping so that no caller is left waiting on it.
+            if (m_Queue.empty())
+            {
+                return;
+            }
+            state = std::move(m_Queue.front());
+            m_Queue.pop_front();
+        }
+        RunRanges(*state);
+    }
+}
+
+#else
+
+TaskPool::TaskPool(unsigned int)
+{
+}
+
+TaskPool::~TaskPool() = default;
+
+void TaskPool::SetNumberOfThreads(unsigned int)
+{
+}
+
+void TaskPool::ParallelFor(unsigned int numItems,
+                              unsigned int,
+                              const std::function<void(unsigned int, unsigned int)>& function)
+{
+    if (numItems > 0)
+    {
+        function(0, numItems);
+    }
+}
+
+#endif
+
+} // namespace armnn
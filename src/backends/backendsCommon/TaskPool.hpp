@@ -0,0 +1,79 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#if !defined(ARMNN_DISABLE_THREADS)
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace armnn
+{
+
+/// A pool of worker threads splitting loops over independent items across threads. It is used by the reference
+/// kernels to split their outer loops, see RefTaskPool, and by LoadedNetwork to create and execute the workloads of
+/// a network in parallel while loading it.
+///
+/// ParallelFor() only ever hands disjoint index ranges to the threads, so results do not depend on the number of
+/// threads as long as each item is computed independently of the range it falls in.
+class TaskPool
+{
+public:
+    /// The upper limit for the number of threads, matching the CpuAcc "NumberOfThreads" option.
+    static constexpr unsigned int MaxNumberOfThreads = 64;
+
+    /// Starts numThreads - 1 worker threads: the thread calling ParallelFor() takes part in the work too.
+    explicit TaskPool(unsigned int numThreads = 1);
+
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    /// Sets the number of threads used by ParallelFor(), including the calling thread. Zero is ignored and values
+    /// above MaxNumberOfThreads are clamped.
+    void SetNumberOfThreads(unsigned int numThreads);
+
+    unsigned int GetNumberOfThreads() const { return m_NumberOfThreads.load(); }
+
+    /// Calls function(begin, end) for contiguous sub-ranges covering [0, numItems), in parallel where worthwhile.
+    /// The calling thread takes part in the work and ParallelFor() returns once every range has been processed.
+    /// Ranges hold at least minItemsPerTask items so that small loops are not split into tasks smaller than the
+    /// cost of scheduling them. Calls made from inside a running range, of this pool or any other, execute serially.
+    /// If a range throws, the first exception is rethrown on the calling thread once the other ranges have finished.
+    void ParallelFor(unsigned int numItems,
+                     unsigned int minItemsPerTask,
+                     const std::function<void(unsigned int, unsigned int)>& function);
+
+private:
+#if !defined(ARMNN_DISABLE_THREADS)
+    struct ParallelForState;
+
+    static void RunRanges(ParallelForState& state);
+
+    void StartWorkers(unsigned int numWorkers);
+    void StopWorkers();
+    void WorkerLoop();
+
+    std::mutex m_ResizeMutex;
+    std::mutex m_QueueMutex;
+    std::condition_variable m_QueueCondition;
+    std::deque<std::shared_ptr<ParallelForState>> m_Queue;
+    std::vector<std::thread> m_Workers;
+    bool m_Stop = false;
+#endif
+
+    std::atomic<unsigned int> m_NumberOfThreads{1};
+};
+
+} // namespace armnn
@@ -20,12 +20,15 @@ COMMON_SOURCES := \
     MemoryManager.cpp \
     MemSyncWorkload.cpp \
     OptimizationViews.cpp \
+    ScratchArena.cpp \
+    TaskPool.cpp \
     TensorHandleFactoryRegistry.cpp \
     UnmapWorkload.cpp \
     WorkloadData.cpp \
     WorkloadFactory.cpp \
     WorkloadUtils.cpp \
     memoryOptimizerStrategyLibrary/strategies/ConstantMemoryStrategy.cpp \
+    memoryOptimizerStrategyLibrary/strategies/GreedyBySizeMemoryStrategy.cpp \
 	memoryOptimizerStrategyLibrary/strategies/SingleAxisPriorityList.cpp \
     memoryOptimizerStrategyLibrary/strategies/StrategyValidator.cpp
 
@@ -41,6 +44,7 @@ COMMON_TEST_SOURCES := \
     test/LogSoftmaxEndToEndTestImpl.cpp \
     test/QLstmEndToEndTestImpl.cpp \
     test/QuantizedLstmEndToEndTestImpl.cpp \
+    test/ScratchArenaTests.cpp \
     test/SpaceToDepthEndToEndTestImpl.cpp \
     test/layerTests/AbsTestImpl.cpp \
     test/layerTests/ActivationTestImpl.cpp \
@@ -112,6 +116,7 @@ COMMON_TEST_SOURCES := \
     test/layerTests/TransposeConvolution2dTestImpl.cpp \
     test/layerTests/UnidirectionalSequenceLstmTestImpl.cpp \
     memoryOptimizerStrategyLibrary/test/ConstMemoryStrategyTests.cpp \
+    memoryOptimizerStrategyLibrary/test/GreedyBySizeMemoryStrategyTests.cpp \
     memoryOptimizerStrategyLibrary/test/ValidatorStrategyTests.cpp \
     memoryOptimizerStrategyLibrary/test/SingleAxisPriorityListTests.cpp
 
@@ -8,6 +8,7 @@
 #include "MemoryOptimizerStrategyFactory.hpp"
 
 #include "strategies/ConstantMemoryStrategy.hpp"
+#include "strategies/GreedyBySizeMemoryStrategy.hpp"
 #include "strategies/StrategyValidator.hpp"
 #include "strategies/SingleAxisPriorityList.hpp"
 
@@ -24,9 +25,10 @@ static std::map<std::string, std::unique_ptr<IMemoryOptimizerStrategyFactory>>&
 
     if (strategies.size() == 0)
     {
-        strategies["ConstantMemoryStrategy"] = std::make_unique<StrategyFactory<ConstantMemoryStrategy>>();
-        strategies["SingleAxisPriorityList"] = std::make_unique<StrategyFactory<SingleAxisPriorityList>>();
-        strategies["StrategyValidator"]      = std::make_unique<StrategyFactory<StrategyValidator>>();
+        strategies["ConstantMemoryStrategy"]     = std::make_unique<StrategyFactory<ConstantMemoryStrategy>>();
+        strategies["GreedyBySizeMemoryStrategy"] = std::make_unique<StrategyFactory<GreedyBySizeMemoryStrategy>>();
+        strategies["SingleAxisPriorityList"]     = std::make_unique<StrategyFactory<SingleAxisPriorityList>>();
+        strategies["StrategyValidator"]          = std::make_unique<StrategyFactory<StrategyValidator>>();
     }
     return strategies;
 }
@@ -0,0 +1,112 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "GreedyBySizeMemoryStrategy.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace armnn
+{
+
+std::string GreedyBySizeMemoryStrategy::GetName() const
+{
+    return m_Name;
+}
+
+MemBlockStrategyType GreedyBySizeMemoryStrategy::GetMemBlockStrategyType() const
+{
+    return m_MemBlockStrategyType;
+}
+
+// For more information on the algorithm see: https://arxiv.org/pdf/2001.03288.pdf
+// This strategy is an implementation of 4.3 Greedy by Size for offset calculation
+std::vector<MemBin> GreedyBySizeMemoryStrategy::Optimize(std::vector<MemBlock>& memBlocks)
+{
+    std::vector<const MemBlock*> priorityList;
+    priorityList.reserve(memBlocks.size());
+    for (const auto& block : memBlocks)
+    {
+        priorityList.push_back(&block);
+    }
+
+    // Place the largest blocks first, breaking ties by lifetime so the result does not depend on the input order
+    std::sort(priorityList.begin(), priorityList.end(), [](const MemBlock* lhs, const MemBlock* rhs)
+    {
+        if (lhs->m_MemSize != rhs->m_MemSize)
+        {
+            return lhs->m_MemSize > rhs->m_MemSize;
+        }
+        if (lhs->m_StartOfLife != rhs->m_StartOfLife)
+        {
+            return lhs->m_StartOfLife < rhs->m_StartOfLife;
+        }
+        return lhs->m_Index < rhs->m_Index;
+    });
+
+    MemBin bin;
+    bin.m_MemSize = 0;
+    bin.m_MemBlocks.reserve(memBlocks.size());
+
+    // Indexes into bin.m_MemBlocks, kept sorted by offset
+    std::vector<size_t> placedByOffset;
+    placedByOffset.reserve(memBlocks.size());
+
+    for (const MemBlock* block : priorityList)
+    {
+        // Walk the placed blocks in order of offset, looking at the gaps between those which are alive at the same
+        // time as this block. The smallest gap that fits wins, otherwise the block goes after all of them.
+        size_t candidateOffset = 0;
+        size_t bestOffset = 0;
+        size_t bestGap = std::numeric_limits<size_t>::max();
+        for (size_t placedIndex : placedByOffset)
+        {
+            const MemBlock& placed = bin.m_MemBlocks[placedIndex];
+            if (placed.m_EndOfLife < block->m_StartOfLife || placed.m_StartOfLife > block->m_EndOfLife)
+            {
+                continue;
+            }
+
+            if (placed.m_Offset >= candidateOffset)
+            {
+                const size_t gap = placed.m_Offset - candidateOffset;
+                if (gap >= block->m_MemSize && gap < bestGap)
+                {
+                    bestOffset = candidateOffset;
+                    bestGap = gap;
+                }
+            }
+            candidateOffset = std::max(candidateOffset, placed.m_Offset + placed.m_MemSize);
+        }
+        if (bestGap == std::numeric_limits<size_t>::max())
+        {
+            bestOffset = candidateOffset;
+        }
+
+        bin.m_MemBlocks.emplace_back(MemBlock{block->m_StartOfLife,
+                                              block->m_EndOfLife,
+                                              block->m_MemSize,
+                                              bestOffset,
+                                              block->m_Index});
+        bin.m_MemSize = std::max(bin.m_MemSize, bestOffset + block->m_MemSize);
+
+        const size_t newIndex = bin.m_MemBlocks.size() - 1;
+        auto insertPosition = std::upper_bound(placedByOffset.begin(), placedByOffset.end(), bestOffset,
+                                               [&](size_t offset, size_t placedIndex)
+                                               {
+                                                   return offset < bin.m_MemBlocks[placedIndex].m_Offset;
+                                               });
+        placedByOffset.insert(insertPosition, newIndex);
+    }
+
+    std::vector<MemBin> bins;
+    if (!bin.m_MemBlocks.empty())
+    {
+        bins.push_back(std::move(bin));
+    }
+    return bins;
+}
+
+} // namespace armnn
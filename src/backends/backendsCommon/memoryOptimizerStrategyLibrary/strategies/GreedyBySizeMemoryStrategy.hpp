@@ -0,0 +1,35 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Types.hpp>
+#include <armnn/backends/IMemoryOptimizerStrategy.hpp>
+
+namespace armnn
+{
+
+/// GreedyBySizeMemoryStrategy packs all MemBlocks into a single MemBin by assigning each one an offset.
+/// MemBlocks are placed largest first, each into the smallest gap left between the already placed MemBlocks whose
+/// lifetimes overlap with it, or after the last of them when no gap is big enough (greedy by size with best fit,
+/// the offset calculation used by the TfLite arena planner).
+class GreedyBySizeMemoryStrategy : public IMemoryOptimizerStrategy
+{
+public:
+    GreedyBySizeMemoryStrategy()
+        : m_Name(std::string("GreedyBySizeMemoryStrategy"))
+        , m_MemBlockStrategyType(MemBlockStrategyType::MultiAxisPacking) {}
+
+    std::string GetName() const override;
+
+    MemBlockStrategyType GetMemBlockStrategyType() const override;
+
+    std::vector<MemBin> Optimize(std::vector<MemBlock>& memBlocks) override;
+
+private:
+    std::string m_Name;
+    MemBlockStrategyType m_MemBlockStrategyType;
+};
+
+} // namespace armnn
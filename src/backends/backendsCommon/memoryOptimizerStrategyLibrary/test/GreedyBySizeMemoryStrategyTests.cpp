@@ -0,0 +1,76 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <backendsCommon/memoryOptimizerStrategyLibrary/strategies/GreedyBySizeMemoryStrategy.hpp>
+#include <backendsCommon/memoryOptimizerStrategyLibrary/strategies/StrategyValidator.hpp>
+
+#include <doctest/doctest.h>
+#include <vector>
+
+using namespace armnn;
+
+TEST_SUITE("GreedyBySizeMemoryStrategyTestSuite")
+{
+
+std::vector<MemBlock> CreateGreedyBySizeTestBlocks()
+{
+    // The largest amount of memory in use at once is 200, at lifetime 1 (blocks 0, 1 and 3)
+    return std::vector<MemBlock>
+    {
+        { 0, 2, 100, 0, 0 },
+        { 0, 4, 80, 0, 1 },
+        { 3, 4, 60, 0, 2 },
+        { 1, 1, 20, 0, 3 },
+        { 4, 4, 30, 0, 4 }
+    };
+}
+
+TEST_CASE("GreedyBySizeMemoryStrategyTest")
+{
+    std::vector<MemBlock> memBlocks = CreateGreedyBySizeTestBlocks();
+
+    GreedyBySizeMemoryStrategy greedyBySizeMemoryStrategy;
+    CHECK_EQ(greedyBySizeMemoryStrategy.GetName(), std::string("GreedyBySizeMemoryStrategy"));
+    CHECK_EQ(greedyBySizeMemoryStrategy.GetMemBlockStrategyType(), MemBlockStrategyType::MultiAxisPacking);
+
+    auto memBins = greedyBySizeMemoryStrategy.Optimize(memBlocks);
+    REQUIRE(memBins.size() == 1);
+    CHECK(memBins[0].m_MemSize == 200);
+    REQUIRE(memBins[0].m_MemBlocks.size() == 5);
+
+    std::vector<size_t> offsets(memBlocks.size());
+    for (const auto& memBlock : memBins[0].m_MemBlocks)
+    {
+        offsets[memBlock.m_Index] = memBlock.m_Offset;
+    }
+    CHECK(offsets[0] == 0);
+    CHECK(offsets[1] == 100);
+    // Block 2 reuses the memory of block 0 once it has died
+    CHECK(offsets[2] == 0);
+    // Block 3 does not fit in any gap, so goes after blocks 0 and 1
+    CHECK(offsets[3] == 180);
+    // Block 4 goes in the gap between blocks 2 and 1
+    CHECK(offsets[4] == 60);
+}
+
+TEST_CASE("GreedyBySizeMemoryStrategyValidatorTest")
+{
+    std::vector<MemBlock> memBlocks = CreateGreedyBySizeTestBlocks();
+
+    auto ptr = std::make_shared<GreedyBySizeMemoryStrategy>();
+    StrategyValidator validator;
+    validator.SetStrategy(ptr);
+    CHECK_NOTHROW(validator.Optimize(memBlocks));
+}
+
+TEST_CASE("GreedyBySizeMemoryStrategyNoBlocksTest")
+{
+    std::vector<MemBlock> memBlocks;
+
+    GreedyBySizeMemoryStrategy greedyBySizeMemoryStrategy;
+    CHECK(greedyBySizeMemoryStrategy.Optimize(memBlocks).empty());
+}
+
+}
@@ -181,7 +181,9 @@ TEST_CASE ("Ref_Backends_Capability_Test")
                           {"ConstantTensorsAsInputs", true},
                           {"PreImportIOTensors", true},
                           {"ExternallyManagedMemory", true},
-                          {"MultiAxisPacking", false}});
+                          {"MultiAxisPacking", false},
+                          {"ThreadSafeWorkloadCreation", true},
+                          {"ConcurrentWorkloadExecution", true}});
 }
 
 #endif
@@ -0,0 +1,99 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+#include <armnn/IAsyncExecutionCallback.hpp>
+
+#include <AsyncExecutionCallback.hpp>
+#include <CommonTestUtils.hpp>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+/// Schedules inferences of a chain of activations on the execution pipeline of a network without waiting for them,
+/// so that several are in flight at once, and checks that every inference gets its own results. The network is
+/// unloaded while the last inferences may still be executing, which must finish them first.
+inline void PipelinedExecutionEndToEndTest(const std::vector<BackendId>& backends, unsigned int numberOfInferences)
+{
+    constexpr unsigned int rowSize = 5;
+    const TensorInfo info({ 1, rowSize }, DataType::Float32);
+
+    // out = 2 * (2 * in + 1) + 1
+    INetworkPtr network(INetwork::Create());
+    ActivationDescriptor descriptor(ActivationFunction::Linear, 2.0f, 1.0f);
+    IConnectableLayer* input = network->AddInputLayer(0);
+    IConnectableLayer* activation0 = network->AddActivationLayer(descriptor);
+    IConnectableLayer* activation1 = network->AddActivationLayer(descriptor);
+    IConnectableLayer* output = network->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(activation0->GetInputSlot(0));
+    activation0->GetOutputSlot(0).Connect(activation1->GetInputSlot(0));
+    activation1->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    activation0->GetOutputSlot(0).SetTensorInfo(info);
+    activation1->GetOutputSlot(0).SetTensorInfo(info);
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    const INetworkProperties networkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+    std::string errorMessage;
+    NetworkId networkId = 0;
+    REQUIRE(runtime->LoadNetwork(networkId, Optimize(*network, backends, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+
+    std::vector<std::vector<float>> inputData(numberOfInferences, std::vector<float>(rowSize));
+    std::vector<std::vector<float>> outputData(numberOfInferences, std::vector<float>(rowSize));
+    TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(networkId, 0);
+
+    // The tensors are checked before the inference is handed to the pipeline.
+    AsyncCallbackManager callbackManager;
+    CHECK_THROWS_AS(runtime->SchedulePipelined(networkId, {}, { { 0, Tensor(outputInfo, outputData[0].data()) } },
+                                               callbackManager.GetNewCallback()),
+                    InvalidArgumentException);
+
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        for (unsigned int j = 0; j < rowSize; ++j)
+        {
+            inputData[i][j] = static_cast<float>(i * rowSize + j);
+        }
+        runtime->SchedulePipelined(networkId,
+                                   { { 0, ConstTensor(inputInfo, inputData[i].data()) } },
+                                   { { 0, Tensor(outputInfo, outputData[i].data()) } },
+                                   callbackManager.GetNewCallback());
+    }
+
+    for (unsigned int i = 0; i < numberOfInferences / 2; ++i)
+    {
+        CHECK(callbackManager.GetNotifiedCallback()->GetStatus() == Status::Success);
+    }
+    CHECK(runtime->UnloadNetwork(networkId) == Status::Success);
+    for (unsigned int i = numberOfInferences / 2; i < numberOfInferences; ++i)
+    {
+        CHECK(callbackManager.GetNotifiedCallback()->GetStatus() == Status::Success);
+    }
+
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        for (unsigned int j = 0; j < rowSize; ++j)
+        {
+            CHECK(outputData[i][j] == 4.0f * inputData[i][j] + 3.0f);
+        }
+    }
+}
+
+} // namespace experimental
+
+} // namespace armnn
@@ -0,0 +1,157 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <backendsCommon/ScratchArena.hpp>
+
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <WorkingMemHandle.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <numeric>
+
+TEST_SUITE("ScratchArenaTests")
+{
+using namespace armnn;
+
+TEST_CASE("ScratchArenaAllocationsAreAlignedAndStackLike")
+{
+    ScratchArena arena(1024);
+    CHECK(arena.GetCapacity() == 1024);
+
+    void* first = arena.Allocate(10);
+    void* second = arena.Allocate(100);
+    CHECK(reinterpret_cast<uintptr_t>(first) % ScratchArena::Alignment == 0);
+    CHECK(reinterpret_cast<uintptr_t>(second) % ScratchArena::Alignment == 0);
+    CHECK(static_cast<uint8_t*>(second) == static_cast<uint8_t*>(first) + ScratchArena::Alignment);
+
+    // Freeing the most recent allocation gives its memory back straight away.
+    arena.Deallocate(second, 100);
+    CHECK(arena.Allocate(100) == second);
+
+    arena.Reset();
+    CHECK(arena.Allocate(10) == first);
+    CHECK(arena.GetNumHeapAllocations() == 0);
+    CHECK(arena.GetPeakUsage() == ScratchArena::Alignment + ScratchArena::GetAllocationSize(100));
+}
+
+TEST_CASE("ScratchArenaGrowsAfterFallingBackToTheHeap")
+{
+    ScratchArena arena(128);
+
+    std::vector<void*> allocations;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        allocations.push_back(arena.Allocate(100));
+    }
+    CHECK(arena.GetNumHeapAllocations() == 3);
+    CHECK(arena.GetPeakUsage() == 4 * ScratchArena::GetAllocationSize(100));
+    for (auto it = allocations.rbegin(); it != allocations.rend(); ++it)
+    {
+        arena.Deallocate(*it, 100);
+    }
+
+    // The next round fits in the arena.
+    arena.Reset();
+    CHECK(arena.GetCapacity() >= 4 * ScratchArena::GetAllocationSize(100));
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        arena.Allocate(100);
+    }
+    CHECK(arena.GetNumHeapAllocations() == 3);
+
+    // After being released, the arena comes back at the size it had grown to.
+    arena.Reset();
+    arena.Release();
+    CHECK(arena.GetCapacity() == 0);
+    arena.Reset();
+    CHECK(arena.GetCapacity() >= 4 * ScratchArena::GetAllocationSize(100));
+}
+
+TEST_CASE("ScratchVectorUsesTheCurrentArena")
+{
+    ScratchArena arena(4096);
+
+    ScratchVector<float> heapVector(16, 1.0f);
+    CHECK(heapVector.get_allocator().GetArena() == nullptr);
+    {
+        ScratchArena::Scope scope(arena);
+        CHECK(ScratchArena::GetCurrent() == &arena);
+
+        ScratchVector<float> arenaVector(16);
+        std::iota(arenaVector.begin(), arenaVector.end(), 0.0f);
+        CHECK(arenaVector.get_allocator().GetArena() == &arena);
+        CHECK(arenaVector[15] == 15.0f);
+
+        // Copies made within the scope take their memory from the arena too.
+        ScratchVector<float> copy = arenaVector;
+        CHECK(copy.get_allocator().GetArena() == &arena);
+        CHECK(copy == arenaVector);
+    }
+    CHECK(ScratchArena::GetCurrent() == nullptr);
+    CHECK(arena.GetNumHeapAllocations() == 0);
+}
+
+#if defined(ARMNNREF_ENABLED)
+TEST_CASE("CpuRefInferenceTakesNoScratchMemoryFromTheHeap")
+{
+    const TensorInfo inputInfo({ 2, 8 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 8, 4 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo outputInfo({ 2, 4 }, DataType::Float32);
+    std::vector<float> weightsData(weightsInfo.GetNumElements());
+    std::iota(weightsData.begin(), weightsData.end(), 0.0f);
+
+    INetworkPtr net(INetwork::Create());
+    FullyConnectedDescriptor descriptor;
+    descriptor.m_ConstantWeights = true;
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* weights = net->AddConstantLayer(ConstTensor(weightsInfo, weightsData.data()));
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(descriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    weights->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(1));
+    fullyConnected->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    weights->GetOutputSlot(0).SetTensorInfo(weightsInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    NetworkId networkId;
+    std::string errorMessage;
+    const INetworkProperties networkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+    REQUIRE(runtime->LoadNetwork(networkId, Optimize(*net, { Compute::CpuRef }, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+
+    std::unique_ptr<experimental::IWorkingMemHandle> memHandle = runtime->CreateWorkingMemHandle(networkId);
+    ScratchArena& arena = dynamic_cast<experimental::WorkingMemHandle&>(*memHandle).GetScratchArena();
+
+    std::vector<float> inputData(inputInfo.GetNumElements(), 1.0f);
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    TensorInfo constantInputInfo = inputInfo;
+    constantInputInfo.SetConstant(true);
+    InputTensors inputTensors{ { 0, ConstTensor(constantInputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+ARMNN_NO_DEPRECATE_WARN_BEGIN
+        CHECK(runtime->Execute(*memHandle, inputTensors, outputTensors) == Status::Success);
+ARMNN_NO_DEPRECATE_WARN_END
+    }
+
+    // The fully connected kernel decoded its input and accumulated its output in the arena, which was sized for
+    // them at load time.
+    CHECK(arena.GetCapacity() >= arena.GetPeakUsage());
+    CHECK(arena.GetPeakUsage() > 0);
+    CHECK(arena.GetNumHeapAllocations() == 0);
+    // Each output is the sum of one column of the weights.
+    CHECK(outputData[0] == 112.0f);
+    CHECK(outputData[7] == 136.0f);
+}
+#endif
+
+}
@@ -1,5 +1,5 @@
 //
-// Copyright © 2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2023-2024 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -81,9 +81,12 @@ armnn::INetworkPtr CreateReshapeInOutNetwork(const armnn::TensorShape& inputShap
     TensorInfo outputTensorInfo(outputShape, ArmnnType, qScale, qOffset);
 
     IConnectableLayer* activation0 = network->AddActivationLayer(ActivationFunction::ReLu, "act0");
+    // The consumers of the reshape differ, so they are not merged into one before the reshape is looked at.
     IConnectableLayer* activation1 = network->AddActivationLayer(ActivationFunction::ReLu, "act1");
-    IConnectableLayer* activation2 = network->AddActivationLayer(ActivationFunction::ReLu, "act2");
-    IConnectableLayer* activation3 = network->AddActivationLayer(ActivationFunction::ReLu, "act3");
+    IConnectableLayer* activation2 = network->AddActivationLayer(
+        ActivationDescriptor(ActivationFunction::BoundedReLu, 10.0f, 0.0f), "act2");
+    IConnectableLayer* activation3 = network->AddActivationLayer(
+        ActivationDescriptor(ActivationFunction::Linear, 1.0f, 0.0f), "act3");
     IConnectableLayer* reshape = network->AddReshapeLayer(descriptor, "reshape");
 
     IConnectableLayer* input   = network->AddInputLayer(0, "input");
@@ -0,0 +1,283 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/INetwork.hpp>
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Threadpool.hpp>
+#include <armnn/IAsyncExecutionCallback.hpp>
+
+#include <AsyncExecutionCallback.hpp>
+#include <CommonTestUtils.hpp>
+
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <vector>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+namespace
+{
+
+// out = 2 * in + 1, elementwise on a [batchSize, rowSize] tensor.
+INetworkPtr CreateLinearActivationNetwork(unsigned int batchSize, unsigned int rowSize)
+{
+    INetworkPtr net(INetwork::Create());
+
+    ActivationDescriptor descriptor(ActivationFunction::Linear, 2.0f, 1.0f);
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* activation = net->AddActivationLayer(descriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    const TensorInfo info({ batchSize, rowSize }, DataType::Float32);
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    activation->GetOutputSlot(0).SetTensorInfo(info);
+    return net;
+}
+
+// Reverses the rows of a [batchSize, rowSize] tensor, so that the result of a row depends on another row.
+INetworkPtr CreateReverseRowsNetwork(unsigned int batchSize, unsigned int rowSize)
+{
+    INetworkPtr net(INetwork::Create());
+
+    const TensorInfo info({ batchSize, rowSize }, DataType::Float32);
+    const TensorInfo axisInfo({ 1 }, DataType::Signed32, 0.0f, 0, true);
+    const std::vector<int32_t> axisData = { 0 };
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* axis = net->AddConstantLayer(ConstTensor(axisInfo, axisData));
+    IConnectableLayer* reverse = net->AddReverseV2Layer();
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(reverse->GetInputSlot(0));
+    axis->GetOutputSlot(0).Connect(reverse->GetInputSlot(1));
+    reverse->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    axis->GetOutputSlot(0).SetTensorInfo(axisInfo);
+    reverse->GetOutputSlot(0).SetTensorInfo(info);
+    return net;
+}
+
+} // anonymous namespace
+
+/// Schedules batch-1 requests on a Threadpool with batching enabled and checks that every request gets its own
+/// results, whether it ran in a full batch, a partial batch or on its own.
+inline void ThreadpoolBatchingEndToEndTest(const std::vector<BackendId>& backends,
+                                           size_t numThreads,
+                                           unsigned int maxBatchSize,
+                                           unsigned int numberOfInferences)
+{
+    constexpr unsigned int rowSize = 5;
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    const INetworkProperties networkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+    std::string errorMessage;
+
+    NetworkId networkId = 0;
+    NetworkId batchedNetworkId = 0;
+    INetworkPtr network = CreateLinearActivationNetwork(1, rowSize);
+    INetworkPtr batchedNetwork = CreateLinearActivationNetwork(maxBatchSize, rowSize);
+    REQUIRE(runtime->LoadNetwork(networkId, Optimize(*network, backends, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+    REQUIRE(runtime->LoadNetwork(batchedNetworkId, Optimize(*batchedNetwork, backends, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+
+    std::vector<std::shared_ptr<IWorkingMemHandle>> memHandles;
+    std::vector<std::shared_ptr<IWorkingMemHandle>> batchedMemHandles;
+    for (size_t i = 0; i < numThreads; ++i)
+    {
+        memHandles.emplace_back(runtime->CreateWorkingMemHandle(networkId));
+        batchedMemHandles.emplace_back(runtime->CreateWorkingMemHandle(batchedNetworkId));
+    }
+
+    std::vector<std::vector<float>> inputData(numberOfInferences, std::vector<float>(rowSize));
+    std::vector<std::vector<float>> outputData(numberOfInferences, std::vector<float>(rowSize));
+    std::vector<InputTensors> inputTensors;
+    std::vector<OutputTensors> outputTensors;
+    TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(networkId, 0);
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        for (unsigned int j = 0; j < rowSize; ++j)
+        {
+            inputData[i][j] = static_cast<float>(i * rowSize + j);
+        }
+        inputTensors.push_back({ { 0, ConstTensor(inputInfo, inputData[i].data()) } });
+        outputTensors.push_back({ { 0, Tensor(outputInfo, outputData[i].data()) } });
+    }
+
+    {
+        Threadpool threadpool(numThreads, runtime.get(), memHandles);
+        threadpool.LoadMemHandles(batchedMemHandles);
+        threadpool.EnableBatching(networkId, batchedNetworkId, maxBatchSize, std::chrono::milliseconds(2));
+
+        AsyncCallbackManager callbackManager;
+        for (unsigned int i = 0; i < numberOfInferences; ++i)
+        {
+            threadpool.Schedule(networkId, inputTensors[i], outputTensors[i],
+                                static_cast<QosExecPriority>(i % 3), callbackManager.GetNewCallback());
+        }
+
+        for (unsigned int i = 0; i < numberOfInferences; ++i)
+        {
+            CHECK(callbackManager.GetNotifiedCallback()->GetStatus() == Status::Success);
+        }
+    }
+
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        for (unsigned int j = 0; j < rowSize; ++j)
+        {
+            CHECK(outputData[i][j] == 2.0f * inputData[i][j] + 1.0f);
+        }
+    }
+}
+
+/// Runs a full batch of 3 then a partial batch of 2 on a batched network reversing its rows, so the first request of
+/// the partial batch reads back the padding row, which must be zero rather than a row of the full batch. Then
+/// checks that unloading the batched network's handles disables batching.
+inline void ThreadpoolBatchingPaddingEndToEndTest(const std::vector<BackendId>& backends)
+{
+    constexpr unsigned int rowSize = 3;
+    constexpr unsigned int maxBatchSize = 3;
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    const INetworkProperties networkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+    std::string errorMessage;
+
+    NetworkId networkId = 0;
+    NetworkId batchedNetworkId = 0;
+    INetworkPtr network = CreateReverseRowsNetwork(1, rowSize);
+    INetworkPtr batchedNetwork = CreateReverseRowsNetwork(maxBatchSize, rowSize);
+    REQUIRE(runtime->LoadNetwork(networkId, Optimize(*network, backends, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+    REQUIRE(runtime->LoadNetwork(batchedNetworkId, Optimize(*batchedNetwork, backends, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+
+    TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(networkId, 0);
+
+    constexpr unsigned int numberOfInferences = 7;
+    std::vector<std::vector<float>> inputData(numberOfInferences, std::vector<float>(rowSize));
+    std::vector<std::vector<float>> outputData(numberOfInferences, std::vector<float>(rowSize, -1.0f));
+    std::vector<InputTensors> inputTensors;
+    std::vector<OutputTensors> outputTensors;
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        for (unsigned int j = 0; j < rowSize; ++j)
+        {
+            inputData[i][j] = static_cast<float>(1 + i * rowSize + j);
+        }
+        inputTensors.push_back({ { 0, ConstTensor(inputInfo, inputData[i].data()) } });
+        outputTensors.push_back({ { 0, Tensor(outputInfo, outputData[i].data()) } });
+    }
+
+    // A single worker and a long window, so that each group of requests scheduled together forms one batch.
+    Threadpool threadpool(1, runtime.get(), { runtime->CreateWorkingMemHandle(networkId) });
+    threadpool.LoadMemHandles({ runtime->CreateWorkingMemHandle(batchedNetworkId) });
+    threadpool.EnableBatching(networkId, batchedNetworkId, maxBatchSize, std::chrono::milliseconds(200));
+
+    AsyncCallbackManager callbackManager;
+    auto run = [&](unsigned int first, unsigned int count)
+    {
+        for (unsigned int i = first; i < first + count; ++i)
+        {
+            threadpool.Schedule(networkId, inputTensors[i], outputTensors[i], QosExecPriority::Medium,
+                                callbackManager.GetNewCallback());
+        }
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            CHECK(callbackManager.GetNotifiedCallback()->GetStatus() == Status::Success);
+        }
+    };
+
+    // The full batch: each request gets the row of the request mirrored in the batch.
+    run(0, 3);
+    CHECK(outputData[0] == inputData[2]);
+    CHECK(outputData[1] == inputData[1]);
+    CHECK(outputData[2] == inputData[0]);
+
+    // The partial batch: request 3 gets the padding row.
+    run(3, 2);
+    CHECK(outputData[3] == std::vector<float>(rowSize, 0.0f));
+    CHECK(outputData[4] == inputData[4]);
+
+    // Without batching every request runs on its own network, which leaves its row in place.
+    threadpool.UnloadMemHandles(batchedNetworkId);
+    run(5, 2);
+    CHECK(outputData[5] == inputData[5]);
+    CHECK(outputData[6] == inputData[6]);
+}
+
+/// Schedules a request that waits for its batch window on a single worker, then a request for a network without
+/// batching. The worker must not wait for the window, so the second request completes first.
+inline void ThreadpoolBatchingWindowEndToEndTest(const std::vector<BackendId>& backends)
+{
+    constexpr unsigned int rowSize = 5;
+
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    const INetworkProperties networkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+    std::string errorMessage;
+
+    NetworkId networkId = 0;
+    NetworkId batchedNetworkId = 0;
+    NetworkId otherNetworkId = 0;
+    INetworkPtr network = CreateLinearActivationNetwork(1, rowSize);
+    INetworkPtr batchedNetwork = CreateLinearActivationNetwork(4, rowSize);
+    INetworkPtr otherNetwork = CreateLinearActivationNetwork(1, rowSize);
+    REQUIRE(runtime->LoadNetwork(networkId, Optimize(*network, backends, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+    REQUIRE(runtime->LoadNetwork(batchedNetworkId, Optimize(*batchedNetwork, backends, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+    REQUIRE(runtime->LoadNetwork(otherNetworkId, Optimize(*otherNetwork, backends, runtime->GetDeviceSpec()),
+                                 errorMessage, networkProperties) == Status::Success);
+
+    TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(networkId, 0);
+    std::vector<float> inputData = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+    std::vector<float> batchedOutputData(rowSize);
+    std::vector<float> otherOutputData(rowSize);
+    const InputTensors inputTensors = { { 0, ConstTensor(inputInfo, inputData.data()) } };
+    const OutputTensors batchedOutputTensors = { { 0, Tensor(outputInfo, batchedOutputData.data()) } };
+    const OutputTensors otherOutputTensors = { { 0, Tensor(outputInfo, otherOutputData.data()) } };
+
+    Threadpool threadpool(1, runtime.get(), { runtime->CreateWorkingMemHandle(networkId) });
+    threadpool.LoadMemHandles({ runtime->CreateWorkingMemHandle(batchedNetworkId) });
+    threadpool.LoadMemHandles({ runtime->CreateWorkingMemHandle(otherNetworkId) });
+    threadpool.EnableBatching(networkId, batchedNetworkId, 4, std::chrono::milliseconds(500));
+
+    AsyncCallbackManager callbackManager;
+    auto batchedCallback = callbackManager.GetNewCallback();
+    auto otherCallback = callbackManager.GetNewCallback();
+    threadpool.Schedule(networkId, inputTensors, batchedOutputTensors, QosExecPriority::Medium, batchedCallback);
+    threadpool.Schedule(otherNetworkId, inputTensors, otherOutputTensors, QosExecPriority::Medium, otherCallback);
+
+    auto firstCallback = callbackManager.GetNotifiedCallback();
+    CHECK(firstCallback->GetInferenceId() == otherCallback->GetInferenceId());
+    CHECK(firstCallback->GetStatus() == Status::Success);
+    auto secondCallback = callbackManager.GetNotifiedCallback();
+    CHECK(secondCallback->GetInferenceId() == batchedCallback->GetInferenceId());
+    CHECK(secondCallback->GetStatus() == Status::Success);
+
+    for (unsigned int j = 0; j < rowSize; ++j)
+    {
+        CHECK(batchedOutputData[j] == 2.0f * inputData[j] + 1.0f);
+        CHECK(otherOutputData[j] == 2.0f * inputData[j] + 1.0f);
+    }
+}
+
+} // namespace experimental
+
+} // namespace armnn
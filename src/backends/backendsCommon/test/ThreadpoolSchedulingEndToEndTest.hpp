@@ -0,0 +1,330 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/INetwork.hpp>
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Threadpool.hpp>
+#include <armnn/IAsyncExecutionCallback.hpp>
+
+#include <CommonTestUtils.hpp>
+
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace armnn
+{
+
+namespace experimental
+{
+
+namespace
+{
+
+// How long a test waits for the workers before it fails, rather than hanging.
+constexpr std::chrono::seconds SchedulingTestTimeout(60);
+
+// Records the order in which the workers notify the requests. The workers notifying a blocking request wait until
+// the gate is opened, which keeps them busy while the test schedules further requests.
+class SchedulingRecorder
+{
+public:
+    void Notify(unsigned int id, Status status, bool blocks)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Order.push_back(id);
+        m_AllSucceeded = m_AllSucceeded && status == Status::Success;
+        if (blocks)
+        {
+            ++m_NumBlocked;
+            m_Event.notify_all();
+            m_Event.wait(lock, [this] { return m_GateOpen; });
+            return;
+        }
+        m_Event.notify_all();
+    }
+
+    bool WaitForBlocked(unsigned int numBlocked)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        return m_Event.wait_for(lock, SchedulingTestTimeout, [&] { return m_NumBlocked >= numBlocked; });
+    }
+
+    bool WaitForNotified(std::size_t numNotified)
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        return m_Event.wait_for(lock, SchedulingTestTimeout, [&] { return m_Order.size() >= numNotified; });
+    }
+
+    void OpenGate()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_GateOpen = true;
+        m_Event.notify_all();
+    }
+
+    std::vector<unsigned int> GetOrder()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Order;
+    }
+
+    bool AllSucceeded()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_AllSucceeded;
+    }
+
+private:
+    std::mutex m_Mutex;
+    std::condition_variable m_Event;
+    std::vector<unsigned int> m_Order;
+    unsigned int m_NumBlocked = 0;
+    bool m_GateOpen = false;
+    bool m_AllSucceeded = true;
+};
+
+class RecordingCallback : public IAsyncExecutionCallback
+{
+public:
+    RecordingCallback(SchedulingRecorder& recorder, unsigned int id, bool blocks)
+        : m_Recorder(recorder), m_Id(id), m_Blocks(blocks)
+    {}
+
+    void Notify(Status status, InferenceTimingPair) override
+    {
+        m_Recorder.Notify(m_Id, status, m_Blocks);
+    }
+
+private:
+    SchedulingRecorder& m_Recorder;
+    unsigned int m_Id;
+    bool m_Blocks;
+};
+
+// Opens the gate of a SchedulingRecorder when it goes out of scope, so that a failing test releases the blocked
+// workers before the Threadpool joins them.
+struct ScopedGateOpener
+{
+    ~ScopedGateOpener()
+    {
+        m_Recorder.OpenGate();
+    }
+
+    SchedulingRecorder& m_Recorder;
+};
+
+// Loads out = 2 * in + 1 on [1, rowSize] tensors as an async network, with one working memory handle per worker,
+// and prepares the tensors of numberOfInferences requests with distinct inputs.
+class SchedulingTestNetwork
+{
+public:
+    SchedulingTestNetwork(const std::vector<BackendId>& backends, size_t numThreads, unsigned int numberOfInferences)
+        : m_Runtime(IRuntime::Create(IRuntime::CreationOptions()))
+        , m_InputData(numberOfInferences, std::vector<float>(RowSize))
+        , m_OutputData(numberOfInferences, std::vector<float>(RowSize))
+    {
+        INetworkPtr net(INetwork::Create());
+        ActivationDescriptor descriptor(ActivationFunction::Linear, 2.0f, 1.0f);
+        IConnectableLayer* input = net->AddInputLayer(0);
+        IConnectableLayer* activation = net->AddActivationLayer(descriptor);
+        IConnectableLayer* output = net->AddOutputLayer(0);
+        const TensorInfo info({ 1, RowSize }, DataType::Float32);
+        input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        input->GetOutputSlot(0).SetTensorInfo(info);
+        activation->GetOutputSlot(0).SetTensorInfo(info);
+
+        const INetworkProperties networkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+        std::string errorMessage;
+        REQUIRE(m_Runtime->LoadNetwork(m_NetworkId, Optimize(*net, backends, m_Runtime->GetDeviceSpec()),
+                                       errorMessage, networkProperties) == Status::Success);
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            m_MemHandles.emplace_back(m_Runtime->CreateWorkingMemHandle(m_NetworkId));
+        }
+
+        TensorInfo inputInfo = m_Runtime->GetInputTensorInfo(m_NetworkId, 0);
+        inputInfo.SetConstant(true);
+        const TensorInfo outputInfo = m_Runtime->GetOutputTensorInfo(m_NetworkId, 0);
+        for (unsigned int i = 0; i < numberOfInferences; ++i)
+        {
+            for (unsigned int j = 0; j < RowSize; ++j)
+            {
+                m_InputData[i][j] = static_cast<float>(i * RowSize + j);
+            }
+            m_InputTensors.push_back({ { 0, ConstTensor(inputInfo, m_InputData[i].data()) } });
+            m_OutputTensors.push_back({ { 0, Tensor(outputInfo, m_OutputData[i].data()) } });
+        }
+    }
+
+    void Schedule(Threadpool& threadpool, SchedulingRecorder& recorder, unsigned int request,
+                  QosExecPriority priority, bool blocks = false)
+    {
+        threadpool.Schedule(m_NetworkId, m_InputTensors[request], m_OutputTensors[request], priority,
+                            std::make_shared<RecordingCallback>(recorder, request, blocks));
+    }
+
+    bool HasCorrectOutputs(unsigned int request) const
+    {
+        for (unsigned int j = 0; j < RowSize; ++j)
+        {
+            if (m_OutputData[request][j] != 2.0f * m_InputData[request][j] + 1.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    IRuntime* GetRuntime() { return m_Runtime.get(); }
+    const std::vector<std::shared_ptr<IWorkingMemHandle>>& GetMemHandles() const { return m_MemHandles; }
+
+private:
+    static constexpr unsigned int RowSize = 4;
+
+    IRuntimePtr m_Runtime;
+    NetworkId m_NetworkId = 0;
+    std::vector<std::shared_ptr<IWorkingMemHandle>> m_MemHandles;
+    std::vector<std::vector<float>> m_InputData;
+    std::vector<std::vector<float>> m_OutputData;
+    std::vector<InputTensors> m_InputTensors;
+    std::vector<OutputTensors> m_OutputTensors;
+};
+
+} // anonymous namespace
+
+/// Keeps one of two workers blocked in the callback of a request, then schedules requests round robin over both
+/// workers' queues. They can only all complete if the free worker steals those queued for the blocked one.
+inline void ThreadpoolWorkStealingEndToEndTest(const std::vector<BackendId>& backends)
+{
+    constexpr unsigned int numberOfInferences = 9;
+    SchedulingTestNetwork network(backends, 2, numberOfInferences);
+    SchedulingRecorder recorder;
+
+    Threadpool threadpool(2, network.GetRuntime(), network.GetMemHandles());
+    ScopedGateOpener gateOpener{ recorder };
+
+    network.Schedule(threadpool, recorder, 0, QosExecPriority::Medium, true);
+    REQUIRE(recorder.WaitForBlocked(1));
+
+    for (unsigned int i = 1; i < numberOfInferences; ++i)
+    {
+        network.Schedule(threadpool, recorder, i, QosExecPriority::Medium);
+    }
+    REQUIRE(recorder.WaitForNotified(numberOfInferences));
+    recorder.OpenGate();
+
+    CHECK(recorder.AllSucceeded());
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        CHECK(network.HasCorrectOutputs(i));
+    }
+}
+
+/// Keeps both workers blocked while scheduling more requests of one priority than their lock-free queues hold, so
+/// that the rest goes to the locked overflow queue. Every request must still complete with its own results.
+inline void ThreadpoolOverflowEndToEndTest(const std::vector<BackendId>& backends)
+{
+    // The capacity of each worker's queue per priority is 256.
+    constexpr unsigned int numBlockingRequests = 2;
+    constexpr unsigned int numberOfInferences = numBlockingRequests + 2 * 256 + 100;
+    SchedulingTestNetwork network(backends, 2, numberOfInferences);
+    SchedulingRecorder recorder;
+
+    Threadpool threadpool(2, network.GetRuntime(), network.GetMemHandles());
+    ScopedGateOpener gateOpener{ recorder };
+
+    for (unsigned int i = 0; i < numBlockingRequests; ++i)
+    {
+        network.Schedule(threadpool, recorder, i, QosExecPriority::Medium, true);
+    }
+    REQUIRE(recorder.WaitForBlocked(numBlockingRequests));
+
+    for (unsigned int i = numBlockingRequests; i < numberOfInferences; ++i)
+    {
+        network.Schedule(threadpool, recorder, i, QosExecPriority::Medium);
+    }
+    recorder.OpenGate();
+    REQUIRE(recorder.WaitForNotified(numberOfInferences));
+
+    CHECK(recorder.AllSucceeded());
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        CHECK(network.HasCorrectOutputs(i));
+    }
+}
+
+/// Queues High, Medium and Low requests behind a blocked single worker, then checks the order in which they run:
+/// after EXPIRE_RATE High requests a Medium one runs, and after EXPIRE_RATE Medium requests the Low one runs although
+/// High requests are still waiting.
+inline void ThreadpoolPriorityAgingEndToEndTest(const std::vector<BackendId>& backends)
+{
+    const unsigned int numHigh = EXPIRE_RATE * (EXPIRE_RATE + 2);
+    const unsigned int numMedium = EXPIRE_RATE;
+    const unsigned int numberOfInferences = 1 + numHigh + numMedium + 1;
+    SchedulingTestNetwork network(backends, 1, numberOfInferences);
+    SchedulingRecorder recorder;
+
+    Threadpool threadpool(1, network.GetRuntime(), network.GetMemHandles());
+    ScopedGateOpener gateOpener{ recorder };
+
+    // Taking a Low request resets the aging counts, so the requests below start from a known state.
+    network.Schedule(threadpool, recorder, 0, QosExecPriority::Low, true);
+    REQUIRE(recorder.WaitForBlocked(1));
+
+    // Request ids: the High ones first, then the Medium ones and the Low one last. Scheduled from low to high.
+    const unsigned int firstHigh = 1;
+    const unsigned int firstMedium = firstHigh + numHigh;
+    const unsigned int low = firstMedium + numMedium;
+    network.Schedule(threadpool, recorder, low, QosExecPriority::Low);
+    for (unsigned int i = firstMedium; i < low; ++i)
+    {
+        network.Schedule(threadpool, recorder, i, QosExecPriority::Medium);
+    }
+    for (unsigned int i = firstHigh; i < firstMedium; ++i)
+    {
+        network.Schedule(threadpool, recorder, i, QosExecPriority::High);
+    }
+    recorder.OpenGate();
+    REQUIRE(recorder.WaitForNotified(numberOfInferences));
+
+    // EXPIRE_RATE times: EXPIRE_RATE High then one Medium. Then EXPIRE_RATE High, the Low one and the remaining High.
+    std::vector<unsigned int> expectedOrder = { 0 };
+    unsigned int nextHigh = firstHigh;
+    for (unsigned int medium = firstMedium; medium < low; ++medium)
+    {
+        for (unsigned int i = 0; i < EXPIRE_RATE; ++i)
+        {
+            expectedOrder.push_back(nextHigh++);
+        }
+        expectedOrder.push_back(medium);
+    }
+    for (unsigned int i = 0; i < EXPIRE_RATE; ++i)
+    {
+        expectedOrder.push_back(nextHigh++);
+    }
+    expectedOrder.push_back(low);
+    while (nextHigh < firstMedium)
+    {
+        expectedOrder.push_back(nextHigh++);
+    }
+
+    CHECK(recorder.GetOrder() == expectedOrder);
+    CHECK(recorder.AllSucceeded());
+    for (unsigned int i = 0; i < numberOfInferences; ++i)
+    {
+        CHECK(network.HasCorrectOutputs(i));
+    }
+}
+
+} // namespace experimental
+
+} // namespace armnn
@@ -5,20 +5,233 @@
 
 #include "RefBackend.hpp"
 #include "RefBackendId.hpp"
+#include "RefBackendModelContext.hpp"
 #include "RefWorkloadFactory.hpp"
 #include "RefLayerSupport.hpp"
 #include "RefTensorHandleFactory.hpp"
+#include "workloads/FusedElementwise.hpp"
+#include "workloads/RefTaskPool.hpp"
 
 #include <armnn/BackendRegistry.hpp>
+#include <armnn/Logging.hpp>
 #include <armnn/backends/IBackendContext.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 #include <backendsCommon/DefaultAllocator.hpp>
 #include <backendsCommon/SubgraphUtils.hpp>
 
+#include <atomic>
+#include <unordered_map>
+
 namespace armnn
 {
 
+namespace
+{
+
+/// Returns true if the Activation will be fused into the Convolution2d, DepthwiseConvolution2d or FullyConnected layer
+/// producing its input, which saves more than fusing it into an elementwise chain.
+bool IsFusedIntoProducer(const Layer& activation)
+{
+    const OutputSlot* connectedSlot = activation.GetInputSlot(0).GetConnectedOutputSlot();
+    if (connectedSlot == nullptr || connectedSlot->GetNumConnections() != 1)
+    {
+        return false;
+    }
+
+    const Layer& producer = connectedSlot->GetOwningLayer();
+    return (producer.GetType() == LayerType::Convolution2d || producer.GetType() == LayerType::DepthwiseConvolution2d
+            || producer.GetType() == LayerType::FullyConnected)
+           && producer.GetAdditionalInformation<ActivationDescriptor>() == nullptr;
+}
+
+/// Returns true if the layer is an ElementwiseBinary, ElementwiseUnary or Activation layer which FusedElementwise can
+/// evaluate: a supported operation on Float32 tensors which all have the same number of dimensions.
+bool IsFusableElementwiseLayer(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::ElementwiseBinary:
+        {
+            auto binaryLayer = PolymorphicDowncast<const ElementwiseBinaryLayer*>(&layer);
+            if (!FusedElementwise::IsSupported(binaryLayer->GetParameters().m_Operation))
+            {
+                return false;
+            }
+            break;
+        }
+        case LayerType::ElementwiseUnary:
+        {
+            auto unaryLayer = PolymorphicDowncast<const ElementwiseUnaryLayer*>(&layer);
+            if (!FusedElementwise::IsSupported(unaryLayer->GetParameters().m_Operation))
+            {
+                return false;
+            }
+            break;
+        }
+        case LayerType::Activation:
+        {
+            auto activationLayer = PolymorphicDowncast<const ActivationLayer*>(&layer);
+            if (!FusedElementwise::IsSupported(activationLayer->GetParameters().m_Function)
+                || IsFusedIntoProducer(layer))
+            {
+                return false;
+            }
+            break;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+
+    const TensorInfo& outputInfo = layer.GetOutputSlot(0).GetTensorInfo();
+    if (outputInfo.GetDataType() != DataType::Float32)
+    {
+        return false;
+    }
+
+    for (const InputSlot& inputSlot : layer.GetInputSlots())
+    {
+        const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+        if (connectedSlot == nullptr
+            || connectedSlot->GetTensorInfo().GetDataType() != DataType::Float32
+            || connectedSlot->GetTensorInfo().GetNumDimensions() != outputInfo.GetNumDimensions())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Returns the layer connected to the input slot if it can be fused into the layer owning the slot: a fusable
+/// elementwise layer of the same subgraph, not replaced by another substitution, whose output is only used there.
+Layer* GetFusableProducer(const InputSlot& inputSlot, const std::map<LayerGuid, Layer*>& untouched)
+{
+    const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+    if (connectedSlot == nullptr || connectedSlot->GetNumConnections() != 1)
+    {
+        return nullptr;
+    }
+
+    Layer& producer = connectedSlot->GetOwningLayer();
+    if (untouched.find(producer.GetGuid()) == untouched.end() || !IsFusableElementwiseLayer(producer))
+    {
+        return nullptr;
+    }
+    return &producer;
+}
+
+/// Collects the layers of the elementwise chain ending with the given layer, producers before consumers, along with
+/// the input slots through which the chain reads the rest of the graph.
+void CollectElementwiseChain(Layer& layer,
+                             const std::map<LayerGuid, Layer*>& untouched,
+                             std::vector<Layer*>& chainLayers,
+                             std::vector<InputSlot*>& chainInputs)
+{
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        InputSlot& inputSlot = layer.GetInputSlot(i);
+        Layer* producer = GetFusableProducer(inputSlot, untouched);
+        if (producer != nullptr)
+        {
+            CollectElementwiseChain(*producer, untouched, chainLayers, chainInputs);
+        }
+        else
+        {
+            chainInputs.push_back(&inputSlot);
+        }
+    }
+    chainLayers.push_back(&layer);
+}
+
+void DeleteFusedElementwise(const void* blob)
+{
+    delete static_cast<const FusedElementwise*>(blob);
+}
+
+/// Replaces the chain of ElementwiseBinary, ElementwiseUnary and Activation layers ending with the given layer by a
+/// single PreCompiled layer evaluating the whole chain in one pass over memory, when there is more than one layer
+/// to fuse. Returns the layers which were replaced.
+std::vector<Layer*> FuseElementwiseChain(OptimizationViews& optimizationViews,
+                                         Layer& lastLayer,
+                                         const std::map<LayerGuid, Layer*>& untouched)
+{
+    std::vector<Layer*> chainLayers;
+    std::vector<InputSlot*> chainInputs;
+    CollectElementwiseChain(lastLayer, untouched, chainLayers, chainInputs);
+    if (chainLayers.size() < 2)
+    {
+        return {};
+    }
+
+    std::unordered_map<const InputSlot*, unsigned int> inputOperands;
+    for (unsigned int i = 0; i < chainInputs.size(); ++i)
+    {
+        inputOperands[chainInputs[i]] = i;
+    }
+
+    auto fusedElementwise = std::make_unique<FusedElementwise>(static_cast<unsigned int>(chainInputs.size()));
+    std::unordered_map<const Layer*, unsigned int> resultOperands;
+    for (Layer* layer : chainLayers)
+    {
+        std::vector<unsigned int> operands;
+        for (const InputSlot& inputSlot : layer->GetInputSlots())
+        {
+            auto input = inputOperands.find(&inputSlot);
+            operands.push_back(input != inputOperands.end()
+                               ? input->second
+                               : resultOperands.at(&inputSlot.GetConnectedOutputSlot()->GetOwningLayer()));
+        }
+
+        switch (layer->GetType())
+        {
+            case LayerType::ElementwiseBinary:
+            {
+                auto binaryLayer = PolymorphicDowncast<ElementwiseBinaryLayer*>(layer);
+                resultOperands[layer] = fusedElementwise->AddBinary(binaryLayer->GetParameters().m_Operation,
+                                                                    operands[0],
+                                                                    operands[1]);
+                break;
+            }
+            case LayerType::ElementwiseUnary:
+            {
+                auto unaryLayer = PolymorphicDowncast<ElementwiseUnaryLayer*>(layer);
+                resultOperands[layer] = fusedElementwise->AddUnary(unaryLayer->GetParameters().m_Operation,
+                                                                   operands[0]);
+                break;
+            }
+            default:
+            {
+                auto activationLayer = PolymorphicDowncast<ActivationLayer*>(layer);
+                resultOperands[layer] = fusedElementwise->AddActivation(activationLayer->GetParameters(),
+                                                                        operands[0]);
+                break;
+            }
+        }
+    }
+
+    CompiledBlobPtr compiledBlob(fusedElementwise.release(), DeleteFusedElementwise);
+
+    const std::string name = std::string("fused-elementwise-") + lastLayer.GetName();
+    IConnectableLayer* replacementLayer = optimizationViews.GetINetwork()->AddPrecompiledLayer(
+        PreCompiledDescriptor(static_cast<unsigned int>(chainInputs.size()), 1),
+        std::move(compiledBlob),
+        RefBackend::GetIdStatic(),
+        name.c_str());
+    replacementLayer->GetOutputSlot(0).SetTensorInfo(lastLayer.GetOutputSlot(0).GetTensorInfo());
+
+    SubgraphView substitutionSubgraph(SubgraphView::IConnectableLayers(chainLayers.begin(), chainLayers.end()),
+                                      SubgraphView::IInputSlots(chainInputs.begin(), chainInputs.end()),
+                                      { &lastLayer.GetOutputSlot(0) });
+    SubgraphView replacementSubgraph(replacementLayer);
+    optimizationViews.AddSubstitution({ substitutionSubgraph, replacementSubgraph });
+
+    return chainLayers;
+}
+
+} // anonymous namespace
+
 const BackendId& RefBackend::GetIdStatic()
 {
     static const BackendId s_Id{RefBackendId()};
@@ -47,8 +260,39 @@ IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     return std::make_unique<RefWorkloadFactory>(PolymorphicPointerDowncast<RefMemoryManager>(memoryManager));
 }
 
-IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions&) const
+IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
+    const IBackendInternal::IMemoryManagerSharedPtr& memoryManager, const ModelOptions&) const
+{
+    // The CpuRef model options only change OptimizeSubgraphView, the workloads do not depend on them. This overload
+    // still has to be provided, as the default one returns no factory as soon as there are CpuRef model options.
+    return CreateWorkloadFactory(memoryManager);
+}
+
+IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
+    class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry, const ModelOptions&) const
+{
+    return CreateWorkloadFactory(tensorHandleFactoryRegistry);
+}
+
+IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions& options) const
 {
+    // Whether a runtime of this process has already set the number of threads of the process wide RefTaskPool.
+    static std::atomic<bool> numberOfThreadsSet{false};
+
+    ParseOptions(options.m_BackendOptions, GetIdStatic(), [](std::string name, const BackendOptions::Var& value)
+    {
+        if (name == "NumberOfThreads" && value.IsUnsignedInt())
+        {
+            const unsigned int numThreads = value.AsUnsignedInt();
+            const unsigned int currentNumThreads = RefTaskPool::Get().GetNumberOfThreads();
+            if (numberOfThreadsSet.exchange(true) && numThreads != currentNumThreads)
+            {
+                ARMNN_LOG(warning) << "CpuRef NumberOfThreads is process wide: changing it from " << currentNumThreads
+                                   << " to " << numThreads << " also applies to the runtimes created before.";
+            }
+            RefTaskPool::Get().SetNumberOfThreads(numThreads);
+        }
+    });
     return IBackendContextPtr{};
 }
 
@@ -63,6 +307,12 @@ IBackendInternal::IMemoryManagerUniquePtr RefBackend::CreateMemoryManager() cons
     return std::make_unique<RefMemoryManager>();
 }
 
+IBackendInternal::IBackendSpecificModelContextPtr RefBackend::CreateBackendSpecificModelContext(
+    const ModelOptions& modelOptions) const
+{
+    return IBackendSpecificModelContextPtr{new RefBackendModelContext{modelOptions}};
+}
+
 IBackendInternal::ILayerSupportSharedPtr RefBackend::GetLayerSupport() const
 {
     static ILayerSupportSharedPtr layerSupport{new RefLayerSupport};
@@ -73,6 +323,7 @@ OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph,
                                                    const ModelOptions& modelOptions) const
 {
     OptimizationViews optimizationViews(modelOptions);
+    const RefBackendModelContext modelContext(modelOptions);
 
     auto it = subgraph.end();
     std::map<LayerGuid, Layer*> untouched;
@@ -115,6 +366,82 @@ OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph,
             }
         }
 
+        // Fuse an Activation into the Convolution2d, DepthwiseConvolution2d or FullyConnected layer producing its
+        // input. The reference workloads then apply it as they write their output, rather than it costing another
+        // workload and another pass over the whole tensor.
+        if ((base.GetType() == LayerType::Convolution2d || base.GetType() == LayerType::DepthwiseConvolution2d
+             || base.GetType() == LayerType::FullyConnected)
+            && base.GetAdditionalInformation<ActivationDescriptor>() == nullptr
+            && base.GetOutputSlot(0).GetNumConnections() == 1)
+        {
+            Layer& child = base.GetOutputSlot(0).GetConnection(0)->GetOwningLayer();
+
+            // The Activation must be part of this subgraph and not already replaced by another substitution.
+            if (child.GetType() == LayerType::Activation
+                && untouched.find(child.GetGuid()) != untouched.end()
+                && checkDataTypeInputandOutput(child))
+            {
+                ActivationLayer* activationLayer = PolymorphicDowncast<ActivationLayer*>(&child);
+                ActivationDescriptor activationDesc = activationLayer->GetParameters();
+                const std::string name = std::string("fused-") + child.GetName() + std::string("-into-") +
+                                         base.GetName();
+
+                if (base.GetType() == LayerType::Convolution2d)
+                {
+                    FuseConvolution2dLayer<Convolution2dLayer>(optimizationViews,
+                                                               PolymorphicDowncast<Convolution2dLayer*>(&base),
+                                                               activationLayer,
+                                                               activationDesc,
+                                                               name);
+                }
+                else if (base.GetType() == LayerType::DepthwiseConvolution2d)
+                {
+                    FuseDepthwiseConvolution2dLayer<DepthwiseConvolution2dLayer>(
+                        optimizationViews,
+                        PolymorphicDowncast<DepthwiseConvolution2dLayer*>(&base),
+                        activationLayer,
+                        activationDesc,
+                        name);
+                }
+                else
+                {
+                    FuseFullyConnectedLayer<FullyConnectedLayer>(optimizationViews,
+                                                                 PolymorphicDowncast<FullyConnectedLayer*>(&base),
+                                                                 activationLayer,
+                                                                 activationDesc,
+                                                                 name);
+                }
+                untouched.erase(base.GetGuid());
+                untouched.erase(child.GetGuid());
+            }
+        }
+
+        // Fuse a chain of elementwise layers, such as the Sub, Mul and Add of a normalisation or the operations of
+        // an approximate GELU, into one layer which computes every element of the output in a single pass. Chains
+        // are fused from their last layer, which is the one whose output is not used by another layer of the chain.
+        if (modelContext.IsElementwiseFusionEnabled()
+            && untouched.find(base.GetGuid()) != untouched.end()
+            && IsFusableElementwiseLayer(base))
+        {
+            bool isLastLayer = true;
+            if (base.GetOutputSlot(0).GetNumConnections() == 1)
+            {
+                const InputSlot& consumerSlot = *base.GetOutputSlot(0).GetConnection(0);
+                const Layer& consumer = consumerSlot.GetOwningLayer();
+                isLastLayer = untouched.find(consumer.GetGuid()) == untouched.end()
+                              || !IsFusableElementwiseLayer(consumer)
+                              || GetFusableProducer(consumerSlot, untouched) == nullptr;
+            }
+
+            if (isLastLayer)
+            {
+                for (Layer* fusedLayer : FuseElementwiseChain(optimizationViews, base, untouched))
+                {
+                    untouched.erase(fusedLayer->GetGuid());
+                }
+            }
+        }
+
         // Remove Reshape where possible
         if (base.GetType() == LayerType::Reshape)
         {
@@ -171,4 +498,15 @@ void RefBackend::UpdateExecutionData(ExecutionData& executionData, WorkingMemDes
     executionData.m_Data = &workingMemDescriptor;
 }
 
+std::vector<uint8_t> RefBackend::SerializePreCompiledObject(const void* preCompiledObject) const
+{
+    // The fused elementwise chains are the only pre-compiled objects of this backend.
+    return static_cast<const FusedElementwise*>(preCompiledObject)->Serialize();
+}
+
+CompiledBlobPtr RefBackend::DeserializePreCompiledObject(const std::vector<uint8_t>& data) const
+{
+    return CompiledBlobPtr(FusedElementwise::Deserialize(data).release(), DeleteFusedElementwise);
+}
+
 } // namespace armnn
@@ -19,7 +19,9 @@ const BackendCapabilities cpuRefCapabilities("CpuRef",
                                                     {"ExternallyManagedMemory", true},
                                                     {"MultiAxisPacking", false},
                                                     {"SingleAxisPacking", true},
-                                                    {"HasFp16", true}
+                                                    {"HasFp16", true},
+                                                    {"ThreadSafeWorkloadCreation", true},
+                                                    {"ConcurrentWorkloadExecution", true}
                                              });
 
 const std::set<armnn::BackendCapability> oldCpuRefCapabilities {
@@ -44,11 +46,28 @@ public:
     IBackendInternal::IWorkloadFactoryPtr CreateWorkloadFactory(
         class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry) const override;
 
-    IBackendInternal::IBackendContextPtr CreateBackendContext(const IRuntime::CreationOptions&) const override;
+    IBackendInternal::IWorkloadFactoryPtr CreateWorkloadFactory(
+        const IMemoryManagerSharedPtr& memoryManager, const ModelOptions& modelOptions) const override;
+
+    IBackendInternal::IWorkloadFactoryPtr CreateWorkloadFactory(
+        class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry,
+        const ModelOptions& modelOptions) const override;
+
+    /// Applies the CpuRef backend options of IRuntime::CreationOptions::m_BackendOptions. The supported options are:
+    ///  - "NumberOfThreads"\n
+    ///    Specify the number of threads the CpuRef backend uses to split heavy workloads (convolutions, fully
+    ///    connected, pooling). The thread pool is process wide: it is shared by every network of every runtime in the
+    ///    process, so the runtime created last sets the number of threads, and a warning is logged when it changes a
+    ///    number set by an earlier runtime. Defaults to 1, i.e. every workload runs on the thread executing the
+    ///    network.
+    IBackendInternal::IBackendContextPtr CreateBackendContext(const IRuntime::CreationOptions& options) const override;
 
     IBackendInternal::IBackendProfilingContextPtr CreateBackendProfilingContext(
         const IRuntime::CreationOptions& creationOptions, IBackendProfilingPtr& backendProfiling) override;
 
+    IBackendInternal::IBackendSpecificModelContextPtr CreateBackendSpecificModelContext(
+        const ModelOptions& modelOptions) const override;
+
     IBackendInternal::ILayerSupportSharedPtr GetLayerSupport() const override;
 
     OptimizationViews OptimizeSubgraphView(const SubgraphView& subgraph,
@@ -68,6 +87,10 @@ public:
     ExecutionData CreateExecutionData(WorkingMemDescriptor& workingMemDescriptor) const override;
 
     void UpdateExecutionData(ExecutionData& executionData, WorkingMemDescriptor& workingMemDescriptor) const override;
+
+    std::vector<uint8_t> SerializePreCompiledObject(const void* preCompiledObject) const override;
+
+    CompiledBlobPtr DeserializePreCompiledObject(const std::vector<uint8_t>& data) const override;
 };
 
 } // namespace armnn
@@ -0,0 +1,45 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefBackendModelContext.hpp"
+
+namespace
+{
+
+bool ParseBool(const armnn::BackendOptions::Var& value, bool defaultValue)
+{
+    if (value.IsBool())
+    {
+        return value.AsBool();
+    }
+    return defaultValue;
+}
+
+} // namespace anonymous
+
+namespace armnn
+{
+
+RefBackendModelContext::RefBackendModelContext(const ModelOptions& modelOptions)
+    : m_IsElementwiseFusionEnabled(false)
+{
+    if (!modelOptions.empty())
+    {
+        ParseOptions(modelOptions, "CpuRef", [&](std::string name, const BackendOptions::Var& value)
+        {
+            if (name == "FuseElementwise")
+            {
+                m_IsElementwiseFusionEnabled = ParseBool(value, false);
+            }
+        });
+    }
+}
+
+bool RefBackendModelContext::IsElementwiseFusionEnabled() const
+{
+    return m_IsElementwiseFusionEnabled;
+}
+
+} // namespace armnn
@@ -0,0 +1,28 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/backends/IBackendContext.hpp>
+
+namespace armnn
+{
+
+/// The RefBackendModelContext is used to pass in CpuRef specific backend ModelOptions. The supported backend
+/// ModelOptions are:
+///  - "FuseElementwise"\n
+///    Whether chains of ElementwiseBinary, ElementwiseUnary and Activation layers are fused into single layers which
+///    compute their whole result in one pass over memory. Defaults to false.
+class RefBackendModelContext : public IBackendModelContext
+{
+public:
+    RefBackendModelContext(const ModelOptions& modelOptions);
+
+    bool IsElementwiseFusionEnabled() const;
+
+private:
+    bool m_IsElementwiseFusionEnabled;
+};
+
+} // namespace armnn
@@ -533,7 +533,14 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateWorkload(LayerType type,
         }
         case LayerType::PreCompiled:
         {
-            return nullptr;
+            // The only PreCompiled layers assigned to CpuRef are the elementwise chains fused by
+            // RefBackend::OptimizeSubgraphView.
+            auto preCompiledQueueDescriptor = PolymorphicDowncast<const PreCompiledQueueDescriptor*>(&descriptor);
+            if (preCompiledQueueDescriptor->m_PreCompiledObject == nullptr)
+            {
+                return nullptr;
+            }
+            return std::make_unique<RefFusedElementwiseWorkload>(*preCompiledQueueDescriptor, info);
         }
         case LayerType::Prelu:
         {
@@ -15,6 +15,7 @@ ifeq ($(ARMNN_REF_ENABLED),1)
 
 BACKEND_SOURCES := \
         RefBackend.cpp \
+        RefBackendModelContext.cpp \
         RefLayerSupport.cpp \
         RefMemoryManager.cpp \
         RefTensorHandle.cpp \
@@ -27,6 +28,7 @@ BACKEND_SOURCES := \
         workloads/BatchNormImpl.cpp \
         workloads/BatchToSpaceNd.cpp \
         workloads/Broadcast.cpp \
+        workloads/ConvGemmImpl.cpp \
         workloads/ConvImpl.cpp \
         workloads/Conv3dImpl.cpp \
         workloads/Debug.cpp \
@@ -36,6 +38,8 @@ BACKEND_SOURCES := \
         workloads/ElementwiseFunction.cpp \
         workloads/Fill.cpp \
         workloads/FullyConnected.cpp \
+        workloads/FusedActivation.cpp \
+        workloads/FusedElementwise.cpp \
         workloads/Gather.cpp \
         workloads/InstanceNorm.cpp \
         workloads/LogSoftmax.cpp \
@@ -47,6 +51,7 @@ BACKEND_SOURCES := \
         workloads/Pooling2d.cpp \
         workloads/Pooling3d.cpp \
         workloads/PreluImpl.cpp \
+        workloads/QuantizedConvImpl.cpp \
         workloads/Reduce.cpp \
         workloads/RefActivationWorkload.cpp \
         workloads/RefArgMinMaxWorkload.cpp \
@@ -75,6 +80,7 @@ BACKEND_SOURCES := \
         workloads/RefFillWorkload.cpp \
         workloads/RefFloorWorkload.cpp \
         workloads/RefFullyConnectedWorkload.cpp \
+        workloads/RefFusedElementwiseWorkload.cpp \
         workloads/RefGatherNdWorkload.cpp \
         workloads/RefGatherWorkload.cpp \
         workloads/RefInstanceNormalizationWorkload.cpp \
@@ -104,6 +110,7 @@ BACKEND_SOURCES := \
         workloads/RefStackWorkload.cpp \
         workloads/RefStridedSliceWorkload.cpp \
         workloads/RefSplitterWorkload.cpp \
+        workloads/RefTaskPool.cpp \
         workloads/RefTileWorkload.cpp \
         workloads/RefTransposeConvolution2dWorkload.cpp \
         workloads/RefTransposeWorkload.cpp \
@@ -143,15 +150,20 @@ ifeq ($(ARMNN_REF_ENABLED),1)
 BACKEND_TEST_SOURCES := \
         test/ArgMinMaxTests.cpp \
         test/RefBackendTests.cpp \
+        test/RefConvolutionGemmTests.cpp \
         test/RefCreateWorkloadTests.cpp \
+        test/RefDecoderEncoderRangeTests.cpp \
         test/RefDetectionPostProcessTests.cpp \
         test/RefEndToEndTests.cpp \
+        test/RefFusedElementwiseTests.cpp \
         test/RefJsonPrinterTests.cpp \
         test/RefLayerSupportTests.cpp \
         test/RefLayerTests.cpp \
         test/RefMemoryManagerTests.cpp \
         test/RefOptimizedNetworkTests.cpp \
+        test/RefQuantizedConvTests.cpp \
         test/RefRuntimeTests.cpp \
+        test/RefTaskPoolTests.cpp \
         test/RefTensorHandleTests.cpp
 else
 
@@ -0,0 +1,133 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/ConvGemmImpl.hpp>
+#include <reference/workloads/ConvImpl.hpp>
+
+#include <fmt/format.h>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+TEST_SUITE("RefConvolutionGemm")
+{
+using namespace armnn;
+
+struct ConvGemmTestCase
+{
+    DataLayout m_DataLayout;
+    unsigned int m_Batches;
+    unsigned int m_InputChannels;
+    unsigned int m_InputHeight;
+    unsigned int m_InputWidth;
+    unsigned int m_OutputChannels;
+    unsigned int m_FilterHeight;
+    unsigned int m_FilterWidth;
+    unsigned int m_PadTop;
+    unsigned int m_PadBottom;
+    unsigned int m_PadLeft;
+    unsigned int m_PadRight;
+    unsigned int m_Stride;
+    unsigned int m_Dilation;
+    bool m_BiasEnabled;
+};
+
+TensorShape MakeShape(DataLayout dataLayout, unsigned int n, unsigned int c, unsigned int h, unsigned int w)
+{
+    return dataLayout == DataLayout::NHWC ? TensorShape({ n, h, w, c }) : TensorShape({ n, c, h, w });
+}
+
+// Runs the same convolution through the generic Convolve() loop and through ConvolveGemm() and checks that the
+// results match.
+void CompareWithReference(const ConvGemmTestCase& t)
+{
+    const unsigned int dilatedFilterHeight = t.m_Dilation * (t.m_FilterHeight - 1) + 1;
+    const unsigned int dilatedFilterWidth  = t.m_Dilation * (t.m_FilterWidth - 1) + 1;
+    const unsigned int outputHeight =
+        (t.m_InputHeight + t.m_PadTop + t.m_PadBottom - dilatedFilterHeight) / t.m_Stride + 1;
+    const unsigned int outputWidth =
+        (t.m_InputWidth + t.m_PadLeft + t.m_PadRight - dilatedFilterWidth) / t.m_Stride + 1;
+
+    const TensorShape inputShape  = MakeShape(t.m_DataLayout, t.m_Batches, t.m_InputChannels,
+                                              t.m_InputHeight, t.m_InputWidth);
+    const TensorShape outputShape = MakeShape(t.m_DataLayout, t.m_Batches, t.m_OutputChannels,
+                                              outputHeight, outputWidth);
+    const TensorShape filterShape = MakeShape(t.m_DataLayout, t.m_OutputChannels, t.m_InputChannels,
+                                              t.m_FilterHeight, t.m_FilterWidth);
+    const TensorShape biasShape{ t.m_OutputChannels };
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    auto fill = [&](std::vector<float>& data) { for (auto& v : data) { v = distribution(generator); } };
+
+    std::vector<float> input(inputShape.GetNumElements());
+    std::vector<float> filter(filterShape.GetNumElements());
+    std::vector<float> bias(biasShape.GetNumElements());
+    fill(input);
+    fill(filter);
+    fill(bias);
+
+    std::vector<float> expected(outputShape.GetNumElements());
+    std::vector<float> actual(outputShape.GetNumElements());
+
+    Float32Decoder inputDecoder(input.data());
+    Float32Decoder filterDecoder(filter.data());
+    Float32Decoder biasDecoder(bias.data());
+    Float32Encoder outputEncoder(expected.data());
+
+    Convolve(inputShape, inputDecoder, outputShape, outputEncoder, filterShape, filterDecoder,
+             t.m_BiasEnabled, &biasDecoder, t.m_DataLayout, t.m_PadTop, t.m_PadLeft,
+             t.m_Stride, t.m_Stride, t.m_Dilation, t.m_Dilation);
+
+    const std::vector<float> packedFilter = PackConvolutionFilter(filterShape, filter.data(), t.m_DataLayout);
+    CHECK(packedFilter.size() == GetPackedConvolutionFilterSize(filterShape, t.m_DataLayout));
+
+    ConvolveGemm(inputShape, input.data(), outputShape, actual.data(), filterShape, packedFilter.data(),
+                 t.m_BiasEnabled ? bias.data() : nullptr, t.m_DataLayout, t.m_PadTop, t.m_PadLeft,
+                 t.m_Stride, t.m_Stride, t.m_Dilation, t.m_Dilation);
+
+    for (unsigned int i = 0; i < expected.size(); ++i)
+    {
+        // The two implementations accumulate in a different order, so allow for rounding relative to the magnitude.
+        const float tolerance = 1e-4f * std::max(1.0f, std::fabs(expected[i]));
+        if (std::fabs(expected[i] - actual[i]) > tolerance)
+        {
+            FAIL(fmt::format("Output mismatch at index {}: {} != {}", i, expected[i], actual[i]));
+        }
+    }
+}
+
+TEST_CASE("ConvolveGemmMatchesConvolveNhwc")
+{
+    CompareWithReference({ DataLayout::NHWC, 2, 5, 9, 7, 19, 3, 3, 1, 1, 1, 1, 1, 1, true });
+}
+
+TEST_CASE("ConvolveGemmMatchesConvolveNchw")
+{
+    CompareWithReference({ DataLayout::NCHW, 2, 5, 9, 7, 19, 3, 3, 1, 1, 1, 1, 1, 1, true });
+}
+
+TEST_CASE("ConvolveGemmStridedDilatedAsymmetricPadding")
+{
+    CompareWithReference({ DataLayout::NHWC, 1, 3, 12, 11, 8, 3, 2, 2, 0, 1, 3, 2, 2, false });
+    CompareWithReference({ DataLayout::NCHW, 1, 3, 12, 11, 8, 3, 2, 2, 0, 1, 3, 2, 2, false });
+}
+
+TEST_CASE("ConvolveGemmPointwise")
+{
+    CompareWithReference({ DataLayout::NHWC, 1, 32, 6, 5, 33, 1, 1, 0, 0, 0, 0, 1, 1, true });
+    CompareWithReference({ DataLayout::NCHW, 1, 32, 6, 5, 33, 1, 1, 0, 0, 0, 0, 1, 1, true });
+}
+
+TEST_CASE("ConvolveGemmLargeRowSize")
+{
+    // K = 5 * 5 * 128 forces the im2col matrix to be split into several row blocks.
+    CompareWithReference({ DataLayout::NHWC, 1, 128, 10, 10, 17, 5, 5, 2, 2, 2, 2, 1, 1, true });
+}
+
+}
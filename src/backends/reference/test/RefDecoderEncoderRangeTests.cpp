@@ -0,0 +1,178 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/Encoders.hpp>
+
+#include <fmt/format.h>
+
+#include <doctest/doctest.h>
+
+#include <cstring>
+#include <random>
+
+TEST_SUITE("RefDecoderEncoderRange")
+{
+using namespace armnn;
+
+constexpr unsigned int NumElements = 2 * 3 * 4 * 5;
+constexpr unsigned int Position = 7;
+constexpr unsigned int Offset = 11;
+constexpr unsigned int Count = 50;
+
+std::vector<TensorInfo> GetFloatTensorInfos()
+{
+    const TensorShape shape({ 2, 3, 4, 5 });
+    return
+    {
+        TensorInfo(shape, DataType::Float32),
+        TensorInfo(shape, DataType::Float16),
+        TensorInfo(shape, DataType::QAsymmU8, 0.1f, 120),
+        TensorInfo(shape, DataType::QAsymmS8, 0.1f, -3),
+        TensorInfo(shape, DataType::QSymmS8, 0.1f, 0),
+        TensorInfo(shape, DataType::QSymmS16, 0.01f, 0),
+        TensorInfo(shape, DataType::Signed32),
+        TensorInfo(shape, DataType::Signed32, 0.5f, 0),
+        TensorInfo(shape, DataType::QSymmS8, { 0.1f, 0.2f, 0.3f }, 1),
+        TensorInfo(shape, DataType::Signed32, { 0.1f, 0.2f }, 0)
+    };
+}
+
+// DecodeRange() must give the same values as Get() from the same position and must not move the iterator.
+TEST_CASE("DecodeRangeMatchesGet")
+{
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    for (const TensorInfo& info : GetFloatTensorInfos())
+    {
+        CAPTURE(GetDataTypeName(info.GetDataType()));
+        // Float32/Float16 buffers are filled from small integers to avoid NaNs.
+        std::vector<uint8_t> data(info.GetNumBytes());
+        if (info.GetDataType() == DataType::Float32)
+        {
+            float* values = reinterpret_cast<float*>(data.data());
+            for (unsigned int i = 0; i < NumElements; ++i)
+            {
+                values[i] = static_cast<float>(distribution(generator)) - 100.0f;
+            }
+        }
+        else if (info.GetDataType() == DataType::Float16)
+        {
+            std::vector<float> values(NumElements);
+            for (auto& value : values)
+            {
+                value = static_cast<float>(distribution(generator)) - 100.0f;
+            }
+            armnnUtils::FloatingPointConverter::ConvertFloat32To16(values.data(), NumElements, data.data());
+        }
+        else
+        {
+            for (auto& value : data)
+            {
+                value = static_cast<uint8_t>(distribution(generator));
+            }
+        }
+
+        auto decoder = MakeDecoder<float>(info, data.data());
+        (*decoder)[Position];
+
+        std::vector<float> range(Count);
+        decoder->DecodeRange(Offset, Count, range.data());
+        auto reference = MakeDecoder<float>(info, data.data());
+        (*reference)[Position];
+        CHECK(decoder->Get() == reference->Get());
+
+        for (unsigned int i = 0; i < Count; ++i)
+        {
+            (*decoder)[Position + Offset + i];
+            if (decoder->Get() != range[i])
+            {
+                FAIL(fmt::format("Decoded value mismatch at index {}: {} != {}", i, decoder->Get(), range[i]));
+            }
+        }
+    }
+}
+
+// EncodeRange() must write the same bytes as Set() from the same position and must not move the iterator.
+TEST_CASE("EncodeRangeMatchesSet")
+{
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<float> distribution(-30.0f, 30.0f);
+    std::vector<float> values(Count);
+    for (auto& value : values)
+    {
+        value = distribution(generator);
+    }
+
+    const TensorShape shape({ 2, 3, 4, 5 });
+    const std::vector<TensorInfo> infos =
+    {
+        TensorInfo(shape, DataType::Float32),
+        TensorInfo(shape, DataType::Float16),
+        TensorInfo(shape, DataType::QAsymmU8, 0.1f, 120),
+        TensorInfo(shape, DataType::QAsymmS8, 0.1f, -3),
+        TensorInfo(shape, DataType::QSymmS8, 0.1f, 0),
+        TensorInfo(shape, DataType::QSymmS16, 0.01f, 0),
+        TensorInfo(shape, DataType::Signed32)
+    };
+
+    for (const TensorInfo& info : infos)
+    {
+        CAPTURE(GetDataTypeName(info.GetDataType()));
+        std::vector<uint8_t> expected(info.GetNumBytes());
+        std::vector<uint8_t> actual(info.GetNumBytes());
+
+        auto expectedEncoder = MakeEncoder<float>(info, expected.data());
+        for (unsigned int i = 0; i < Count; ++i)
+        {
+            (*expectedEncoder)[Position + Offset + i];
+            expectedEncoder->Set(values[i]);
+        }
+
+        auto encoder = MakeEncoder<float>(info, actual.data());
+        (*encoder)[Position];
+        encoder->EncodeRange(Offset, Count, values.data());
+
+        CHECK(std::memcmp(expected.data(), actual.data(), expected.size()) == 0);
+
+        // The position is unchanged, so a Set() lands on the element at Position.
+        encoder->Set(1.0f);
+        (*expectedEncoder)[Position];
+        expectedEncoder->Set(1.0f);
+        CHECK(std::memcmp(expected.data(), actual.data(), expected.size()) == 0);
+    }
+}
+
+TEST_CASE("BooleanAndInt32RangesMatchGetSet")
+{
+    std::vector<uint8_t> booleans = { 0, 1, 1, 0, 1, 0, 0, 1 };
+    std::vector<int32_t> integers = { -5, 3, 200, -70000, 1, 0, 42, 7 };
+    const TensorInfo booleanInfo({ 8 }, DataType::Boolean);
+    const TensorInfo int32Info({ 8 }, DataType::Signed32);
+
+    bool decodedBooleans[8];
+    MakeDecoder<bool>(booleanInfo, booleans.data())->DecodeRange(0, 8, decodedBooleans);
+    std::vector<uint8_t> encodedBooleans(8);
+    MakeEncoder<bool>(booleanInfo, encodedBooleans.data())->EncodeRange(0, 8, decodedBooleans);
+    CHECK(encodedBooleans == booleans);
+
+    std::vector<int32_t> decodedIntegers(8);
+    MakeDecoder<int32_t>(int32Info, integers.data())->DecodeRange(0, 8, decodedIntegers.data());
+    CHECK(decodedIntegers == integers);
+    std::vector<int32_t> encodedIntegers(8);
+    MakeEncoder<int32_t>(int32Info, encodedIntegers.data())->EncodeRange(0, 8, decodedIntegers.data());
+    CHECK(encodedIntegers == integers);
+}
+
+TEST_CASE("QuantizedEncodeRangeThrowsOnNaN")
+{
+    std::vector<uint8_t> data(4);
+    const std::vector<float> values = { 1.0f, std::numeric_limits<float>::quiet_NaN(), 2.0f, 3.0f };
+    auto encoder = MakeEncoder<float>(TensorInfo({ 4 }, DataType::QAsymmU8, 1.0f, 0), data.data());
+    CHECK_THROWS_AS(encoder->EncodeRange(0, 4, values.data()), InvalidArgumentException);
+}
+
+}
@@ -29,6 +29,7 @@
 #include <backendsCommon/test/InstanceNormalizationEndToEndTestImpl.hpp>
 #include <backendsCommon/test/LogSoftmaxEndToEndTestImpl.hpp>
 #include "backendsCommon/test/Pooling2dEndToEndTestImpl.hpp"
+#include <backendsCommon/test/PipelinedExecutionEndToEndTest.hpp>
 #include <backendsCommon/test/PreluEndToEndTestImpl.hpp>
 #include <backendsCommon/test/QLstmEndToEndTestImpl.hpp>
 #include <backendsCommon/test/QuantizationEndToEndTestImpl.hpp>
@@ -44,6 +45,8 @@
 #include <backendsCommon/test/SplitterEndToEndTestImpl.hpp>
 #include <backendsCommon/test/StridedSliceAsyncEndToEndTest.hpp>
 #include <backendsCommon/test/SubgraphUtilsTest.hpp>
+#include <backendsCommon/test/ThreadpoolBatchingEndToEndTest.hpp>
+#include <backendsCommon/test/ThreadpoolSchedulingEndToEndTest.hpp>
 #include <backendsCommon/test/TileEndToEndTestImpl.hpp>
 #include <backendsCommon/test/TransposeConvolution2dEndToEndTestImpl.hpp>
 #include <backendsCommon/test/TransposeEndToEndTestImpl.hpp>
@@ -699,6 +702,210 @@ TEST_CASE("RefFullyConnectedEndToEndTestConstantWeightsNonConstantBiasesFloat32"
     FullyConnectedWithDynamicOrConstantInputsEndToEnd<armnn::DataType::Float32>(defaultBackends, true, false);
 }
 
+TEST_CASE("RefFullyConnectedConstantWeightsRepeatedInference")
+{
+    // The constant weights and bias are decoded and cached by the workload on the first inference; check that the
+    // cached values give correct results for subsequent inferences with different inputs.
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    TensorInfo inputInfo({ 1, 3 }, DataType::Float32);
+    TensorInfo outputInfo({ 1, 2 }, DataType::Float32);
+    TensorInfo weightsInfo({ 3, 2 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo biasInfo({ 2 }, DataType::Float32, 0.0f, 0, true);
+
+    // Weights are [input, output] as m_TransposeWeightMatrix is false.
+    std::vector<float> weightsData = { 1.0f, 2.0f,
+                                       3.0f, 4.0f,
+                                       5.0f, 6.0f };
+    std::vector<float> biasData = { 10.0f, 20.0f };
+
+    FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = true;
+    descriptor.m_ConstantWeights = true;
+    descriptor.m_TransposeWeightMatrix = false;
+
+    INetworkPtr network(INetwork::Create());
+    IConnectableLayer* input   = network->AddInputLayer(0, "input");
+    IConnectableLayer* weights = network->AddConstantLayer(ConstTensor(weightsInfo, weightsData), "weights");
+    IConnectableLayer* bias    = network->AddConstantLayer(ConstTensor(biasInfo, biasData), "bias");
+    IConnectableLayer* fc      = network->AddFullyConnectedLayer(descriptor, "fc");
+    IConnectableLayer* output  = network->AddOutputLayer(0, "output");
+
+    Connect(input, fc, inputInfo, 0, 0);
+    Connect(weights, fc, weightsInfo, 0, 1);
+    Connect(bias, fc, biasInfo, 0, 2);
+    Connect(fc, output, outputInfo, 0, 0);
+
+    IOptimizedNetworkPtr optNet = Optimize(*network, defaultBackends, runtime->GetDeviceSpec());
+    NetworkId netId;
+    CHECK(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    TensorInfo runtimeInputInfo = runtime->GetInputTensorInfo(netId, 0);
+    runtimeInputInfo.SetConstant(true);
+
+    const std::vector<std::vector<float>> inputs   = { { 1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } };
+    const std::vector<std::vector<float>> expected = { { 11.0f, 22.0f }, { 19.0f, 32.0f } };
+    for (unsigned int i = 0; i < inputs.size(); ++i)
+    {
+        std::vector<float> outputData(2);
+        InputTensors inputTensors{ { 0, ConstTensor(runtimeInputInfo, inputs[i].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+
+        CHECK(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        CHECK(outputData == expected[i]);
+    }
+}
+
+// Runs a network taking data on input 0 and weights on input 1 once for each set of weights, and checks every
+// inference uses its own weights rather than weights cached by the workload on the first inference. The weights are
+// marked constant, as they are whenever a caller passes them in a ConstTensor, but they are not from a ConstantLayer.
+void CheckDynamicWeightsAreNotCached(armnn::INetworkPtr network,
+                                     const std::vector<float>& inputData,
+                                     const std::vector<std::vector<float>>& weightsData,
+                                     const std::vector<std::vector<float>>& expectedOutputs)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    IOptimizedNetworkPtr optNet = Optimize(*network, defaultBackends, runtime->GetDeviceSpec());
+    NetworkId netId;
+    REQUIRE(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    TensorInfo inputInfo = runtime->GetInputTensorInfo(netId, 0);
+    TensorInfo weightsInfo = runtime->GetInputTensorInfo(netId, 1);
+    inputInfo.SetConstant(true);
+    weightsInfo.SetConstant(true);
+
+    for (unsigned int i = 0; i < weightsData.size(); ++i)
+    {
+        std::vector<float> outputData(expectedOutputs[i].size());
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) },
+                                   { 1, ConstTensor(weightsInfo, weightsData[i].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+
+        CHECK(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        CHECK(outputData == expectedOutputs[i]);
+    }
+}
+
+TEST_CASE("RefFullyConnectedDynamicWeightsRepeatedInference")
+{
+    using namespace armnn;
+
+    TensorInfo inputInfo({ 1, 3 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo weightsInfo({ 2, 3 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo outputInfo({ 1, 2 }, DataType::Float32);
+
+    FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = false;
+    descriptor.m_ConstantWeights = false;
+    descriptor.m_TransposeWeightMatrix = true;
+
+    INetworkPtr network(INetwork::Create());
+    IConnectableLayer* input   = network->AddInputLayer(0, "input");
+    IConnectableLayer* weights = network->AddInputLayer(1, "weights");
+    IConnectableLayer* fc      = network->AddFullyConnectedLayer(descriptor, "fc");
+    IConnectableLayer* output  = network->AddOutputLayer(0, "output");
+
+    Connect(input, fc, inputInfo, 0, 0);
+    Connect(weights, fc, weightsInfo, 0, 1);
+    Connect(fc, output, outputInfo, 0, 0);
+
+    // Weights are [output, input] as m_TransposeWeightMatrix is true.
+    CheckDynamicWeightsAreNotCached(std::move(network),
+                                    { 1.0f, 2.0f, 3.0f },
+                                    { { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f },
+                                      { 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f } },
+                                    { { 1.0f, 2.0f }, { 3.0f, 6.0f } });
+}
+
+TEST_CASE("RefFullyConnectedDynamicWeightsDefaultDescriptorRepeatedInference")
+{
+    using namespace armnn;
+
+    TensorInfo inputInfo({ 1, 3 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo weightsInfo({ 3, 2 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo outputInfo({ 1, 2 }, DataType::Float32);
+
+    // m_ConstantWeights keeps its default of true, although the weights come from an InputLayer.
+    FullyConnectedDescriptor descriptor;
+
+    INetworkPtr network(INetwork::Create());
+    IConnectableLayer* input   = network->AddInputLayer(0, "input");
+    IConnectableLayer* weights = network->AddInputLayer(1, "weights");
+    IConnectableLayer* fc      = network->AddFullyConnectedLayer(descriptor, "fc");
+    IConnectableLayer* output  = network->AddOutputLayer(0, "output");
+
+    Connect(input, fc, inputInfo, 0, 0);
+    Connect(weights, fc, weightsInfo, 0, 1);
+    Connect(fc, output, outputInfo, 0, 0);
+
+    // Weights are [input, output] as m_TransposeWeightMatrix is false.
+    CheckDynamicWeightsAreNotCached(std::move(network),
+                                    { 1.0f, 2.0f, 3.0f },
+                                    { { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f },
+                                      { 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f } },
+                                    { { 1.0f, 2.0f }, { 3.0f, 6.0f } });
+}
+
+TEST_CASE("RefConvolution2dDynamicWeightsRepeatedInference")
+{
+    using namespace armnn;
+
+    TensorInfo inputInfo({ 1, 2, 2, 1 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo weightsInfo({ 1, 1, 1, 1 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo outputInfo({ 1, 2, 2, 1 }, DataType::Float32);
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_BiasEnabled = false;
+    descriptor.m_StrideX = 1;
+    descriptor.m_StrideY = 1;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    INetworkPtr network(INetwork::Create());
+    IConnectableLayer* input   = network->AddInputLayer(0, "input");
+    IConnectableLayer* weights = network->AddInputLayer(1, "weights");
+    IConnectableLayer* conv    = network->AddConvolution2dLayer(descriptor, "conv");
+    IConnectableLayer* output  = network->AddOutputLayer(0, "output");
+
+    Connect(input, conv, inputInfo, 0, 0);
+    Connect(weights, conv, weightsInfo, 0, 1);
+    Connect(conv, output, outputInfo, 0, 0);
+
+    CheckDynamicWeightsAreNotCached(std::move(network),
+                                    { 1.0f, 2.0f, 3.0f, 4.0f },
+                                    { { 2.0f }, { -1.0f } },
+                                    { { 2.0f, 4.0f, 6.0f, 8.0f }, { -1.0f, -2.0f, -3.0f, -4.0f } });
+}
+
+TEST_CASE("RefBatchMatMulDynamicInputsRepeatedInference")
+{
+    using namespace armnn;
+
+    TensorInfo inputInfo({ 2, 2 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo outputInfo({ 2, 2 }, DataType::Float32);
+
+    INetworkPtr network(INetwork::Create());
+    IConnectableLayer* inputX      = network->AddInputLayer(0, "inputX");
+    IConnectableLayer* inputY      = network->AddInputLayer(1, "inputY");
+    IConnectableLayer* batchMatMul = network->AddBatchMatMulLayer(BatchMatMulDescriptor(), "batchMatMul");
+    IConnectableLayer* output      = network->AddOutputLayer(0, "output");
+
+    Connect(inputX, batchMatMul, inputInfo, 0, 0);
+    Connect(inputY, batchMatMul, inputInfo, 0, 1);
+    Connect(batchMatMul, output, outputInfo, 0, 0);
+
+    CheckDynamicWeightsAreNotCached(std::move(network),
+                                    { 1.0f, 2.0f, 3.0f, 4.0f },
+                                    { { 1.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 1.0f, 0.0f } },
+                                    { { 1.0f, 2.0f, 3.0f, 4.0f }, { 2.0f, 1.0f, 4.0f, 3.0f } });
+}
+
 TEST_CASE("RefFullyConnectedEndToEndTestConstantWeightsTensorInfoNotSet")
 {
     FullyConnectedErrorChecking<armnn::DataType::Float32>(defaultBackends, false, true, true, true, false);
@@ -2065,6 +2272,49 @@ TEST_CASE("RefAsyncFP32StridedSlicedScheduledMultiThreadedEndToEndTest")
     armnn::experimental::StridedSlicedEndToEndTest<armnn::DataType::Float32>(defaultBackends, 3);
 }
 
+TEST_CASE("RefAsyncFP32StridedSlicedScheduledWorkStealingEndToEndTest")
+{
+    // Eight workers share the scheduled requests, so idle workers sleep, wake up and steal from each other.
+    armnn::experimental::StridedSlicedEndToEndTest<armnn::DataType::Float32>(defaultBackends, 8);
+}
+
+TEST_CASE("RefAsyncThreadpoolWorkStealingEndToEndTest")
+{
+    armnn::experimental::ThreadpoolWorkStealingEndToEndTest(defaultBackends);
+}
+
+TEST_CASE("RefAsyncThreadpoolOverflowEndToEndTest")
+{
+    armnn::experimental::ThreadpoolOverflowEndToEndTest(defaultBackends);
+}
+
+TEST_CASE("RefAsyncThreadpoolPriorityAgingEndToEndTest")
+{
+    armnn::experimental::ThreadpoolPriorityAgingEndToEndTest(defaultBackends);
+}
+
+TEST_CASE("RefAsyncThreadpoolBatchingEndToEndTest")
+{
+    // 11 requests with a maximum batch of 4 give full batches, a padded partial batch or single executions
+    // depending on how the requests arrive.
+    armnn::experimental::ThreadpoolBatchingEndToEndTest(defaultBackends, 2, 4, 11);
+}
+
+TEST_CASE("RefAsyncThreadpoolBatchingPaddingEndToEndTest")
+{
+    armnn::experimental::ThreadpoolBatchingPaddingEndToEndTest(defaultBackends);
+}
+
+TEST_CASE("RefAsyncThreadpoolBatchingWindowEndToEndTest")
+{
+    armnn::experimental::ThreadpoolBatchingWindowEndToEndTest(defaultBackends);
+}
+
+TEST_CASE("RefAsyncPipelinedExecutionEndToEndTest")
+{
+    armnn::experimental::PipelinedExecutionEndToEndTest(defaultBackends, 9);
+}
+
 TEST_CASE("RefAddEndToEndTestFloat32")
 {
     ElementwiseBinarySimpleEndToEnd<armnn::DataType::Float32>(defaultBackends, BinaryOperation::Add);
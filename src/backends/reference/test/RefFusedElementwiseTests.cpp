@@ -0,0 +1,271 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <Graph.hpp>
+#include <GraphUtils.hpp>
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <vector>
+
+TEST_SUITE("RefFusedElementwise")
+{
+using namespace armnn;
+
+struct FusedElementwiseResult
+{
+    std::vector<float> m_Output;
+    unsigned int m_NumPreCompiledLayers = 0;
+    unsigned int m_NumElementwiseLayers = 0;
+};
+
+OptimizerOptionsOpaque FuseElementwiseOptions()
+{
+    OptimizerOptionsOpaque options;
+    options.AddModelOption(BackendOptions("CpuRef", { { "FuseElementwise", true } }));
+    return options;
+}
+
+// Optimizes the network for CpuRef, counting the layers left in the optimized graph, then runs it. Input i of the
+// network is given inputs[i]. Elementwise fusion is enabled unless other options are given.
+FusedElementwiseResult OptimizeAndRun(INetwork& network,
+                                      const std::vector<std::vector<float>>& inputs,
+                                      unsigned int numOutputElements,
+                                      const OptimizerOptionsOpaque& options = FuseElementwiseOptions())
+{
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    IOptimizedNetworkPtr optNet = Optimize(network, { Compute::CpuRef }, runtime->GetDeviceSpec(), options);
+
+    FusedElementwiseResult result;
+    for (auto&& layer : GetGraphForTesting(optNet.get()))
+    {
+        switch (layer->GetType())
+        {
+            case LayerType::PreCompiled:
+                ++result.m_NumPreCompiledLayers;
+                break;
+            case LayerType::ElementwiseBinary:
+            case LayerType::ElementwiseUnary:
+            case LayerType::Activation:
+                ++result.m_NumElementwiseLayers;
+                break;
+            default:
+                break;
+        }
+    }
+
+    NetworkId networkId;
+    REQUIRE(runtime->LoadNetwork(networkId, std::move(optNet)) == Status::Success);
+
+    InputTensors inputTensors;
+    for (unsigned int i = 0; i < inputs.size(); ++i)
+    {
+        TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, static_cast<LayerBindingId>(i));
+        inputInfo.SetConstant(true);
+        inputTensors.push_back({ static_cast<LayerBindingId>(i), ConstTensor(inputInfo, inputs[i].data()) });
+    }
+
+    result.m_Output.resize(numOutputElements);
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), result.m_Output.data()) }
+    };
+    REQUIRE(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    return result;
+}
+
+IConnectableLayer* AddInput(INetwork& network, LayerBindingId id, const TensorInfo& info)
+{
+    IConnectableLayer* input = network.AddInputLayer(id);
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    return input;
+}
+
+IConnectableLayer* AddConstant(INetwork& network, const TensorInfo& info, const std::vector<float>& values)
+{
+    IConnectableLayer* constant = network.AddConstantLayer(ConstTensor(info, values));
+    constant->GetOutputSlot(0).SetTensorInfo(info);
+    return constant;
+}
+
+IConnectableLayer* AddBinary(INetwork& network,
+                             BinaryOperation operation,
+                             IConnectableLayer* input0,
+                             IConnectableLayer* input1,
+                             const TensorInfo& outputInfo)
+{
+    IConnectableLayer* layer = network.AddElementwiseBinaryLayer(operation);
+    input0->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(layer->GetInputSlot(1));
+    layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    return layer;
+}
+
+IConnectableLayer* AddUnary(INetwork& network,
+                            UnaryOperation operation,
+                            IConnectableLayer* input,
+                            const TensorInfo& outputInfo)
+{
+    IConnectableLayer* layer = network.AddElementwiseUnaryLayer(ElementwiseUnaryDescriptor(operation));
+    input->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+    layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    return layer;
+}
+
+IConnectableLayer* AddActivation(INetwork& network,
+                                 ActivationFunction function,
+                                 IConnectableLayer* input,
+                                 const TensorInfo& outputInfo,
+                                 float a = 0.0f,
+                                 float b = 0.0f)
+{
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = function;
+    descriptor.m_A = a;
+    descriptor.m_B = b;
+    IConnectableLayer* layer = network.AddActivationLayer(descriptor);
+    input->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+    layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    return layer;
+}
+
+void AddOutput(INetwork& network, IConnectableLayer* layer)
+{
+    layer->GetOutputSlot(0).Connect(network.AddOutputLayer(0)->GetInputSlot(0));
+}
+
+TEST_CASE("FuseNormalisationChainWithBroadcast")
+{
+    // relu((x - mean) * rsqrt(variance + epsilon) * gamma + beta), with the statistics broadcast along the last
+    // dimension and the parameters along the first two.
+    const TensorInfo info({ 2, 3, 5 }, DataType::Float32);
+    const TensorInfo statisticsInfo({ 2, 3, 1 }, DataType::Float32);
+    const TensorInfo parameterInfo({ 1, 1, 5 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo epsilonInfo({ 1, 1, 1 }, DataType::Float32, 0.0f, 0, true);
+
+    const std::vector<float> gamma = { 1.0f, 0.5f, 2.0f, -1.0f, 1.5f };
+    const std::vector<float> beta  = { 0.0f, 0.1f, -0.2f, 0.3f, 1.0f };
+    const std::vector<float> epsilon = { 0.001f };
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* x        = AddInput(*network, 0, info);
+    IConnectableLayer* mean     = AddInput(*network, 1, statisticsInfo);
+    IConnectableLayer* variance = AddInput(*network, 2, statisticsInfo);
+
+    IConnectableLayer* centred  = AddBinary(*network, BinaryOperation::Sub, x, mean, info);
+    IConnectableLayer* shifted  = AddBinary(*network, BinaryOperation::Add, variance,
+                                            AddConstant(*network, epsilonInfo, epsilon), statisticsInfo);
+    IConnectableLayer* rstd     = AddUnary(*network, UnaryOperation::Rsqrt, shifted, statisticsInfo);
+    IConnectableLayer* normed   = AddBinary(*network, BinaryOperation::Mul, centred, rstd, info);
+    IConnectableLayer* scaled   = AddBinary(*network, BinaryOperation::Mul, normed,
+                                            AddConstant(*network, parameterInfo, gamma), info);
+    IConnectableLayer* biased   = AddBinary(*network, BinaryOperation::Add, scaled,
+                                            AddConstant(*network, parameterInfo, beta), info);
+    AddOutput(*network, AddActivation(*network, ActivationFunction::ReLu, biased, info));
+
+    std::vector<float> xData(info.GetNumElements());
+    for (unsigned int i = 0; i < xData.size(); ++i)
+    {
+        xData[i] = static_cast<float>(i % 7) * 0.5f - 1.0f;
+    }
+    const std::vector<float> meanData = { 0.0f, 0.5f, -0.5f, 1.0f, 0.25f, -1.0f };
+    const std::vector<float> varianceData = { 1.0f, 0.25f, 4.0f, 2.0f, 0.5f, 1.0f };
+
+    FusedElementwiseResult result = OptimizeAndRun(*network, { xData, meanData, varianceData },
+                                                   info.GetNumElements());
+
+    // Every elementwise layer of the chain is fused into one.
+    CHECK(result.m_NumPreCompiledLayers == 1);
+    CHECK(result.m_NumElementwiseLayers == 0);
+
+    for (unsigned int i = 0; i < xData.size(); ++i)
+    {
+        const unsigned int row = i / 5;
+        const unsigned int column = i % 5;
+        const float normalised = (xData[i] - meanData[row]) / std::sqrt(varianceData[row] + epsilon[0]);
+        const float expected = std::max(0.0f, normalised * gamma[column] + beta[column]);
+        CHECK(result.m_Output[i] == doctest::Approx(expected).epsilon(1e-5));
+    }
+}
+
+TEST_CASE("FuseGeluChain")
+{
+    // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))), the usual approximation of GELU, with scalar
+    // constants broadcast to the whole tensor.
+    const TensorInfo info({ 1, 4, 300 }, DataType::Float32);
+    const TensorInfo scalarInfo({ 1, 1, 1 }, DataType::Float32, 0.0f, 0, true);
+    const float sqrt2OverPi = 0.7978845608f;
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* x = AddInput(*network, 0, info);
+    auto scalar = [&](float value) { return AddConstant(*network, scalarInfo, { value }); };
+
+    IConnectableLayer* squared = AddBinary(*network, BinaryOperation::Mul, x, x, info);
+    IConnectableLayer* cubed   = AddBinary(*network, BinaryOperation::Mul, squared, x, info);
+    IConnectableLayer* term    = AddBinary(*network, BinaryOperation::Mul, cubed, scalar(0.044715f), info);
+    IConnectableLayer* inner   = AddBinary(*network, BinaryOperation::Add, x, term, info);
+    IConnectableLayer* tanh    = AddActivation(*network, ActivationFunction::TanH, inner, info, 1.0f, sqrt2OverPi);
+    IConnectableLayer* onePlus = AddBinary(*network, BinaryOperation::Add, tanh, scalar(1.0f), info);
+    IConnectableLayer* half    = AddBinary(*network, BinaryOperation::Mul, x, scalar(0.5f), info);
+    AddOutput(*network, AddBinary(*network, BinaryOperation::Mul, half, onePlus, info));
+
+    std::vector<float> xData(info.GetNumElements());
+    for (unsigned int i = 0; i < xData.size(); ++i)
+    {
+        xData[i] = static_cast<float>(i) * 0.01f - 6.0f;
+    }
+
+    FusedElementwiseResult result = OptimizeAndRun(*network, { xData }, info.GetNumElements());
+    CHECK(result.m_NumPreCompiledLayers == 1);
+    CHECK(result.m_NumElementwiseLayers == 0);
+
+    for (unsigned int i = 0; i < xData.size(); ++i)
+    {
+        const float v = xData[i];
+        const float expected = 0.5f * v * (1.0f + std::tanh(sqrt2OverPi * (v + 0.044715f * v * v * v)));
+        CHECK(result.m_Output[i] == doctest::Approx(expected).epsilon(1e-5));
+    }
+}
+
+TEST_CASE("ResultUsedTwiceIsNotFused")
+{
+    // d = x - y is used by both the Mul and the Add, so it has to be written out; only the Mul and the Add, whose
+    // intermediate result has a single use, are fused.
+    const TensorInfo info({ 3, 4 }, DataType::Float32);
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* x = AddInput(*network, 0, info);
+    IConnectableLayer* y = AddInput(*network, 1, info);
+    IConnectableLayer* difference = AddBinary(*network, BinaryOperation::Sub, x, y, info);
+    IConnectableLayer* square = AddBinary(*network, BinaryOperation::Mul, difference, difference, info);
+    AddOutput(*network, AddBinary(*network, BinaryOperation::Add, square, difference, info));
+
+    const std::vector<float> xData = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    const std::vector<float> yData = { 0, 4, 1, 6, 2, 8, 3, 10, 4, 12, 5, 14 };
+
+    FusedElementwiseResult result = OptimizeAndRun(*network, { xData, yData }, info.GetNumElements());
+    CHECK(result.m_NumPreCompiledLayers == 1);
+    CHECK(result.m_NumElementwiseLayers == 1);
+
+    for (unsigned int i = 0; i < xData.size(); ++i)
+    {
+        const float d = xData[i] - yData[i];
+        CHECK(result.m_Output[i] == doctest::Approx(d * d + d));
+    }
+
+    // Nothing is fused unless the "FuseElementwise" model option turns fusion on.
+    FusedElementwiseResult unfused = OptimizeAndRun(*network, { xData, yData }, info.GetNumElements(),
+                                                    OptimizerOptionsOpaque());
+    CHECK(unfused.m_NumPreCompiledLayers == 0);
+    CHECK(unfused.m_NumElementwiseLayers == 3);
+    CHECK(unfused.m_Output == result.m_Output);
+}
+
+}
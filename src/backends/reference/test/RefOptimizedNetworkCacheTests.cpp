@@ -0,0 +1,289 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <Graph.hpp>
+#include <GraphUtils.hpp>
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <armnnUtils/Filesystem.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if !defined(ARMNN_DISABLE_FILESYSTEM)
+
+TEST_SUITE("RefOptimizedNetworkCache")
+{
+using namespace armnn;
+
+namespace
+{
+
+const TensorInfo g_Info({ 1, 2, 2, 1 }, DataType::Float32);
+
+// input -> conv2d (1x1) -> relu -> add (constant) -> mul (constant) -> output. On CpuRef the ReLu is fused into the
+// convolution and the Add and the Mul into a PreCompiled layer, so the optimized graph holds both a fused activation
+// and a pre-compiled object.
+INetworkPtr CreateNetwork(float weight = 2.0f)
+{
+    INetworkPtr network = INetwork::Create();
+    const TensorInfo constantInfo({ 1, 2, 2, 1 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo weightsInfo({ 1, 1, 1, 1 }, DataType::Float32, 0.0f, 0, true);
+
+    IConnectableLayer* input = network->AddInputLayer(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(g_Info);
+
+    const std::vector<float> weightsData = { weight };
+    IConnectableLayer* weights = network->AddConstantLayer(ConstTensor(weightsInfo, weightsData), "weights");
+    weights->GetOutputSlot(0).SetTensorInfo(weightsInfo);
+    Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_StrideX = 1;
+    convolutionDescriptor.m_StrideY = 1;
+    convolutionDescriptor.m_DataLayout = DataLayout::NHWC;
+    IConnectableLayer* convolution = network->AddConvolution2dLayer(convolutionDescriptor, "conv2d");
+    convolution->GetOutputSlot(0).SetTensorInfo(g_Info);
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* relu = network->AddActivationLayer(reluDescriptor, "relu");
+    relu->GetOutputSlot(0).SetTensorInfo(g_Info);
+
+    const std::vector<float> addData = { 1.0f, 2.0f, 3.0f, 4.0f };
+    IConnectableLayer* addConstant = network->AddConstantLayer(ConstTensor(constantInfo, addData), "addConstant");
+    addConstant->GetOutputSlot(0).SetTensorInfo(constantInfo);
+    IConnectableLayer* add = network->AddElementwiseBinaryLayer(BinaryOperation::Add, "add");
+    add->GetOutputSlot(0).SetTensorInfo(g_Info);
+
+    const std::vector<float> mulData = { 0.5f, 0.5f, 2.0f, 2.0f };
+    IConnectableLayer* mulConstant = network->AddConstantLayer(ConstTensor(constantInfo, mulData), "mulConstant");
+    mulConstant->GetOutputSlot(0).SetTensorInfo(constantInfo);
+    IConnectableLayer* mul = network->AddElementwiseBinaryLayer(BinaryOperation::Mul, "mul");
+    mul->GetOutputSlot(0).SetTensorInfo(g_Info);
+
+    IConnectableLayer* output = network->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+    weights->GetOutputSlot(0).Connect(convolution->GetInputSlot(1));
+    convolution->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    addConstant->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(mul->GetInputSlot(0));
+    mulConstant->GetOutputSlot(0).Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    return network;
+}
+
+// relu(2 * input) + { 1, 2, 3, 4 }, multiplied by { 0.5, 0.5, 2, 2 }.
+const std::vector<float> g_Input = { -1.0f, 1.0f, -2.0f, 2.0f };
+const std::vector<float> g_ExpectedOutput = { 0.5f, 2.0f, 6.0f, 16.0f };
+
+struct CachedOptimizeResult
+{
+    IOptimizedNetworkPtr m_OptNet = IOptimizedNetworkPtr(nullptr, nullptr);
+    bool m_LoadedFromCache = false;
+};
+
+CachedOptimizeResult OptimizeWithCache(const IRuntime& runtime,
+                                       const INetwork& network,
+                                       const std::string& cacheDirectory,
+                                       OptimizerOptionsOpaque options = OptimizerOptionsOpaque())
+{
+    options.SetOptimizedNetworkCacheDirectory(cacheDirectory);
+    // Fuses the elementwise chain of the network, so that the cache has a PreCompiled layer to store too.
+    options.AddModelOption(BackendOptions("CpuRef", { { "FuseElementwise", true } }));
+    std::vector<std::string> messages;
+    CachedOptimizeResult result;
+    result.m_OptNet = Optimize(network, { Compute::CpuRef }, runtime.GetDeviceSpec(), options, messages);
+    result.m_LoadedFromCache = std::any_of(messages.begin(), messages.end(), [](const std::string& message)
+    {
+        return message.find("from the cache") != std::string::npos;
+    });
+    return result;
+}
+
+std::vector<float> Run(IRuntime& runtime, IOptimizedNetworkPtr optNet)
+{
+    NetworkId networkId;
+    REQUIRE(runtime.LoadNetwork(networkId, std::move(optNet)) == Status::Success);
+
+    TensorInfo inputInfo = runtime.GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, g_Input.data()) } };
+    std::vector<float> output(g_ExpectedOutput.size());
+    OutputTensors outputTensors{ { 0, Tensor(runtime.GetOutputTensorInfo(networkId, 0), output.data()) } };
+    REQUIRE(runtime.EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    runtime.UnloadNetwork(networkId);
+    return output;
+}
+
+std::vector<std::string> GetCacheFiles(const std::string& cacheDirectory)
+{
+    std::vector<std::string> files;
+    for (auto&& entry : fs::directory_iterator(cacheDirectory))
+    {
+        files.push_back(entry.path().string());
+    }
+    return files;
+}
+
+// The type, name and backend of each layer of the optimized graph, sorted. Like copying a graph, loading it can
+// change the order of its constant layers, which is why they are not compared in topological order.
+std::vector<std::string> DescribeLayers(IOptimizedNetwork* optNet)
+{
+    std::vector<std::string> description;
+    for (auto&& layer : GetGraphForTesting(optNet))
+    {
+        description.push_back(std::string(GetLayerTypeAsCString(layer->GetType())) + " " + layer->GetNameStr() +
+                              " " + layer->GetBackendId().Get());
+    }
+    std::sort(description.begin(), description.end());
+    return description;
+}
+
+} // anonymous namespace
+
+TEST_CASE("RefOptimizedNetworkCacheLoadsPreviouslyOptimizedNetwork")
+{
+    const std::string cacheDirectory = armnnUtils::Filesystem::CreateDirectory("/ArmNNOptimizedNetworkCacheTests");
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    INetworkPtr network = CreateNetwork();
+
+    CachedOptimizeResult optimized = OptimizeWithCache(*runtime, *network, cacheDirectory);
+    CHECK(!optimized.m_LoadedFromCache);
+    CHECK(GetCacheFiles(cacheDirectory).size() == 1);
+
+    CachedOptimizeResult cached = OptimizeWithCache(*runtime, *network, cacheDirectory);
+    CHECK(cached.m_LoadedFromCache);
+
+    // The cached graph is the optimized one, down to the fused activation of the convolution.
+    CHECK(DescribeLayers(cached.m_OptNet.get()) == DescribeLayers(optimized.m_OptNet.get()));
+    for (auto&& layer : GetGraphForTesting(cached.m_OptNet.get()))
+    {
+        if (layer->GetType() == LayerType::Convolution2d)
+        {
+            REQUIRE(layer->GetAdditionalInformation<ActivationDescriptor>() != nullptr);
+            CHECK(layer->GetAdditionalInformation<ActivationDescriptor>()->m_Function == ActivationFunction::ReLu);
+        }
+    }
+    auto& cachedGraph = GetGraphForTesting(cached.m_OptNet.get());
+    CHECK(std::count_if(cachedGraph.begin(), cachedGraph.end(), [](const Layer* layer)
+    {
+        return layer->GetType() == LayerType::PreCompiled;
+    }) == 1);
+
+    CHECK(Run(*runtime, std::move(optimized.m_OptNet)) == g_ExpectedOutput);
+    CHECK(Run(*runtime, std::move(cached.m_OptNet)) == g_ExpectedOutput);
+
+    armnnUtils::Filesystem::RemoveDirectoryAndContents(cacheDirectory);
+}
+
+TEST_CASE("RefOptimizedNetworkCacheIsKeyedOnOptions")
+{
+    const std::string cacheDirectory = armnnUtils::Filesystem::CreateDirectory("/ArmNNOptimizedNetworkCacheTests");
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    INetworkPtr network = CreateNetwork();
+
+    CHECK(!OptimizeWithCache(*runtime, *network, cacheDirectory).m_LoadedFromCache);
+
+    OptimizerOptionsOpaque options;
+    options.SetShapeInferenceMethod(ShapeInferenceMethod::InferAndValidate);
+    CachedOptimizeResult other = OptimizeWithCache(*runtime, *network, cacheDirectory, options);
+    CHECK(!other.m_LoadedFromCache);
+    CHECK(GetCacheFiles(cacheDirectory).size() == 2);
+    CHECK(OptimizeWithCache(*runtime, *network, cacheDirectory, options).m_LoadedFromCache);
+
+    // A different network is not loaded either.
+    INetworkPtr otherNetwork = CreateNetwork(3.0f);
+    CHECK(!OptimizeWithCache(*runtime, *otherNetwork, cacheDirectory).m_LoadedFromCache);
+
+    CHECK(Run(*runtime, std::move(other.m_OptNet)) == g_ExpectedOutput);
+
+    armnnUtils::Filesystem::RemoveDirectoryAndContents(cacheDirectory);
+}
+
+TEST_CASE("RefOptimizedNetworkCacheIgnoresCorruptFiles")
+{
+    const std::string cacheDirectory = armnnUtils::Filesystem::CreateDirectory("/ArmNNOptimizedNetworkCacheTests");
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    INetworkPtr network = CreateNetwork();
+
+    CHECK(!OptimizeWithCache(*runtime, *network, cacheDirectory).m_LoadedFromCache);
+    const std::vector<std::string> files = GetCacheFiles(cacheDirectory);
+    REQUIRE(files.size() == 1);
+
+    // Truncate the file, then flip a byte in the middle of it.
+    const std::string contents = armnnUtils::Filesystem::ReadFileContentsIntoString(files[0]);
+    {
+        std::ofstream file(files[0], std::ios::binary | std::ios::trunc);
+        file << contents.substr(0, contents.size() / 2);
+    }
+    CachedOptimizeResult truncated = OptimizeWithCache(*runtime, *network, cacheDirectory);
+    CHECK(!truncated.m_LoadedFromCache);
+    CHECK(Run(*runtime, std::move(truncated.m_OptNet)) == g_ExpectedOutput);
+
+    std::string corrupted = armnnUtils::Filesystem::ReadFileContentsIntoString(files[0]);
+    REQUIRE(corrupted == contents);
+    corrupted[corrupted.size() / 2] = static_cast<char>(~corrupted[corrupted.size() / 2]);
+    {
+        std::ofstream file(files[0], std::ios::binary | std::ios::trunc);
+        file << corrupted;
+    }
+    CachedOptimizeResult flipped = OptimizeWithCache(*runtime, *network, cacheDirectory);
+    CHECK(!flipped.m_LoadedFromCache);
+    CHECK(Run(*runtime, std::move(flipped.m_OptNet)) == g_ExpectedOutput);
+
+    // The corrupt file has been replaced by a good one.
+    CHECK(OptimizeWithCache(*runtime, *network, cacheDirectory).m_LoadedFromCache);
+
+    armnnUtils::Filesystem::RemoveDirectoryAndContents(cacheDirectory);
+}
+
+TEST_CASE("RefOptimizedNetworkCacheIgnoresFilesOfOtherFormatVersions")
+{
+    const std::string cacheDirectory = armnnUtils::Filesystem::CreateDirectory("/ArmNNOptimizedNetworkCacheTests");
+    IRuntimePtr runtime(IRuntime::Create(IRuntime::CreationOptions()));
+    INetworkPtr network = CreateNetwork();
+
+    CHECK(!OptimizeWithCache(*runtime, *network, cacheDirectory).m_LoadedFromCache);
+    const std::vector<std::string> files = GetCacheFiles(cacheDirectory);
+    REQUIRE(files.size() == 1);
+
+    // Files start with the length and the characters of their identifier, followed by their format version.
+    const std::string identifier = "ArmNNOptimizedNetwork";
+    const size_t versionOffset = sizeof(uint32_t) + identifier.size();
+    std::string contents = armnnUtils::Filesystem::ReadFileContentsIntoString(files[0]);
+    REQUIRE(contents.size() > versionOffset + sizeof(uint32_t));
+    REQUIRE(contents.substr(sizeof(uint32_t), identifier.size()) == identifier);
+
+    uint32_t formatVersion = 0;
+    std::memcpy(&formatVersion, &contents[versionOffset], sizeof(formatVersion));
+    const uint32_t oldFormatVersion = formatVersion - 1;
+    std::memcpy(&contents[versionOffset], &oldFormatVersion, sizeof(oldFormatVersion));
+    {
+        std::ofstream file(files[0], std::ios::binary | std::ios::trunc);
+        file << contents;
+    }
+
+    CachedOptimizeResult old = OptimizeWithCache(*runtime, *network, cacheDirectory);
+    CHECK(!old.m_LoadedFromCache);
+    CHECK(Run(*runtime, std::move(old.m_OptNet)) == g_ExpectedOutput);
+
+    // The file of the old version has been replaced by one of the current version.
+    CHECK(OptimizeWithCache(*runtime, *network, cacheDirectory).m_LoadedFromCache);
+
+    armnnUtils::Filesystem::RemoveDirectoryAndContents(cacheDirectory);
+}
+
+}
+
+#endif
@@ -0,0 +1,221 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/ConvImpl.hpp>
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/Encoders.hpp>
+#include <reference/workloads/FullyConnected.hpp>
+#include <reference/workloads/QuantizedConvImpl.hpp>
+
+#include <fmt/format.h>
+
+#include <doctest/doctest.h>
+
+#include <cstdlib>
+#include <random>
+
+TEST_SUITE("RefQuantizedConv")
+{
+using namespace armnn;
+
+// Fills a tensor of any 8-bit or int32 type with random values over its whole range.
+std::vector<uint8_t> MakeRandomData(const TensorInfo& info, std::mt19937& generator)
+{
+    std::vector<uint8_t> data(info.GetNumBytes());
+    if (info.GetDataType() == DataType::Signed32)
+    {
+        std::uniform_int_distribution<int32_t> distribution(-2000, 2000);
+        int32_t* values = reinterpret_cast<int32_t*>(data.data());
+        for (unsigned int i = 0; i < info.GetNumElements(); ++i)
+        {
+            values[i] = distribution(generator);
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<int> distribution(0, 255);
+        for (auto& value : data)
+        {
+            value = static_cast<uint8_t>(distribution(generator));
+        }
+    }
+    return data;
+}
+
+int32_t ReadOutput(const TensorInfo& info, const std::vector<uint8_t>& data, unsigned int index)
+{
+    return info.GetDataType() == DataType::QAsymmS8 ? static_cast<int32_t>(static_cast<int8_t>(data[index]))
+                                                    : static_cast<int32_t>(data[index]);
+}
+
+// The integer kernels round once, at the end, whereas the float path rounds the dequantized result, so allow the
+// outputs to differ by one.
+void CheckOutputsMatch(const TensorInfo& outputInfo,
+                       const std::vector<uint8_t>& expected,
+                       const std::vector<uint8_t>& actual)
+{
+    for (unsigned int i = 0; i < outputInfo.GetNumElements(); ++i)
+    {
+        const int32_t e = ReadOutput(outputInfo, expected, i);
+        const int32_t a = ReadOutput(outputInfo, actual, i);
+        if (std::abs(e - a) > 1)
+        {
+            FAIL(fmt::format("Output mismatch at index {}: {} != {}", i, e, a));
+        }
+    }
+}
+
+struct QuantizedConvTestCase
+{
+    TensorInfo m_InputInfo;
+    TensorInfo m_WeightsInfo;
+    TensorInfo m_BiasInfo;
+    TensorInfo m_OutputInfo;
+    DataLayout m_DataLayout;
+    unsigned int m_Pad;
+    unsigned int m_Stride;
+    unsigned int m_Dilation;
+    bool m_BiasEnabled;
+    bool m_Depthwise;
+};
+
+// Runs the same convolution through the float Convolve() loop and through QuantizedConvolve() and checks that the
+// results match.
+void CompareWithReference(const QuantizedConvTestCase& t)
+{
+    const unsigned int weightsChannelAxis = t.m_Depthwise ? 3 : 0;
+    REQUIRE(IsQuantizedConvolveSupported(t.m_InputInfo, t.m_WeightsInfo, t.m_OutputInfo,
+                                         t.m_BiasEnabled ? &t.m_BiasInfo : nullptr, weightsChannelAxis));
+
+    std::mt19937 generator(42);
+    std::vector<uint8_t> input   = MakeRandomData(t.m_InputInfo, generator);
+    std::vector<uint8_t> weights = MakeRandomData(t.m_WeightsInfo, generator);
+    std::vector<uint8_t> bias    = MakeRandomData(t.m_BiasInfo, generator);
+    std::vector<uint8_t> expected(t.m_OutputInfo.GetNumBytes());
+    std::vector<uint8_t> actual(t.m_OutputInfo.GetNumBytes());
+
+    auto inputDecoder   = MakeDecoder<float>(t.m_InputInfo, input.data());
+    auto weightsDecoder = MakeDecoder<float>(t.m_WeightsInfo, weights.data());
+    auto biasDecoder    = MakeDecoder<float>(t.m_BiasInfo, bias.data());
+    auto outputEncoder  = MakeEncoder<float>(t.m_OutputInfo, expected.data());
+
+    Convolve(t.m_InputInfo.GetShape(), *inputDecoder, t.m_OutputInfo.GetShape(), *outputEncoder,
+             t.m_WeightsInfo.GetShape(), *weightsDecoder, t.m_BiasEnabled, biasDecoder.get(), t.m_DataLayout,
+             t.m_Pad, t.m_Pad, t.m_Stride, t.m_Stride, t.m_Dilation, t.m_Dilation, t.m_Depthwise);
+
+    const unsigned int numOutputChannels = t.m_WeightsInfo.GetShape()[weightsChannelAxis];
+    const QuantizedConvOutputStage outputStage(t.m_InputInfo, t.m_WeightsInfo, t.m_OutputInfo, numOutputChannels);
+    const std::vector<int16_t> preparedWeights =
+        t.m_Depthwise ? PrepareQuantizedDepthwiseWeights(t.m_WeightsInfo, weights.data())
+                      : PrepareQuantizedConvolutionWeights(t.m_WeightsInfo, weights.data(), t.m_DataLayout);
+
+    QuantizedConvolve(t.m_InputInfo, input.data(), t.m_OutputInfo, actual.data(), t.m_WeightsInfo.GetShape(),
+                      preparedWeights.data(),
+                      t.m_BiasEnabled ? reinterpret_cast<const int32_t*>(bias.data()) : nullptr,
+                      outputStage, t.m_DataLayout, t.m_Pad, t.m_Pad, t.m_Stride, t.m_Stride,
+                      t.m_Dilation, t.m_Dilation, t.m_Depthwise);
+
+    CheckOutputsMatch(t.m_OutputInfo, expected, actual);
+}
+
+TEST_CASE("QuantizedConvolveMatchesConvolveQAsymmU8Nhwc")
+{
+    // 1x7x6x5 input, 3x3 filter, pad 1 => 1x7x6x11 output.
+    const TensorInfo inputInfo({ 1, 7, 6, 5 }, DataType::QAsymmU8, 0.05f, 120);
+    const TensorInfo weightsInfo({ 11, 3, 3, 5 }, DataType::QAsymmU8, 0.02f, 130, true);
+    const TensorInfo biasInfo({ 11 }, DataType::Signed32, 0.05f * 0.02f, 0, true);
+    const TensorInfo outputInfo({ 1, 7, 6, 11 }, DataType::QAsymmU8, 0.25f, 100);
+
+    CompareWithReference({ inputInfo, weightsInfo, biasInfo, outputInfo, DataLayout::NHWC, 1, 1, 1, true, false });
+}
+
+TEST_CASE("QuantizedConvolveMatchesConvolvePerAxisQAsymmS8Nchw")
+{
+    // 2x4x9x8 input, 3x3 filter dilated by 2, stride 2, pad 2 => 2x6x5x4 output.
+    const std::vector<float> weightsScales = { 0.01f, 0.02f, 0.03f, 0.015f, 0.025f, 0.005f };
+    std::vector<float> biasScales;
+    for (float weightsScale : weightsScales)
+    {
+        biasScales.push_back(0.04f * weightsScale);
+    }
+
+    const TensorInfo inputInfo({ 2, 4, 9, 8 }, DataType::QAsymmS8, 0.04f, -10);
+    const TensorInfo weightsInfo({ 6, 4, 3, 3 }, DataType::QSymmS8, weightsScales, 0, true);
+    const TensorInfo biasInfo({ 6 }, DataType::Signed32, biasScales, 0, true);
+    const TensorInfo outputInfo({ 2, 6, 5, 4 }, DataType::QAsymmS8, 0.3f, 5);
+
+    CompareWithReference({ inputInfo, weightsInfo, biasInfo, outputInfo, DataLayout::NCHW, 2, 2, 2, true, false });
+}
+
+TEST_CASE("QuantizedDepthwiseConvolveMatchesConvolve")
+{
+    // 1x8x7x3 input, 3x3 filter with a depth multiplier of 2, pad 1 => 1x8x7x6 output.
+    const TensorInfo inputInfo({ 1, 8, 7, 3 }, DataType::QAsymmU8, 0.05f, 128);
+    const TensorInfo weightsInfo({ 1, 3, 3, 6 }, DataType::QAsymmU8, 0.02f, 127, true);
+    const TensorInfo biasInfo({ 6 }, DataType::Signed32, 0.05f * 0.02f, 0, true);
+    const TensorInfo outputInfo({ 1, 8, 7, 6 }, DataType::QAsymmU8, 0.1f, 128);
+
+    CompareWithReference({ inputInfo, weightsInfo, biasInfo, outputInfo, DataLayout::NHWC, 1, 1, 1, true, true });
+    CompareWithReference({ inputInfo, weightsInfo, biasInfo, outputInfo, DataLayout::NHWC, 1, 1, 1, false, true });
+}
+
+TEST_CASE("QuantizedFullyConnectedMatchesFullyConnected")
+{
+    for (bool transposeWeights : { false, true })
+    {
+        const TensorInfo inputInfo({ 3, 37 }, DataType::QAsymmS8, 0.05f, 3);
+        const TensorInfo weightsInfo(transposeWeights ? TensorShape({ 13, 37 }) : TensorShape({ 37, 13 }),
+                                     DataType::QAsymmS8, 0.01f, -2, true);
+        const TensorInfo biasInfo({ 13 }, DataType::Signed32, 0.05f * 0.01f, 0, true);
+        const TensorInfo outputInfo({ 3, 13 }, DataType::QAsymmU8, 0.1f, 128);
+
+        REQUIRE(IsQuantizedConvolveSupported(inputInfo, weightsInfo, outputInfo, &biasInfo,
+                                             transposeWeights ? 0 : 1));
+
+        std::mt19937 generator(7);
+        std::vector<uint8_t> input   = MakeRandomData(inputInfo, generator);
+        std::vector<uint8_t> weights = MakeRandomData(weightsInfo, generator);
+        std::vector<uint8_t> bias    = MakeRandomData(biasInfo, generator);
+        std::vector<uint8_t> expected(outputInfo.GetNumBytes());
+        std::vector<uint8_t> actual(outputInfo.GetNumBytes());
+
+        auto inputDecoder   = MakeDecoder<float>(inputInfo, input.data());
+        auto weightsDecoder = MakeDecoder<float>(weightsInfo, weights.data());
+        auto biasDecoder    = MakeDecoder<float>(biasInfo, bias.data());
+        auto outputEncoder  = MakeEncoder<float>(outputInfo, expected.data());
+
+        FullyConnected(inputInfo.GetShape(), *inputDecoder, outputInfo.GetShape(), *outputEncoder,
+                       weightsInfo.GetShape(), *weightsDecoder, biasDecoder.get(), true, 37, transposeWeights);
+
+        const QuantizedConvOutputStage outputStage(inputInfo, weightsInfo, outputInfo, 13);
+        const std::vector<int16_t> preparedWeights =
+            PrepareQuantizedFullyConnectedWeights(weightsInfo, weights.data(), transposeWeights);
+
+        QuantizedFullyConnected(inputInfo, input.data(), outputInfo, actual.data(), preparedWeights.data(),
+                                reinterpret_cast<const int32_t*>(bias.data()), outputStage, 37);
+
+        CheckOutputsMatch(outputInfo, expected, actual);
+    }
+}
+
+TEST_CASE("QuantizedConvolveUnsupportedFallsBack")
+{
+    const TensorInfo inputInfo({ 1, 4, 4, 2 }, DataType::QAsymmU8, 1.0f, 0);
+    const TensorInfo weightsInfo({ 2, 1, 1, 2 }, DataType::QAsymmU8, 1.0f, 0, true);
+    const TensorInfo outputInfo({ 1, 4, 4, 2 }, DataType::QAsymmU8, 0.5f, 0);
+    const TensorInfo floatInfo({ 1, 4, 4, 2 }, DataType::Float32);
+
+    // The requantisation multiplier is 2, which the integer output stage cannot represent.
+    CHECK(!IsQuantizedConvolveSupported(inputInfo, weightsInfo, outputInfo, nullptr, 0));
+    // Float tensors always use the float path.
+    CHECK(!IsQuantizedConvolveSupported(floatInfo, weightsInfo, floatInfo, nullptr, 0));
+    // The bias must be in the accumulator scale.
+    const TensorInfo smallerOutputInfo({ 1, 4, 4, 2 }, DataType::QAsymmU8, 4.0f, 0);
+    const TensorInfo biasInfo({ 2 }, DataType::Signed32, 0.5f, 0, true);
+    CHECK(IsQuantizedConvolveSupported(inputInfo, weightsInfo, smallerOutputInfo, nullptr, 0));
+    CHECK(!IsQuantizedConvolveSupported(inputInfo, weightsInfo, smallerOutputInfo, &biasInfo, 0));
+}
+
+}
@@ -5,12 +5,20 @@
 
 #include <test/RuntimeTests.hpp>
 
+#include <AsyncExecutionCallback.hpp>
+#include <ExecutionPipeline.hpp>
 #include <LeakChecking.hpp>
+#include <LoadedNetwork.hpp>
+
+#include <armnn/BackendRegistry.hpp>
 
 #include <backendsCommon/test/RuntimeTestImpl.hpp>
+#include <reference/RefBackend.hpp>
 
 #include <doctest/doctest.h>
 
+#include <vector>
+
 
 #ifdef ARMNN_LEAK_CHECKING_ENABLED
 TEST_SUITE("RefRuntime")
@@ -45,3 +53,114 @@ TEST_CASE("RuntimeMemoryLeaksCpuRef")
 }
 #endif
 
+#if !defined(ARMNN_DISABLE_THREADS)
+TEST_SUITE("RefRuntime")
+{
+using namespace armnn;
+
+namespace
+{
+
+/// CpuRef registered under another id, so that a network can be split between two backends which both execute.
+class SecondRefBackend : public RefBackend
+{
+public:
+    static const BackendId& GetIdStatic()
+    {
+        static const BackendId s_Id{ "SecondCpuRef" };
+        return s_Id;
+    }
+
+    const BackendId& GetId() const override { return GetIdStatic(); }
+};
+
+} // anonymous namespace
+
+TEST_CASE("RefExecutionPipelineSplitsNetworkBetweenBackends")
+{
+    BackendRegistryInstance().Register(SecondRefBackend::GetIdStatic(), []()
+    {
+        return IBackendInternalUniquePtr(new SecondRefBackend);
+    });
+
+    {
+        constexpr unsigned int rowSize = 4;
+        constexpr unsigned int numberOfInferences = 8;
+        const TensorInfo info({ 1, rowSize }, DataType::Float32);
+
+        // input -> activation0 (CpuRef) -> activation1 (SecondCpuRef) -> activation2 (CpuRef) -> output, where each
+        // activation computes 2 * x + 1, so out = 8 * in + 7.
+        INetworkPtr network(INetwork::Create());
+        ActivationDescriptor descriptor(ActivationFunction::Linear, 2.0f, 1.0f);
+        IConnectableLayer* input = network->AddInputLayer(0);
+        IConnectableLayer* activation0 = network->AddActivationLayer(descriptor, "activation0");
+        IConnectableLayer* activation1 = network->AddActivationLayer(descriptor, "activation1");
+        IConnectableLayer* activation2 = network->AddActivationLayer(descriptor, "activation2");
+        IConnectableLayer* output = network->AddOutputLayer(0);
+        input->GetOutputSlot(0).Connect(activation0->GetInputSlot(0));
+        activation0->GetOutputSlot(0).Connect(activation1->GetInputSlot(0));
+        activation1->GetOutputSlot(0).Connect(activation2->GetInputSlot(0));
+        activation2->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        for (IConnectableLayer* layer : { input, activation0, activation1, activation2 })
+        {
+            layer->GetOutputSlot(0).SetTensorInfo(info);
+        }
+        activation1->BackendSelectionHint(Optional<BackendId>(SecondRefBackend::GetIdStatic()));
+
+        RuntimeImpl runtime(IRuntime::CreationOptions{});
+        IOptimizedNetworkPtr optNet = Optimize(*network,
+                                               { Compute::CpuRef, SecondRefBackend::GetIdStatic() },
+                                               runtime.GetDeviceSpec());
+        REQUIRE(optNet);
+
+        std::string errorMessage;
+        const INetworkProperties networkProperties(true, MemorySource::Undefined, MemorySource::Undefined);
+        std::unique_ptr<LoadedNetwork> loadedNetwork = LoadedNetwork::MakeLoadedNetwork(
+            std::unique_ptr<IOptimizedNetwork>(optNet.release()), errorMessage, networkProperties,
+            &GetProfilingService(&runtime));
+        REQUIRE_MESSAGE(loadedNetwork, errorMessage);
+
+        std::vector<std::vector<float>> inputData(numberOfInferences, std::vector<float>(rowSize));
+        std::vector<std::vector<float>> outputData(numberOfInferences, std::vector<float>(rowSize));
+        TensorInfo inputInfo = loadedNetwork->GetInputTensorInfo(0);
+        inputInfo.SetConstant(true);
+        const TensorInfo outputInfo = loadedNetwork->GetOutputTensorInfo(0);
+
+        experimental::AsyncCallbackManager callbackManager;
+        {
+            experimental::ExecutionPipeline pipeline(*loadedNetwork, 0);
+
+            const auto& stages = pipeline.GetStages();
+            REQUIRE(stages.size() == 3);
+            CHECK(stages[0].m_BackendId == Compute::CpuRef);
+            CHECK(stages[1].m_BackendId == SecondRefBackend::GetIdStatic());
+            CHECK(stages[2].m_BackendId == Compute::CpuRef);
+
+            // More inferences than working memories, so the pipeline is full while they are scheduled.
+            for (unsigned int i = 0; i < numberOfInferences; ++i)
+            {
+                for (unsigned int j = 0; j < rowSize; ++j)
+                {
+                    inputData[i][j] = static_cast<float>(i * rowSize + j);
+                }
+                pipeline.Schedule({ { 0, ConstTensor(inputInfo, inputData[i].data()) } },
+                                  { { 0, Tensor(outputInfo, outputData[i].data()) } },
+                                  callbackManager.GetNewCallback());
+            }
+        }
+
+        for (unsigned int i = 0; i < numberOfInferences; ++i)
+        {
+            CHECK(callbackManager.GetNotifiedCallback()->GetStatus() == Status::Success);
+            for (unsigned int j = 0; j < rowSize; ++j)
+            {
+                CHECK(outputData[i][j] == 8.0f * inputData[i][j] + 7.0f);
+            }
+        }
+    }
+
+    BackendRegistryInstance().Deregister(SecondRefBackend::GetIdStatic());
+}
+
+}
+#endif
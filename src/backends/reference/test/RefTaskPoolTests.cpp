@@ -0,0 +1,269 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/ConvGemmImpl.hpp>
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/ElementwiseFunction.hpp>
+#include <reference/workloads/Encoders.hpp>
+#include <reference/workloads/FullyConnected.hpp>
+#include <reference/workloads/Pooling2d.hpp>
+#include <reference/workloads/QuantizedConvImpl.hpp>
+#include <reference/workloads/RefTaskPool.hpp>
+
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+
+TEST_SUITE("RefTaskPool")
+{
+using namespace armnn;
+
+// Restores the default of a single thread when a test case finishes.
+struct ScopedNumberOfThreads
+{
+    explicit ScopedNumberOfThreads(unsigned int numThreads)
+    {
+        RefTaskPool::Get().SetNumberOfThreads(numThreads);
+    }
+    ~ScopedNumberOfThreads()
+    {
+        RefTaskPool::Get().SetNumberOfThreads(1);
+    }
+};
+
+std::vector<float> RandomFloats(unsigned int size, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> values(size);
+    for (auto& value : values)
+    {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+TEST_CASE("ParallelForCoversEveryItemOnce")
+{
+    ScopedNumberOfThreads threads(4);
+
+    constexpr unsigned int numItems = 1000;
+    std::vector<std::atomic<unsigned int>> counts(numItems);
+    ParallelFor(numItems, 7, [&](unsigned int begin, unsigned int end)
+    {
+        CHECK(begin < end);
+        // Nested calls run serially on the calling thread.
+        ParallelFor(end - begin, 1, [&](unsigned int nestedBegin, unsigned int nestedEnd)
+        {
+            for (unsigned int i = begin + nestedBegin; i < begin + nestedEnd; ++i)
+            {
+                counts[i]++;
+            }
+        });
+    });
+
+    for (unsigned int i = 0; i < numItems; ++i)
+    {
+        CHECK(counts[i].load() == 1);
+    }
+}
+
+TEST_CASE("ParallelForRethrowsExceptions")
+{
+    ScopedNumberOfThreads threads(3);
+
+    std::atomic<unsigned int> processed{0};
+    CHECK_THROWS_AS(ParallelFor(64, 1, [&](unsigned int begin, unsigned int end)
+    {
+        processed += end - begin;
+        if (begin == 0)
+        {
+            throw std::runtime_error("ParallelFor test exception");
+        }
+    }), std::runtime_error);
+    CHECK(processed.load() == 64);
+
+    // The pool is still usable afterwards.
+    std::atomic<unsigned int> total{0};
+    ParallelFor(64, 1, [&](unsigned int begin, unsigned int end) { total += end - begin; });
+    CHECK(total.load() == 64);
+}
+
+// The kernels must produce bit identical results regardless of the number of threads.
+TEST_CASE("KernelsAreDeterministicAcrossThreadCounts")
+{
+    const TensorShape inputShape({ 2, 13, 11, 8 });
+    const TensorShape filterShape({ 19, 3, 3, 8 });
+    const TensorShape outputShape({ 2, 13, 11, 19 });
+    const std::vector<float> input = RandomFloats(inputShape.GetNumElements(), 1);
+    const std::vector<float> filter = RandomFloats(filterShape.GetNumElements(), 2);
+    const std::vector<float> bias = RandomFloats(19, 3);
+    const std::vector<float> packedFilter = PackConvolutionFilter(filterShape, filter.data(), DataLayout::NHWC);
+
+    const TensorInfo fcInputInfo({ 3, 40 }, DataType::Float32);
+    const TensorInfo fcWeightsInfo({ 40, 37 }, DataType::Float32);
+    const TensorInfo fcOutputInfo({ 3, 37 }, DataType::Float32);
+    const std::vector<float> fcInput = RandomFloats(fcInputInfo.GetNumElements(), 4);
+    const std::vector<float> fcWeights = RandomFloats(fcWeightsInfo.GetNumElements(), 5);
+
+    const TensorInfo qInputInfo(inputShape, DataType::QAsymmU8, 0.05f, 128);
+    const TensorInfo qFilterInfo(filterShape, DataType::QAsymmS8, 0.01f, 0, true);
+    const TensorInfo qOutputInfo(outputShape, DataType::QAsymmU8, 0.5f, 100);
+    std::vector<uint8_t> qInput(inputShape.GetNumElements());
+    std::vector<int8_t> qFilter(filterShape.GetNumElements());
+    for (unsigned int i = 0; i < qInput.size(); ++i)
+    {
+        qInput[i] = static_cast<uint8_t>(input[i] * 127.0f + 128.0f);
+    }
+    for (unsigned int i = 0; i < qFilter.size(); ++i)
+    {
+        qFilter[i] = static_cast<int8_t>(filter[i] * 127.0f);
+    }
+    const QuantizedConvOutputStage outputStage(qInputInfo, qFilterInfo, qOutputInfo, 19);
+    const std::vector<int16_t> preparedFilter =
+        PrepareQuantizedConvolutionWeights(qFilterInfo, qFilter.data(), DataLayout::NHWC);
+
+    Pooling2dDescriptor poolDescriptor;
+    poolDescriptor.m_PoolType = PoolingAlgorithm::Average;
+    poolDescriptor.m_PoolWidth = 3;
+    poolDescriptor.m_PoolHeight = 3;
+    poolDescriptor.m_StrideX = 2;
+    poolDescriptor.m_StrideY = 2;
+    poolDescriptor.m_PadLeft = 1;
+    poolDescriptor.m_PadRight = 1;
+    poolDescriptor.m_PadTop = 1;
+    poolDescriptor.m_PadBottom = 1;
+    poolDescriptor.m_PaddingMethod = PaddingMethod::Exclude;
+    poolDescriptor.m_DataLayout = DataLayout::NHWC;
+    const TensorInfo poolInputInfo(inputShape, DataType::Float32);
+    const TensorInfo poolOutputInfo({ 2, 7, 6, 8 }, DataType::Float32);
+
+    // Large enough for the elementwise kernel to split its rows across threads: a per channel broadcast with short
+    // rows, and a same shape subtraction collapsing into a single row split into chunks.
+    const TensorInfo addInputInfo({ 2, 130, 130, 8 }, DataType::Float32);
+    const TensorInfo addBiasInfo({ 1, 1, 1, 8 }, DataType::Float32);
+    const std::vector<float> addInput = RandomFloats(addInputInfo.GetNumElements(), 6);
+    const std::vector<float> addBias = RandomFloats(addBiasInfo.GetNumElements(), 7);
+    const TensorInfo subInfo({ 5, 9001 }, DataType::Float32);
+    const std::vector<float> subInput0 = RandomFloats(subInfo.GetNumElements(), 8);
+    const std::vector<float> subInput1 = RandomFloats(subInfo.GetNumElements(), 9);
+
+    struct Results
+    {
+        std::vector<float> m_Gemm;
+        std::vector<float> m_FullyConnected;
+        std::vector<float> m_Pooling;
+        std::vector<uint8_t> m_Quantized;
+        std::vector<float> m_Add;
+        std::vector<float> m_Sub;
+    };
+
+    auto run = [&](unsigned int numThreads)
+    {
+        ScopedNumberOfThreads threads(numThreads);
+        Results results;
+
+        results.m_Gemm.resize(outputShape.GetNumElements());
+        ConvolveGemm(inputShape, input.data(), outputShape, results.m_Gemm.data(), filterShape, packedFilter.data(),
+                     bias.data(), DataLayout::NHWC, 1, 1, 1, 1, 1, 1);
+
+        results.m_FullyConnected.resize(fcOutputInfo.GetNumElements());
+        auto fcInputDecoder = MakeDecoder<float>(fcInputInfo, fcInput.data());
+        auto fcWeightsDecoder = MakeDecoder<float>(fcWeightsInfo, fcWeights.data());
+        auto fcOutputEncoder = MakeEncoder<float>(fcOutputInfo, results.m_FullyConnected.data());
+        FullyConnected(fcInputInfo.GetShape(), *fcInputDecoder, fcOutputInfo.GetShape(), *fcOutputEncoder,
+                       fcWeightsInfo.GetShape(), *fcWeightsDecoder, nullptr, false, 40, false);
+
+        results.m_Pooling.resize(poolOutputInfo.GetNumElements());
+        auto poolInputDecoder = MakeDecoder<float>(poolInputInfo, input.data());
+        auto poolOutputEncoder = MakeEncoder<float>(poolOutputInfo, results.m_Pooling.data());
+        Pooling2d(*poolInputDecoder, *poolOutputEncoder, poolInputInfo, poolOutputInfo, poolDescriptor);
+
+        results.m_Quantized.resize(outputShape.GetNumElements());
+        QuantizedConvolve(qInputInfo, qInput.data(), qOutputInfo, results.m_Quantized.data(), filterShape,
+                          preparedFilter.data(), nullptr, outputStage, DataLayout::NHWC, 1, 1, 1, 1, 1, 1, false);
+
+        results.m_Add.resize(addInputInfo.GetNumElements());
+        auto addInputDecoder = MakeDecoder<float>(addInputInfo, addInput.data());
+        auto addBiasDecoder = MakeDecoder<float>(addBiasInfo, addBias.data());
+        auto addOutputEncoder = MakeEncoder<float>(addInputInfo, results.m_Add.data());
+        ElementwiseBinaryFunction<std::plus<float>>(addInputInfo.GetShape(), addBiasInfo.GetShape(),
+                                                    addInputInfo.GetShape(), *addInputDecoder, *addBiasDecoder,
+                                                    *addOutputEncoder);
+
+        results.m_Sub.resize(subInfo.GetNumElements());
+        auto subInputDecoder0 = MakeDecoder<float>(subInfo, subInput0.data());
+        auto subInputDecoder1 = MakeDecoder<float>(subInfo, subInput1.data());
+        auto subOutputEncoder = MakeEncoder<float>(subInfo, results.m_Sub.data());
+        ElementwiseBinaryFunction<std::minus<float>>(subInfo.GetShape(), subInfo.GetShape(), subInfo.GetShape(),
+                                                     *subInputDecoder0, *subInputDecoder1, *subOutputEncoder);
+        return results;
+    };
+
+    const Results expected = run(1);
+    for (unsigned int i = 0; i < expected.m_Add.size(); ++i)
+    {
+        REQUIRE(expected.m_Add[i] == addInput[i] + addBias[i % 8]);
+    }
+    for (unsigned int i = 0; i < expected.m_Sub.size(); ++i)
+    {
+        REQUIRE(expected.m_Sub[i] == subInput0[i] - subInput1[i]);
+    }
+
+    for (unsigned int numThreads : { 2u, 3u, 8u })
+    {
+        CAPTURE(numThreads);
+        const Results actual = run(numThreads);
+        CHECK(std::memcmp(actual.m_Gemm.data(), expected.m_Gemm.data(), expected.m_Gemm.size() * sizeof(float)) == 0);
+        CHECK(actual.m_FullyConnected == expected.m_FullyConnected);
+        CHECK(actual.m_Pooling == expected.m_Pooling);
+        CHECK(actual.m_Quantized == expected.m_Quantized);
+        CHECK(actual.m_Add == expected.m_Add);
+        CHECK(actual.m_Sub == expected.m_Sub);
+    }
+}
+
+TEST_CASE("NumberOfThreadsBackendOptionOnCpuRef")
+{
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* activation = net->AddActivationLayer(ActivationDescriptor(ActivationFunction::ReLu));
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    const TensorInfo info({ 1, 4 }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    activation->GetOutputSlot(0).SetTensorInfo(info);
+
+    IRuntime::CreationOptions options;
+    options.m_BackendOptions.emplace_back(BackendOptions("CpuRef", {{ "NumberOfThreads", 3u }}));
+    IRuntimePtr runtime(IRuntime::Create(options));
+    CHECK(RefTaskPool::Get().GetNumberOfThreads() == 3);
+
+    IOptimizedNetworkPtr optimizedNet = Optimize(*net, { Compute::CpuRef }, runtime->GetDeviceSpec());
+    REQUIRE(optimizedNet);
+
+    NetworkId networkId;
+    REQUIRE(runtime->LoadNetwork(networkId, std::move(optimizedNet)) == Status::Success);
+
+    std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f };
+    std::vector<float> outputData(4);
+    TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>({ 0.0f, 2.0f, 0.0f, 4.0f }));
+
+    RefTaskPool::Get().SetNumberOfThreads(1);
+}
+
+}
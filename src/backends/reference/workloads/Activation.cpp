@@ -5,6 +5,8 @@
 
 #include "Activation.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 namespace armnn
@@ -106,16 +108,19 @@ void Activation(Decoder<float>& in,
                 float a,
                 float b)
 {
-    unsigned int numElements = tensorInfo.GetNumElements();
+    const unsigned int numElements = tensorInfo.GetNumElements();
 
-    for (unsigned int i = 0; i < numElements; i++)
+    std::array<float, RangeChunkSize> values;
+    for (unsigned int start = 0; start < numElements; start += RangeChunkSize)
     {
-        out.Set(Activation(in.Get(), function, a, b));
-        ++in;
-        ++out;
+        const unsigned int count = std::min(RangeChunkSize, numElements - start);
+        in.DecodeRange(start, count, values.data());
+        for (unsigned int i = 0; i < count; i++)
+        {
+            values[i] = Activation(values[i], function, a, b);
+        }
+        out.EncodeRange(start, count, values.data());
     }
-    in -= numElements;
-    out -= numElements;
 }
 
 } //namespace armnn
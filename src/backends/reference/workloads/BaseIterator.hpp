@@ -12,6 +12,10 @@
 
 #include <ResolveType.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace armnn
 {
 
@@ -44,6 +48,20 @@ public:
     virtual IType Get() const = 0;
 
     virtual std::vector<float> DecodeTensor(const TensorShape &tensorShape, bool isDepthwise = false) = 0;
+
+    /// Decodes count elements into dst, starting offset elements after the current position, without moving the
+    /// iterator. Concrete decoders override this with a loop over the underlying data which avoids the virtual
+    /// Get() and increment calls per element.
+    virtual void DecodeRange(unsigned int offset, unsigned int count, IType* dst)
+    {
+        this->operator+=(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = Get();
+            this->operator++();
+        }
+        this->operator-=(offset + count);
+    }
 };
 
 template<typename IType>
@@ -59,8 +77,59 @@ public:
     virtual void Set(IType right) = 0;
 
     virtual IType Get() const = 0;
+
+    /// Encodes count elements from src, starting offset elements after the current position, without moving the
+    /// iterator. Concrete encoders override this with a loop over the underlying data which avoids the virtual
+    /// Set() and increment calls per element.
+    virtual void EncodeRange(unsigned int offset, unsigned int count, const IType* src)
+    {
+        this->operator+=(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            Set(src[i]);
+            this->operator++();
+        }
+        this->operator-=(offset + count);
+    }
 };
 
+/// Number of elements kernels stream through DecodeRange() and EncodeRange() at a time, when they do not need the
+/// whole tensor at once.
+constexpr unsigned int RangeChunkSize = 1024;
+
+/// Bulk equivalent of armnn::Dequantize(), giving identical results.
+template<typename QuantizedType>
+inline void DequantizeRange(const QuantizedType* src, unsigned int count, float scale, int32_t offset, float* dst)
+{
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        dst[i] = static_cast<float>(static_cast<int32_t>(src[i]) - offset) * scale;
+    }
+}
+
+/// Bulk equivalent of armnn::Quantize(), giving identical results.
+template<typename QuantizedType>
+inline void QuantizeRange(const float* src, unsigned int count, float scale, int32_t offset, QuantizedType* dst)
+{
+    bool hasNan = false;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        hasNan |= std::isnan(src[i]);
+    }
+    if (hasNan)
+    {
+        throw armnn::InvalidArgumentException("Quantize: Value is NaN");
+    }
+
+    constexpr float min = static_cast<float>(std::numeric_limits<QuantizedType>::lowest());
+    constexpr float max = static_cast<float>(std::numeric_limits<QuantizedType>::max());
+    const float offsetValue = static_cast<float>(offset);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        dst[i] = static_cast<QuantizedType>(std::min(std::max(offsetValue + std::round(src[i] / scale), min), max));
+    }
+}
+
 template<typename T, typename Base>
 class TypedIterator : public Base
 {
@@ -104,6 +173,12 @@ public:
     }
 
 protected:
+    T* GetRangeStart(const unsigned int offset) const
+    {
+        ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(m_Iterator, "TypedIterator: m_Iterator is null!");
+        return m_Iterator + offset;
+    }
+
     T* m_Iterator;
     T* m_Start;
 };
@@ -121,16 +196,19 @@ public:
     {
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        DequantizeRange(GetRangeStart(offset), count, m_Scale, m_Offset, dst);
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
-        std::vector<float> decodedTensor;
-        decodedTensor.reserve(size);
-
-        for (uint32_t i = 0; i < size; ++i)
+        std::vector<float> decodedTensor(size);
+        if (size > 0)
         {
-            this->operator[](i);
-            decodedTensor.emplace_back(armnn::Dequantize(*m_Iterator, m_Scale, m_Offset));
+            this->operator[](0);
+            DecodeRange(0, size, decodedTensor.data());
         }
 
         return decodedTensor;
@@ -155,16 +233,19 @@ public:
     {
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        DequantizeRange(GetRangeStart(offset), count, m_Scale, m_Offset, dst);
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
-        std::vector<float> decodedTensor;
-        decodedTensor.reserve(size);
-
-        for (uint32_t i = 0; i < size; ++i)
+        std::vector<float> decodedTensor(size);
+        if (size > 0)
         {
-            this->operator[](i);
-            decodedTensor.emplace_back(armnn::Dequantize(*m_Iterator, m_Scale, m_Offset));
+            this->operator[](0);
+            DecodeRange(0, size, decodedTensor.data());
         }
 
         return decodedTensor;
@@ -189,16 +270,19 @@ public:
     {
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        DequantizeRange(GetRangeStart(offset), count, m_Scale, m_Offset, dst);
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
-        std::vector<float> decodedTensor;
-        decodedTensor.reserve(size);
-
-        for (uint32_t i = 0; i < size; ++i)
+        std::vector<float> decodedTensor(size);
+        if (size > 0)
         {
-            this->operator[](i);
-            decodedTensor.emplace_back(armnn::Dequantize(*m_Iterator, m_Scale, m_Offset));
+            this->operator[](0);
+            DecodeRange(0, size, decodedTensor.data());
         }
 
         return decodedTensor;
@@ -223,16 +307,19 @@ public:
     {
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        DequantizeRange(GetRangeStart(offset), count, m_Scale, m_Offset, dst);
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
-        std::vector<float> decodedTensor;
-        decodedTensor.reserve(size);
-
-        for (uint32_t i = 0; i < size; ++i)
+        std::vector<float> decodedTensor(size);
+        if (size > 0)
         {
-            this->operator[](i);
-            decodedTensor.emplace_back(armnn::Dequantize(*m_Iterator, m_Scale, m_Offset));
+            this->operator[](0);
+            DecodeRange(0, size, decodedTensor.data());
         }
 
         return decodedTensor;
@@ -259,18 +346,19 @@ public:
         armnnUtils::FloatingPointConverter::ConvertFloat16To32(m_Iterator, 1, &val);
         return val;
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        armnnUtils::FloatingPointConverter::ConvertFloat16To32(GetRangeStart(offset), count, dst);
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool ) override
     {
         const unsigned int size = tensorShape.GetNumElements();
-        std::vector<float> decodedTensor;
-        decodedTensor.reserve(size);
-
-        for (uint32_t i = 0; i < size; ++i)
+        std::vector<float> decodedTensor(size);
+        if (size > 0)
         {
-            float val = 0.f;
-            this->operator[](i);
-            armnnUtils::FloatingPointConverter::ConvertFloat16To32(m_Iterator, 1, &val);
-            decodedTensor.emplace_back(val);
+            this->operator[](0);
+            DecodeRange(0, size, decodedTensor.data());
         }
 
         return decodedTensor;
@@ -292,6 +380,12 @@ public:
     {
         return *m_Iterator;
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        const float* src = GetRangeStart(offset);
+        std::copy(src, src + count, dst);
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
@@ -317,16 +411,23 @@ public:
     {
         return static_cast<float>(*m_Iterator) * m_Scale;
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        const auto* src = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = static_cast<float>(src[i]) * m_Scale;
+        }
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
-        std::vector<float> decodedTensor;
-        decodedTensor.reserve(size);
-
-        for (uint32_t i = 0; i < size; ++i)
+        std::vector<float> decodedTensor(size);
+        if (size > 0)
         {
-            this->operator[](i);
-            decodedTensor.emplace_back(static_cast<float>(*m_Iterator) * m_Scale);
+            this->operator[](0);
+            DecodeRange(0, size, decodedTensor.data());
         }
 
         return decodedTensor;
@@ -350,6 +451,15 @@ public:
     {
         return static_cast<float>(*m_Iterator);
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        const auto* src = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = static_cast<float>(src[i]);
+        }
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
@@ -379,6 +489,12 @@ public:
     {
         return *m_Iterator;
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, int32_t* dst) override
+    {
+        const int32_t* src = GetRangeStart(offset);
+        std::copy(src, src + count, dst);
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
@@ -408,6 +524,15 @@ public:
     {
         return static_cast<double_t>(*m_Iterator);
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, double_t* dst) override
+    {
+        const auto* src = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = static_cast<double_t>(src[i]);
+        }
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
@@ -437,6 +562,15 @@ public:
     {
         return *m_Iterator;
     }
+
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        const auto* src = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = src[i];
+        }
+    }
     std::vector<float> DecodeTensor (const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
@@ -467,6 +601,15 @@ public:
         return *m_Iterator;
     }
 
+    void DecodeRange(unsigned int offset, unsigned int count, bool* dst) override
+    {
+        const auto* src = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = src[i];
+        }
+    }
+
     std::vector<float> DecodeTensor(const TensorShape& tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
@@ -502,6 +645,11 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        QuantizeRange(src, count, m_Scale, m_Offset, GetRangeStart(offset));
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
@@ -526,6 +674,11 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        QuantizeRange(src, count, m_Scale, m_Offset, GetRangeStart(offset));
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
@@ -550,6 +703,11 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        QuantizeRange(src, count, m_Scale, m_Offset, GetRangeStart(offset));
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
@@ -574,6 +732,11 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        QuantizeRange(src, count, m_Scale, m_Offset, GetRangeStart(offset));
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
@@ -599,6 +762,11 @@ public:
         armnnUtils::FloatingPointConverter::ConvertFloat16To32(m_Iterator, 1, &val);
         return val;
     }
+
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        armnnUtils::FloatingPointConverter::ConvertFloat32To16(src, count, GetRangeStart(offset));
+    }
 };
 
 class Float32Encoder : public TypedIterator<float, Encoder<float>>
@@ -619,6 +787,11 @@ public:
     {
         return *m_Iterator;
     }
+
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        std::copy(src, src + count, GetRangeStart(offset));
+    }
 };
 
 class Int32Encoder : public TypedIterator<int32_t, Encoder<float>>
@@ -639,6 +812,15 @@ public:
     {
         return static_cast<float>(*m_Iterator);
     }
+
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        auto* dst = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = static_cast<int32_t>(src[i]);
+        }
+    }
 };
 
 class Int32ToInt32tEncoder : public TypedIterator<int32_t, Encoder<int32_t>>
@@ -659,6 +841,11 @@ public:
     {
         return *m_Iterator;
     }
+
+    void EncodeRange(unsigned int offset, unsigned int count, const int32_t* src) override
+    {
+        std::copy(src, src + count, GetRangeStart(offset));
+    }
 };
 
 class Int64Encoder : public TypedIterator<int64_t, Encoder<double>>
@@ -679,6 +866,15 @@ public:
     {
         return static_cast<double>(*m_Iterator);
     }
+
+    void EncodeRange(unsigned int offset, unsigned int count, const double* src) override
+    {
+        auto* dst = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = static_cast<int64_t>(src[i]);
+        }
+    }
 };
 
 class BooleanEncoder : public TypedIterator<uint8_t, Encoder<bool>>
@@ -699,6 +895,15 @@ public:
     {
         return *m_Iterator;
     }
+
+    void EncodeRange(unsigned int offset, unsigned int count, const bool* src) override
+    {
+        auto* dst = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = src[i];
+        }
+    }
 };
 
 /// PerAxisIterator for per-axis quantization. Iterates over a tensor as layed out in memory and keeps track
@@ -764,14 +969,7 @@ public:
     {
         ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(m_Iterator, "PerAxisIterator: m_Iterator is null!");
         m_Iterator = m_Start + index;
-        if (index < m_AxisFactor)
-        {
-            m_AxisIndex = 0;
-        }
-        else
-        {
-            m_AxisIndex = (index / m_AxisFactor) % m_AxisDimensionality;
-        }
+        m_AxisIndex = GetAxisIndex(index);
         m_Index = index;
         return *this;
     }
@@ -783,6 +981,17 @@ public:
     }
 
     protected:
+        unsigned int GetAxisIndex(const unsigned int index) const
+        {
+            return index < m_AxisFactor ? 0 : (index / m_AxisFactor) % m_AxisDimensionality;
+        }
+
+        T* GetRangeStart(const unsigned int offset) const
+        {
+            ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(m_Iterator, "PerAxisIterator: m_Iterator is null!");
+            return m_Iterator + offset;
+        }
+
         T* m_Iterator;
         T* m_Start;
         unsigned int m_AxisIndex;
@@ -810,6 +1019,15 @@ public:
         return m_Scales[m_AxisIndex];
     }
 
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        const auto* src = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = armnn::Dequantize(src[i], m_Scales[GetAxisIndex(m_Index + offset + i)], 0);
+        }
+    }
+
     std::vector<float> DecodeTensor(const TensorShape &tensorShape, const bool) override
     {
         const unsigned int size = tensorShape.GetNumElements();
@@ -850,6 +1068,15 @@ public:
         return m_Scale[m_AxisIndex];
     }
 
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        auto* dst = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = armnn::Quantize<int8_t>(src[i], m_Scale[GetAxisIndex(m_Index + offset + i)], 0);
+        }
+    }
+
 private:
     std::vector<float> m_Scale;
 };
@@ -873,6 +1100,15 @@ public:
         return m_Scales[m_AxisIndex];
     }
 
+    void DecodeRange(unsigned int offset, unsigned int count, float* dst) override
+    {
+        const auto* src = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = armnn::Dequantize(src[i], m_Scales[GetAxisIndex(m_Index + offset + i)], 0);
+        }
+    }
+
     std::vector<float> DecodeTensor(const TensorShape &tensorShape,
                                     bool isDepthwise) override
     {
@@ -929,6 +1165,15 @@ public:
         return m_Scale[m_AxisIndex];
     }
 
+    void EncodeRange(unsigned int offset, unsigned int count, const float* src) override
+    {
+        auto* dst = GetRangeStart(offset);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            dst[i] = armnn::Quantize<int16_t>(src[i], m_Scale[GetAxisIndex(m_Index + offset + i)], 0);
+        }
+    }
+
 private:
     std::vector<float> m_Scale;
 };
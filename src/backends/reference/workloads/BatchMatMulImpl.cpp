@@ -12,6 +12,18 @@
 namespace armnn
 {
 
+namespace
+{
+
+void DecodeInput(Decoder<float>& decoder, const TensorInfo& info, ScratchVector<float>& data)
+{
+    data.resize(info.GetNumElements());
+    decoder[0];
+    decoder.DecodeRange(0, info.GetNumElements(), data.data());
+}
+
+} // anonymous namespace
+
 BatchMatMul::BatchMatMul(const BatchMatMulDescriptor& params,
                          const TensorInfo& inputXInfo,
                          const TensorInfo& inputYInfo,
@@ -19,21 +31,94 @@ BatchMatMul::BatchMatMul(const BatchMatMulDescriptor& params,
                          Decoder<float>& inputXDecoder,
                          Decoder<float>& inputYDecoder,
                          Encoder<float>& outputEncoder)
+    : BatchMatMul(params,
+                  inputXInfo,
+                  inputYInfo,
+                  outputInfo,
+                  &inputXDecoder,
+                  nullptr,
+                  &inputYDecoder,
+                  nullptr,
+                  outputEncoder)
+{}
+
+BatchMatMul::BatchMatMul(const BatchMatMulDescriptor& params,
+                         const TensorInfo& inputXInfo,
+                         const TensorInfo& inputYInfo,
+                         const TensorInfo& outputInfo,
+                         Decoder<float>* inputXDecoder,
+                         const PreparedInput* preparedInputX,
+                         Decoder<float>* inputYDecoder,
+                         const PreparedInput* preparedInputY,
+                         Encoder<float>& outputEncoder)
+    : BatchMatMul(params, inputXInfo, inputYInfo, outputInfo)
+{
+    this->outputEncoder = &outputEncoder;
+
+    ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(preparedInputX || inputXDecoder,
+                                        "BatchMatMul: InputX needs either a decoder or a prepared input.");
+    ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(preparedInputY || inputYDecoder,
+                                        "BatchMatMul: InputY needs either a decoder or a prepared input.");
+
+    // At this point, we don't touch the input decoders - just the resultant vectors
+    if (preparedInputX)
+    {
+        this->inputXInfo = preparedInputX->m_Info;
+        inputXValues = preparedInputX->m_Data.data();
+    }
+    else
+    {
+        DecodeInput(*inputXDecoder, inputXInfo, inputXData);
+        ApplyParams(DataSlot::InputX);
+        inputXValues = inputXData.data();
+    }
+
+    if (preparedInputY)
+    {
+        this->inputYInfo = preparedInputY->m_Info;
+        inputYValues = preparedInputY->m_Data.data();
+    }
+    else
+    {
+        DecodeInput(*inputYDecoder, inputYInfo, inputYData);
+        ApplyParams(DataSlot::InputY);
+        inputYValues = inputYData.data();
+    }
+
+    ApplyBatchMatMul();
+}
+
+BatchMatMul::BatchMatMul(const BatchMatMulDescriptor& params,
+                         const TensorInfo& inputXInfo,
+                         const TensorInfo& inputYInfo,
+                         const TensorInfo& outputInfo)
     : params(params),
       inputXInfo(inputXInfo),
       inputYInfo(inputYInfo),
       outputInfo(outputInfo),
-      inputXDecoder(inputXDecoder),
-      inputYDecoder(inputYDecoder),
-      outputEncoder(outputEncoder)
+      outputEncoder(nullptr),
+      inputXValues(nullptr),
+      inputYValues(nullptr)
+{}
+
+BatchMatMul::PreparedInput BatchMatMul::PrepareInput(const BatchMatMulDescriptor& params,
+                                                     const TensorInfo& inputXInfo,
+                                                     const TensorInfo& inputYInfo,
+                                                     const TensorInfo& outputInfo,
+                                                     bool isInputX,
+                                                     Decoder<float>& inputDecoder)
 {
-    inputXData = this->inputXDecoder.DecodeTensor(inputXInfo.GetShape());
-    inputYData = this->inputYDecoder.DecodeTensor(inputYInfo.GetShape());
-    // At this point, we don't touch the input decoders - just the resultant vectors
-
-    ApplyParams();
+    BatchMatMul bmm(params, inputXInfo, inputYInfo, outputInfo);
+    if (isInputX)
+    {
+        DecodeInput(inputDecoder, inputXInfo, bmm.inputXData);
+        bmm.ApplyParams(DataSlot::InputX);
+        return { bmm.inputXInfo, std::vector<float>(bmm.inputXData.begin(), bmm.inputXData.end()) };
+    }
 
-    ApplyBatchMatMul();
+    DecodeInput(inputDecoder, inputYInfo, bmm.inputYData);
+    bmm.ApplyParams(DataSlot::InputY);
+    return { bmm.inputYInfo, std::vector<float>(bmm.inputYData.begin(), bmm.inputYData.end()) };
 }
 
 void BatchMatMul::ApplyBatchMatMul()
@@ -49,7 +134,7 @@ void BatchMatMul::ApplyBatchMatMul()
 
     unsigned int inputYRowSize = inputYInfo.GetShape()[inputYRowDim];
 
-    auto batchMatMulOperation = [&](const std::vector<unsigned int>& curIdx)
+    auto batchMatMulOperation = [&](const TensorIndex& curIdx)
     {
         float sum = 0.0f;
 
@@ -67,30 +152,24 @@ void BatchMatMul::ApplyBatchMatMul()
         SetValueAt(sum, DataSlot::Output, curIdx);
     };
 
-    auto startIdx = std::vector<unsigned int>(outputInfo.GetNumDimensions(), 0);
+    TensorIndex startIdx(outputInfo.GetNumDimensions());
     RecurseTensor(outputInfo,
                   batchMatMulOperation,
                   startIdx,
                   0);
 }
 
-void BatchMatMul::ApplyParams()
+void BatchMatMul::ApplyParams(DataSlot type)
 {
-    if(params.m_TransposeX)
-    {
-        Transpose(DataSlot::InputX);
-    }
-    else if(params.m_AdjointX)
-    {
-        Adjoint(DataSlot::InputX);
-    }
-    if(params.m_TransposeY)
+    const bool transpose = (type == DataSlot::InputX) ? params.m_TransposeX : params.m_TransposeY;
+    const bool adjoint   = (type == DataSlot::InputX) ? params.m_AdjointX : params.m_AdjointY;
+    if(transpose)
     {
-        Transpose(DataSlot::InputY);
+        Transpose(type);
     }
-    else if(params.m_AdjointY)
+    else if(adjoint)
     {
-        Adjoint(DataSlot::InputY);
+        Adjoint(type);
     }
 }
 
@@ -106,13 +185,13 @@ void BatchMatMul::Transpose(DataSlot type)
             auto permuteVec = BatchMatMulDescriptor::GetPermuteVec(params.m_DataLayoutX,
                                                                    inputXInfo.GetShape());
             inputXInfo = armnnUtils::Permuted(inputXInfo, permuteVec);
-            std::vector<float> temp(inputXData.size());
+            ScratchVector<float> temp(inputXData.size());
             armnnUtils::Permute(inputXInfo.GetShape(),
                                 permuteVec,
                                 inputXData.data(),
                                 temp.data(),
                                 sizeof(float));
-            inputXData = temp;
+            inputXData.swap(temp);
             break;
         }
         case DataSlot::InputY:
@@ -120,13 +199,13 @@ void BatchMatMul::Transpose(DataSlot type)
             auto permuteVec = BatchMatMulDescriptor::GetPermuteVec(params.m_DataLayoutY,
                                                                    inputYInfo.GetShape());
             inputYInfo = armnnUtils::Permuted(inputYInfo, permuteVec);
-            std::vector<float> temp(inputYData.size());
+            ScratchVector<float> temp(inputYData.size());
             armnnUtils::Permute(inputYInfo.GetShape(),
                                 permuteVec,
                                 inputYData.data(),
                                 temp.data(),
                                 sizeof(float));
-            inputYData = temp;
+            inputYData.swap(temp);
             break;
         }
         case DataSlot::Output: // We needn't transpose the output tensor
@@ -146,7 +225,7 @@ void BatchMatMul::Adjoint(DataSlot type)
     const auto axesToAdjoint = BatchMatMulDescriptor::GetAxesToMul(dataLayout,inputInfo.GetShape());
 
     // We grab a copy of the tensor data to prevent overwriting
-    std::vector<float> inputDataClone = (type == DataSlot::InputX) ? inputXData : inputYData;
+    const ScratchVector<float> inputDataClone = (type == DataSlot::InputX) ? inputXData : inputYData;
 
     // The sub-matrix is the resultant matrix when the row and column of the current index is removed
     unsigned int subMatAxisSize = inputInfo.GetShape()[axesToAdjoint.first] - 1;
@@ -212,7 +291,7 @@ void BatchMatMul::Adjoint(DataSlot type)
         }
     };
 
-    auto cofactorOperation = [&](const std::vector<unsigned int>& curIdx)
+    auto cofactorOperation = [&](const TensorIndex& curIdx)
     {
         auto row = curIdx[axesToAdjoint.first];
         auto col = curIdx[axesToAdjoint.second];
@@ -228,7 +307,7 @@ void BatchMatMul::Adjoint(DataSlot type)
                 auto cloneIdx = curIdx;
                 cloneIdx[axesToAdjoint.first] = outerRow;
                 cloneIdx[axesToAdjoint.second] = outerCol;
-                subMat[subRow][subCol] = GetValueAt(type,cloneIdx,inputDataClone);
+                subMat[subRow][subCol] = GetValueAt(type, cloneIdx, inputDataClone.data());
             }
         }
 
@@ -239,7 +318,7 @@ void BatchMatMul::Adjoint(DataSlot type)
         {
             case 0:
             {
-                determinant = GetValueAt(type, curIdx, inputDataClone);
+                determinant = GetValueAt(type, curIdx, inputDataClone.data());
                 break;
             }
             case 1:
@@ -292,7 +371,7 @@ void BatchMatMul::Adjoint(DataSlot type)
         SetValueAt(cofactor, type, curIdx);
     };
 
-    auto startIdx = std::vector<unsigned int>(inputInfo.GetNumDimensions(), 0);
+    TensorIndex startIdx(inputInfo.GetNumDimensions());
     RecurseTensor(inputInfo,
                   cofactorOperation,
                   startIdx,
@@ -302,8 +381,8 @@ void BatchMatMul::Adjoint(DataSlot type)
 }
 
 void BatchMatMul::RecurseTensor(const TensorInfo& tensorInfo,
-                                const std::function<void(const std::vector<unsigned int>&)>& operation,
-                                std::vector<unsigned int>& curIdx,
+                                const std::function<void(const TensorIndex&)>& operation,
+                                TensorIndex& curIdx,
                                 unsigned int curDim)
 {
     if(!(curDim < tensorInfo.GetNumDimensions()))
@@ -346,7 +425,7 @@ void BatchMatMul::AdjustAxesToMulForUnequalRanks(std::pair<unsigned int, unsigne
     }
 }
 
-float BatchMatMul::GetValueAt(DataSlot type, std::vector<unsigned int> idx, const std::vector<float>& customData)
+float BatchMatMul::GetValueAt(DataSlot type, TensorIndex idx, const float* customData)
 {
     // This gets the data from the input vector that we have, Not the decoder
     // But for the output, it is operating on the encoder itself
@@ -357,14 +436,14 @@ float BatchMatMul::GetValueAt(DataSlot type, std::vector<unsigned int> idx, cons
     switch(type)
     {
         case DataSlot::InputX:
-            value = customData.empty() ? inputXData[flatIdx] : customData[flatIdx];
+            value = customData ? customData[flatIdx] : inputXValues[flatIdx];
             break;
         case DataSlot::InputY:
-            value = customData.empty() ? inputYData[flatIdx] : customData[flatIdx];
+            value = customData ? customData[flatIdx] : inputYValues[flatIdx];
             break;
         case DataSlot::Output:
-            outputEncoder[flatIdx];
-            value = outputEncoder.Get();
+            (*outputEncoder)[flatIdx];
+            value = outputEncoder->Get();
             break;
         default:
             break;
@@ -373,7 +452,7 @@ float BatchMatMul::GetValueAt(DataSlot type, std::vector<unsigned int> idx, cons
     return value;
 }
 
-void BatchMatMul::SetValueAt(float value, DataSlot type, std::vector<unsigned int> idx)
+void BatchMatMul::SetValueAt(float value, DataSlot type, TensorIndex idx)
 {
     AdjustToSafeIdx(type, idx);
     unsigned int flatIdx = CalcFlatIdx(type, idx);
@@ -386,15 +465,15 @@ void BatchMatMul::SetValueAt(float value, DataSlot type, std::vector<unsigned in
             inputYData[flatIdx] = value;
             break;
         case DataSlot::Output:
-            outputEncoder[flatIdx];
-            outputEncoder.Set(value);
+            (*outputEncoder)[flatIdx];
+            outputEncoder->Set(value);
             break;
         default:
             break;
     }
 }
 
-void BatchMatMul::AdjustToSafeIdx(DataSlot type, std::vector<unsigned int>& idx)
+void BatchMatMul::AdjustToSafeIdx(DataSlot type, TensorIndex& idx)
 {
     for(unsigned int dim = 0; dim < idx.size(); dim++)
     {
@@ -433,7 +512,7 @@ void BatchMatMul::AdjustToSafeIdx(DataSlot type, std::vector<unsigned int>& idx)
     }
 }
 
-unsigned int BatchMatMul::CalcFlatIdx(DataSlot type, const std::vector<unsigned int>& idx)
+unsigned int BatchMatMul::CalcFlatIdx(DataSlot type, const TensorIndex& idx)
 {
     unsigned int result = idx[idx.size()-1];
     unsigned int dimMultiplier = 1;
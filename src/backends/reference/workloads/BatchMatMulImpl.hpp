@@ -9,12 +9,23 @@
 #include "Decoders.hpp"
 
 #include <armnn/backends/WorkloadData.hpp>
+#include <backendsCommon/ScratchArena.hpp>
+
+#include <array>
 
 namespace armnn
 {
 
 class BatchMatMul {
 public:
+    /// An input which has been decoded and had its transpose/adjoint parameters applied, so that a constant input
+    /// only needs to be prepared once.
+    struct PreparedInput
+    {
+        TensorInfo m_Info;
+        std::vector<float> m_Data;
+    };
+
     BatchMatMul(const BatchMatMulDescriptor& params,
                 const TensorInfo& inputXInfo,
                 const TensorInfo& inputYInfo,
@@ -23,6 +34,25 @@ public:
                 Decoder<float>& inputYDecoder,
                 Encoder<float>& outputEncoder);
 
+    /// As above, but either input can be given as a PreparedInput, in which case its decoder may be nullptr.
+    BatchMatMul(const BatchMatMulDescriptor& params,
+                const TensorInfo& inputXInfo,
+                const TensorInfo& inputYInfo,
+                const TensorInfo& outputInfo,
+                Decoder<float>* inputXDecoder,
+                const PreparedInput* preparedInputX,
+                Decoder<float>* inputYDecoder,
+                const PreparedInput* preparedInputY,
+                Encoder<float>& outputEncoder);
+
+    /// Decodes InputX (if isInputX is true) or InputY and applies the transpose/adjoint parameters for that input.
+    static PreparedInput PrepareInput(const BatchMatMulDescriptor& params,
+                                      const TensorInfo& inputXInfo,
+                                      const TensorInfo& inputYInfo,
+                                      const TensorInfo& outputInfo,
+                                      bool isInputX,
+                                      Decoder<float>& inputDecoder);
+
 private:
     enum DataSlot
     {
@@ -31,42 +61,66 @@ private:
         Output = 2
     };
 
+    // Index of a tensor element. It is kept on the stack, as an index is copied for every element visited.
+    class TensorIndex
+    {
+    public:
+        explicit TensorIndex(unsigned int numDimensions) : m_NumDimensions(numDimensions) {}
+
+        size_t size() const { return m_NumDimensions; }
+        unsigned int& operator[](size_t dim) { return m_Values[dim]; }
+        unsigned int operator[](size_t dim) const { return m_Values[dim]; }
+
+    private:
+        std::array<unsigned int, MaxNumOfTensorDimensions> m_Values{};
+        unsigned int m_NumDimensions;
+    };
+
+    // Only used by PrepareInput(), which applies the parameters of one input without an output.
+    BatchMatMul(const BatchMatMulDescriptor& params,
+                const TensorInfo& inputXInfo,
+                const TensorInfo& inputYInfo,
+                const TensorInfo& outputInfo);
+
     const BatchMatMulDescriptor& params;
     TensorInfo inputXInfo;
     TensorInfo inputYInfo;
     TensorInfo outputInfo;
-    Decoder<float>& inputXDecoder;
-    Decoder<float>& inputYDecoder;
-    Encoder<float>& outputEncoder;
+    Encoder<float>* outputEncoder;
+
+    // Decoded inputs live in the ScratchArena of the executing network, if there is one.
+    ScratchVector<float> inputXData;
+    ScratchVector<float> inputYData;
 
-    std::vector<float> inputXData;
-    std::vector<float> inputYData;
+    // Point at either inputXData/inputYData or the data of a PreparedInput.
+    const float* inputXValues;
+    const float* inputYValues;
 
     void ApplyBatchMatMul();
 
-    void ApplyParams();
+    void ApplyParams(DataSlot type);
 
     void Transpose(DataSlot type);
 
     void Adjoint(DataSlot type);
 
     void RecurseTensor(const TensorInfo& tensorInfo,
-                       std::function<void(const std::vector<unsigned int>&)> const& operation,
-                       std::vector<unsigned int>& curIdx,
+                       std::function<void(const TensorIndex&)> const& operation,
+                       TensorIndex& curIdx,
                        unsigned int curDim);
 
     // Adjusts it for when input tensors are of unequal rank
     void AdjustAxesToMulForUnequalRanks(std::pair<unsigned int, unsigned int>& axesXToMul,
                                         std::pair<unsigned int, unsigned int>& axesYToMul);
 
-    float GetValueAt(DataSlot type, std::vector<unsigned int> idx, const std::vector<float>& customData = {});
+    float GetValueAt(DataSlot type, TensorIndex idx, const float* customData = nullptr);
 
-    void SetValueAt(float value, DataSlot type, std::vector<unsigned int> idx);
+    void SetValueAt(float value, DataSlot type, TensorIndex idx);
 
     // Takes into account broadcasting
-    void AdjustToSafeIdx(DataSlot type, std::vector<unsigned int>& idx);
+    void AdjustToSafeIdx(DataSlot type, TensorIndex& idx);
 
-    unsigned int CalcFlatIdx(DataSlot type, const std::vector<unsigned int>& idx);
+    unsigned int CalcFlatIdx(DataSlot type, const TensorIndex& idx);
 };
 
 } // namespace armnn
\ No newline at end of file
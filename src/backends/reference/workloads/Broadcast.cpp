@@ -5,6 +5,8 @@
 
 #include "Broadcast.hpp"
 
+#include <armnn/Exceptions.hpp>
+
 namespace armnn
 {
 
@@ -28,6 +30,8 @@ BroadcastLoop::BroadcastLoop(const TensorShape& inShape0, const TensorShape& inS
         sIn1 *= inShape1[j];
         sOut *= outShape[j];
     }
+
+    CollapseDimensions();
 }
 
 BroadcastLoop::BroadcastLoop(const TensorShape& inShape, const TensorShape& outShape)
@@ -42,11 +46,167 @@ BroadcastLoop::BroadcastLoop(const TensorShape& inShape, const TensorShape& outS
     {
         m_DimData[j].m_DimSize = outShape[j];
         m_DimData[j].m_Stride1 = (inShape[j] > 1) ? sIn : 0;
+        m_DimData[j].m_Stride2 = 0;
         m_DimData[j].m_StrideOut = sOut;
 
         sIn *= inShape[j];
         sOut *= outShape[j];
     }
+
+    CollapseDimensions();
+}
+
+void BroadcastLoop::CollapseDimensions()
+{
+    std::vector<BroadcastDimensionData> collapsed;
+    for (const BroadcastDimensionData& dim : m_DimData)
+    {
+        if (dim.m_DimSize == 1)
+        {
+            continue;
+        }
+
+        if (!collapsed.empty())
+        {
+            BroadcastDimensionData& outer = collapsed.back();
+            if (outer.m_StrideOut == dim.m_StrideOut * dim.m_DimSize &&
+                outer.m_Stride1 == dim.m_Stride1 * dim.m_DimSize &&
+                outer.m_Stride2 == dim.m_Stride2 * dim.m_DimSize)
+            {
+                outer.m_DimSize  *= dim.m_DimSize;
+                outer.m_StrideOut = dim.m_StrideOut;
+                outer.m_Stride1   = dim.m_Stride1;
+                outer.m_Stride2   = dim.m_Stride2;
+                continue;
+            }
+        }
+        collapsed.push_back(dim);
+    }
+
+    if (collapsed.empty())
+    {
+        // A single element, treated as one row broadcast from every input.
+        collapsed.push_back({ 1, 1, 0, 0 });
+    }
+    m_DimData = std::move(collapsed);
+}
+
+unsigned int BroadcastLoop::GetNumChunks(unsigned int dimension, unsigned int chunkSize) const
+{
+    unsigned int numChunks = (GetRowSize() + chunkSize - 1) / chunkSize;
+    for (unsigned int dim = dimension; dim + 1 < GetNumDimensions(); ++dim)
+    {
+        numChunks *= m_DimData[dim].m_DimSize;
+    }
+    return numChunks;
+}
+
+unsigned int BroadcastLoop::GetMinChunksPerTask(unsigned int chunkSize)
+{
+    constexpr unsigned int minElementsPerTask = 16 * RangeChunkSize;
+    return std::max(1u, minElementsPerTask / chunkSize);
+}
+
+BroadcastLoop::Chunk BroadcastLoop::GetChunk(unsigned int dimension,
+                                             unsigned int chunkSize,
+                                             unsigned int chunkIndex) const
+{
+    const BroadcastDimensionData& row = m_DimData.back();
+    const unsigned int chunksPerRow = (row.m_DimSize + chunkSize - 1) / chunkSize;
+    const unsigned int chunkStart = (chunkIndex % chunksPerRow) * chunkSize;
+
+    Chunk chunk { chunkStart * row.m_Stride1,
+                  chunkStart * row.m_Stride2,
+                  chunkStart * row.m_StrideOut,
+                  std::min(chunkSize, row.m_DimSize - chunkStart) };
+
+    // Adds the offsets of the row, peeling its index in every outer dimension off the row number, innermost first.
+    unsigned int rowIndex = chunkIndex / chunksPerRow;
+    for (unsigned int dim = GetNumDimensions() - 1; dim > dimension; --dim)
+    {
+        const BroadcastDimensionData& outer = m_DimData[dim - 1];
+        const unsigned int index = rowIndex % outer.m_DimSize;
+        rowIndex /= outer.m_DimSize;
+
+        chunk.m_InOffset0 += index * outer.m_Stride1;
+        chunk.m_InOffset1 += index * outer.m_Stride2;
+        chunk.m_OutOffset += index * outer.m_StrideOut;
+    }
+    return chunk;
+}
+
+MultiBroadcastLoop::MultiBroadcastLoop(const std::vector<TensorShape>& inShapes, const TensorShape& outShape)
+    : m_NumInputs(static_cast<unsigned int>(inShapes.size()))
+    , m_IsEmpty(outShape.GetNumElements() == 0)
+{
+    const unsigned int numDims = outShape.GetNumDimensions();
+    for (const TensorShape& inShape : inShapes)
+    {
+        if (inShape.GetNumDimensions() != numDims)
+        {
+            throw InvalidArgumentException("MultiBroadcastLoop: every input must have as many dimensions as the output",
+                                           CHECK_LOCATION());
+        }
+    }
+
+    // Strides of every dimension, innermost first, before collapsing them.
+    std::vector<unsigned int> inStrideSoFar(m_NumInputs, 1);
+    unsigned int outStrideSoFar = 1;
+    std::vector<unsigned int> dimSizes(numDims);
+    std::vector<unsigned int> outStrides(numDims);
+    std::vector<std::vector<unsigned int>> inStrides(numDims, std::vector<unsigned int>(m_NumInputs));
+    for (unsigned int j = numDims; j > 0; --j)
+    {
+        const unsigned int dim = j - 1;
+        dimSizes[dim] = outShape[dim];
+        outStrides[dim] = outStrideSoFar;
+        outStrideSoFar *= outShape[dim];
+        for (unsigned int i = 0; i < m_NumInputs; ++i)
+        {
+            inStrides[dim][i] = (inShapes[i][dim] > 1) ? inStrideSoFar[i] : 0;
+            inStrideSoFar[i] *= inShapes[i][dim];
+        }
+    }
+
+    // Drops dimensions of size one and merges dimensions which are contiguous in every tensor, as
+    // BroadcastLoop::CollapseDimensions() does.
+    for (unsigned int dim = 0; dim < numDims; ++dim)
+    {
+        const unsigned int size = dimSizes[dim];
+        if (size == 1)
+        {
+            continue;
+        }
+
+        if (!m_DimSizes.empty())
+        {
+            bool contiguous = m_OutStrides.back() == outStrides[dim] * size;
+            for (unsigned int i = 0; contiguous && i < m_NumInputs; ++i)
+            {
+                contiguous = m_InStrides.back()[i] == inStrides[dim][i] * size;
+            }
+
+            if (contiguous)
+            {
+                m_DimSizes.back() *= size;
+                m_OutStrides.back() = outStrides[dim];
+                m_InStrides.back() = inStrides[dim];
+                continue;
+            }
+        }
+
+        m_DimSizes.push_back(size);
+        m_OutStrides.push_back(outStrides[dim]);
+        m_InStrides.push_back(inStrides[dim]);
+    }
+
+    if (m_DimSizes.empty())
+    {
+        // A single element, treated as one row broadcast from every input.
+        m_DimSizes.push_back(1);
+        m_OutStrides.push_back(1);
+        m_InStrides.push_back(std::vector<unsigned int>(m_NumInputs, 0));
+    }
 }
 
 } // namespace armnn
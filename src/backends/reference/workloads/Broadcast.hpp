@@ -4,9 +4,14 @@
 //
 
 #include "BaseIterator.hpp"
+#include "RefTaskPool.hpp"
 #include <armnn/Tensor.hpp>
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace armnn
 {
@@ -17,11 +22,15 @@ struct BroadcastLoop
 
     BroadcastLoop(const TensorShape& inShape, const TensorShape& outShape);
 
-    unsigned int GetNumDimensions()
+    unsigned int GetNumDimensions() const
     {
         return static_cast<unsigned int>(m_DimData.size());
     }
 
+    /// Applies operationFunc to every element of the output. The tensors are processed a chunk of a row (the
+    /// innermost, possibly collapsed, dimension) at a time through DecodeRange() and EncodeRange(), relative to the
+    /// current position of each iterator. The chunks are split across RefTaskPool; every output element is written
+    /// by one thread only, so results do not depend on the number of threads.
     template <typename Func, typename DecoderOp, typename EncoderOp>
     void Unroll(Func operationFunc,
                 unsigned int dimension,
@@ -29,33 +38,36 @@ struct BroadcastLoop
                 DecoderOp& inData1,
                 EncoderOp& outData)
     {
-        if (dimension >= GetNumDimensions())
+        using InType  = std::decay_t<decltype(inData0.Get())>;
+        using OutType = std::decay_t<decltype(outData.Get())>;
+
+        if (dimension >= GetNumDimensions() || GetRowSize() == 0)
         {
-            outData.Set(operationFunc(inData0.Get(), inData1.Get()));
             return;
         }
 
-        unsigned int inData0Movement = 0;
-        unsigned int inData1Movement = 0;
-        unsigned int outDataMovement = 0;
-
-        for (unsigned int i = 0; i < m_DimData[dimension].m_DimSize; i++)
+        const unsigned int chunkSize = std::min(GetRowSize(), RangeChunkSize);
+        ParallelFor(GetNumChunks(dimension, chunkSize), GetMinChunksPerTask(chunkSize),
+                    [&](unsigned int firstChunk, unsigned int lastChunk)
         {
-            Unroll(operationFunc, dimension + 1, inData0, inData1, outData);
-
-            inData0 += m_DimData[dimension].m_Stride1;
-            inData1 += m_DimData[dimension].m_Stride2;
-            outData += m_DimData[dimension].m_StrideOut;
-
-            inData0Movement += m_DimData[dimension].m_Stride1;
-            inData1Movement += m_DimData[dimension].m_Stride2;
-            outDataMovement += m_DimData[dimension].m_StrideOut;
-        }
-
-        // move iterator back to the start
-        inData0 -= inData0Movement;
-        inData1 -= inData1Movement;
-        outData -= outDataMovement;
+            // Plain arrays rather than std::vector, as the element type may be bool.
+            std::unique_ptr<InType[]> inRow0(new InType[chunkSize]);
+            std::unique_ptr<InType[]> inRow1(new InType[chunkSize]);
+            std::unique_ptr<OutType[]> outRow(new OutType[chunkSize]);
+
+            const BroadcastDimensionData& row = m_DimData.back();
+            for (unsigned int chunkIndex = firstChunk; chunkIndex < lastChunk; ++chunkIndex)
+            {
+                const Chunk chunk = GetChunk(dimension, chunkSize, chunkIndex);
+                DecodeRow(inData0, chunk.m_InOffset0, row.m_Stride1, chunk.m_Size, inRow0.get());
+                DecodeRow(inData1, chunk.m_InOffset1, row.m_Stride2, chunk.m_Size, inRow1.get());
+                for (unsigned int i = 0; i < chunk.m_Size; ++i)
+                {
+                    outRow[i] = operationFunc(inRow0[i], inRow1[i]);
+                }
+                outData.EncodeRange(chunk.m_OutOffset, chunk.m_Size, outRow.get());
+            }
+        });
     }
 
     template <typename Func, typename DecoderOp, typename EncoderOp>
@@ -64,29 +76,32 @@ struct BroadcastLoop
                 DecoderOp& inData,
                 EncoderOp& outData)
     {
-        if (dimension >= GetNumDimensions())
+        using InType  = std::decay_t<decltype(inData.Get())>;
+        using OutType = std::decay_t<decltype(outData.Get())>;
+
+        if (dimension >= GetNumDimensions() || GetRowSize() == 0)
         {
-            outData.Set(operationFunc(inData.Get()));
             return;
         }
 
-        unsigned int inDataMovement = 0;
-        unsigned int outDataMovement = 0;
-
-        for (unsigned int i = 0; i < m_DimData[dimension].m_DimSize; i++)
+        const unsigned int chunkSize = std::min(GetRowSize(), RangeChunkSize);
+        ParallelFor(GetNumChunks(dimension, chunkSize), GetMinChunksPerTask(chunkSize),
+                    [&](unsigned int firstChunk, unsigned int lastChunk)
         {
-            Unroll(operationFunc, dimension + 1, inData, outData);
-
-            inData += m_DimData[dimension].m_Stride1;
-            outData += m_DimData[dimension].m_StrideOut;
-
-            inDataMovement += m_DimData[dimension].m_Stride1;
-            outDataMovement += m_DimData[dimension].m_StrideOut;
-        }
-
-        // move iterator back to the start
-        inData -= inDataMovement;
-        outData -= outDataMovement;
+            std::unique_ptr<InType[]> inRow(new InType[chunkSize]);
+            std::unique_ptr<OutType[]> outRow(new OutType[chunkSize]);
+
+            for (unsigned int chunkIndex = firstChunk; chunkIndex < lastChunk; ++chunkIndex)
+            {
+                const Chunk chunk = GetChunk(dimension, chunkSize, chunkIndex);
+                DecodeRow(inData, chunk.m_InOffset0, m_DimData.back().m_Stride1, chunk.m_Size, inRow.get());
+                for (unsigned int i = 0; i < chunk.m_Size; ++i)
+                {
+                    outRow[i] = operationFunc(inRow[i]);
+                }
+                outData.EncodeRange(chunk.m_OutOffset, chunk.m_Size, outRow.get());
+            }
+        });
     }
 
 private:
@@ -99,7 +114,127 @@ private:
         unsigned int m_Stride2;
     };
 
+    // A contiguous part of a row of the output and the offsets of the matching elements of the inputs.
+    struct Chunk
+    {
+        unsigned int m_InOffset0;
+        unsigned int m_InOffset1;
+        unsigned int m_OutOffset;
+        unsigned int m_Size;
+    };
+
+    unsigned int GetRowSize() const
+    {
+        return m_DimData.back().m_DimSize;
+    }
+
+    // Number of chunks of at most chunkSize elements the rows below the given dimension are split into.
+    unsigned int GetNumChunks(unsigned int dimension, unsigned int chunkSize) const;
+
+    // Elementwise operations are cheap, so a task covers enough chunks to outweigh the cost of scheduling it.
+    static unsigned int GetMinChunksPerTask(unsigned int chunkSize);
+
+    // Returns the chunkIndex-th chunk, counting the chunks of every row in order.
+    Chunk GetChunk(unsigned int dimension, unsigned int chunkSize, unsigned int chunkIndex) const;
+
+    // The innermost stride of an input is 1, or 0 when it is broadcast along the row.
+    template <typename DecoderOp, typename T>
+    static void DecodeRow(DecoderOp& decoder, unsigned int offset, unsigned int stride, unsigned int rowSize, T* row)
+    {
+        if (stride == 0)
+        {
+            decoder.DecodeRange(offset, 1, row);
+            std::fill(row + 1, row + rowSize, row[0]);
+        }
+        else
+        {
+            decoder.DecodeRange(offset, rowSize, row);
+        }
+    }
+
+    // Drops dimensions of size one and merges dimensions which are contiguous in every tensor, so that rows are as
+    // long as possible.
+    void CollapseDimensions();
+
     std::vector<BroadcastDimensionData> m_DimData;
 };
 
+/// BroadcastLoop for any number of inputs, as needed by a chain of fused elementwise operations. Rather than applying
+/// a function itself, it calls a function with the offsets of every row of the output and of the matching row of each
+/// input, leaving the caller to decode, combine and encode them.
+struct MultiBroadcastLoop
+{
+    /// Every input shape must have as many dimensions as the output shape.
+    MultiBroadcastLoop(const std::vector<TensorShape>& inShapes, const TensorShape& outShape);
+
+    /// Number of elements in a row (the innermost, possibly collapsed, dimension) of the output.
+    unsigned int GetRowSize() const
+    {
+        return m_DimSizes.back();
+    }
+
+    /// Returns true if every element of a row of the output reads the same element of the given input.
+    bool IsBroadcastAlongRow(unsigned int input) const
+    {
+        return m_InStrides.back()[input] == 0;
+    }
+
+    /// Calls rowFunc(inOffsets, outOffset) for every row of the output, in order. inOffsets holds the offset of the
+    /// matching row of each input.
+    template <typename RowFunc>
+    void ForEachRow(RowFunc&& rowFunc) const
+    {
+        if (m_IsEmpty)
+        {
+            return;
+        }
+
+        const unsigned int numDims = static_cast<unsigned int>(m_DimSizes.size());
+        std::vector<unsigned int> index(numDims, 0);
+        std::vector<unsigned int> inOffsets(m_NumInputs, 0);
+        unsigned int outOffset = 0;
+
+        while (true)
+        {
+            rowFunc(static_cast<const std::vector<unsigned int>&>(inOffsets), outOffset);
+
+            // Moves on to the next row, carrying into the outer dimensions as they wrap around.
+            unsigned int dim = numDims - 1;
+            while (true)
+            {
+                if (dim == 0)
+                {
+                    return;
+                }
+                --dim;
+
+                if (++index[dim] < m_DimSizes[dim])
+                {
+                    outOffset += m_OutStrides[dim];
+                    for (unsigned int i = 0; i < m_NumInputs; ++i)
+                    {
+                        inOffsets[i] += m_InStrides[dim][i];
+                    }
+                    break;
+                }
+
+                index[dim] = 0;
+                outOffset -= (m_DimSizes[dim] - 1) * m_OutStrides[dim];
+                for (unsigned int i = 0; i < m_NumInputs; ++i)
+                {
+                    inOffsets[i] -= (m_DimSizes[dim] - 1) * m_InStrides[dim][i];
+                }
+            }
+        }
+    }
+
+private:
+    unsigned int m_NumInputs;
+    bool m_IsEmpty;
+    std::vector<unsigned int> m_DimSizes;
+    std::vector<unsigned int> m_OutStrides;
+    /// Stride of every input in each dimension, 0 where it is broadcast.
+    std::vector<std::vector<unsigned int>> m_InStrides;
+};
+
 } //namespace armnn
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include "Decoders.hpp"
 #include "Encoders.hpp"
 
+#include <armnnUtils/TensorUtils.hpp>
+
 namespace armnn
 {
 
@@ -16,71 +18,81 @@ void Concatenate(const ConcatQueueDescriptor &data,
                  std::vector<ITensorHandle*> outputs)
 {
     const TensorInfo& outputInfo0 = GetTensorInfo(outputs[0]);
+    const TensorShape& outputShape = outputInfo0.GetShape();
+    const unsigned int numDimensions = outputInfo0.GetNumDimensions();
 
     std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputInfo0, outputs[0]->Map());
     Encoder<float>& encoder = *encoderPtr;
 
-    for (unsigned int index = 0 ; index < outputInfo0.GetNumElements(); ++index)
+    unsigned int outputStrides[MaxNumOfTensorDimensions] = { 0 };
+    unsigned int dimensionStride = 1;
+    for (unsigned int i = numDimensions; i-- > 0;)
     {
-        unsigned int indices[MaxNumOfTensorDimensions] = { 0 };
+        outputStrides[i] = dimensionStride;
+        dimensionStride *= outputShape[i];
+    }
 
-        unsigned int indexRemainder = index;
-        unsigned int dimensionStride = outputInfo0.GetNumElements();
+    std::vector<float> block;
 
-        for (unsigned int i = 0; i < outputInfo0.GetNumDimensions(); i++)
+    // What should we do if input views overlap on the output tensor?
+    // We could error, take the average, or shm else...
+    // For now the first view (input) that covers an element wins, so the views are copied in reverse order.
+    for (unsigned int viewIdx = static_cast<unsigned int>(data.m_ViewOrigins.size()); viewIdx-- > 0;)
+    {
+        ConcatQueueDescriptor::ViewOrigin const& view = data.m_ViewOrigins[viewIdx];
+
+        //Split view extents are defined by the size of (the corresponding) input tensor.
+        const TensorInfo& inputInfo = GetTensorInfo(inputs[viewIdx]);
+        const TensorShape& inputShape = inputInfo.GetShape();
+        ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(
+            inputInfo.GetNumDimensions() == numDimensions,
+            "The number of output dimensions does not match the number of input dimensions.");
+        for (unsigned int i = 0; i < numDimensions; i++)
         {
-            dimensionStride /= outputInfo0.GetShape()[i];
-            indices[i] = indexRemainder / dimensionStride; // Use integer division to round down.
-            indexRemainder -= indices[i] * dimensionStride;
+            ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(view.m_Origin[i] + inputShape[i] <= outputShape[i],
+                                                "The input view does not fit inside the output tensor.");
         }
 
-        for (unsigned int viewIdx = 0; viewIdx < data.m_ViewOrigins.size(); ++viewIdx)
+        // The input is copied in blocks which are contiguous in both the input and the output: the innermost
+        // dimension whose extent differs from the output, together with all the dimensions inside it.
+        unsigned int blockDimension = 0;
+        for (unsigned int i = numDimensions; i-- > 0;)
         {
-            ConcatQueueDescriptor::ViewOrigin const& view = data.m_ViewOrigins[viewIdx];
-
-            //Split view extents are defined by the size of (the corresponding) input tensor.
-            const TensorInfo& inputInfo = GetTensorInfo(inputs[viewIdx]);
-            ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(
-                inputInfo.GetNumDimensions() == outputInfo0.GetNumDimensions(),
-                "The number of output dimensions does not match the number of input dimensions.");
-
-            // Check all dimensions to see if this element is inside the given input view.
-            bool insideView = true;
-            for (unsigned int i = 0; i < inputInfo.GetNumDimensions(); i++)
+            if (inputShape[i] != outputShape[i])
             {
-                if (indices[i] < view.m_Origin[i])
-                {
-                    insideView = false;
-                }
-                if (indices[i] >= view.m_Origin[i] + inputInfo.GetShape()[i])
-                {
-                    insideView = false;
-                }
+                blockDimension = i;
+                break;
             }
+        }
+        const unsigned int blockSize = armnnUtils::GetNumElementsBetween(inputShape, blockDimension, numDimensions);
+        if (blockSize == 0)
+        {
+            continue;
+        }
+        const unsigned int numBlocks = inputInfo.GetNumElements() / blockSize;
+        block.resize(blockSize);
 
-            if (insideView)
-            {
-                std::unique_ptr<Decoder<float>> decoderPtr =
-                    MakeDecoder<float>(inputInfo,inputs[viewIdx]->Map());
-                Decoder<float>& decoder = *decoderPtr;
-                unsigned int inIndex = 0;
-                unsigned int dimensionStride = 1;
+        std::unique_ptr<Decoder<float>> decoderPtr = MakeDecoder<float>(inputInfo, inputs[viewIdx]->Map());
+        Decoder<float>& decoder = *decoderPtr;
 
-                for (unsigned int i = inputInfo.GetNumDimensions(); i-- > 0;)
+        for (unsigned int blockIdx = 0; blockIdx < numBlocks; ++blockIdx)
+        {
+            unsigned int outIndex = 0;
+            unsigned int indexRemainder = blockIdx;
+            for (unsigned int i = numDimensions; i-- > 0;)
+            {
+                unsigned int index = 0;
+                if (i < blockDimension)
                 {
-                    inIndex += dimensionStride * (indices[i] - view.m_Origin[i]);
-                    dimensionStride *= inputInfo.GetShape()[i];
+                    index = indexRemainder % inputShape[i];
+                    indexRemainder /= inputShape[i];
                 }
-                decoder += inIndex;
-                encoder.Set(decoder.Get());
-
-                //What should we do if input views overlap on the output tensor?
-                //We could error, take the average, or shm else...
-                //For now just stop after finding first view (input) that matches.
-                break;
+                outIndex += (index + view.m_Origin[i]) * outputStrides[i];
             }
+
+            decoder.DecodeRange(blockIdx * blockSize, blockSize, block.data());
+            encoder.EncodeRange(outIndex, blockSize, block.data());
         }
-        ++encoder;
     }
 }
 
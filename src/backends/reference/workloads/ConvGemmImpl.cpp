@@ -0,0 +1,371 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ConvGemmImpl.hpp"
+
+#include "RefTaskPool.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Number of im2col rows (output pixels) computed together by the GEMM micro kernel.
+constexpr unsigned int RowBlock = 6;
+
+// Target size in bytes of the im2col block, chosen so that it stays resident in the L2 cache while every filter
+// panel is swept across it.
+constexpr unsigned int ColumnBlockBytes = 256 * 1024;
+
+struct ConvGemmParams
+{
+    unsigned int m_InputChannels;
+    unsigned int m_InputHeight;
+    unsigned int m_InputWidth;
+    unsigned int m_OutputChannels;
+    unsigned int m_OutputHeight;
+    unsigned int m_OutputWidth;
+    unsigned int m_FilterHeight;
+    unsigned int m_FilterWidth;
+    unsigned int m_PaddingTop;
+    unsigned int m_PaddingLeft;
+    unsigned int m_StrideX;
+    unsigned int m_StrideY;
+    unsigned int m_DilationX;
+    unsigned int m_DilationY;
+    bool m_IsNhwc;
+};
+
+// Fills rows [firstPixel, firstPixel + numPixels) of the im2col matrix for one batch. Each row holds the K input
+// values seen by one output pixel, ordered (y, x, channel) to match the packed filter. Padding is written as zeros
+// here so that the GEMM inner loop is branch free.
+void Im2Col(const ConvGemmParams& p,
+            const float* batchInput,
+            unsigned int firstPixel,
+            unsigned int numPixels,
+            float* columns)
+{
+    const unsigned int inputChannels = p.m_InputChannels;
+    const unsigned int rowSize       = p.m_FilterHeight * p.m_FilterWidth * inputChannels;
+    const unsigned int planeSize     = p.m_InputHeight * p.m_InputWidth;
+
+    for (unsigned int row = 0; row < numPixels; ++row)
+    {
+        const unsigned int pixel   = firstPixel + row;
+        const unsigned int yOutput = pixel / p.m_OutputWidth;
+        const unsigned int xOutput = pixel % p.m_OutputWidth;
+
+        float* dst = columns + row * rowSize;
+
+        for (unsigned int yFilter = 0; yFilter < p.m_FilterHeight; ++yFilter)
+        {
+            const unsigned int yPadded = yOutput * p.m_StrideY + yFilter * p.m_DilationY;
+            if (yPadded < p.m_PaddingTop || yPadded >= p.m_InputHeight + p.m_PaddingTop)
+            {
+                std::fill_n(dst, p.m_FilterWidth * inputChannels, 0.0f);
+                dst += p.m_FilterWidth * inputChannels;
+                continue;
+            }
+            const unsigned int yInput = yPadded - p.m_PaddingTop;
+
+            for (unsigned int xFilter = 0; xFilter < p.m_FilterWidth; ++xFilter)
+            {
+                const unsigned int xPadded = xOutput * p.m_StrideX + xFilter * p.m_DilationX;
+                if (xPadded < p.m_PaddingLeft || xPadded >= p.m_InputWidth + p.m_PaddingLeft)
+                {
+                    std::fill_n(dst, inputChannels, 0.0f);
+                }
+                else
+                {
+                    const unsigned int xInput = xPadded - p.m_PaddingLeft;
+                    if (p.m_IsNhwc)
+                    {
+                        std::memcpy(dst,
+                                    batchInput + (yInput * p.m_InputWidth + xInput) * inputChannels,
+                                    inputChannels * sizeof(float));
+                    }
+                    else
+                    {
+                        const float* src = batchInput + yInput * p.m_InputWidth + xInput;
+                        for (unsigned int c = 0; c < inputChannels; ++c)
+                        {
+                            dst[c] = src[c * planeSize];
+                        }
+                    }
+                }
+                dst += inputChannels;
+            }
+        }
+    }
+}
+
+// Computes a Rows x ConvGemmPanelWidth block of the output. The accumulator is kept local (so it cannot alias the
+// inputs) and indexed by the output channel in the innermost loop so that the compiler can map it onto SIMD
+// registers on any target.
+template<unsigned int Rows>
+void GemmMicroKernel(const float* columns,
+                     unsigned int rowSize,
+                     const float* panel,
+                     float (&result)[RowBlock][ConvGemmPanelWidth])
+{
+    float accumulator[Rows][ConvGemmPanelWidth];
+    for (unsigned int r = 0; r < Rows; ++r)
+    {
+        for (unsigned int n = 0; n < ConvGemmPanelWidth; ++n)
+        {
+            accumulator[r][n] = result[r][n];
+        }
+    }
+
+    for (unsigned int k = 0; k < rowSize; ++k)
+    {
+        const float* filterRow = panel + k * ConvGemmPanelWidth;
+        for (unsigned int r = 0; r < Rows; ++r)
+        {
+            const float inputValue = columns[r * rowSize + k];
+            for (unsigned int n = 0; n < ConvGemmPanelWidth; ++n)
+            {
+                accumulator[r][n] += inputValue * filterRow[n];
+            }
+        }
+    }
+
+    for (unsigned int r = 0; r < Rows; ++r)
+    {
+        for (unsigned int n = 0; n < ConvGemmPanelWidth; ++n)
+        {
+            result[r][n] = accumulator[r][n];
+        }
+    }
+}
+
+} // anonymous namespace
+
+bool IsConvolveGemmSupported(const TensorInfo& inputInfo,
+                             const TensorInfo& filterInfo,
+                             const TensorInfo& outputInfo,
+                             const TensorInfo* biasInfo)
+{
+    if (inputInfo.GetDataType() != DataType::Float32 ||
+        filterInfo.GetDataType() != DataType::Float32 ||
+        outputInfo.GetDataType() != DataType::Float32)
+    {
+        return false;
+    }
+    if (biasInfo && biasInfo->GetDataType() != DataType::Float32)
+    {
+        return false;
+    }
+    return inputInfo.GetNumDimensions() == 4 &&
+           filterInfo.GetNumDimensions() == 4 &&
+           outputInfo.GetNumDimensions() == 4;
+}
+
+unsigned int GetPackedConvolutionFilterSize(const TensorShape& filterShape, DataLayout dataLayout)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int outputChannels = filterShape[0];
+    const unsigned int rowSize = filterShape[dataLayoutIndexed.GetHeightIndex()] *
+                                 filterShape[dataLayoutIndexed.GetWidthIndex()] *
+                                 filterShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int numPanels = (outputChannels + ConvGemmPanelWidth - 1) / ConvGemmPanelWidth;
+    return numPanels * rowSize * ConvGemmPanelWidth;
+}
+
+void PackConvolutionFilter(const TensorShape& filterShape,
+                           const float* filterData,
+                           DataLayout dataLayout,
+                           float* packedFilter)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int outputChannels = filterShape[0];
+    const unsigned int filterHeight   = filterShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int filterWidth    = filterShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int inputChannels  = filterShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int rowSize        = filterHeight * filterWidth * inputChannels;
+    const bool isNhwc = dataLayout == DataLayout::NHWC;
+
+    std::fill_n(packedFilter, GetPackedConvolutionFilterSize(filterShape, dataLayout), 0.0f);
+
+    for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+    {
+        float* panel = packedFilter + (cOutput / ConvGemmPanelWidth) * rowSize * ConvGemmPanelWidth;
+        const unsigned int lane = cOutput % ConvGemmPanelWidth;
+
+        for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+        {
+            for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+            {
+                for (unsigned int cInput = 0; cInput < inputChannels; ++cInput)
+                {
+                    const unsigned int k = (yFilter * filterWidth + xFilter) * inputChannels + cInput;
+                    const unsigned int filterIndex = isNhwc ?
+                        ((cOutput * filterHeight + yFilter) * filterWidth + xFilter) * inputChannels + cInput :
+                        ((cOutput * inputChannels + cInput) * filterHeight + yFilter) * filterWidth + xFilter;
+                    panel[k * ConvGemmPanelWidth + lane] = filterData[filterIndex];
+                }
+            }
+        }
+    }
+}
+
+std::vector<float> PackConvolutionFilter(const TensorShape& filterShape,
+                                         const float* filterData,
+                                         DataLayout dataLayout)
+{
+    std::vector<float> packedFilter(GetPackedConvolutionFilterSize(filterShape, dataLayout));
+    PackConvolutionFilter(filterShape, filterData, dataLayout, packedFilter.data());
+    return packedFilter;
+}
+
+void ConvolveGemm(const TensorShape& inputShape,
+                  const float* inputData,
+                  const TensorShape& outputShape,
+                  float* outputData,
+                  const TensorShape& filterShape,
+                  const float* packedFilter,
+                  const float* biasData,
+                  DataLayout dataLayout,
+                  unsigned int paddingTop,
+                  unsigned int paddingLeft,
+                  unsigned int xStride,
+                  unsigned int yStride,
+                  unsigned int xDilation,
+                  unsigned int yDilation,
+                  float outputMin,
+                  float outputMax)
+{
+    if (!inputData || !outputData || !packedFilter)
+    {
+        throw InvalidArgumentException("ConvolveGemm: input, output and filter data must not be null.");
+    }
+
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
+    const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
+    const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+
+    ConvGemmParams p{};
+    p.m_InputChannels  = inputShape[channelsIndex];
+    p.m_InputHeight    = inputShape[heightIndex];
+    p.m_InputWidth     = inputShape[widthIndex];
+    p.m_OutputChannels = outputShape[channelsIndex];
+    p.m_OutputHeight   = outputShape[heightIndex];
+    p.m_OutputWidth    = outputShape[widthIndex];
+    p.m_FilterHeight   = filterShape[heightIndex];
+    p.m_FilterWidth    = filterShape[widthIndex];
+    p.m_PaddingTop     = paddingTop;
+    p.m_PaddingLeft    = paddingLeft;
+    p.m_StrideX        = xStride;
+    p.m_StrideY        = yStride;
+    p.m_DilationX      = xDilation;
+    p.m_DilationY      = yDilation;
+    p.m_IsNhwc         = dataLayout == DataLayout::NHWC;
+
+    const unsigned int batchSize       = outputShape[0];
+    const unsigned int outputChannels  = p.m_OutputChannels;
+    const unsigned int outputPixels    = p.m_OutputHeight * p.m_OutputWidth;
+    const unsigned int inputBatchSize  = p.m_InputChannels * p.m_InputHeight * p.m_InputWidth;
+    const unsigned int outputBatchSize = outputChannels * outputPixels;
+    const unsigned int rowSize         = p.m_FilterHeight * p.m_FilterWidth * p.m_InputChannels;
+    const unsigned int numPanels       = (outputChannels + ConvGemmPanelWidth - 1) / ConvGemmPanelWidth;
+
+    // A 1x1, unit stride, unpadded NHWC convolution already has its input in im2col form.
+    const bool isPointwise = p.m_IsNhwc && p.m_FilterHeight == 1 && p.m_FilterWidth == 1 &&
+                             xStride == 1 && yStride == 1 && paddingTop == 0 && paddingLeft == 0 &&
+                             p.m_OutputHeight == p.m_InputHeight && p.m_OutputWidth == p.m_InputWidth;
+
+    // Blocks are shrunk so that every thread gets some, which changes the blocking but not the per pixel sums.
+    const unsigned int numThreads = RefTaskPool::Get().GetNumberOfThreads();
+    const unsigned int rowsPerThread = (batchSize * outputPixels + numThreads - 1) / numThreads;
+    const unsigned int rowsFittingBlock = ColumnBlockBytes / static_cast<unsigned int>(sizeof(float)) / rowSize;
+    const unsigned int rowsPerBlock = std::min({ outputPixels,
+                                                 std::max(RowBlock, rowsFittingBlock / RowBlock * RowBlock),
+                                                 std::max(RowBlock, rowsPerThread) });
+    const unsigned int blocksPerBatch = (outputPixels + rowsPerBlock - 1) / rowsPerBlock;
+
+    ParallelFor(batchSize * blocksPerBatch, 1, [&](unsigned int firstBlock, unsigned int lastBlock)
+    {
+        std::vector<float> columnBuffer(isPointwise ? 0 : rowsPerBlock * rowSize);
+
+        for (unsigned int blockIdx = firstBlock; blockIdx < lastBlock; ++blockIdx)
+        {
+            const unsigned int batchIdx = blockIdx / blocksPerBatch;
+            const unsigned int firstPixel = (blockIdx % blocksPerBatch) * rowsPerBlock;
+            const float* batchInput = inputData + batchIdx * inputBatchSize;
+            float* batchOutput = outputData + batchIdx * outputBatchSize;
+            const unsigned int numPixels = std::min(rowsPerBlock, outputPixels - firstPixel);
+
+            const float* columns = nullptr;
+            if (isPointwise)
+            {
+                columns = batchInput + firstPixel * rowSize;
+            }
+            else
+            {
+                Im2Col(p, batchInput, firstPixel, numPixels, columnBuffer.data());
+                columns = columnBuffer.data();
+            }
+
+            for (unsigned int panelIdx = 0; panelIdx < numPanels; ++panelIdx)
+            {
+                const float* panel = packedFilter + panelIdx * rowSize * ConvGemmPanelWidth;
+                const unsigned int firstChannel = panelIdx * ConvGemmPanelWidth;
+                const unsigned int numChannels = std::min(ConvGemmPanelWidth, outputChannels - firstChannel);
+
+                for (unsigned int firstRow = 0; firstRow < numPixels; firstRow += RowBlock)
+                {
+                    const unsigned int numRows = std::min(RowBlock, numPixels - firstRow);
+
+                    float accumulator[RowBlock][ConvGemmPanelWidth];
+                    for (unsigned int r = 0; r < RowBlock; ++r)
+                    {
+                        for (unsigned int n = 0; n < ConvGemmPanelWidth; ++n)
+                        {
+                            accumulator[r][n] = (biasData && n < numChannels) ? biasData[firstChannel + n] : 0.0f;
+                        }
+                    }
+
+                    const float* rows = columns + firstRow * rowSize;
+                    switch (numRows)
+                    {
+                        case 6: GemmMicroKernel<6>(rows, rowSize, panel, accumulator); break;
+                        case 5: GemmMicroKernel<5>(rows, rowSize, panel, accumulator); break;
+                        case 4: GemmMicroKernel<4>(rows, rowSize, panel, accumulator); break;
+                        case 3: GemmMicroKernel<3>(rows, rowSize, panel, accumulator); break;
+                        case 2: GemmMicroKernel<2>(rows, rowSize, panel, accumulator); break;
+                        default: GemmMicroKernel<1>(rows, rowSize, panel, accumulator); break;
+                    }
+
+                    for (unsigned int r = 0; r < numRows; ++r)
+                    {
+                        const unsigned int pixel = firstPixel + firstRow + r;
+                        for (unsigned int n = 0; n < numChannels; ++n)
+                        {
+                            const float value = std::min(std::max(accumulator[r][n], outputMin), outputMax);
+                            if (p.m_IsNhwc)
+                            {
+                                batchOutput[pixel * outputChannels + firstChannel + n] = value;
+                            }
+                            else
+                            {
+                                batchOutput[(firstChannel + n) * outputPixels + pixel] = value;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+} //namespace armnn
@@ -0,0 +1,62 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace armnn
+{
+
+/// Number of output channels held by one panel of a packed convolution filter.
+constexpr unsigned int ConvGemmPanelWidth = 8;
+
+/// Returns true if the float32 im2col/GEMM convolution path can be used for the given tensors.
+/// The bias info is optional and should be nullptr when bias is disabled.
+bool IsConvolveGemmSupported(const TensorInfo& inputInfo,
+                             const TensorInfo& filterInfo,
+                             const TensorInfo& outputInfo,
+                             const TensorInfo* biasInfo);
+
+/// Returns the number of floats needed to hold the packed version of a filter with the given shape.
+unsigned int GetPackedConvolutionFilterSize(const TensorShape& filterShape, DataLayout dataLayout);
+
+/// Packs a Conv2d filter ([O,H,W,I] for NHWC, [O,I,H,W] for NCHW) into panels of ConvGemmPanelWidth output
+/// channels. Each panel is laid out as [K][ConvGemmPanelWidth] where K = H * W * I is ordered (y, x, channel),
+/// with the trailing panel zero padded.
+void PackConvolutionFilter(const TensorShape& filterShape,
+                           const float* filterData,
+                           DataLayout dataLayout,
+                           float* packedFilter);
+
+std::vector<float> PackConvolutionFilter(const TensorShape& filterShape,
+                                         const float* filterData,
+                                         DataLayout dataLayout);
+
+/// Float32 Conv2d implemented as a cache blocked im2col + GEMM, using a filter previously packed by
+/// PackConvolutionFilter(). The bias data may be nullptr when bias is disabled. The output is clamped to
+/// [outputMin, outputMax] as it is written, which applies a fused ReLu or BoundedReLu.
+void ConvolveGemm(const TensorShape& inputShape,
+                  const float* inputData,
+                  const TensorShape& outputShape,
+                  float* outputData,
+                  const TensorShape& filterShape,
+                  const float* packedFilter,
+                  const float* biasData,
+                  DataLayout dataLayout,
+                  unsigned int paddingTop,
+                  unsigned int paddingLeft,
+                  unsigned int xStride,
+                  unsigned int yStride,
+                  unsigned int xDilation,
+                  unsigned int yDilation,
+                  float outputMin = -std::numeric_limits<float>::infinity(),
+                  float outputMax = std::numeric_limits<float>::infinity());
+
+} //namespace armnn
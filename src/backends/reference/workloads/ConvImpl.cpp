@@ -5,6 +5,10 @@
 
 #include "ConvImpl.hpp"
 
+#include "RefTaskPool.hpp"
+
+#include <backendsCommon/ScratchArena.hpp>
+
 #include <cmath>
 #include <limits>
 
@@ -86,6 +90,34 @@ void Convolve(const TensorShape& rInputShape,
     {
         throw InvalidArgumentException("Bias is enabled but the bias data is invalid");
     }
+
+    const std::vector<float> filterVec = rFilterDecoder.DecodeTensor(rFilterShape, depthwise);
+
+    const TensorShape biasShape{rOutputShape[armnnUtils::DataLayoutIndexed(dataLayout).GetChannelsIndex()]};
+    const std::vector<float> biasVec = biasEnabled ? pBiasDecoder->DecodeTensor(biasShape) : std::vector<float>();
+
+    Convolve(rInputShape, rInputDecoder, rOutputShape, rOutputEncoder, rFilterShape, filterVec,
+             biasEnabled, biasVec, dataLayout, paddingTop, paddingLeft, xStride, yStride,
+             xDilation, yDilation, depthwise);
+}
+
+void Convolve(const TensorShape& rInputShape,
+              Decoder<float>& rInputDecoder,
+              const TensorShape& rOutputShape,
+              Encoder<float>& rOutputEncoder,
+              const TensorShape& rFilterShape,
+              const std::vector<float>& filterVec,
+              bool biasEnabled,
+              const std::vector<float>& biasVec,
+              DataLayout dataLayout,
+              unsigned int paddingTop,
+              unsigned int paddingLeft,
+              unsigned int xStride,
+              unsigned int yStride,
+              unsigned int xDilation,
+              unsigned int yDilation,
+              bool depthwise)
+{
     const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
 
     const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
@@ -108,16 +140,24 @@ void Convolve(const TensorShape& rInputShape,
     const unsigned int filterHeight = depthwise ? rFilterShape[1] : rFilterShape[heightIndex];
     const unsigned int filterWidth  = depthwise ? rFilterShape[2] : rFilterShape[widthIndex];
 
-    const std::vector<float> inputVec = rInputDecoder.DecodeTensor(rInputShape);
-    const std::vector<float> filterVec = rFilterDecoder.DecodeTensor(rFilterShape, depthwise);
+    if (filterVec.size() < rFilterShape.GetNumElements() || (biasEnabled && biasVec.size() < outputChannels))
+    {
+        throw InvalidArgumentException("Convolve: the decoded filter or bias does not match its shape");
+    }
 
-    const TensorShape biasShape{outputChannels};
-    const std::vector<float> biasVec = biasEnabled ? pBiasDecoder->DecodeTensor(biasShape) : std::vector<float>();
+    ScratchVector<float> inputVec(rInputShape.GetNumElements());
+    rInputDecoder[0];
+    rInputDecoder.DecodeRange(0, rInputShape.GetNumElements(), inputVec.data());
+    ScratchVector<float> outputVec(rOutputShape.GetNumElements());
 
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+    // Every (batch, output channel) pair writes its own output elements, so they can be computed in parallel.
+    ParallelFor(batchSize * outputChannels, 1, [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+        for (unsigned int item = begin; item < end; ++item)
         {
+            const unsigned int batchIdx = item / outputChannels;
+            const unsigned int cOutput  = item % outputChannels;
+
             for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
             {
                 for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
@@ -224,12 +264,14 @@ void Convolve(const TensorShape& rInputShape,
                                  xOutput;
                     }
 
-                    rOutputEncoder[outIdx];
-                    rOutputEncoder.Set(sum);
+                    outputVec[outIdx] = sum;
                 }
             }
         }
-    }
+    });
+
+    rOutputEncoder[0];
+    rOutputEncoder.EncodeRange(0, rOutputShape.GetNumElements(), outputVec.data());
 }
 
 } // namespace armnn
@@ -61,4 +61,23 @@ void Convolve(const TensorShape& rInputShape,
               unsigned int xDilation,
               unsigned int yDilation,
               bool depthwise = false);
+
+/// As above, but with the filter and bias already decoded (e.g. because they are constant and were decoded once
+/// when the workload was first executed). The bias vector is ignored when bias is disabled.
+void Convolve(const TensorShape& rInputShape,
+              Decoder<float>& rInputDecoder,
+              const TensorShape& rOutputShape,
+              Encoder<float>& rOutputEncoder,
+              const TensorShape& rFilterShape,
+              const std::vector<float>& filterVec,
+              bool biasEnabled,
+              const std::vector<float>& biasVec,
+              DataLayout dataLayout,
+              unsigned int paddingTop,
+              unsigned int paddingLeft,
+              unsigned int xStride,
+              unsigned int yStride,
+              unsigned int xDilation,
+              unsigned int yDilation,
+              bool depthwise = false);
 } //namespace armnn
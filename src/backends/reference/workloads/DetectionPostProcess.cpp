@@ -6,6 +6,7 @@
 #include "DetectionPostProcess.hpp"
 
 #include <armnn/utility/NumericCast.hpp>
+#include <backendsCommon/ScratchArena.hpp>
 
 #include <algorithm>
 #include <numeric>
@@ -13,13 +14,18 @@
 namespace armnn
 {
 
-std::vector<unsigned int> GenerateRangeK(unsigned int k)
+namespace
 {
-    std::vector<unsigned int> range(k);
+
+ScratchVector<unsigned int> GenerateRangeK(unsigned int k)
+{
+    ScratchVector<unsigned int> range(k);
     std::iota(range.begin(), range.end(), 0);
     return range;
 }
 
+} // anonymous namespace
+
 void TopKSort(unsigned int k, unsigned int* indices, const float* values, unsigned int numElement)
 {
     std::partial_sort(indices, indices + k, indices + numElement,
@@ -45,16 +51,22 @@ float IntersectionOverUnion(const float* boxI, const float* boxJ)
     return areaIntersection / areaUnion;
 }
 
-std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
-                                            const std::vector<float>& boxCorners,
-                                            const std::vector<float>& scores,
-                                            float nmsScoreThreshold,
-                                            unsigned int maxDetection,
-                                            float nmsIouThreshold)
+namespace
+{
+
+// Takes all of its temporary memory from the ScratchArena of the executing network, if there is one.
+ScratchVector<unsigned int> NonMaxSuppressionImpl(unsigned int numBoxes,
+                                                  const float* boxCorners,
+                                                  const float* scores,
+                                                  float nmsScoreThreshold,
+                                                  unsigned int maxDetection,
+                                                  float nmsIouThreshold)
 {
     // Select boxes that have scores above a given threshold.
-    std::vector<float> scoresAboveThreshold;
-    std::vector<unsigned int> indicesAboveThreshold;
+    ScratchVector<float> scoresAboveThreshold;
+    ScratchVector<unsigned int> indicesAboveThreshold;
+    scoresAboveThreshold.reserve(numBoxes);
+    indicesAboveThreshold.reserve(numBoxes);
     for (unsigned int i = 0; i < numBoxes; ++i)
     {
         if (scores[i] >= nmsScoreThreshold)
@@ -66,13 +78,14 @@ std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
 
     // Sort the indices based on scores.
     unsigned int numAboveThreshold = armnn::numeric_cast<unsigned int>(scoresAboveThreshold.size());
-    std::vector<unsigned int> sortedIndices = GenerateRangeK(numAboveThreshold);
+    ScratchVector<unsigned int> sortedIndices = GenerateRangeK(numAboveThreshold);
     TopKSort(numAboveThreshold, sortedIndices.data(), scoresAboveThreshold.data(), numAboveThreshold);
 
     // Number of output cannot be more than max detections specified in the option.
     unsigned int numOutput = std::min(maxDetection, numAboveThreshold);
-    std::vector<unsigned int> outputIndices;
-    std::vector<bool> visited(numAboveThreshold, false);
+    ScratchVector<unsigned int> outputIndices;
+    outputIndices.reserve(numOutput);
+    ScratchVector<bool> visited(numAboveThreshold, false);
 
     // Prune out the boxes with high intersection over union by keeping the box with higher score.
     for (unsigned int i = 0; i < numAboveThreshold; ++i)
@@ -98,13 +111,28 @@ std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
     return outputIndices;
 }
 
+} // anonymous namespace
+
+std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
+                                            const std::vector<float>& boxCorners,
+                                            const std::vector<float>& scores,
+                                            float nmsScoreThreshold,
+                                            unsigned int maxDetection,
+                                            float nmsIouThreshold)
+{
+    const ScratchVector<unsigned int> outputIndices = NonMaxSuppressionImpl(numBoxes, boxCorners.data(), scores.data(),
+                                                                            nmsScoreThreshold, maxDetection,
+                                                                            nmsIouThreshold);
+    return std::vector<unsigned int>(outputIndices.begin(), outputIndices.end());
+}
+
 void AllocateOutputData(unsigned int numOutput,
                         unsigned int numSelected,
-                        const std::vector<float>& boxCorners,
-                        const std::vector<unsigned int>& outputIndices,
-                        const std::vector<unsigned int>& selectedBoxes,
-                        const std::vector<unsigned int>& selectedClasses,
-                        const std::vector<float>& selectedScores,
+                        const ScratchVector<float>& boxCorners,
+                        const ScratchVector<unsigned int>& outputIndices,
+                        const ScratchVector<unsigned int>& selectedBoxes,
+                        const ScratchVector<unsigned int>& selectedClasses,
+                        const ScratchVector<float>& selectedScores,
                         float* detectionBoxes,
                         float* detectionScores,
                         float* detectionClasses,
@@ -155,7 +183,7 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
 
     // Transform center-size format which is (ycenter, xcenter, height, width) to box-corner format,
     // which represents the lower left corner and the upper right corner (ymin, xmin, ymax, xmax)
-    std::vector<float> boxCorners(boxEncodingsInfo.GetNumElements());
+    ScratchVector<float> boxCorners(boxEncodingsInfo.GetNumElements());
 
     const unsigned int numBoxes  = boxEncodingsInfo.GetShape()[1];
     const unsigned int numScores = scoresInfo.GetNumElements();
@@ -214,29 +242,28 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
     unsigned int numClassesWithBg = desc.m_NumClasses + 1;
 
     // Decode scores
-    std::vector<float> decodedScores;
-    decodedScores.reserve(numScores);
-
-    for (unsigned int i = 0u; i < numScores; ++i)
-    {
-        decodedScores.emplace_back(scores.Get());
-        ++scores;
-    }
+    ScratchVector<float> decodedScores(numScores);
+    scores.DecodeRange(0, numScores, decodedScores.data());
 
     // Perform Non Max Suppression.
     if (desc.m_UseRegularNms)
     {
         // Perform Regular NMS.
         // For each class, perform NMS and select max detection numbers of the highest score across all classes.
-        std::vector<float> classScores(numBoxes);
+        ScratchVector<float> classScores(numBoxes);
+
+        // Each class selects at most m_DetectionsPerClass boxes.
+        const size_t maxSelected = static_cast<size_t>(desc.m_NumClasses) *
+                                   std::min(desc.m_DetectionsPerClass, numBoxes);
 
-        std::vector<unsigned int> selectedBoxesAfterNms;
-        selectedBoxesAfterNms.reserve(numBoxes);
+        ScratchVector<unsigned int> selectedBoxesAfterNms;
+        selectedBoxesAfterNms.reserve(maxSelected);
 
-        std::vector<float> selectedScoresAfterNms;
-        selectedBoxesAfterNms.reserve(numScores);
+        ScratchVector<float> selectedScoresAfterNms;
+        selectedScoresAfterNms.reserve(maxSelected);
 
-        std::vector<unsigned int> selectedClasses;
+        ScratchVector<unsigned int> selectedClasses;
+        selectedClasses.reserve(maxSelected);
 
         for (unsigned int c = 0; c < desc.m_NumClasses; ++c)
         {
@@ -245,12 +272,12 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
             {
                 classScores[i] = decodedScores[i * numClassesWithBg + c + 1];
             }
-            std::vector<unsigned int> selectedIndices = NonMaxSuppression(numBoxes,
-                                                                          boxCorners,
-                                                                          classScores,
-                                                                          desc.m_NmsScoreThreshold,
-                                                                          desc.m_DetectionsPerClass,
-                                                                          desc.m_NmsIouThreshold);
+            const ScratchVector<unsigned int> selectedIndices = NonMaxSuppressionImpl(numBoxes,
+                                                                                      boxCorners.data(),
+                                                                                      classScores.data(),
+                                                                                      desc.m_NmsScoreThreshold,
+                                                                                      desc.m_DetectionsPerClass,
+                                                                                      desc.m_NmsIouThreshold);
 
             for (unsigned int i = 0; i < selectedIndices.size(); ++i)
             {
@@ -265,7 +292,7 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
         unsigned int numOutput = std::min(desc.m_MaxDetections,  numSelected);
 
         // Sort the max scores among the selected indices.
-        std::vector<unsigned int> outputIndices = GenerateRangeK(numSelected);
+        ScratchVector<unsigned int> outputIndices = GenerateRangeK(numSelected);
         TopKSort(numOutput, outputIndices.data(), selectedScoresAfterNms.data(), numSelected);
 
         AllocateOutputData(detectionBoxesInfo.GetShape()[1], numOutput, boxCorners, outputIndices,
@@ -278,16 +305,20 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
         // Select max scores of boxes and perform NMS on max scores,
         // select max detection numbers of the highest score
         unsigned int numClassesPerBox = std::min(desc.m_MaxClassesPerDetection, desc.m_NumClasses);
-        std::vector<float> maxScores;
-        std::vector<unsigned int>boxIndices;
-        std::vector<unsigned int>maxScoreClasses;
-
+        ScratchVector<float> maxScores;
+        ScratchVector<unsigned int> boxIndices;
+        ScratchVector<unsigned int> maxScoreClasses;
+        maxScores.reserve(numBoxes * numClassesPerBox);
+        boxIndices.reserve(numBoxes * numClassesPerBox);
+        maxScoreClasses.reserve(numBoxes * numClassesPerBox);
+
+        ScratchVector<unsigned int> maxScoreIndices(desc.m_NumClasses);
         for (unsigned int box = 0; box < numBoxes; ++box)
         {
             unsigned int scoreIndex = box * numClassesWithBg + 1;
 
             // Get the max scores of the box.
-            std::vector<unsigned int> maxScoreIndices = GenerateRangeK(desc.m_NumClasses);
+            std::iota(maxScoreIndices.begin(), maxScoreIndices.end(), 0);
             TopKSort(numClassesPerBox, maxScoreIndices.data(),
                 decodedScores.data() + scoreIndex, desc.m_NumClasses);
 
@@ -300,10 +331,11 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
         }
 
         // Perform NMS on max scores
-        std::vector<unsigned int> selectedIndices = NonMaxSuppression(numBoxes, boxCorners, maxScores,
-                                                                      desc.m_NmsScoreThreshold,
-                                                                      desc.m_MaxDetections,
-                                                                      desc.m_NmsIouThreshold);
+        const ScratchVector<unsigned int> selectedIndices = NonMaxSuppressionImpl(numBoxes, boxCorners.data(),
+                                                                                  maxScores.data(),
+                                                                                  desc.m_NmsScoreThreshold,
+                                                                                  desc.m_MaxDetections,
+                                                                                  desc.m_NmsIouThreshold);
 
         unsigned int numSelected = armnn::numeric_cast<unsigned int>(selectedIndices.size());
         unsigned int numOutput = std::min(desc.m_MaxDetections,  numSelected);
@@ -5,8 +5,11 @@
 
 #include "FullyConnected.hpp"
 
+#include "RefTaskPool.hpp"
 #include "RefWorkloadUtils.hpp"
 
+#include <backendsCommon/ScratchArena.hpp>
+
 namespace armnn
 {
 
@@ -21,47 +24,71 @@ void FullyConnected(const TensorShape& rInputShape,
                     const unsigned int K,
                     const bool transposeWeights)
 {
-    // Perform FullyConnected implementation
-    unsigned int outputSize = rOutputShape[1];
-
-    const std::vector<float> decodedInputs = rInputDecoder.DecodeTensor(rInputShape);
     const std::vector<float> decodedWeights = rWeightDecoder.DecodeTensor(rWeightsShape);
 
-    const TensorShape biasShape{outputSize};
+    const TensorShape biasShape{rOutputShape[1]};
 
     const std::vector<float> decodedBiases = biasEnabled ? pBiasDecoder->DecodeTensor(biasShape) : std::vector<float>();
 
+    FullyConnected(rInputShape, rInputDecoder, rOutputShape, rOutputEncoder, decodedWeights, decodedBiases,
+                   biasEnabled, K, transposeWeights);
+}
+
+void FullyConnected(const TensorShape& rInputShape,
+                    Decoder<float>& rInputDecoder,
+                    const TensorShape& rOutputShape,
+                    Encoder<float>& rOutputEncoder,
+                    const std::vector<float>& decodedWeights,
+                    const std::vector<float>& decodedBiases,
+                    const bool biasEnabled,
+                    const unsigned int K,
+                    const bool transposeWeights)
+{
+    // Perform FullyConnected implementation
+    unsigned int outputSize = rOutputShape[1];
+
+    ScratchVector<float> decodedInputs(rInputShape.GetNumElements());
+    rInputDecoder[0];
+    rInputDecoder.DecodeRange(0, rInputShape.GetNumElements(), decodedInputs.data());
+    const unsigned int batchSize = rInputShape[0];
+    ScratchVector<float> outputValues(batchSize * outputSize);
 
-    for (unsigned int n = 0; n < rInputShape[0]; n++)
+    // Split the output channels rather than the batches, as fully connected layers usually run with a batch of one.
+    ParallelFor(outputSize, 1, [&](unsigned int firstChannel, unsigned int lastChannel)
     {
-        for (unsigned int channelOutput = 0; channelOutput < outputSize; channelOutput++)
+        for (unsigned int n = 0; n < batchSize; n++)
         {
-            float outval = 0.f;
-
-            for (unsigned int channelInput = 0; channelInput < K; channelInput++)
+            for (unsigned int channelOutput = firstChannel; channelOutput < lastChannel; channelOutput++)
             {
-                float weight;
-                if (transposeWeights)
+                float outval = 0.f;
+
+                for (unsigned int channelInput = 0; channelInput < K; channelInput++)
                 {
-                    weight = decodedWeights[channelOutput * K + channelInput];
+                    float weight;
+                    if (transposeWeights)
+                    {
+                        weight = decodedWeights[channelOutput * K + channelInput];
+                    }
+                    else
+                    {
+                        weight = decodedWeights[channelInput * outputSize + channelOutput];
+                    }
+
+                    outval += weight * decodedInputs[n * K + channelInput];
                 }
-                else
+
+                if (biasEnabled)
                 {
-                    weight = decodedWeights[channelInput * outputSize + channelOutput];
+                    outval += decodedBiases[channelOutput];
                 }
 
-                outval += weight * decodedInputs[n * K + channelInput];
-            }
-
-            if (biasEnabled)
-            {
-                outval += decodedBiases[channelOutput];
+                outputValues[n * outputSize + channelOutput] = outval;
             }
-
-            rOutputEncoder[n * outputSize + channelOutput];
-            rOutputEncoder.Set(outval);
         }
-    }
+    });
+
+    rOutputEncoder[0];
+    rOutputEncoder.EncodeRange(0, batchSize * outputSize, outputValues.data());
 }
 
 } //namespace armnn
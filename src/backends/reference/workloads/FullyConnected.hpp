@@ -26,4 +26,16 @@ void FullyConnected(const TensorShape& rInputShape,
                     unsigned int K,
                     bool transposeWeights);
 
+/// As above, but with the weights and bias already decoded (e.g. because they are constant and were decoded once
+/// when the workload was first executed). The bias vector is ignored when bias is disabled.
+void FullyConnected(const TensorShape& rInputShape,
+                    Decoder<float>& rInputDecoder,
+                    const TensorShape& rOutputShape,
+                    Encoder<float>& rOutputEncoder,
+                    const std::vector<float>& decodedWeights,
+                    const std::vector<float>& decodedBiases,
+                    bool biasEnabled,
+                    unsigned int K,
+                    bool transposeWeights);
+
 } //namespace armnn
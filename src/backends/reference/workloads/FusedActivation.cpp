@@ -0,0 +1,56 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FusedActivation.hpp"
+
+#include "Activation.hpp"
+#include "Decoders.hpp"
+#include "Encoders.hpp"
+
+#include <limits>
+#include <memory>
+
+namespace armnn
+{
+
+FusedActivation::FusedActivation(const ActivationDescriptor* descriptor)
+    : m_IsEnabled(descriptor != nullptr)
+    , m_IsClamp(false)
+    , m_LowerBound(-std::numeric_limits<float>::infinity())
+    , m_UpperBound(std::numeric_limits<float>::infinity())
+{
+    if (!descriptor)
+    {
+        return;
+    }
+
+    m_Descriptor = *descriptor;
+    if (m_Descriptor.m_Function == ActivationFunction::ReLu)
+    {
+        m_IsClamp = true;
+        m_LowerBound = 0.0f;
+    }
+    else if (m_Descriptor.m_Function == ActivationFunction::BoundedReLu)
+    {
+        m_IsClamp = true;
+        m_LowerBound = m_Descriptor.m_B;
+        m_UpperBound = m_Descriptor.m_A;
+    }
+}
+
+void FusedActivation::Apply(const TensorInfo& outputInfo, void* outputData, bool clampApplied) const
+{
+    if (!m_IsEnabled || (m_IsClamp && clampApplied))
+    {
+        return;
+    }
+
+    // Every element is decoded before the same element is encoded, so the output can be updated in place.
+    std::unique_ptr<Decoder<float>> decoder = MakeDecoder<float>(outputInfo, outputData);
+    std::unique_ptr<Encoder<float>> encoder = MakeEncoder<float>(outputInfo, outputData);
+    Activation(*decoder, *encoder, outputInfo, m_Descriptor.m_Function, m_Descriptor.m_A, m_Descriptor.m_B);
+}
+
+} //namespace armnn
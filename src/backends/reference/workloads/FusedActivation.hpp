@@ -0,0 +1,46 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+namespace armnn
+{
+
+/// Activation fused into a Conv2d, DepthwiseConv2d or FullyConnected workload by RefBackend::OptimizeSubgraphView,
+/// taken from the additional information of the workload's queue descriptor.
+///
+/// ReLu and BoundedReLu only clamp their input, so the kernels which can clamp their output as they write it apply
+/// them there. Every other function is applied in place to the whole output once the kernel has finished.
+class FusedActivation
+{
+public:
+    /// The descriptor may be nullptr, when no activation was fused into the workload.
+    explicit FusedActivation(const ActivationDescriptor* descriptor);
+
+    bool IsEnabled() const { return m_IsEnabled; }
+
+    /// Returns true if the activation does nothing other than clamp its input to [GetLowerBound(), GetUpperBound()].
+    bool IsClamp() const { return m_IsClamp; }
+
+    /// Bounds of a clamp, or of the whole float range otherwise.
+    float GetLowerBound() const { return m_LowerBound; }
+    float GetUpperBound() const { return m_UpperBound; }
+
+    /// Applies the activation in place to the output of the workload. Set clampApplied when the kernel has already
+    /// clamped its output to the bounds, in which case only non clamp activations are applied.
+    void Apply(const TensorInfo& outputInfo, void* outputData, bool clampApplied) const;
+
+private:
+    bool m_IsEnabled;
+    bool m_IsClamp;
+    float m_LowerBound;
+    float m_UpperBound;
+    ActivationDescriptor m_Descriptor;
+};
+
+} //namespace armnn
@@ -0,0 +1,449 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FusedElementwise.hpp"
+
+#include "Abs.hpp"
+#include "Activation.hpp"
+#include "Broadcast.hpp"
+#include "Ceil.hpp"
+#include "Exp.hpp"
+#include "Log.hpp"
+#include "Maximum.hpp"
+#include "Minimum.hpp"
+#include "Power.hpp"
+#include "Rsqrt.hpp"
+#include "Sin.hpp"
+#include "Sqrt.hpp"
+#include "SquaredDifference.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// An operand which is uniform along the row only holds its first element, which is combined with every element of
+/// the other operand.
+template <typename Functor>
+void ApplyBinary(const float* in0, bool isUniform0, const float* in1, bool isUniform1, float* out, unsigned int count)
+{
+    const Functor function;
+    if (isUniform0 == isUniform1)
+    {
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            out[i] = function(in0[i], in1[i]);
+        }
+    }
+    else if (isUniform0)
+    {
+        const float value0 = in0[0];
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            out[i] = function(value0, in1[i]);
+        }
+    }
+    else
+    {
+        const float value1 = in1[0];
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            out[i] = function(in0[i], value1);
+        }
+    }
+}
+
+template <typename Functor>
+void ApplyUnary(const float* in, float* out, unsigned int count)
+{
+    const Functor function;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        out[i] = function(in[i]);
+    }
+}
+
+void ApplyOperation(const FusedElementwise::Operation& operation,
+                    const float* in0,
+                    bool isUniform0,
+                    const float* in1,
+                    bool isUniform1,
+                    float* out,
+                    unsigned int count)
+{
+    switch (operation.m_Kind)
+    {
+        case FusedElementwise::Kind::Binary:
+        {
+            switch (operation.m_BinaryOperation)
+            {
+                case BinaryOperation::Add:
+                    ApplyBinary<std::plus<float>>(in0, isUniform0, in1, isUniform1, out, count);
+                    break;
+                case BinaryOperation::Div:
+                    ApplyBinary<std::divides<float>>(in0, isUniform0, in1, isUniform1, out, count);
+                    break;
+                case BinaryOperation::Maximum:
+                    ApplyBinary<maximum<float>>(in0, isUniform0, in1, isUniform1, out, count);
+                    break;
+                case BinaryOperation::Minimum:
+                    ApplyBinary<minimum<float>>(in0, isUniform0, in1, isUniform1, out, count);
+                    break;
+                case BinaryOperation::Mul:
+                    ApplyBinary<std::multiplies<float>>(in0, isUniform0, in1, isUniform1, out, count);
+                    break;
+                case BinaryOperation::Sub:
+                    ApplyBinary<std::minus<float>>(in0, isUniform0, in1, isUniform1, out, count);
+                    break;
+                case BinaryOperation::SqDiff:
+                    ApplyBinary<squaredDifference<float>>(in0, isUniform0, in1, isUniform1, out, count);
+                    break;
+                case BinaryOperation::Power:
+                    ApplyBinary<power<float>>(in0, isUniform0, in1, isUniform1, out, count);
+                    break;
+                default:
+                    throw InvalidArgumentException(std::string("Unsupported binary operation ") +
+                                                   GetBinaryOperationAsCString(operation.m_BinaryOperation),
+                                                   CHECK_LOCATION());
+            }
+            break;
+        }
+        case FusedElementwise::Kind::Unary:
+        {
+            switch (operation.m_UnaryOperation)
+            {
+                case UnaryOperation::Abs:
+                    ApplyUnary<abs<float>>(in0, out, count);
+                    break;
+                case UnaryOperation::Ceil:
+                    ApplyUnary<ceil<float>>(in0, out, count);
+                    break;
+                case UnaryOperation::Exp:
+                    ApplyUnary<exp<float>>(in0, out, count);
+                    break;
+                case UnaryOperation::Log:
+                    ApplyUnary<log<float>>(in0, out, count);
+                    break;
+                case UnaryOperation::Neg:
+                    ApplyUnary<std::negate<float>>(in0, out, count);
+                    break;
+                case UnaryOperation::Rsqrt:
+                    ApplyUnary<rsqrt<float>>(in0, out, count);
+                    break;
+                case UnaryOperation::Sin:
+                    ApplyUnary<sin<float>>(in0, out, count);
+                    break;
+                case UnaryOperation::Sqrt:
+                    ApplyUnary<sqrt<float>>(in0, out, count);
+                    break;
+                default:
+                    throw InvalidArgumentException(std::string("Unsupported unary operation ") +
+                                                   GetUnaryOperationAsCString(operation.m_UnaryOperation),
+                                                   CHECK_LOCATION());
+            }
+            break;
+        }
+        case FusedElementwise::Kind::Activation:
+        {
+            const ActivationDescriptor& descriptor = operation.m_Activation;
+            if (descriptor.m_Function == ActivationFunction::ReLu)
+            {
+                // The commonest activations get loops of their own rather than a switch per element.
+                for (unsigned int i = 0; i < count; ++i)
+                {
+                    out[i] = std::max(0.0f, in0[i]);
+                }
+            }
+            else if (descriptor.m_Function == ActivationFunction::BoundedReLu)
+            {
+                for (unsigned int i = 0; i < count; ++i)
+                {
+                    out[i] = std::min(descriptor.m_A, std::max(descriptor.m_B, in0[i]));
+                }
+            }
+            else
+            {
+                for (unsigned int i = 0; i < count; ++i)
+                {
+                    out[i] = Activation(in0[i], descriptor.m_Function, descriptor.m_A, descriptor.m_B);
+                }
+            }
+            break;
+        }
+    }
+}
+
+} // anonymous namespace
+
+FusedElementwise::FusedElementwise(unsigned int numInputs)
+    : m_NumInputs(numInputs)
+{}
+
+bool FusedElementwise::IsSupported(BinaryOperation operation)
+{
+    switch (operation)
+    {
+        case BinaryOperation::Add:
+        case BinaryOperation::Div:
+        case BinaryOperation::Maximum:
+        case BinaryOperation::Minimum:
+        case BinaryOperation::Mul:
+        case BinaryOperation::Sub:
+        case BinaryOperation::SqDiff:
+        case BinaryOperation::Power:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool FusedElementwise::IsSupported(UnaryOperation operation)
+{
+    switch (operation)
+    {
+        case UnaryOperation::Abs:
+        case UnaryOperation::Ceil:
+        case UnaryOperation::Exp:
+        case UnaryOperation::Log:
+        case UnaryOperation::Neg:
+        case UnaryOperation::Rsqrt:
+        case UnaryOperation::Sin:
+        case UnaryOperation::Sqrt:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool FusedElementwise::IsSupported(ActivationFunction function)
+{
+    switch (function)
+    {
+        case ActivationFunction::Sigmoid:
+        case ActivationFunction::TanH:
+        case ActivationFunction::Linear:
+        case ActivationFunction::ReLu:
+        case ActivationFunction::BoundedReLu:
+        case ActivationFunction::SoftReLu:
+        case ActivationFunction::LeakyReLu:
+        case ActivationFunction::Abs:
+        case ActivationFunction::Sqrt:
+        case ActivationFunction::Square:
+        case ActivationFunction::Elu:
+        case ActivationFunction::HardSwish:
+        case ActivationFunction::Gelu:
+            return true;
+        default:
+            return false;
+    }
+}
+
+unsigned int FusedElementwise::AddBinary(BinaryOperation operation, unsigned int operand0, unsigned int operand1)
+{
+    Operation binary;
+    binary.m_Kind = Kind::Binary;
+    binary.m_BinaryOperation = operation;
+    binary.m_Operands[0] = operand0;
+    binary.m_Operands[1] = operand1;
+    return AddOperation(binary);
+}
+
+unsigned int FusedElementwise::AddUnary(UnaryOperation operation, unsigned int operand)
+{
+    Operation unary;
+    unary.m_Kind = Kind::Unary;
+    unary.m_UnaryOperation = operation;
+    unary.m_Operands[0] = operand;
+    return AddOperation(unary);
+}
+
+unsigned int FusedElementwise::AddActivation(const ActivationDescriptor& descriptor, unsigned int operand)
+{
+    Operation activation;
+    activation.m_Kind = Kind::Activation;
+    activation.m_Activation = descriptor;
+    activation.m_Operands[0] = operand;
+    return AddOperation(activation);
+}
+
+unsigned int FusedElementwise::AddOperation(const Operation& operation)
+{
+    const unsigned int result = m_NumInputs + static_cast<unsigned int>(m_Operations.size());
+    if (operation.m_Operands[0] >= result || operation.m_Operands[1] >= result)
+    {
+        throw InvalidArgumentException("FusedElementwise: operations can only use inputs or earlier results",
+                                       CHECK_LOCATION());
+    }
+    m_Operations.push_back(operation);
+    return result;
+}
+
+std::vector<uint8_t> FusedElementwise::Serialize() const
+{
+    // Every value is saved as a 32-bit word: the number of inputs and of operations, then the kind, the operation,
+    // the activation and the operands of each operation.
+    std::vector<uint32_t> words = { m_NumInputs, static_cast<uint32_t>(m_Operations.size()) };
+    for (const Operation& operation : m_Operations)
+    {
+        uint32_t a = 0;
+        uint32_t b = 0;
+        std::memcpy(&a, &operation.m_Activation.m_A, sizeof(a));
+        std::memcpy(&b, &operation.m_Activation.m_B, sizeof(b));
+        words.insert(words.end(), { static_cast<uint32_t>(operation.m_Kind),
+                                    static_cast<uint32_t>(operation.m_BinaryOperation),
+                                    static_cast<uint32_t>(operation.m_UnaryOperation),
+                                    static_cast<uint32_t>(operation.m_Activation.m_Function),
+                                    a,
+                                    b,
+                                    operation.m_Operands[0],
+                                    operation.m_Operands[1] });
+    }
+
+    std::vector<uint8_t> data(words.size() * sizeof(uint32_t));
+    std::memcpy(data.data(), words.data(), data.size());
+    return data;
+}
+
+std::unique_ptr<FusedElementwise> FusedElementwise::Deserialize(const std::vector<uint8_t>& data)
+{
+    constexpr size_t wordsPerOperation = 8;
+    std::vector<uint32_t> words(data.size() / sizeof(uint32_t));
+    std::memcpy(words.data(), data.data(), words.size() * sizeof(uint32_t));
+    if (words.size() < 2 || data.size() != words.size() * sizeof(uint32_t) ||
+        words.size() != 2 + words[1] * wordsPerOperation)
+    {
+        throw ParseException("FusedElementwise: invalid serialized chain");
+    }
+
+    auto fusedElementwise = std::make_unique<FusedElementwise>(words[0]);
+    for (size_t i = 2; i < words.size(); i += wordsPerOperation)
+    {
+        const auto binaryOperation = static_cast<BinaryOperation>(words[i + 1]);
+        const auto unaryOperation = static_cast<UnaryOperation>(words[i + 2]);
+        ActivationDescriptor activation;
+        activation.m_Function = static_cast<ActivationFunction>(words[i + 3]);
+        std::memcpy(&activation.m_A, &words[i + 4], sizeof(activation.m_A));
+        std::memcpy(&activation.m_B, &words[i + 5], sizeof(activation.m_B));
+
+        // Adding the operations checks their operands.
+        switch (static_cast<Kind>(words[i]))
+        {
+            case Kind::Binary:
+                if (!IsSupported(binaryOperation))
+                {
+                    throw ParseException("FusedElementwise: unsupported binary operation");
+                }
+                fusedElementwise->AddBinary(binaryOperation, words[i + 6], words[i + 7]);
+                break;
+            case Kind::Unary:
+                if (!IsSupported(unaryOperation))
+                {
+                    throw ParseException("FusedElementwise: unsupported unary operation");
+                }
+                fusedElementwise->AddUnary(unaryOperation, words[i + 6]);
+                break;
+            case Kind::Activation:
+                if (!IsSupported(activation.m_Function))
+                {
+                    throw ParseException("FusedElementwise: unsupported activation");
+                }
+                fusedElementwise->AddActivation(activation, words[i + 6]);
+                break;
+            default:
+                throw ParseException("FusedElementwise: invalid serialized chain");
+        }
+    }
+    return fusedElementwise;
+}
+
+void FusedElementwise::Execute(const std::vector<TensorShape>& inputShapes,
+                               const std::vector<std::unique_ptr<Decoder<float>>>& inputs,
+                               const TensorShape& outputShape,
+                               Encoder<float>& output) const
+{
+    if (inputs.size() != m_NumInputs || inputShapes.size() != m_NumInputs || m_Operations.empty())
+    {
+        throw InvalidArgumentException("FusedElementwise: the inputs do not match the fused operations",
+                                       CHECK_LOCATION());
+    }
+
+    const MultiBroadcastLoop loop(inputShapes, outputShape);
+    const unsigned int rowSize = loop.GetRowSize();
+    const unsigned int chunkSize = std::min(rowSize, RangeChunkSize);
+    const unsigned int numOperands = m_NumInputs + static_cast<unsigned int>(m_Operations.size());
+
+    // Operands which have the same value along a row, such as the statistics of a normalisation, only hold that one
+    // value: the inputs are decoded once per row rather than broadcast, and the operations which only use such
+    // operands are only evaluated once per row.
+    std::vector<char> isUniform(numOperands);
+    for (unsigned int i = 0; i < m_NumInputs; ++i)
+    {
+        isUniform[i] = loop.IsBroadcastAlongRow(i);
+    }
+    for (unsigned int op = 0; op < m_Operations.size(); ++op)
+    {
+        const Operation& operation = m_Operations[op];
+        isUniform[m_NumInputs + op] = isUniform[operation.m_Operands[0]]
+                                      && (operation.m_Kind != Kind::Binary || isUniform[operation.m_Operands[1]]);
+    }
+
+    // One chunk for every operand, small enough to stay in cache from the decoding of the inputs to the encoding of
+    // the output.
+    std::vector<float> operands(static_cast<size_t>(numOperands) * chunkSize);
+    auto operand = [&operands, chunkSize](unsigned int index)
+    {
+        return operands.data() + static_cast<size_t>(index) * chunkSize;
+    };
+
+    loop.ForEachRow([&](const std::vector<unsigned int>& inOffsets, unsigned int outOffset)
+    {
+        for (unsigned int start = 0; start < rowSize; start += chunkSize)
+        {
+            const unsigned int count = std::min(chunkSize, rowSize - start);
+
+            for (unsigned int i = 0; i < m_NumInputs; ++i)
+            {
+                if (isUniform[i])
+                {
+                    inputs[i]->DecodeRange(inOffsets[i], 1, operand(i));
+                }
+                else
+                {
+                    inputs[i]->DecodeRange(inOffsets[i] + start, count, operand(i));
+                }
+            }
+
+            for (unsigned int op = 0; op < m_Operations.size(); ++op)
+            {
+                const Operation& operation = m_Operations[op];
+                const unsigned int result = m_NumInputs + op;
+                ApplyOperation(operation,
+                               operand(operation.m_Operands[0]),
+                               isUniform[operation.m_Operands[0]],
+                               operand(operation.m_Operands[1]),
+                               isUniform[operation.m_Operands[1]],
+                               operand(result),
+                               isUniform[result] ? 1 : count);
+            }
+
+            float* result = operand(numOperands - 1);
+            if (isUniform[numOperands - 1])
+            {
+                std::fill(result + 1, result + count, result[0]);
+            }
+            output.EncodeRange(outOffset + start, count, result);
+        }
+    });
+}
+
+} //namespace armnn
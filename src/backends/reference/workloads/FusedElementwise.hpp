@@ -0,0 +1,81 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "BaseIterator.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+/// A chain of ElementwiseBinary, ElementwiseUnary and Activation layers which RefBackend::OptimizeSubgraphView fused
+/// into a single PreCompiled layer. It is the pre-compiled object of that layer, evaluated by
+/// RefFusedElementwiseWorkload.
+///
+/// The operations are evaluated in order, a chunk of one row of the output at a time, so the intermediate results
+/// only ever take a few kilobytes rather than a whole tensor each. Operands are numbered like registers: the inputs
+/// of the fused layer first, then the result of each operation. The result of the last operation is the output.
+class FusedElementwise
+{
+public:
+    enum class Kind
+    {
+        Binary,
+        Unary,
+        Activation
+    };
+
+    struct Operation
+    {
+        Kind m_Kind;
+        BinaryOperation m_BinaryOperation = BinaryOperation::Add;
+        UnaryOperation m_UnaryOperation = UnaryOperation::Abs;
+        ActivationDescriptor m_Activation;
+        /// The second operand is only used by binary operations.
+        unsigned int m_Operands[2] = { 0, 0 };
+    };
+
+    explicit FusedElementwise(unsigned int numInputs);
+
+    /// Returns true for the operations Execute() supports.
+    static bool IsSupported(BinaryOperation operation);
+    static bool IsSupported(UnaryOperation operation);
+    static bool IsSupported(ActivationFunction function);
+
+    /// Each add function returns the operand number of the result.
+    unsigned int AddBinary(BinaryOperation operation, unsigned int operand0, unsigned int operand1);
+    unsigned int AddUnary(UnaryOperation operation, unsigned int operand);
+    unsigned int AddActivation(const ActivationDescriptor& descriptor, unsigned int operand);
+
+    unsigned int GetNumInputs() const { return m_NumInputs; }
+    const std::vector<Operation>& GetOperations() const { return m_Operations; }
+
+    /// Serializes the chain, so that the optimized networks it is part of can be cached.
+    std::vector<uint8_t> Serialize() const;
+
+    /// Recreates a chain serialized by Serialize(). Throws a ParseException if the data is not a valid chain.
+    static std::unique_ptr<FusedElementwise> Deserialize(const std::vector<uint8_t>& data);
+
+    /// Evaluates the whole chain in one pass over the output. The inputs are broadcast to the shape of the output as
+    /// ElementwiseBinary does, so their shapes must have as many dimensions as the output.
+    void Execute(const std::vector<TensorShape>& inputShapes,
+                 const std::vector<std::unique_ptr<Decoder<float>>>& inputs,
+                 const TensorShape& outputShape,
+                 Encoder<float>& output) const;
+
+private:
+    unsigned int AddOperation(const Operation& operation);
+
+    unsigned int m_NumInputs;
+    std::vector<Operation> m_Operations;
+};
+
+} //namespace armnn
@@ -4,6 +4,7 @@
 //
 
 #include "Pooling2d.hpp"
+#include "RefTaskPool.hpp"
 
 #include <armnn/Exceptions.hpp>
 #include <armnn/Types.hpp>
@@ -179,11 +180,16 @@ void Pooling2d(Decoder<float>& rInputDecoder,
     }
 
     const std::vector<float> decodedInputVec = rInputDecoder.DecodeTensor(inputInfo.GetShape());
+    std::vector<float> outputValues(outputInfo.GetNumElements());
 
-    for (int n = 0; n < batchSize; n++)
+    // Every (batch, channel) pair writes its own output elements, so they can be pooled in parallel.
+    ParallelFor(armnn::numeric_cast<unsigned int>(batchSize * channels), 1, [&](unsigned int begin, unsigned int end)
     {
-        for (int c = 0; c < channels; c++)
+        for (unsigned int item = begin; item < end; item++)
         {
+            const int n = static_cast<int>(item) / channels;
+            const int c = static_cast<int>(item) % channels;
+
             for (int yOutput = 0; yOutput < heightOutput; yOutput++)
             {
                 //  Calculate values independent of the x axis
@@ -235,8 +241,7 @@ void Pooling2d(Decoder<float>& rInputDecoder,
                                           xOutput;
                         }
 
-                        rOutputEncoder[static_cast<unsigned int>(outputIndex)];
-                        rOutputEncoder.Set(result);
+                        outputValues[static_cast<unsigned int>(outputIndex)] = result;
                         continue;
                     }
 
@@ -294,12 +299,13 @@ void Pooling2d(Decoder<float>& rInputDecoder,
                                       xOutput;
                     }
 
-                    rOutputEncoder[static_cast<unsigned int>(outputIndex)];
-                    rOutputEncoder.Set(result);
+                    outputValues[static_cast<unsigned int>(outputIndex)] = result;
                 }
             }
         }
-    }
+    });
+
+    rOutputEncoder.EncodeRange(0, outputInfo.GetNumElements(), outputValues.data());
 }
 
 } //namespace armnn
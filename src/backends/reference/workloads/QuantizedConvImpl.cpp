@@ -0,0 +1,563 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "QuantizedConvImpl.hpp"
+
+#include "RefTaskPool.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace armnn
+{
+
+namespace
+{
+
+bool IsAsymmetric8BitType(DataType dataType)
+{
+    return dataType == DataType::QAsymmU8 || dataType == DataType::QAsymmS8;
+}
+
+int32_t ReadQuantizedWeight(const TensorInfo& weightsInfo, const void* weightsData, unsigned int index)
+{
+    switch (weightsInfo.GetDataType())
+    {
+        case DataType::QAsymmU8:
+            return static_cast<const uint8_t*>(weightsData)[index];
+        case DataType::QAsymmS8:
+        case DataType::QSymmS8:
+            return static_cast<const int8_t*>(weightsData)[index];
+        default:
+            throw InvalidArgumentException("Unsupported data type for quantized weights: " +
+                                           std::string(GetDataTypeName(weightsInfo.GetDataType())));
+    }
+}
+
+int16_t PrepareQuantizedWeight(const TensorInfo& weightsInfo, const void* weightsData, unsigned int index)
+{
+    // Per-axis weights are symmetric, so a single offset applies to every channel.
+    return static_cast<int16_t>(ReadQuantizedWeight(weightsInfo, weightsData, index) -
+                                weightsInfo.GetQuantizationOffset());
+}
+
+std::vector<float> GetWeightsScales(const TensorInfo& weightsInfo, unsigned int numOutputChannels)
+{
+    if (weightsInfo.HasPerAxisQuantization())
+    {
+        return weightsInfo.GetQuantizationScales();
+    }
+    return std::vector<float>(numOutputChannels, weightsInfo.GetQuantizationScale());
+}
+
+struct QuantizedConvGeometry
+{
+    unsigned int m_BatchSize;
+    unsigned int m_InputChannels;
+    unsigned int m_InputHeight;
+    unsigned int m_InputWidth;
+    unsigned int m_OutputChannels;
+    unsigned int m_OutputHeight;
+    unsigned int m_OutputWidth;
+    unsigned int m_FilterHeight;
+    unsigned int m_FilterWidth;
+    unsigned int m_PaddingTop;
+    unsigned int m_PaddingLeft;
+    unsigned int m_StrideX;
+    unsigned int m_StrideY;
+    unsigned int m_DilationX;
+    unsigned int m_DilationY;
+    bool m_IsNhwc;
+
+    unsigned int InputIndex(unsigned int batch, unsigned int y, unsigned int x, unsigned int c) const
+    {
+        return m_IsNhwc ? ((batch * m_InputHeight + y) * m_InputWidth + x) * m_InputChannels + c
+                        : ((batch * m_InputChannels + c) * m_InputHeight + y) * m_InputWidth + x;
+    }
+
+    unsigned int OutputIndex(unsigned int batch, unsigned int y, unsigned int x, unsigned int c) const
+    {
+        return m_IsNhwc ? ((batch * m_OutputHeight + y) * m_OutputWidth + x) * m_OutputChannels + c
+                        : ((batch * m_OutputChannels + c) * m_OutputHeight + y) * m_OutputWidth + x;
+    }
+
+    // Returns false if the filter tap lands in the padding, otherwise sets the input coordinate.
+    bool GetInputCoordinate(unsigned int output, unsigned int filter, bool isY, unsigned int& input) const
+    {
+        const unsigned int padded = isY ? output * m_StrideY + filter * m_DilationY
+                                        : output * m_StrideX + filter * m_DilationX;
+        const unsigned int padding = isY ? m_PaddingTop : m_PaddingLeft;
+        const unsigned int size = isY ? m_InputHeight : m_InputWidth;
+        if (padded < padding || padded >= size + padding)
+        {
+            return false;
+        }
+        input = padded - padding;
+        return true;
+    }
+};
+
+template<typename TIn, typename TOut>
+void QuantizedConvolveImpl(const QuantizedConvGeometry& g,
+                           const TIn* input,
+                           TOut* output,
+                           const int16_t* weights,
+                           const int32_t* bias,
+                           const QuantizedConvOutputStage& outputStage)
+{
+    const int32_t inputOffset = outputStage.GetInputOffset();
+    const unsigned int rowSize = g.m_FilterHeight * g.m_FilterWidth * g.m_InputChannels;
+
+    // Output rows of every batch are split across threads.
+    ParallelFor(g.m_BatchSize * g.m_OutputHeight, 1, [&](unsigned int firstRow, unsigned int lastRow)
+    {
+        // One im2col row of offset corrected inputs. Padding taps hold zero, i.e. the input offset.
+        std::vector<int16_t> row(rowSize);
+
+        for (unsigned int outputRow = firstRow; outputRow < lastRow; ++outputRow)
+        {
+            const unsigned int batchIdx = outputRow / g.m_OutputHeight;
+            const unsigned int yOutput  = outputRow % g.m_OutputHeight;
+            for (unsigned int xOutput = 0; xOutput < g.m_OutputWidth; ++xOutput)
+            {
+                int16_t* dst = row.data();
+                for (unsigned int yFilter = 0; yFilter < g.m_FilterHeight; ++yFilter)
+                {
+                    unsigned int yInput = 0;
+                    const bool yValid = g.GetInputCoordinate(yOutput, yFilter, true, yInput);
+                    for (unsigned int xFilter = 0; xFilter < g.m_FilterWidth; ++xFilter)
+                    {
+                        unsigned int xInput = 0;
+                        if (!yValid || !g.GetInputCoordinate(xOutput, xFilter, false, xInput))
+                        {
+                            std::fill_n(dst, g.m_InputChannels, static_cast<int16_t>(0));
+                        }
+                        else
+                        {
+                            for (unsigned int c = 0; c < g.m_InputChannels; ++c)
+                            {
+                                dst[c] = static_cast<int16_t>(input[g.InputIndex(batchIdx, yInput, xInput, c)] -
+                                                              inputOffset);
+                            }
+                        }
+                        dst += g.m_InputChannels;
+                    }
+                }
+
+                for (unsigned int cOutput = 0; cOutput < g.m_OutputChannels; ++cOutput)
+                {
+                    const int16_t* filterRow = weights + cOutput * rowSize;
+                    int32_t accumulator = bias ? bias[cOutput] : 0;
+                    for (unsigned int k = 0; k < rowSize; ++k)
+                    {
+                        accumulator += static_cast<int32_t>(row[k]) * static_cast<int32_t>(filterRow[k]);
+                    }
+                    output[g.OutputIndex(batchIdx, yOutput, xOutput, cOutput)] =
+                        static_cast<TOut>(outputStage.Requantize(accumulator, cOutput));
+                }
+            }
+        }
+    });
+}
+
+template<typename TIn, typename TOut>
+void QuantizedDepthwiseConvolveImpl(const QuantizedConvGeometry& g,
+                                    const TIn* input,
+                                    TOut* output,
+                                    const int16_t* weights,
+                                    const int32_t* bias,
+                                    const QuantizedConvOutputStage& outputStage)
+{
+    const int32_t inputOffset = outputStage.GetInputOffset();
+    const unsigned int outputChannels = g.m_OutputChannels;
+    const unsigned int depthMultiplier = outputChannels / g.m_InputChannels;
+
+    ParallelFor(g.m_BatchSize * g.m_OutputHeight, 1, [&](unsigned int firstRow, unsigned int lastRow)
+    {
+        std::vector<int32_t> accumulators(outputChannels);
+
+        for (unsigned int outputRow = firstRow; outputRow < lastRow; ++outputRow)
+        {
+            const unsigned int batchIdx = outputRow / g.m_OutputHeight;
+            const unsigned int yOutput  = outputRow % g.m_OutputHeight;
+            for (unsigned int xOutput = 0; xOutput < g.m_OutputWidth; ++xOutput)
+            {
+                for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+                {
+                    accumulators[cOutput] = bias ? bias[cOutput] : 0;
+                }
+
+                for (unsigned int yFilter = 0; yFilter < g.m_FilterHeight; ++yFilter)
+                {
+                    unsigned int yInput = 0;
+                    if (!g.GetInputCoordinate(yOutput, yFilter, true, yInput))
+                    {
+                        continue;
+                    }
+                    for (unsigned int xFilter = 0; xFilter < g.m_FilterWidth; ++xFilter)
+                    {
+                        unsigned int xInput = 0;
+                        if (!g.GetInputCoordinate(xOutput, xFilter, false, xInput))
+                        {
+                            continue;
+                        }
+                        const int16_t* filterTap = weights + (yFilter * g.m_FilterWidth + xFilter) * outputChannels;
+                        for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+                        {
+                            const int32_t inputValue =
+                                input[g.InputIndex(batchIdx, yInput, xInput, cOutput / depthMultiplier)] -
+                                inputOffset;
+                            accumulators[cOutput] += inputValue * static_cast<int32_t>(filterTap[cOutput]);
+                        }
+                    }
+                }
+
+                for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+                {
+                    output[g.OutputIndex(batchIdx, yOutput, xOutput, cOutput)] =
+                        static_cast<TOut>(outputStage.Requantize(accumulators[cOutput], cOutput));
+                }
+            }
+        }
+    });
+}
+
+template<typename TIn, typename TOut>
+void QuantizedFullyConnectedImpl(unsigned int batchSize,
+                                 unsigned int outputSize,
+                                 unsigned int K,
+                                 const TIn* input,
+                                 TOut* output,
+                                 const int16_t* weights,
+                                 const int32_t* bias,
+                                 const QuantizedConvOutputStage& outputStage)
+{
+    const int32_t inputOffset = outputStage.GetInputOffset();
+    std::vector<int16_t> rows(batchSize * K);
+    for (unsigned int i = 0; i < rows.size(); ++i)
+    {
+        rows[i] = static_cast<int16_t>(input[i] - inputOffset);
+    }
+
+    // Split the output channels rather than the batches, as fully connected layers usually run with a batch of one.
+    ParallelFor(outputSize, 1, [&](unsigned int firstChannel, unsigned int lastChannel)
+    {
+        for (unsigned int n = 0; n < batchSize; ++n)
+        {
+            const int16_t* row = rows.data() + n * K;
+            for (unsigned int channelOutput = firstChannel; channelOutput < lastChannel; ++channelOutput)
+            {
+                const int16_t* weightsRow = weights + channelOutput * K;
+                int32_t accumulator = bias ? bias[channelOutput] : 0;
+                for (unsigned int k = 0; k < K; ++k)
+                {
+                    accumulator += static_cast<int32_t>(row[k]) * static_cast<int32_t>(weightsRow[k]);
+                }
+                output[n * outputSize + channelOutput] =
+                    static_cast<TOut>(outputStage.Requantize(accumulator, channelOutput));
+            }
+        }
+    });
+}
+
+// Calls function with the input and output data cast to their quantized element types.
+template<typename Function>
+void DispatchQuantizedTypes(const TensorInfo& inputInfo,
+                            const void* inputData,
+                            const TensorInfo& outputInfo,
+                            void* outputData,
+                            Function&& function)
+{
+    const bool signedInput = inputInfo.GetDataType() == DataType::QAsymmS8;
+    const bool signedOutput = outputInfo.GetDataType() == DataType::QAsymmS8;
+    if (signedInput && signedOutput)
+    {
+        function(static_cast<const int8_t*>(inputData), static_cast<int8_t*>(outputData));
+    }
+    else if (signedInput)
+    {
+        function(static_cast<const int8_t*>(inputData), static_cast<uint8_t*>(outputData));
+    }
+    else if (signedOutput)
+    {
+        function(static_cast<const uint8_t*>(inputData), static_cast<int8_t*>(outputData));
+    }
+    else
+    {
+        function(static_cast<const uint8_t*>(inputData), static_cast<uint8_t*>(outputData));
+    }
+}
+
+} // anonymous namespace
+
+bool IsQuantizedConvolveSupported(const TensorInfo& inputInfo,
+                                  const TensorInfo& weightsInfo,
+                                  const TensorInfo& outputInfo,
+                                  const TensorInfo* biasInfo,
+                                  unsigned int weightsChannelAxis)
+{
+    if (!IsAsymmetric8BitType(inputInfo.GetDataType()) || !IsAsymmetric8BitType(outputInfo.GetDataType()) ||
+        inputInfo.HasMultipleQuantizationScales() || outputInfo.HasMultipleQuantizationScales())
+    {
+        return false;
+    }
+
+    const DataType weightsType = weightsInfo.GetDataType();
+    if (!IsAsymmetric8BitType(weightsType) && weightsType != DataType::QSymmS8)
+    {
+        return false;
+    }
+
+    const unsigned int numOutputChannels = weightsInfo.GetShape()[weightsChannelAxis];
+    if (weightsInfo.HasPerAxisQuantization())
+    {
+        if (weightsInfo.GetQuantizationDim().value() != weightsChannelAxis ||
+            weightsInfo.GetQuantizationScales().size() != numOutputChannels ||
+            weightsInfo.GetQuantizationOffset() != 0)
+        {
+            return false;
+        }
+    }
+
+    const std::vector<float> weightsScales = GetWeightsScales(weightsInfo, numOutputChannels);
+
+    if (biasInfo)
+    {
+        if (biasInfo->GetDataType() != DataType::Signed32)
+        {
+            return false;
+        }
+        // The int32 bias is added straight to the accumulators, so it must be in the accumulator's scale.
+        const std::vector<float> biasScales = biasInfo->HasPerAxisQuantization() ?
+                                              biasInfo->GetQuantizationScales() :
+                                              std::vector<float>(numOutputChannels,
+                                                                 biasInfo->GetQuantizationScale());
+        if (biasScales.size() != numOutputChannels)
+        {
+            return false;
+        }
+        for (unsigned int c = 0; c < numOutputChannels; ++c)
+        {
+            const double expectedScale = static_cast<double>(inputInfo.GetQuantizationScale()) * weightsScales[c];
+            if (std::fabs(biasScales[c] - expectedScale) > 1e-3 * expectedScale)
+            {
+                return false;
+            }
+        }
+    }
+
+    for (float weightsScale : weightsScales)
+    {
+        const double multiplier = static_cast<double>(inputInfo.GetQuantizationScale()) * weightsScale /
+                                  outputInfo.GetQuantizationScale();
+        if (!(multiplier >= 0.0 && static_cast<float>(multiplier) < 1.0f))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+QuantizedConvOutputStage::QuantizedConvOutputStage(const TensorInfo& inputInfo,
+                                                   const TensorInfo& weightsInfo,
+                                                   const TensorInfo& outputInfo,
+                                                   unsigned int numOutputChannels)
+    : m_InputOffset(inputInfo.GetQuantizationOffset())
+    , m_OutputOffset(outputInfo.GetQuantizationOffset())
+    , m_OutputScale(outputInfo.GetQuantizationScale())
+{
+    if (outputInfo.GetDataType() == DataType::QAsymmS8)
+    {
+        m_OutputMin = std::numeric_limits<int8_t>::lowest();
+        m_OutputMax = std::numeric_limits<int8_t>::max();
+    }
+    else
+    {
+        m_OutputMin = std::numeric_limits<uint8_t>::lowest();
+        m_OutputMax = std::numeric_limits<uint8_t>::max();
+    }
+
+    const std::vector<float> weightsScales = GetWeightsScales(weightsInfo, numOutputChannels);
+    m_Multipliers.reserve(weightsScales.size());
+    for (float weightsScale : weightsScales)
+    {
+        const double multiplier = static_cast<double>(inputInfo.GetQuantizationScale()) * weightsScale /
+                                  outputInfo.GetQuantizationScale();
+        m_Multipliers.emplace_back(static_cast<float>(multiplier));
+    }
+}
+
+void QuantizedConvOutputStage::ClampOutput(float lowerBound, float upperBound)
+{
+    // Infinite bounds leave that side of the output range as it is.
+    auto quantize = [this](float bound)
+    {
+        const double value = std::round(static_cast<double>(bound) / static_cast<double>(m_OutputScale)) +
+                             static_cast<double>(m_OutputOffset);
+        return static_cast<int32_t>(std::clamp(value,
+                                               static_cast<double>(m_OutputMin),
+                                               static_cast<double>(m_OutputMax)));
+    };
+    if (std::isfinite(lowerBound))
+    {
+        m_OutputMin = quantize(lowerBound);
+    }
+    if (std::isfinite(upperBound))
+    {
+        m_OutputMax = quantize(upperBound);
+    }
+}
+
+std::vector<int16_t> PrepareQuantizedConvolutionWeights(const TensorInfo& weightsInfo,
+                                                        const void* weightsData,
+                                                        DataLayout dataLayout)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const TensorShape& shape = weightsInfo.GetShape();
+    const unsigned int outputChannels = shape[0];
+    const unsigned int filterHeight   = shape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int filterWidth    = shape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int inputChannels  = shape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int rowSize        = filterHeight * filterWidth * inputChannels;
+    const bool isNhwc = dataLayout == DataLayout::NHWC;
+
+    std::vector<int16_t> prepared(outputChannels * rowSize);
+    for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+    {
+        for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+        {
+            for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+            {
+                for (unsigned int cInput = 0; cInput < inputChannels; ++cInput)
+                {
+                    const unsigned int k = (yFilter * filterWidth + xFilter) * inputChannels + cInput;
+                    const unsigned int index = isNhwc ?
+                        ((cOutput * filterHeight + yFilter) * filterWidth + xFilter) * inputChannels + cInput :
+                        ((cOutput * inputChannels + cInput) * filterHeight + yFilter) * filterWidth + xFilter;
+                    prepared[cOutput * rowSize + k] = PrepareQuantizedWeight(weightsInfo, weightsData, index);
+                }
+            }
+        }
+    }
+    return prepared;
+}
+
+std::vector<int16_t> PrepareQuantizedDepthwiseWeights(const TensorInfo& weightsInfo, const void* weightsData)
+{
+    std::vector<int16_t> prepared(weightsInfo.GetNumElements());
+    for (unsigned int i = 0; i < prepared.size(); ++i)
+    {
+        prepared[i] = PrepareQuantizedWeight(weightsInfo, weightsData, i);
+    }
+    return prepared;
+}
+
+std::vector<int16_t> PrepareQuantizedFullyConnectedWeights(const TensorInfo& weightsInfo,
+                                                           const void* weightsData,
+                                                           bool transposeWeights)
+{
+    // Weights are [O, K] when transposeWeights is set, otherwise [K, O].
+    const TensorShape& shape = weightsInfo.GetShape();
+    const unsigned int outputSize = transposeWeights ? shape[0] : shape[1];
+    const unsigned int K = transposeWeights ? shape[1] : shape[0];
+
+    std::vector<int16_t> prepared(outputSize * K);
+    for (unsigned int channelOutput = 0; channelOutput < outputSize; ++channelOutput)
+    {
+        for (unsigned int k = 0; k < K; ++k)
+        {
+            const unsigned int index = transposeWeights ? channelOutput * K + k : k * outputSize + channelOutput;
+            prepared[channelOutput * K + k] = PrepareQuantizedWeight(weightsInfo, weightsData, index);
+        }
+    }
+    return prepared;
+}
+
+void QuantizedConvolve(const TensorInfo& inputInfo,
+                       const void* inputData,
+                       const TensorInfo& outputInfo,
+                       void* outputData,
+                       const TensorShape& weightsShape,
+                       const int16_t* preparedWeights,
+                       const int32_t* biasData,
+                       const QuantizedConvOutputStage& outputStage,
+                       DataLayout dataLayout,
+                       unsigned int paddingTop,
+                       unsigned int paddingLeft,
+                       unsigned int xStride,
+                       unsigned int yStride,
+                       unsigned int xDilation,
+                       unsigned int yDilation,
+                       bool depthwise)
+{
+    if (!inputData || !outputData || !preparedWeights)
+    {
+        throw InvalidArgumentException("QuantizedConvolve: input, output and weights data must not be null.");
+    }
+
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const TensorShape& inputShape  = inputInfo.GetShape();
+    const TensorShape& outputShape = outputInfo.GetShape();
+
+    QuantizedConvGeometry g{};
+    g.m_BatchSize      = outputShape[0];
+    g.m_InputChannels  = inputShape[dataLayoutIndexed.GetChannelsIndex()];
+    g.m_InputHeight    = inputShape[dataLayoutIndexed.GetHeightIndex()];
+    g.m_InputWidth     = inputShape[dataLayoutIndexed.GetWidthIndex()];
+    g.m_OutputChannels = outputShape[dataLayoutIndexed.GetChannelsIndex()];
+    g.m_OutputHeight   = outputShape[dataLayoutIndexed.GetHeightIndex()];
+    g.m_OutputWidth    = outputShape[dataLayoutIndexed.GetWidthIndex()];
+    // Depthwise weights are always [1,H,W,O].
+    g.m_FilterHeight   = depthwise ? weightsShape[1] : weightsShape[dataLayoutIndexed.GetHeightIndex()];
+    g.m_FilterWidth    = depthwise ? weightsShape[2] : weightsShape[dataLayoutIndexed.GetWidthIndex()];
+    g.m_PaddingTop     = paddingTop;
+    g.m_PaddingLeft    = paddingLeft;
+    g.m_StrideX        = xStride;
+    g.m_StrideY        = yStride;
+    g.m_DilationX      = xDilation;
+    g.m_DilationY      = yDilation;
+    g.m_IsNhwc         = dataLayout == DataLayout::NHWC;
+
+    DispatchQuantizedTypes(inputInfo, inputData, outputInfo, outputData, [&](auto* input, auto* output)
+    {
+        if (depthwise)
+        {
+            QuantizedDepthwiseConvolveImpl(g, input, output, preparedWeights, biasData, outputStage);
+        }
+        else
+        {
+            QuantizedConvolveImpl(g, input, output, preparedWeights, biasData, outputStage);
+        }
+    });
+}
+
+void QuantizedFullyConnected(const TensorInfo& inputInfo,
+                             const void* inputData,
+                             const TensorInfo& outputInfo,
+                             void* outputData,
+                             const int16_t* preparedWeights,
+                             const int32_t* biasData,
+                             const QuantizedConvOutputStage& outputStage,
+                             unsigned int K)
+{
+    if (!inputData || !outputData || !preparedWeights)
+    {
+        throw InvalidArgumentException("QuantizedFullyConnected: input, output and weights data must not be null.");
+    }
+
+    const unsigned int batchSize  = outputInfo.GetShape()[0];
+    const unsigned int outputSize = outputInfo.GetShape()[1];
+
+    DispatchQuantizedTypes(inputInfo, inputData, outputInfo, outputData, [&](auto* input, auto* output)
+    {
+        QuantizedFullyConnectedImpl(batchSize, outputSize, K, input, output, preparedWeights, biasData, outputStage);
+    });
+}
+
+} //namespace armnn
@@ -0,0 +1,103 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "ConvImpl.hpp"
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace armnn
+{
+
+/// Returns true if the integer only Conv2d/DepthwiseConv2d/FullyConnected kernels can be used for the given tensors:
+/// QAsymmU8/QAsymmS8 input and output, QAsymmU8/QAsymmS8/QSymmS8 weights (optionally per-axis symmetric along
+/// weightsChannelAxis), Signed32 bias scaled by inputScale * weightsScale, and requantisation multipliers that are
+/// smaller than one. The bias info is optional and should be nullptr when bias is disabled.
+bool IsQuantizedConvolveSupported(const TensorInfo& inputInfo,
+                                  const TensorInfo& weightsInfo,
+                                  const TensorInfo& outputInfo,
+                                  const TensorInfo* biasInfo,
+                                  unsigned int weightsChannelAxis);
+
+/// Requantises the int32 accumulators of the integer only kernels to the output quantization space.
+class QuantizedConvOutputStage
+{
+public:
+    QuantizedConvOutputStage(const TensorInfo& inputInfo,
+                             const TensorInfo& weightsInfo,
+                             const TensorInfo& outputInfo,
+                             unsigned int numOutputChannels);
+
+    int32_t GetInputOffset() const { return m_InputOffset; }
+
+    /// Narrows the output range to the quantized equivalent of [lowerBound, upperBound], which applies a fused ReLu
+    /// or BoundedReLu as part of the requantisation.
+    void ClampOutput(float lowerBound, float upperBound);
+
+    int32_t Requantize(int32_t accumulator, unsigned int outputChannel) const
+    {
+        int32_t value = (m_Multipliers[outputChannel] * accumulator) + m_OutputOffset;
+        return std::min(std::max(value, m_OutputMin), m_OutputMax);
+    }
+
+private:
+    int32_t m_InputOffset;
+    int32_t m_OutputOffset;
+    float m_OutputScale;
+    int32_t m_OutputMin;
+    int32_t m_OutputMax;
+    std::vector<QuantizedMultiplierSmallerThanOne> m_Multipliers;
+};
+
+/// Converts Conv2d weights ([O,H,W,I] for NHWC, [O,I,H,W] for NCHW) to int16 with the weights offset removed,
+/// laid out as [O][K] where K = H * W * I is ordered (y, x, channel).
+std::vector<int16_t> PrepareQuantizedConvolutionWeights(const TensorInfo& weightsInfo,
+                                                        const void* weightsData,
+                                                        DataLayout dataLayout);
+
+/// Converts DepthwiseConv2d weights ([1,H,W,O]) to int16 with the weights offset removed, keeping the layout.
+std::vector<int16_t> PrepareQuantizedDepthwiseWeights(const TensorInfo& weightsInfo, const void* weightsData);
+
+/// Converts FullyConnected weights to int16 with the weights offset removed, laid out as [O][K].
+std::vector<int16_t> PrepareQuantizedFullyConnectedWeights(const TensorInfo& weightsInfo,
+                                                           const void* weightsData,
+                                                           bool transposeWeights);
+
+/// Integer only Conv2d (or DepthwiseConv2d if depthwise is true) accumulating in int32. The weights must have been
+/// prepared by PrepareQuantizedConvolutionWeights() or PrepareQuantizedDepthwiseWeights(). The bias may be nullptr.
+void QuantizedConvolve(const TensorInfo& inputInfo,
+                       const void* inputData,
+                       const TensorInfo& outputInfo,
+                       void* outputData,
+                       const TensorShape& weightsShape,
+                       const int16_t* preparedWeights,
+                       const int32_t* biasData,
+                       const QuantizedConvOutputStage& outputStage,
+                       DataLayout dataLayout,
+                       unsigned int paddingTop,
+                       unsigned int paddingLeft,
+                       unsigned int xStride,
+                       unsigned int yStride,
+                       unsigned int xDilation,
+                       unsigned int yDilation,
+                       bool depthwise);
+
+/// Integer only FullyConnected accumulating in int32. The weights must have been prepared by
+/// PrepareQuantizedFullyConnectedWeights(). The bias may be nullptr.
+void QuantizedFullyConnected(const TensorInfo& inputInfo,
+                             const void* inputData,
+                             const TensorInfo& outputInfo,
+                             void* outputData,
+                             const int16_t* preparedWeights,
+                             const int32_t* biasData,
+                             const QuantizedConvOutputStage& outputStage,
+                             unsigned int K);
+
+} //namespace armnn
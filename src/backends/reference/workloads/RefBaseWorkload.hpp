@@ -32,5 +32,20 @@ namespace armnn
         {
             this->m_Data.m_Outputs[slot] = tensorHandle;
         }
+
+        armnn::Optional<armnn::MemoryRequirements> GetMemoryRequirements() override
+        {
+            if (m_ScratchMemorySize == 0)
+            {
+                return armnn::EmptyOptional();
+            }
+            MemoryRequirements memoryRequirements;
+            memoryRequirements.m_ScratchMemorySize = m_ScratchMemorySize;
+            return memoryRequirements;
+        }
+
+    protected:
+        // Bytes of ScratchArena memory one execution takes. Set by workloads whose kernels use ScratchVectors.
+        size_t m_ScratchMemorySize = 0;
     };
 } //namespace armnn
\ No newline at end of file
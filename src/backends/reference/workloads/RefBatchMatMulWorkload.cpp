@@ -9,12 +9,23 @@
 #include "RefWorkloadUtils.hpp"
 #include "Profiling.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
 RefBatchMatMulWorkload::RefBatchMatMulWorkload(const BatchMatMulQueueDescriptor& descriptor, const WorkloadInfo& info)
     : RefBaseWorkload(descriptor, info)
-{}
+    , m_IsInputXConstant(IsInputFromConstantLayer(info, 0))
+    , m_IsInputYConstant(IsInputFromConstantLayer(info, 1))
+{
+    // Both inputs are decoded into scratch memory, and transposing or taking the adjoint of one copies it once more.
+    const unsigned int inputXElements = info.m_InputTensorInfos[0].GetNumElements();
+    const unsigned int inputYElements = info.m_InputTensorInfos[1].GetNumElements();
+    m_ScratchMemorySize = GetScratchMemorySize<float>({ inputXElements,
+                                                        inputYElements,
+                                                        std::max(inputXElements, inputYElements) });
+}
 
 void RefBatchMatMulWorkload::Execute() const
 {
@@ -27,19 +38,51 @@ void RefBatchMatMulWorkload::ExecuteAsync(ExecutionData& executionData)
     Execute(workingMemDescriptor->m_Inputs, workingMemDescriptor->m_Outputs);
 }
 
+void RefBatchMatMulWorkload::PrepareConstantTensors(const std::vector<ITensorHandle*>& inputs,
+                                                    const std::vector<ITensorHandle*>& outputs) const
+{
+    const TensorInfo& inputXInfo = GetTensorInfo(inputs[0]);
+    const TensorInfo& inputYInfo = GetTensorInfo(inputs[1]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
+
+    if (m_IsInputXConstant)
+    {
+        std::unique_ptr<Decoder<float>> inputXDecoder = MakeDecoder<float>(inputXInfo, inputs[0]->Map());
+        m_PreparedInputX = BatchMatMul::PrepareInput(m_Data.m_Parameters, inputXInfo, inputYInfo, outputInfo,
+                                                     true, *inputXDecoder);
+    }
+    if (m_IsInputYConstant)
+    {
+        std::unique_ptr<Decoder<float>> inputYDecoder = MakeDecoder<float>(inputYInfo, inputs[1]->Map());
+        m_PreparedInputY = BatchMatMul::PrepareInput(m_Data.m_Parameters, inputXInfo, inputYInfo, outputInfo,
+                                                     false, *inputYDecoder);
+    }
+}
+
 void RefBatchMatMulWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT_REF_NAME_GUID("RefBatchMatMulWorkload_Execute");
 
+    if (m_IsInputXConstant || m_IsInputYConstant)
+    {
+        std::call_once(m_PrepareOnceFlag, [&]() { PrepareConstantTensors(inputs, outputs); });
+    }
+
     const TensorInfo& inputXInfo = GetTensorInfo(inputs[0]);
     const TensorInfo& inputYInfo = GetTensorInfo(inputs[1]);
     const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
-    std::unique_ptr<Decoder<float>> inputXDecoder = MakeDecoder<float>(GetTensorInfo(inputs[0]),
-                                                                       inputs[0]->Map());
+    std::unique_ptr<Decoder<float>> inputXDecoder;
+    if (!m_IsInputXConstant)
+    {
+        inputXDecoder = MakeDecoder<float>(inputXInfo, inputs[0]->Map());
+    }
 
-    std::unique_ptr<Decoder<float>> inputYDecoder = MakeDecoder<float>(GetTensorInfo(inputs[1]),
-                                                                       inputs[1]->Map());
+    std::unique_ptr<Decoder<float>> inputYDecoder;
+    if (!m_IsInputYConstant)
+    {
+        inputYDecoder = MakeDecoder<float>(inputYInfo, inputs[1]->Map());
+    }
 
     std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(GetTensorInfo(outputs[0]),
                                                                        outputs[0]->Map());
@@ -48,9 +91,11 @@ void RefBatchMatMulWorkload::Execute(std::vector<ITensorHandle*> inputs, std::ve
                            inputXInfo,
                            inputYInfo,
                            outputInfo,
-                           *inputXDecoder,
-                           *inputYDecoder,
+                           inputXDecoder.get(),
+                           m_IsInputXConstant ? &m_PreparedInputX : nullptr,
+                           inputYDecoder.get(),
+                           m_IsInputYConstant ? &m_PreparedInputY : nullptr,
                            *outputEncoder);
 }
 
-} // namespace armnn
\ No newline at end of file
+} // namespace armnn
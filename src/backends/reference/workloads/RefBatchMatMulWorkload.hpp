@@ -10,6 +10,8 @@
 
 #include "BatchMatMulImpl.hpp"
 
+#include <mutex>
+
 namespace armnn
 {
 
@@ -25,6 +27,16 @@ public:
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
 
+    // Decodes the constant inputs and applies their transpose/adjoint parameters once. This is deferred to the first
+    // execution as the constant tensors may not be fully in place until then.
+    void PrepareConstantTensors(const std::vector<ITensorHandle*>& inputs,
+                                const std::vector<ITensorHandle*>& outputs) const;
+
+    const bool m_IsInputXConstant;
+    const bool m_IsInputYConstant;
+    mutable std::once_flag m_PrepareOnceFlag;
+    mutable BatchMatMul::PreparedInput m_PreparedInputX;
+    mutable BatchMatMul::PreparedInput m_PreparedInputY;
 };
 
 } // namespace armnn
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "RefConvolution2dWorkload.hpp"
 
+#include "ConvGemmImpl.hpp"
 #include "ConvImpl.hpp"
 #include "RefWorkloadUtils.hpp"
 
@@ -18,7 +19,33 @@ RefConvolution2dWorkload::RefConvolution2dWorkload(const Convolution2dQueueDescr
     , m_InputShape(info.m_InputTensorInfos[0].GetShape())
     , m_FilterShape(info.m_InputTensorInfos[1].GetShape())
     , m_OutputShape(info.m_OutputTensorInfos[0].GetShape())
+    , m_UseGemm(IsConvolveGemmSupported(info.m_InputTensorInfos[0],
+                                        info.m_InputTensorInfos[1],
+                                        info.m_OutputTensorInfos[0],
+                                        descriptor.m_Parameters.m_BiasEnabled ? &info.m_InputTensorInfos[2] : nullptr))
+    , m_IsWeightsConstant(IsInputFromConstantLayer(info, 1))
+    , m_IsBiasConstant(descriptor.m_Parameters.m_BiasEnabled && IsInputFromConstantLayer(info, 2))
+    , m_FusedActivation(descriptor.GetAdditionalInformation<ActivationDescriptor>())
 {
+    if (IsQuantizedConvolveSupported(info.m_InputTensorInfos[0],
+                                     info.m_InputTensorInfos[1],
+                                     info.m_OutputTensorInfos[0],
+                                     descriptor.m_Parameters.m_BiasEnabled ? &info.m_InputTensorInfos[2] : nullptr,
+                                     0))
+    {
+        m_QuantizedOutputStage = std::make_unique<QuantizedConvOutputStage>(info.m_InputTensorInfos[0],
+                                                                            info.m_InputTensorInfos[1],
+                                                                            info.m_OutputTensorInfos[0],
+                                                                            m_FilterShape[0]);
+        m_QuantizedOutputStage->ClampOutput(m_FusedActivation.GetLowerBound(), m_FusedActivation.GetUpperBound());
+    }
+    else if (!m_UseGemm)
+    {
+        // Convolve() decodes the input and accumulates the output in scratch memory.
+        m_ScratchMemorySize = GetScratchMemorySize<float>({ m_InputShape.GetNumElements(),
+                                                            m_OutputShape.GetNumElements() });
+    }
+
     WorkloadInfo detailsInfo;
     detailsInfo.m_InputTensorInfos = info.m_InputTensorInfos;
     detailsInfo.m_OutputTensorInfos = info.m_OutputTensorInfos;
@@ -41,26 +68,122 @@ void RefConvolution2dWorkload::ExecuteAsync(ExecutionData& executionData)
     Execute(workingMemDescriptor->m_Inputs, workingMemDescriptor->m_Outputs);
 }
 
+void RefConvolution2dWorkload::PrepareConstantTensors(const std::vector<ITensorHandle*>& inputs) const
+{
+    if (m_IsWeightsConstant)
+    {
+        if (m_QuantizedOutputStage)
+        {
+            m_PreparedQuantizedWeights = PrepareQuantizedConvolutionWeights(GetTensorInfo(inputs[1]),
+                                                                            inputs[1]->Map(),
+                                                                            m_Data.m_Parameters.m_DataLayout);
+        }
+        else if (m_UseGemm)
+        {
+            m_PreparedWeights = PackConvolutionFilter(m_FilterShape,
+                                                      reinterpret_cast<const float*>(inputs[1]->Map()),
+                                                      m_Data.m_Parameters.m_DataLayout);
+        }
+        else
+        {
+            m_PreparedWeights = MakeDecoder<float>(GetTensorInfo(inputs[1]), inputs[1]->Map())
+                                    ->DecodeTensor(m_FilterShape);
+        }
+    }
+    if (m_IsBiasConstant && !m_QuantizedOutputStage)
+    {
+        m_PreparedBias = MakeDecoder<float>(GetTensorInfo(inputs[2]), inputs[2]->Map())
+                             ->DecodeTensor(GetTensorInfo(inputs[2]).GetShape());
+    }
+}
+
 void RefConvolution2dWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT_REF_NAME_GUID("RefConvolution2dWorkload_Execute");
 
+    if (m_IsWeightsConstant || m_IsBiasConstant)
+    {
+        std::call_once(m_PrepareOnceFlag, [&]() { PrepareConstantTensors(inputs); });
+    }
+
+    const bool biasEnabled = m_Data.m_Parameters.m_BiasEnabled;
+
+    if (m_QuantizedOutputStage)
+    {
+        std::vector<int16_t> preparedWeights;
+        if (!m_IsWeightsConstant)
+        {
+            preparedWeights = PrepareQuantizedConvolutionWeights(GetTensorInfo(inputs[1]),
+                                                                 inputs[1]->Map(),
+                                                                 m_Data.m_Parameters.m_DataLayout);
+        }
+
+        QuantizedConvolve(GetTensorInfo(inputs[0]), inputs[0]->Map(),
+                          GetTensorInfo(outputs[0]), outputs[0]->Map(),
+                          m_FilterShape,
+                          m_IsWeightsConstant ? m_PreparedQuantizedWeights.data() : preparedWeights.data(),
+                          biasEnabled ? reinterpret_cast<const int32_t*>(inputs[2]->Map()) : nullptr,
+                          *m_QuantizedOutputStage,
+                          m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                          m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                          m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY,
+                          false);
+        m_FusedActivation.Apply(GetTensorInfo(outputs[0]), outputs[0]->Map(), true);
+        return;
+    }
+
+    if (m_UseGemm)
+    {
+        std::vector<float> packedFilter;
+        if (!m_IsWeightsConstant)
+        {
+            packedFilter = PackConvolutionFilter(m_FilterShape,
+                                                 reinterpret_cast<const float*>(inputs[1]->Map()),
+                                                 m_Data.m_Parameters.m_DataLayout);
+        }
+        const float* filterData = m_IsWeightsConstant ? m_PreparedWeights.data() : packedFilter.data();
+
+        const float* biasData = nullptr;
+        if (biasEnabled)
+        {
+            biasData = m_IsBiasConstant ? m_PreparedBias.data() : reinterpret_cast<const float*>(inputs[2]->Map());
+        }
+
+        ConvolveGemm(m_InputShape, reinterpret_cast<const float*>(inputs[0]->Map()),
+                     m_OutputShape, reinterpret_cast<float*>(outputs[0]->Map()),
+                     m_FilterShape, filterData, biasData,
+                     m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                     m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                     m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY,
+                     m_FusedActivation.GetLowerBound(), m_FusedActivation.GetUpperBound());
+        m_FusedActivation.Apply(GetTensorInfo(outputs[0]), outputs[0]->Map(), true);
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> inputDecoder = MakeDecoder<float>(GetTensorInfo(inputs[0]), inputs[0]->Map());
     std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(GetTensorInfo(outputs[0]), outputs[0]->Map());
 
-    std::unique_ptr<Decoder<float>> weightsDecoder = MakeDecoder<float>(GetTensorInfo(inputs[1]), inputs[1]->Map());
-    std::unique_ptr<Decoder<float>> biasDecoder;
+    std::vector<float> decodedWeights;
+    if (!m_IsWeightsConstant)
+    {
+        decodedWeights = MakeDecoder<float>(GetTensorInfo(inputs[1]), inputs[1]->Map())->DecodeTensor(m_FilterShape);
+    }
 
-    if (m_Data.m_Parameters.m_BiasEnabled)
+    std::vector<float> decodedBias;
+    if (biasEnabled && !m_IsBiasConstant)
     {
-        biasDecoder = MakeDecoder<float>(GetTensorInfo(inputs[2]), inputs[2]->Map());
+        decodedBias = MakeDecoder<float>(GetTensorInfo(inputs[2]), inputs[2]->Map())
+                          ->DecodeTensor(GetTensorInfo(inputs[2]).GetShape());
     }
 
     Convolve(m_InputShape, *inputDecoder, m_OutputShape, *outputEncoder, m_FilterShape,
-             *weightsDecoder, m_Data.m_Parameters.m_BiasEnabled, biasDecoder.get(),
+             m_IsWeightsConstant ? m_PreparedWeights : decodedWeights,
+             biasEnabled,
+             m_IsBiasConstant ? m_PreparedBias : decodedBias,
              m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
              m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
              m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY);
+    m_FusedActivation.Apply(GetTensorInfo(outputs[0]), outputs[0]->Map(), false);
 }
 
-} //namespace armnn
\ No newline at end of file
+} //namespace armnn
@@ -9,6 +9,11 @@
 #include <armnn/backends/WorkloadData.hpp>
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "FusedActivation.hpp"
+#include "QuantizedConvImpl.hpp"
+
+#include <memory>
+#include <mutex>
 
 namespace armnn
 {
@@ -25,9 +30,27 @@ public:
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
 
+    // Decodes (and for the GEMM path packs) the constant weights and bias once. This is deferred to the first
+    // execution as the constant tensors may not be fully in place until then.
+    void PrepareConstantTensors(const std::vector<ITensorHandle*>& inputs) const;
+
     const TensorShape m_InputShape;
     const TensorShape m_FilterShape;
     const TensorShape m_OutputShape;
+
+    // True when all tensors are float32 so the im2col/GEMM path in ConvGemmImpl can be used.
+    bool m_UseGemm;
+
+    // Set when the tensors are 8-bit quantized and supported by the integer only kernels in QuantizedConvImpl.
+    std::unique_ptr<QuantizedConvOutputStage> m_QuantizedOutputStage;
+
+    const bool m_IsWeightsConstant;
+    const bool m_IsBiasConstant;
+    const FusedActivation m_FusedActivation;
+    mutable std::once_flag m_PrepareOnceFlag;
+    mutable std::vector<float> m_PreparedWeights;
+    mutable std::vector<float> m_PreparedBias;
+    mutable std::vector<int16_t> m_PreparedQuantizedWeights;
 };
 
 } //namespace armnn
\ No newline at end of file
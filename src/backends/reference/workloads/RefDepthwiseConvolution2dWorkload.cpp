@@ -6,6 +6,7 @@
 #include "RefDepthwiseConvolution2dWorkload.hpp"
 
 #include "ConvImpl.hpp"
+#include "QuantizedConvImpl.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
@@ -18,7 +19,29 @@ namespace armnn
 RefDepthwiseConvolution2dWorkload::RefDepthwiseConvolution2dWorkload(
         const DepthwiseConvolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
         : RefBaseWorkload<DepthwiseConvolution2dQueueDescriptor>(descriptor, info)
+        , m_IsWeightsConstant(IsInputFromConstantLayer(info, 1))
+        , m_FusedActivation(descriptor.GetAdditionalInformation<ActivationDescriptor>())
 {
+    // Depthwise weights are [1,H,W,O] so the output channels are along axis 3.
+    if (IsQuantizedConvolveSupported(info.m_InputTensorInfos[0],
+                                     info.m_InputTensorInfos[1],
+                                     info.m_OutputTensorInfos[0],
+                                     descriptor.m_Parameters.m_BiasEnabled ? &info.m_InputTensorInfos[2] : nullptr,
+                                     3))
+    {
+        m_QuantizedOutputStage = std::make_unique<QuantizedConvOutputStage>(info.m_InputTensorInfos[0],
+                                                                            info.m_InputTensorInfos[1],
+                                                                            info.m_OutputTensorInfos[0],
+                                                                            info.m_InputTensorInfos[1].GetShape()[3]);
+        m_QuantizedOutputStage->ClampOutput(m_FusedActivation.GetLowerBound(), m_FusedActivation.GetUpperBound());
+    }
+    else
+    {
+        // Convolve() decodes the input and accumulates the output in scratch memory.
+        m_ScratchMemorySize = GetScratchMemorySize<float>({ info.m_InputTensorInfos[0].GetNumElements(),
+                                                            info.m_OutputTensorInfos[0].GetNumElements() });
+    }
+
     WorkloadInfo detailsInfo;
     detailsInfo.m_InputTensorInfos = info.m_InputTensorInfos;
     detailsInfo.m_OutputTensorInfos = info.m_OutputTensorInfos;
@@ -50,6 +73,39 @@ void RefDepthwiseConvolution2dWorkload::Execute(std::vector<ITensorHandle*> inpu
     const TensorShape& outputShape = GetTensorInfo(outputs[0]).GetShape();
     const TensorShape& filterShape = GetTensorInfo(inputs[1]).GetShape();
 
+    if (m_QuantizedOutputStage)
+    {
+        // The constant weights are converted once, deferred to the first execution as they may not be fully in
+        // place until then.
+        std::vector<int16_t> preparedWeights;
+        if (m_IsWeightsConstant)
+        {
+            std::call_once(m_PrepareOnceFlag, [&]()
+            {
+                m_PreparedQuantizedWeights = PrepareQuantizedDepthwiseWeights(GetTensorInfo(inputs[1]),
+                                                                              inputs[1]->Map());
+            });
+        }
+        else
+        {
+            preparedWeights = PrepareQuantizedDepthwiseWeights(GetTensorInfo(inputs[1]), inputs[1]->Map());
+        }
+
+        QuantizedConvolve(GetTensorInfo(inputs[0]), inputs[0]->Map(),
+                          GetTensorInfo(outputs[0]), outputs[0]->Map(),
+                          filterShape,
+                          m_IsWeightsConstant ? m_PreparedQuantizedWeights.data() : preparedWeights.data(),
+                          m_Data.m_Parameters.m_BiasEnabled ? reinterpret_cast<const int32_t*>(inputs[2]->Map())
+                                                            : nullptr,
+                          *m_QuantizedOutputStage,
+                          m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                          m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                          m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY,
+                          true);
+        m_FusedActivation.Apply(GetTensorInfo(outputs[0]), outputs[0]->Map(), true);
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> inputDecoder  = MakeDecoder<float>(GetTensorInfo(inputs[0]), inputs[0]->Map());
     std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(GetTensorInfo(outputs[0]), outputs[0]->Map());
     std::unique_ptr<Decoder<float>> filterDecoder = MakeDecoder<float>(GetTensorInfo(inputs[1]), inputs[1]->Map());
@@ -65,6 +121,7 @@ void RefDepthwiseConvolution2dWorkload::Execute(std::vector<ITensorHandle*> inpu
              m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
              m_Data.m_Parameters.m_DilationX,
              m_Data.m_Parameters.m_DilationY, true);
+    m_FusedActivation.Apply(GetTensorInfo(outputs[0]), outputs[0]->Map(), false);
 }
 
 } //namespace armnn
@@ -6,9 +6,14 @@
 #include <armnn/backends/WorkloadData.hpp>
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "FusedActivation.hpp"
+#include "QuantizedConvImpl.hpp"
 
 #include <armnn/TypesUtils.hpp>
 
+#include <memory>
+#include <mutex>
+
 namespace armnn
 {
 
@@ -22,6 +27,13 @@ public:
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
 
+    // Set when the tensors are 8-bit quantized and supported by the integer only kernels in QuantizedConvImpl.
+    std::unique_ptr<QuantizedConvOutputStage> m_QuantizedOutputStage;
+
+    const bool m_IsWeightsConstant;
+    const FusedActivation m_FusedActivation;
+    mutable std::once_flag m_PrepareOnceFlag;
+    mutable std::vector<int16_t> m_PreparedQuantizedWeights;
 };
 
 } //namespace armnn
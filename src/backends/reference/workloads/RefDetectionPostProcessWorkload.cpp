@@ -16,7 +16,15 @@ namespace armnn
 RefDetectionPostProcessWorkload::RefDetectionPostProcessWorkload(
         const DetectionPostProcessQueueDescriptor& descriptor, const WorkloadInfo& info)
         : RefBaseWorkload<DetectionPostProcessQueueDescriptor>(descriptor, info),
-          m_Anchors(std::make_unique<ScopedTensorHandle>(*(descriptor.m_Anchors))) {}
+          m_Anchors(std::make_unique<ScopedTensorHandle>(*(descriptor.m_Anchors)))
+{
+    // The decoded boxes and scores, the selected detections and the per box vectors of the non max suppression.
+    const unsigned int numBoxes = info.m_InputTensorInfos[0].GetShape()[1];
+    const unsigned int numScores = info.m_InputTensorInfos[1].GetNumElements();
+    m_ScratchMemorySize = GetScratchMemorySize<float>({ info.m_InputTensorInfos[0].GetNumElements(),
+                                                        numScores, numScores, numScores, numScores,
+                                                        numBoxes, numBoxes, numBoxes, numBoxes, numBoxes });
+}
 
 void RefDetectionPostProcessWorkload::Execute() const
 {
@@ -6,6 +6,7 @@
 #include "RefFullyConnectedWorkload.hpp"
 
 #include "FullyConnected.hpp"
+#include "QuantizedConvImpl.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
@@ -31,7 +32,30 @@ RefFullyConnectedWorkload::RefFullyConnectedWorkload(
         , m_WeightShape(info.m_InputTensorInfos[1].GetShape())
         , m_OutputShape(info.m_OutputTensorInfos[0].GetShape())
         , m_NumActivations(GetNumActivations(info.m_InputTensorInfos[0]))
+        , m_IsWeightsConstant(IsInputFromConstantLayer(info, 1))
+        , m_IsBiasConstant(descriptor.m_Parameters.m_BiasEnabled && IsInputFromConstantLayer(info, 2))
+        , m_FusedActivation(descriptor.GetAdditionalInformation<ActivationDescriptor>())
 {
+    // Weights are [output, input] when transposed, otherwise [input, output].
+    const unsigned int weightsChannelAxis = descriptor.m_Parameters.m_TransposeWeightMatrix ? 0 : 1;
+    if (IsQuantizedConvolveSupported(info.m_InputTensorInfos[0],
+                                     info.m_InputTensorInfos[1],
+                                     info.m_OutputTensorInfos[0],
+                                     descriptor.m_Parameters.m_BiasEnabled ? &info.m_InputTensorInfos[2] : nullptr,
+                                     weightsChannelAxis))
+    {
+        m_QuantizedOutputStage = std::make_unique<QuantizedConvOutputStage>(info.m_InputTensorInfos[0],
+                                                                            info.m_InputTensorInfos[1],
+                                                                            info.m_OutputTensorInfos[0],
+                                                                            m_OutputShape[1]);
+        m_QuantizedOutputStage->ClampOutput(m_FusedActivation.GetLowerBound(), m_FusedActivation.GetUpperBound());
+    }
+    else
+    {
+        // FullyConnected() decodes the input and accumulates the output in scratch memory.
+        m_ScratchMemorySize = GetScratchMemorySize<float>({ m_InputShape.GetNumElements(),
+                                                            m_OutputShape.GetNumElements() });
+    }
 }
 
 void RefFullyConnectedWorkload::Execute() const
@@ -45,31 +69,106 @@ void RefFullyConnectedWorkload::ExecuteAsync(ExecutionData& executionData)
     Execute(workingMemDescriptor->m_Inputs, workingMemDescriptor->m_Outputs);
 }
 
+void RefFullyConnectedWorkload::PrepareConstantTensors(const std::vector<ITensorHandle*>& inputs) const
+{
+    if (m_QuantizedOutputStage)
+    {
+        if (m_IsWeightsConstant)
+        {
+            m_PreparedQuantizedWeights =
+                PrepareQuantizedFullyConnectedWeights(GetTensorInfo(inputs[1]),
+                                                      inputs[1]->Map(),
+                                                      m_Data.m_Parameters.m_TransposeWeightMatrix);
+        }
+        return;
+    }
+    if (m_IsWeightsConstant)
+    {
+        std::vector<float> decodedWeights = MakeDecoder<float>(GetTensorInfo(inputs[1]), inputs[1]->Map())
+                                                ->DecodeTensor(m_WeightShape);
+        if (m_Data.m_Parameters.m_TransposeWeightMatrix)
+        {
+            m_PreparedWeights = std::move(decodedWeights);
+        }
+        else
+        {
+            const unsigned int outputSize = m_OutputShape[1];
+            m_PreparedWeights.resize(decodedWeights.size());
+            for (unsigned int channelInput = 0; channelInput < m_NumActivations; ++channelInput)
+            {
+                for (unsigned int channelOutput = 0; channelOutput < outputSize; ++channelOutput)
+                {
+                    m_PreparedWeights[channelOutput * m_NumActivations + channelInput] =
+                        decodedWeights[channelInput * outputSize + channelOutput];
+                }
+            }
+        }
+    }
+    if (m_IsBiasConstant)
+    {
+        m_PreparedBias = MakeDecoder<float>(GetTensorInfo(inputs[2]), inputs[2]->Map())
+                             ->DecodeTensor(TensorShape{m_OutputShape[1]});
+    }
+}
+
 void RefFullyConnectedWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT_REF_NAME_GUID("RefFullyConnectedWorkload_Execute");
 
+    if (m_IsWeightsConstant || m_IsBiasConstant)
+    {
+        std::call_once(m_PrepareOnceFlag, [&]() { PrepareConstantTensors(inputs); });
+    }
+
+    const bool biasEnabled = m_Data.m_Parameters.m_BiasEnabled;
+
+    if (m_QuantizedOutputStage)
+    {
+        std::vector<int16_t> preparedWeights;
+        if (!m_IsWeightsConstant)
+        {
+            preparedWeights = PrepareQuantizedFullyConnectedWeights(GetTensorInfo(inputs[1]),
+                                                                    inputs[1]->Map(),
+                                                                    m_Data.m_Parameters.m_TransposeWeightMatrix);
+        }
+
+        QuantizedFullyConnected(GetTensorInfo(inputs[0]), inputs[0]->Map(),
+                                GetTensorInfo(outputs[0]), outputs[0]->Map(),
+                                m_IsWeightsConstant ? m_PreparedQuantizedWeights.data() : preparedWeights.data(),
+                                biasEnabled ? reinterpret_cast<const int32_t*>(inputs[2]->Map()) : nullptr,
+                                *m_QuantizedOutputStage,
+                                m_NumActivations);
+        m_FusedActivation.Apply(GetTensorInfo(outputs[0]), outputs[0]->Map(), true);
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> inputDecoder = MakeDecoder<float>(GetTensorInfo(inputs[0]), inputs[0]->Map());
     std::unique_ptr<Encoder<float>> OutputEncoder = MakeEncoder<float>(GetTensorInfo(outputs[0]), outputs[0]->Map());
 
-    std::unique_ptr<Decoder<float>> weightsDecoder = MakeDecoder<float>(GetTensorInfo(inputs[1]), inputs[1]->Map());
-    std::unique_ptr<Decoder<float>> biasDecoder;
+    std::vector<float> decodedWeights;
+    if (!m_IsWeightsConstant)
+    {
+        decodedWeights = MakeDecoder<float>(GetTensorInfo(inputs[1]), inputs[1]->Map())->DecodeTensor(m_WeightShape);
+    }
 
-    if (m_Data.m_Parameters.m_BiasEnabled)
+    std::vector<float> decodedBias;
+    if (biasEnabled && !m_IsBiasConstant)
     {
-        biasDecoder = MakeDecoder<float>(GetTensorInfo(inputs[2]), inputs[2]->Map());
+        decodedBias = MakeDecoder<float>(GetTensorInfo(inputs[2]), inputs[2]->Map())
+                          ->DecodeTensor(TensorShape{m_OutputShape[1]});
     }
 
+    // Constant weights have already been transposed to [output, input].
     FullyConnected(m_InputShape,
                    *inputDecoder,
                    m_OutputShape,
                    *OutputEncoder,
-                   m_WeightShape,
-                   *weightsDecoder,
-                   biasDecoder.get(),
-                   m_Data.m_Parameters.m_BiasEnabled,
+                   m_IsWeightsConstant ? m_PreparedWeights : decodedWeights,
+                   m_IsBiasConstant ? m_PreparedBias : decodedBias,
+                   biasEnabled,
                    m_NumActivations,
-                   m_Data.m_Parameters.m_TransposeWeightMatrix);
+                   m_IsWeightsConstant || m_Data.m_Parameters.m_TransposeWeightMatrix);
+    m_FusedActivation.Apply(GetTensorInfo(outputs[0]), outputs[0]->Map(), false);
 }
 
 } //namespace armnn
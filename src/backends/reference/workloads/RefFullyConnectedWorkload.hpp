@@ -10,7 +10,11 @@
 #include "BaseIterator.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "FusedActivation.hpp"
+#include "QuantizedConvImpl.hpp"
 
+#include <memory>
+#include <mutex>
 
 namespace armnn
 {
@@ -27,10 +31,25 @@ public:
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
 
+    // Decodes the constant weights (transposed to [output, input] so the inner loop is contiguous) and bias once.
+    // This is deferred to the first execution as the constant tensors may not be fully in place until then.
+    void PrepareConstantTensors(const std::vector<ITensorHandle*>& inputs) const;
+
     const TensorShape m_InputShape;
     const TensorShape m_WeightShape;
     const TensorShape m_OutputShape;
     const unsigned int m_NumActivations;
+
+    // Set when the tensors are 8-bit quantized and supported by the integer only kernels in QuantizedConvImpl.
+    std::unique_ptr<QuantizedConvOutputStage> m_QuantizedOutputStage;
+
+    const bool m_IsWeightsConstant;
+    const bool m_IsBiasConstant;
+    const FusedActivation m_FusedActivation;
+    mutable std::once_flag m_PrepareOnceFlag;
+    mutable std::vector<float> m_PreparedWeights;
+    mutable std::vector<float> m_PreparedBias;
+    mutable std::vector<int16_t> m_PreparedQuantizedWeights;
 };
 
 } //namespace armnn
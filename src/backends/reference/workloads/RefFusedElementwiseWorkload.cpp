@@ -0,0 +1,71 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefFusedElementwiseWorkload.hpp"
+
+#include "Decoders.hpp"
+#include "Encoders.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <Profiling.hpp>
+
+namespace armnn
+{
+
+namespace
+{
+
+const FusedElementwise& GetFusedElementwise(const PreCompiledQueueDescriptor& descriptor)
+{
+    if (descriptor.m_PreCompiledObject == nullptr)
+    {
+        throw InvalidArgumentException("RefFusedElementwiseWorkload: the PreCompiled layer has no pre-compiled object",
+                                       CHECK_LOCATION());
+    }
+    return *static_cast<const FusedElementwise*>(descriptor.m_PreCompiledObject);
+}
+
+} // anonymous namespace
+
+RefFusedElementwiseWorkload::RefFusedElementwiseWorkload(const PreCompiledQueueDescriptor& descriptor,
+                                                         const WorkloadInfo& info)
+    : RefBaseWorkload<PreCompiledQueueDescriptor>(descriptor, info)
+    , m_FusedElementwise(GetFusedElementwise(descriptor))
+{}
+
+void RefFusedElementwiseWorkload::Execute() const
+{
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
+
+void RefFusedElementwiseWorkload::ExecuteAsync(ExecutionData& executionData)
+{
+    WorkingMemDescriptor* workingMemDescriptor = static_cast<WorkingMemDescriptor*>(executionData.m_Data);
+    Execute(workingMemDescriptor->m_Inputs, workingMemDescriptor->m_Outputs);
+}
+
+void RefFusedElementwiseWorkload::Execute(std::vector<ITensorHandle*> inputs,
+                                          std::vector<ITensorHandle*> outputs) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT_REF_NAME_GUID("RefFusedElementwiseWorkload_Execute");
+
+    std::vector<TensorShape> inputShapes;
+    std::vector<std::unique_ptr<Decoder<float>>> decoders;
+    inputShapes.reserve(inputs.size());
+    decoders.reserve(inputs.size());
+    for (ITensorHandle* input : inputs)
+    {
+        const TensorInfo& inputInfo = GetTensorInfo(input);
+        inputShapes.push_back(inputInfo.GetShape());
+        decoders.push_back(MakeDecoder<float>(inputInfo, input->Map()));
+    }
+
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
+    std::unique_ptr<Encoder<float>> encoder = MakeEncoder<float>(outputInfo, outputs[0]->Map());
+
+    m_FusedElementwise.Execute(inputShapes, decoders, outputInfo.GetShape(), *encoder);
+}
+
+} //namespace armnn
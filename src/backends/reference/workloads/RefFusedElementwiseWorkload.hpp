@@ -0,0 +1,31 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "FusedElementwise.hpp"
+#include "RefBaseWorkload.hpp"
+
+#include <armnn/backends/WorkloadData.hpp>
+
+namespace armnn
+{
+
+/// Evaluates the FusedElementwise chain which is the pre-compiled object of a PreCompiled layer.
+class RefFusedElementwiseWorkload : public RefBaseWorkload<PreCompiledQueueDescriptor>
+{
+public:
+    RefFusedElementwiseWorkload(const PreCompiledQueueDescriptor& descriptor, const WorkloadInfo& info);
+    void Execute() const override;
+    void ExecuteAsync(ExecutionData& executionData) override;
+
+private:
+    void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
+
+    // A copy, as the workload may outlive the layer which owns the pre-compiled object.
+    const FusedElementwise m_FusedElementwise;
+};
+
+} //namespace armnn
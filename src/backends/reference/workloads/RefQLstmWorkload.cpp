@@ -10,6 +10,8 @@
 #include "LstmUtils.hpp"
 #include "RefWorkloadUtils.hpp"
 
+#include <backendsCommon/ScratchArena.hpp>
+
 namespace armnn
 {
 
@@ -41,7 +43,13 @@ RefQLstmWorkload::RefQLstmWorkload(const QLstmQueueDescriptor &descriptor, const
         , m_ForgetLayerNormWeightsTensor  (AssignScopedTensorHandle(descriptor.m_ForgetLayerNormWeights))
         , m_CellLayerNormWeightsTensor    (AssignScopedTensorHandle(descriptor.m_CellLayerNormWeights))
         , m_OutputLayerNormWeightsTensor  (AssignScopedTensorHandle(descriptor.m_OutputLayerNormWeights))
-{}
+{
+    // The gate, hidden state and output buffers of the internal state.
+    const unsigned int stateElements = info.m_InputTensorInfos[2].GetNumElements();
+    m_ScratchMemorySize = GetScratchMemorySize<int16_t>({ stateElements, stateElements, stateElements, stateElements,
+                                                          info.m_InputTensorInfos[1].GetNumElements() }) +
+                          GetScratchMemorySize<int32_t>({ stateElements });
+}
 
 void RefQLstmWorkload::Execute() const
 {
@@ -157,12 +165,12 @@ void RefQLstmWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<I
 
     // Int16 vectors for internal state data (to be decoded/encoded)
     const uint32_t stateTensorSize = numBatches * numUnits;
-    std::vector<int16_t> inputGateData(stateTensorSize);
-    std::vector<int16_t> cellGateData(stateTensorSize);
-    std::vector<int16_t> forgetGateData(stateTensorSize);
-    std::vector<int16_t> outputGateData(stateTensorSize);
-    std::vector<int32_t> hiddenStateData(stateTensorSize);
-    std::vector<int16_t> outputInt16Data(numBatches * outputSize);
+    ScratchVector<int16_t> inputGateData(stateTensorSize);
+    ScratchVector<int16_t> cellGateData(stateTensorSize);
+    ScratchVector<int16_t> forgetGateData(stateTensorSize);
+    ScratchVector<int16_t> outputGateData(stateTensorSize);
+    ScratchVector<int32_t> hiddenStateData(stateTensorSize);
+    ScratchVector<int16_t> outputInt16Data(numBatches * outputSize);
 
     armnn::TensorInfo inputGateInfo(
             {numBatches , numUnits}, armnn::DataType::QSymmS16, m_Data.m_Parameters.m_InputIntermediateScale, 0);
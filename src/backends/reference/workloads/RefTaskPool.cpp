@@ -0,0 +1,17 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefTaskPool.hpp"
+
+namespace armnn
+{
+
+RefTaskPool& RefTaskPool::Get()
+{
+    static RefTaskPool pool;
+    return pool;
+}
+
+} //namespace armnn
@@ -0,0 +1,39 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <backendsCommon/TaskPool.hpp>
+
+#include <functional>
+
+namespace armnn
+{
+
+/// Process wide TaskPool used by the reference kernels to split their outer loops (batches, output channels, rows)
+/// across threads. The pool defaults to a single thread, i.e. every kernel runs serially on the calling thread, and is
+/// resized through the "NumberOfThreads" CpuRef option of IRuntime::CreationOptions::m_BackendOptions, see
+/// RefBackend::CreateBackendContext().
+///
+/// The kernels compute each output element with the same sequence of operations regardless of the range it falls in,
+/// so results do not depend on the number of threads.
+class RefTaskPool : public TaskPool
+{
+public:
+    static RefTaskPool& Get();
+
+private:
+    RefTaskPool() = default;
+};
+
+/// Shorthand for RefTaskPool::Get().ParallelFor().
+inline void ParallelFor(unsigned int numItems,
+                        unsigned int minItemsPerTask,
+                        const std::function<void(unsigned int, unsigned int)>& function)
+{
+    RefTaskPool::Get().ParallelFor(numItems, minItemsPerTask, function);
+}
+
+} //namespace armnn
@@ -12,6 +12,7 @@
 #include "RefWorkloadUtils.hpp"
 
 #include <armnnUtils/Permute.hpp>
+#include <backendsCommon/ScratchArena.hpp>
 
 namespace armnn
 {
@@ -41,7 +42,14 @@ RefUnidirectionalSequenceLstmWorkload::RefUnidirectionalSequenceLstmWorkload(
     , m_ForgetLayerNormWeights        (AssignScopedTensorHandle(descriptor.m_ForgetLayerNormWeights))
     , m_CellLayerNormWeights          (AssignScopedTensorHandle(descriptor.m_CellLayerNormWeights))
     , m_OutputLayerNormWeights        (AssignScopedTensorHandle(descriptor.m_OutputLayerNormWeights))
-{}
+{
+    // The four gate scratch buffers and the two state buffers, plus the input and output when they are permuted.
+    const unsigned int stateElements = info.m_InputTensorInfos[2].GetNumElements();
+    m_ScratchMemorySize = GetScratchMemorySize<float>({ stateElements, stateElements, stateElements, stateElements,
+                                                        info.m_InputTensorInfos[1].GetNumElements(), stateElements,
+                                                        info.m_InputTensorInfos[0].GetNumElements(),
+                                                        info.m_OutputTensorInfos[2].GetNumElements() });
+}
 
 void RefUnidirectionalSequenceLstmWorkload::Execute() const
 {
@@ -73,7 +81,7 @@ void RefUnidirectionalSequenceLstmWorkload::Execute(std::vector<ITensorHandle*>
     {
         // Permute to time major
         const PermutationVector& mappings = {1U, 0U, 2U};
-        std::vector<float> inputValue(inputTensor, inputTensor + inputInfo.GetNumElements());
+        ScratchVector<float> inputValue(inputTensor, inputTensor + inputInfo.GetNumElements());
         inputShape = armnnUtils::Permuted(inputInfo.GetShape(), mappings);
         inputInfo.SetShape(inputShape);
         armnnUtils::Permute(inputShape, mappings,  inputValue.data(), inputTensor, sizeof(float));
@@ -90,13 +98,13 @@ void RefUnidirectionalSequenceLstmWorkload::Execute(std::vector<ITensorHandle*>
     TensorInfo scratchInfo = outputInfo;
     scratchInfo.SetShape({batchSize, cellStateInfo.GetShape()[1]});
 
-    std::vector<float> inputGateScratchBuffer;
-    std::vector<float> cellScratchBuffer(scratchInfo.GetNumElements(), 0.);
-    std::vector<float> forgetGateScratchBuffer(scratchInfo.GetNumElements(), 0.);
-    std::vector<float> outputGateScratchBuffer(scratchInfo.GetNumElements(), 0.);
+    ScratchVector<float> inputGateScratchBuffer;
+    ScratchVector<float> cellScratchBuffer(scratchInfo.GetNumElements(), 0.);
+    ScratchVector<float> forgetGateScratchBuffer(scratchInfo.GetNumElements(), 0.);
+    ScratchVector<float> outputGateScratchBuffer(scratchInfo.GetNumElements(), 0.);
 
-    std::vector<float> outputStateOutBuffer(outputStateInfo.GetNumElements(), 0.);
-    std::vector<float> cellStateOutBuffer(cellStateInfo.GetNumElements(), 0.);
+    ScratchVector<float> outputStateOutBuffer(outputStateInfo.GetNumElements(), 0.);
+    ScratchVector<float> cellStateOutBuffer(cellStateInfo.GetNumElements(), 0.);
 
     void* outputStateOutData = outputStateOutBuffer.data();
     void* cellStateOutData = cellStateOutBuffer.data();
@@ -303,7 +311,7 @@ void RefUnidirectionalSequenceLstmWorkload::Execute(std::vector<ITensorHandle*>
         // Permute Output back to batch major
         const PermutationVector& mappings = {1U, 0U, 2U};
         auto outputData = reinterpret_cast<float*>(outputs[2]->Map());
-        std::vector<float> outputValue(outputData, outputData + outputInfo.GetNumElements());
+        ScratchVector<float> outputValue(outputData, outputData + outputInfo.GetNumElements());
         outputShape = armnnUtils::Permuted(outputInfo.GetShape(), mappings);
         outputInfo.SetShape(outputShape);
         armnnUtils::Permute(outputShape, mappings, outputValue.data(), outputData, sizeof(float));
@@ -6,23 +6,29 @@
 #pragma once
 
 #include <armnn/backends/TensorHandle.hpp>
+#include <armnn/backends/WorkloadInfo.hpp>
 
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 
+#include <backendsCommon/ScratchArena.hpp>
+
 #include <reference/RefTensorHandle.hpp>
 
 #include <BFloat16.hpp>
 #include <Half.hpp>
 
+#include <initializer_list>
+
 namespace armnn
 {
-/// Creates a profiling event that uses GetGuid() and GetName() from the calling class
+/// Creates a profiling event that uses GetGuid() and GetName() from the calling class. The name is only built when
+/// profiling is enabled, as this runs on every execution of every workload.
 #define ARMNN_SCOPED_PROFILING_EVENT_REF_NAME_GUID(label) \
 ARMNN_SCOPED_PROFILING_EVENT_WITH_INSTRUMENTS(armnn::Compute::CpuRef, \
                                               this->GetGuid(), \
-                                              this->GetName() + "_" + label, \
+                                              [&]() { return this->GetName() + "_" + label; }, \
                                               armnn::WallClockTimer())
 
 ////////////////////////////////////////////
@@ -94,6 +100,35 @@ BFloat16* GetOutputTensorDataBFloat16(unsigned int idx, const PayloadType& data)
     return GetOutputTensorData<BFloat16>(idx, data);
 }
 
+////////////////////////////////////////////
+/// scratch memory helpers
+////////////////////////////////////////////
+
+/// Returns the ScratchArena memory taken by ScratchVectors of T with the given numbers of elements, for workloads
+/// to report through GetMemoryRequirements().
+template <typename T>
+size_t GetScratchMemorySize(std::initializer_list<unsigned int> numElements)
+{
+    size_t size = 0;
+    for (unsigned int count : numElements)
+    {
+        size += ScratchArena::GetAllocationSize(count * sizeof(T));
+    }
+    return size;
+}
+
+////////////////////////////////////////////
+/// constant input helpers
+////////////////////////////////////////////
+
+/// Returns true if the given input of a workload is the output of a ConstantLayer, so that it can be decoded once and
+/// reused on every execution. A TensorInfo marked constant is not enough, as inputs fed by InputLayers are marked
+/// constant too.
+inline bool IsInputFromConstantLayer(const WorkloadInfo& info, unsigned int index)
+{
+    return index < info.m_InputsFromConstantLayers.size() && info.m_InputsFromConstantLayers[index];
+}
+
 ////////////////////////////////////////////
 /// u8 helpers
 ////////////////////////////////////////////
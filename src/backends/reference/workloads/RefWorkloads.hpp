@@ -33,6 +33,7 @@
 #include "RefFillWorkload.hpp"
 #include "RefFloorWorkload.hpp"
 #include "RefFullyConnectedWorkload.hpp"
+#include "RefFusedElementwiseWorkload.hpp"
 #include "RefGatherNdWorkload.hpp"
 #include "RefGatherWorkload.hpp"
 #include "RefInstanceNormalizationWorkload.hpp"
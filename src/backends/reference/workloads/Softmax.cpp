@@ -32,40 +32,39 @@ void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTen
                                                                       uAxis + 1,
                                                                       inputShape.GetNumDimensions());
 
+    // Each outer slice is decoded, normalised in place and encoded as a whole.
+    const unsigned int sliceSize = axisSize * innerSize;
+    std::vector<float> slice(sliceSize);
+
     for (unsigned int outer = 0; outer < outerSize; ++outer)
     {
-        unsigned int inputBeginIdx  = outer * axisSize * innerSize;
-        unsigned int inputEndIdx    = inputBeginIdx + axisSize * innerSize;
-        unsigned int outputBeginIdx = outer * axisSize * innerSize;
+        const unsigned int sliceBeginIdx = outer * sliceSize;
+        in.DecodeRange(sliceBeginIdx, sliceSize, slice.data());
 
-        for (unsigned int inner = 0; inner < innerSize; ++inner, ++inputBeginIdx, ++inputEndIdx, ++outputBeginIdx)
+        for (unsigned int inner = 0; inner < innerSize; ++inner)
         {
             // Find max
             float maxValue = std::numeric_limits<float>::lowest();
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
+            for (unsigned int iter = inner; iter < sliceSize; iter += innerSize)
             {
-                in[iter];
-                maxValue = std::max(maxValue, in.Get());
+                maxValue = std::max(maxValue, slice[iter]);
             }
 
             // Compute sum
             float sum = 0.0f;
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
+            for (unsigned int iter = inner; iter < sliceSize; iter += innerSize)
             {
-                in[iter];
-                sum += std::exp((in.Get() - maxValue) * beta);
+                sum += std::exp((slice[iter] - maxValue) * beta);
             }
 
             // Compute result
-            unsigned int outputIter = outputBeginIdx;
-            out[outputIter];
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize, outputIter += innerSize)
+            for (unsigned int iter = inner; iter < sliceSize; iter += innerSize)
             {
-                out[outputIter];
-                in[iter];
-                out.Set(std::exp((in.Get() - maxValue) * beta) / sum);
+                slice[iter] = std::exp((slice[iter] - maxValue) * beta) / sum;
             }
         }
+
+        out.EncodeRange(sliceBeginIdx, sliceSize, slice.data());
     }
 }
 
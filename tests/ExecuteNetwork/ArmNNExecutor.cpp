@@ -9,6 +9,13 @@
 
 #include <AsyncExecutionCallback.hpp>
 #include <armnn/IAsyncExecutionCallback.hpp>
+#include <armnn/backends/IMemoryOptimizerStrategy.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <map>
+
 #if defined(ARMNN_SERIALIZER)
 #include <armnnSerializer/ISerializer.hpp>
 #endif
@@ -125,12 +132,109 @@ std::string SerializeNetworkToDotFile(const armnn::IOptimizedNetwork& optimizedN
 }
 #endif
 
+/**
+ * Memory optimizer strategy which records the MemBlocks of a backend so they can be written to a memory profile.
+ * The MemBlocks are optimized the same way as when no strategy is set, giving each one a MemBin of its own.
+ */
+class MemoryProfileRecorder : public armnn::IMemoryOptimizerStrategy
+{
+public:
+    std::string GetName() const override
+    {
+        return "MemoryProfileRecorder";
+    }
+
+    armnn::MemBlockStrategyType GetMemBlockStrategyType() const override
+    {
+        return armnn::MemBlockStrategyType::SingleAxisPacking;
+    }
+
+    std::vector<armnn::MemBin> Optimize(std::vector<armnn::MemBlock>& memBlocks) override
+    {
+        m_MemBlocks = std::vector<armnn::MemBlock>(memBlocks);
+
+        std::vector<armnn::MemBin> memBins;
+        memBins.reserve(memBlocks.size());
+        for (auto& memBlock : memBlocks)
+        {
+            memBlock.m_Offset = 0;
+            memBins.push_back(armnn::MemBin{ { memBlock }, memBlock.m_MemSize });
+        }
+        return memBins;
+    }
+
+    const std::vector<armnn::MemBlock>& GetMemBlocks() const
+    {
+        return m_MemBlocks;
+    }
+
+private:
+    std::vector<armnn::MemBlock> m_MemBlocks;
+};
+
+/**
+ * Writes the MemBlocks recorded for each backend to a memory profile, in the format of
+ * tests/MemoryStrategyBenchmark/TestBlocks.hpp so it can be loaded by MemoryStrategyBenchmark or pasted into that file.
+ *
+ * @param recorders The recorders of each backend.
+ * @param modelPath The path of the model the profile was created for.
+ * @param fileName The file to write the profile to.
+ */
+void WriteMemoryProfiles(const std::map<BackendId, std::shared_ptr<MemoryProfileRecorder>>& recorders,
+                         const std::string& modelPath,
+                         const std::string& fileName)
+{
+    std::ofstream fileStream(fileName, std::ofstream::out | std::ofstream::trunc);
+    if (!fileStream.good())
+    {
+        throw RuntimeException(fmt::format("An error occurred when creating {}", fileName));
+    }
+
+    // The profile name has to be a valid identifier to be pasted into TestBlocks.hpp
+    std::string modelName = fs::path(modelPath).stem().string();
+    std::replace_if(modelName.begin(), modelName.end(), [](unsigned char c) { return !std::isalnum(c); }, '_');
+
+    for (const auto& recorder : recorders)
+    {
+        const std::vector<armnn::MemBlock>& memBlocks = recorder.second->GetMemBlocks();
+        if (memBlocks.empty())
+        {
+            continue;
+        }
+
+        fileStream << "// Generated from " << fs::path(modelPath).filename().string()
+                   << " for " << recorder.first << "\n";
+        fileStream << "std::vector<armnn::MemBlock> " << modelName << "_" << recorder.first << "\n{\n";
+        for (size_t i = 0; i < memBlocks.size(); ++i)
+        {
+            const armnn::MemBlock& memBlock = memBlocks[i];
+            fileStream << "    { " << memBlock.m_StartOfLife << ", " << memBlock.m_EndOfLife << ", "
+                       << memBlock.m_MemSize << ", 0, " << memBlock.m_Index << " }"
+                       << (i + 1 < memBlocks.size() ? ",\n" : "\n");
+        }
+        fileStream << "};\n\n";
+    }
+    ARMNN_LOG(info) << "The memory profile has been written to: " << fileName;
+}
+
 ArmNNExecutor::ArmNNExecutor(const ExecuteNetworkParams& params, armnn::IRuntime::CreationOptions runtimeOptions)
     : m_Params(params)
 {
     runtimeOptions.m_EnableGpuProfiling  = params.m_EnableProfiling;
     runtimeOptions.m_DynamicBackendsPath = params.m_DynamicBackendsPath;
 
+    // Record the MemBlocks of each backend if the user has asked for a memory profile.
+    std::map<BackendId, std::shared_ptr<MemoryProfileRecorder>> memoryProfileRecorders;
+    if (!params.m_MemoryProfileOutputPath.empty())
+    {
+        for (const auto& backendId : params.m_ComputeDevices)
+        {
+            auto recorder = std::make_shared<MemoryProfileRecorder>();
+            memoryProfileRecorders[backendId] = recorder;
+            runtimeOptions.m_MemoryOptimizerStrategyMap[backendId] = recorder;
+        }
+    }
+
     // Create/Get the static ArmNN Runtime. Note that the m_Runtime will be shared by all ArmNNExecutor
     // instances so the RuntimeOptions cannot be altered for different ArmNNExecutor instances.
     m_Runtime = GetRuntime(runtimeOptions);
@@ -189,6 +293,11 @@ ArmNNExecutor::ArmNNExecutor(const ExecuteNetworkParams& params, armnn::IRuntime
         return;
     }
 
+    if (!params.m_MemoryProfileOutputPath.empty())
+    {
+        WriteMemoryProfiles(memoryProfileRecorders, params.m_ModelPath, params.m_MemoryProfileOutputPath);
+    }
+
     SetupInputsAndOutputs();
 
     if (m_Params.m_Iterations > 1)
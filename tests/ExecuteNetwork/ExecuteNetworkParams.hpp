@@ -43,6 +43,7 @@ struct ExecuteNetworkParams
     std::vector<std::string>          m_InputTensorDataFilePaths;
     std::vector<armnn::TensorShape>   m_InputTensorShapes;
     size_t                            m_Iterations;
+    std::string                       m_MemoryProfileOutputPath;
     std::string                       m_ModelPath;
     unsigned int                      m_NumberOfThreads;
     bool                              m_OutputDetailsToStdOut;
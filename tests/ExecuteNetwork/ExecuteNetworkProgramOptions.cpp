@@ -359,7 +359,16 @@ ProgramOptions::ProgramOptions() : m_CxxOptions{"ExecuteNetwork",
                  " in dot format. This option only works with both the TfLite parser and the Arm NN serializer"
                  " enabled in the build. An inference will NOT be executed.",
                  cxxopts::value<bool>(m_ExNetParams.m_SerializeToArmNN)->default_value("false")
-                         ->implicit_value("true"));
+                         ->implicit_value("true"))
+
+                ("memory-profile-output",
+                 "Write the lifetime and size of every intermediate tensor of the loaded network (the MemBlocks "
+                 "given to the memory optimizer strategy) to this file, one profile per backend. The file can be "
+                 "passed to MemoryStrategyBenchmark with --profile. Supported for every model format when the "
+                 "network is executed by Arm NN through a parser, not by the TfLite delegates or the TfLite "
+                 "interpreter. Memory profiles are only created for asynchronous execution, so this option "
+                 "switches to asynchronous execution with --thread-pool-size 1 if no thread pool size is given.",
+                 cxxopts::value<std::string>(m_ExNetParams.m_MemoryProfileOutputPath));
 
         m_CxxOptions.add_options("d) Optimization")
                 ("enable-fast-math",
@@ -587,6 +596,14 @@ void ProgramOptions::ParseOptions(int ac, const char* av[])
         m_ExNetParams.m_TfLiteExecutor = ExecuteNetworkParams::TfLiteExecutor::ArmNNTfLiteDelegate;
     }
 
+    // The memory profile is only created for networks loaded for asynchronous execution
+    if (!m_ExNetParams.m_MemoryProfileOutputPath.empty() && m_ExNetParams.m_ThreadPoolSize == 0)
+    {
+        ARMNN_LOG(info) << "The program option 'memory-profile-output' switches to asynchronous execution with "
+                           "'thread-pool-size' 1, as memory profiles are only created for asynchronous execution.";
+        m_ExNetParams.m_ThreadPoolSize = 1;
+    }
+
     // Set concurrent to true if the user expects to run inferences asynchronously
     if (m_ExNetParams.m_Concurrent)
     {
@@ -9,12 +9,16 @@
 #include <MemoryOptimizerStrategyLibrary.hpp>
 #include <strategies/StrategyValidator.hpp>
 
+#include <armnn/Exceptions.hpp>
 
 #include <cxxopts.hpp>
 
 #include <iostream>
 #include <algorithm>
 #include <iomanip>
+#include <deque>
+#include <fstream>
+#include <sstream>
 
 std::vector<TestBlock> testBlocks
 {
@@ -58,6 +62,43 @@ size_t GetMinPossibleMemorySize(const std::vector<armnn::MemBlock>& blocks)
    return *std::max_element(lifetimes.begin(), lifetimes.end());
 }
 
+// Returns the share of the memory footprint which is not in use, averaged over the lifetime of the model
+float GetFragmentation(const std::vector<armnn::MemBlock>& blocks, size_t memoryUsage)
+{
+    unsigned int maxLifetime = 0;
+    for (const auto& block : blocks)
+    {
+        maxLifetime = std::max(maxLifetime, block.m_EndOfLife);
+    }
+    maxLifetime++;
+
+    std::vector<size_t> lifetimes(maxLifetime);
+    for (const auto& block : blocks)
+    {
+        for (auto lifetime = block.m_StartOfLife; lifetime <= block.m_EndOfLife; ++lifetime)
+        {
+            lifetimes[lifetime] += block.m_MemSize;
+        }
+    }
+
+    double unused = 0;
+    for (size_t inUse : lifetimes)
+    {
+        unused += static_cast<double>(memoryUsage - inUse) / static_cast<double>(memoryUsage);
+    }
+    return static_cast<float>(100 * unused / static_cast<double>(maxLifetime));
+}
+
+size_t GetMemoryUsage(const std::vector<armnn::MemBin>& memBins)
+{
+    size_t memoryUsage = 0;
+    for (const auto& bin : memBins)
+    {
+        memoryUsage += bin.m_MemSize;
+    }
+    return memoryUsage;
+}
+
 void RunBenchmark(armnn::IMemoryOptimizerStrategy* strategy, std::vector<TestBlock>* models)
 {
     using Clock = std::chrono::high_resolution_clock;
@@ -72,11 +113,7 @@ void RunBenchmark(armnn::IMemoryOptimizerStrategy* strategy, std::vector<TestBlo
         auto duration = std::chrono::duration<double, std::milli>(Clock::now() - now);
 
         avgDuration += duration;
-        size_t memoryUsage = 0;
-        for (auto bin : result)
-        {
-            memoryUsage += bin.m_MemSize;
-        }
+        size_t memoryUsage = GetMemoryUsage(result);
         size_t minSize = GetMinPossibleMemorySize(model.m_Blocks);
 
         float efficiency = static_cast<float>(minSize) / static_cast<float>(memoryUsage);
@@ -91,6 +128,9 @@ void RunBenchmark(armnn::IMemoryOptimizerStrategy* strategy, std::vector<TestBlo
         std::cout << "Minimum possible usage: " << minSize/1024 << " kb\n";
 
         std::cout << "Memory efficiency: " << std::setprecision(3) << efficiency << "%\n";
+
+        std::cout << "Memory fragmentation: " << std::setprecision(3) << GetFragmentation(model.m_Blocks, memoryUsage)
+                  << "%\n";
     }
 
     avgDuration/= static_cast<double>(models->size());
@@ -101,12 +141,130 @@ void RunBenchmark(armnn::IMemoryOptimizerStrategy* strategy, std::vector<TestBlo
     std::cout << "Average memory efficiency: " << std::setprecision(3) << avgEfficiency << "%\n";
 }
 
+// Loads the memory profiles written by ExecuteNetwork's --memory-profile-output option. A profile starts with a
+// "std::vector<armnn::MemBlock> <name>" line followed by one "{ startOfLife, endOfLife, memSize, offset, index },"
+// line per MemBlock, the same format as TestBlocks.hpp, so that profiles can also be pasted in there.
+std::vector<TestBlock> LoadMemoryProfiles(const std::string& path, std::deque<std::vector<armnn::MemBlock>>& storage)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        throw armnn::FileNotFoundException("Unable to open memory profile: " + path);
+    }
+
+    std::vector<TestBlock> profiles;
+    const std::string profilePrefix = "std::vector<armnn::MemBlock>";
+    std::string line;
+    while (std::getline(file, line))
+    {
+        const size_t firstChar = line.find_first_not_of(" \t");
+        if (firstChar == std::string::npos)
+        {
+            continue;
+        }
+
+        if (line.compare(firstChar, profilePrefix.size(), profilePrefix) == 0)
+        {
+            std::string name = line.substr(firstChar + profilePrefix.size());
+            name.erase(0, name.find_first_not_of(" \t"));
+            storage.emplace_back();
+            profiles.push_back({ name, storage.back() });
+        }
+        else if (line[firstChar] == '{' && line.find('}') != std::string::npos)
+        {
+            if (profiles.empty())
+            {
+                throw armnn::ParseException("MemBlock found before the start of a profile in " + path);
+            }
+
+            std::replace_if(line.begin(), line.end(), [](char c) { return c == '{' || c == '}' || c == ','; }, ' ');
+            std::istringstream blockStream(line);
+            unsigned int startOfLife = 0;
+            unsigned int endOfLife = 0;
+            size_t memSize = 0;
+            size_t offset = 0;
+            unsigned int index = 0;
+            if (!(blockStream >> startOfLife >> endOfLife >> memSize >> offset >> index) || startOfLife > endOfLife)
+            {
+                throw armnn::ParseException("Invalid MemBlock in " + path + ": " + line);
+            }
+            profiles.back().m_Blocks.emplace_back(startOfLife, endOfLife, memSize, offset, index);
+        }
+    }
+
+    if (profiles.empty())
+    {
+        throw armnn::ParseException("No memory profiles found in " + path);
+    }
+    return profiles;
+}
+
+// Prints the peak memory footprint, fragmentation and execution time of every strategy in the library for each model
+void RunComparison(std::vector<TestBlock>* models, bool validate)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    std::vector<std::string> strategyNames;
+    for (const auto& strategyName : armnn::GetMemoryOptimizerStrategyNames())
+    {
+        // The validator is not a strategy in itself
+        if (strategyName != "StrategyValidator")
+        {
+            strategyNames.push_back(strategyName);
+        }
+    }
+
+    const int nameWidth = 30;
+    const int columnWidth = 16;
+    for (auto& model : *models)
+    {
+        const size_t minSize = GetMinPossibleMemorySize(model.m_Blocks);
+        std::cout << "\nModel: " << model.m_Name << " (" << model.m_Blocks.size() << " blocks, minimum possible usage "
+                  << minSize / 1024 << " kb)\n";
+        std::cout << "===============================================\n";
+        std::cout << std::left << std::setw(nameWidth) << "Strategy" << std::right
+                  << std::setw(columnWidth) << "Peak (kb)"
+                  << std::setw(columnWidth) << "Efficiency"
+                  << std::setw(columnWidth) << "Fragmentation"
+                  << std::setw(columnWidth) << "Time (ms)" << "\n";
+
+        for (const auto& strategyName : strategyNames)
+        {
+            std::shared_ptr<armnn::IMemoryOptimizerStrategy> strategy =
+                armnn::GetMemoryOptimizerStrategy(strategyName);
+            if (validate)
+            {
+                auto validator = std::make_shared<armnn::StrategyValidator>();
+                validator->SetStrategy(strategy);
+                strategy = validator;
+            }
+
+            std::vector<armnn::MemBlock> blocks = model.m_Blocks;
+            auto now = Clock::now();
+            const std::vector<armnn::MemBin> result = strategy->Optimize(blocks);
+            auto duration = std::chrono::duration<double, std::milli>(Clock::now() - now);
+
+            const size_t memoryUsage = GetMemoryUsage(result);
+            const float efficiency = 100 * static_cast<float>(minSize) / static_cast<float>(memoryUsage);
+
+            std::cout << std::left << std::setw(nameWidth) << strategyName << std::right << std::fixed
+                      << std::setw(columnWidth) << memoryUsage / 1024
+                      << std::setw(columnWidth - 1) << std::setprecision(1) << efficiency << "%"
+                      << std::setw(columnWidth - 1) << GetFragmentation(model.m_Blocks, memoryUsage) << "%"
+                      << std::setw(columnWidth) << std::setprecision(3) << duration.count() << "\n";
+            std::cout.unsetf(std::ios::fixed);
+        }
+    }
+}
+
 struct BenchmarkOptions
 {
     std::string m_StrategyName;
     std::string m_ModelName;
     bool m_UseDefaultStrategy = false;
     bool m_Validate = false;
+    bool m_Compare = false;
+    std::vector<std::string> m_ProfilePaths;
 };
 
 BenchmarkOptions ParseOptions(int argc, char* argv[])
@@ -117,6 +275,11 @@ BenchmarkOptions ParseOptions(int argc, char* argv[])
         ("s, strategy", "Strategy name, do not specify to use default strategy", cxxopts::value<std::string>())
         ("m, model", "Model name", cxxopts::value<std::string>())
         ("v, validate", "Validate strategy", cxxopts::value<bool>()->default_value("false")->implicit_value("true"))
+        ("c, compare", "Compare the peak memory footprint, fragmentation and execution time of all available "
+         "strategies", cxxopts::value<bool>()->default_value("false")->implicit_value("true"))
+        ("p, profile", "Memory profile file(s) written by ExecuteNetwork --memory-profile-output. "
+         "The models in these files are tested instead of the built in models",
+         cxxopts::value<std::vector<std::string>>())
         ("h,help", "Display usage information");
 
     auto result = options.parse(argc, argv);
@@ -135,12 +298,13 @@ BenchmarkOptions ParseOptions(int argc, char* argv[])
     }
 
     BenchmarkOptions benchmarkOptions;
+    benchmarkOptions.m_Compare = result["compare"].as<bool>();
 
     if(result.count("strategy"))
     {
         benchmarkOptions.m_StrategyName = result["strategy"].as<std::string>();
     }
-    else
+    else if (!benchmarkOptions.m_Compare)
     {
         std::cout << "No Strategy given, using default strategy";
 
@@ -154,6 +318,11 @@ BenchmarkOptions ParseOptions(int argc, char* argv[])
 
     benchmarkOptions.m_Validate = result["validate"].as<bool>();
 
+    if (result.count("profile"))
+    {
+        benchmarkOptions.m_ProfilePaths = result["profile"].as<std::vector<std::string>>();
+    }
+
     return benchmarkOptions;
 }
 
@@ -167,7 +336,7 @@ int main(int argc, char* argv[])
     {
         strategy = std::make_shared<armnn::TestStrategy>();
     }
-    else
+    else if (!benchmarkOptions.m_Compare)
     {
         strategy = armnn::GetMemoryOptimizerStrategy(benchmarkOptions.m_StrategyName);
 
@@ -178,16 +347,35 @@ int main(int argc, char* argv[])
         }
     }
 
+    std::deque<std::vector<armnn::MemBlock>> profileStorage;
+    std::vector<TestBlock> profiles;
+    try
+    {
+        for (const auto& profilePath : benchmarkOptions.m_ProfilePaths)
+        {
+            for (auto& profile : LoadMemoryProfiles(profilePath, profileStorage))
+            {
+                profiles.push_back(profile);
+            }
+        }
+    }
+    catch (const armnn::Exception& e)
+    {
+        std::cout << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    std::vector<TestBlock>* availableModels = profiles.empty() ? &testBlocks : &profiles;
+
     std::vector<TestBlock> model;
-    std::vector<TestBlock>* modelsToTest = &testBlocks;
+    std::vector<TestBlock>* modelsToTest = availableModels;
     if (benchmarkOptions.m_ModelName.size() != 0)
     {
-        auto it = std::find_if(testBlocks.cbegin(), testBlocks.cend(), [&](const TestBlock testBlock)
+        auto it = std::find_if(availableModels->cbegin(), availableModels->cend(), [&](const TestBlock testBlock)
         {
             return testBlock.m_Name == benchmarkOptions.m_ModelName;
         });
 
-        if (it == testBlocks.end())
+        if (it == availableModels->end())
         {
             std::cout << "Model name not found\n";
             return 0;
@@ -199,7 +387,11 @@ int main(int argc, char* argv[])
         }
     }
 
-    if (benchmarkOptions.m_Validate)
+    if (benchmarkOptions.m_Compare)
+    {
+        RunComparison(modelsToTest, benchmarkOptions.m_Validate);
+    }
+    else if (benchmarkOptions.m_Validate)
     {
         armnn::StrategyValidator strategyValidator;
 
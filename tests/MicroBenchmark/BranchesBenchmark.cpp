@@ -0,0 +1,156 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MicroBenchmarkUtils.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+/// numBranches independent chains of depth 3x3 convolutions on the input of the network, whose results are added
+/// together, as in the blocks of Inception-style and multi-head models.
+INetworkPtr CreateMultiBranchNetwork(const TensorInfo& info,
+                                     unsigned int numBranches,
+                                     unsigned int depth,
+                                     const std::vector<float>& weights,
+                                     const std::vector<float>& bias)
+{
+    const unsigned int channels = info.GetShape()[3];
+    const TensorInfo weightsInfo({ channels, 3, 3, channels }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo biasInfo({ channels }, DataType::Float32, 0.0f, 0, true);
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_PadLeft = 1;
+    descriptor.m_PadRight = 1;
+    descriptor.m_PadTop = 1;
+    descriptor.m_PadBottom = 1;
+    descriptor.m_StrideX = 1;
+    descriptor.m_StrideY = 1;
+    descriptor.m_BiasEnabled = true;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    ActivationDescriptor relu;
+    relu.m_Function = ActivationFunction::ReLu;
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input = network->AddInputLayer(0);
+    input->GetOutputSlot(0).SetTensorInfo(info);
+
+    IConnectableLayer* sum = nullptr;
+    for (unsigned int branch = 0; branch < numBranches; ++branch)
+    {
+        IConnectableLayer* previous = input;
+        for (unsigned int i = 0; i < depth; ++i)
+        {
+            IConnectableLayer* convolution = network->AddConvolution2dLayer(descriptor);
+            IConnectableLayer* weightsLayer = network->AddConstantLayer(ConstTensor(weightsInfo, weights));
+            IConnectableLayer* biasLayer = network->AddConstantLayer(ConstTensor(biasInfo, bias));
+            weightsLayer->GetOutputSlot(0).SetTensorInfo(weightsInfo);
+            biasLayer->GetOutputSlot(0).SetTensorInfo(biasInfo);
+            previous->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+            weightsLayer->GetOutputSlot(0).Connect(convolution->GetInputSlot(1));
+            biasLayer->GetOutputSlot(0).Connect(convolution->GetInputSlot(2));
+            convolution->GetOutputSlot(0).SetTensorInfo(info);
+
+            IConnectableLayer* activation = network->AddActivationLayer(relu);
+            convolution->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+            activation->GetOutputSlot(0).SetTensorInfo(info);
+            previous = activation;
+        }
+
+        if (sum == nullptr)
+        {
+            sum = previous;
+            continue;
+        }
+        IConnectableLayer* add = network->AddElementwiseBinaryLayer(BinaryOperation::Add);
+        sum->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+        previous->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+        add->GetOutputSlot(0).SetTensorInfo(info);
+        sum = add;
+    }
+    sum->GetOutputSlot(0).Connect(network->AddOutputLayer(0)->GetInputSlot(0));
+    return network;
+}
+
+/// Times one inference of the network on CpuRef, executed serially or on numExecutionThreads threads.
+double TimeInferenceMs(const MicroBenchmarkOptions& options,
+                       const TensorInfo& info,
+                       unsigned int numBranches,
+                       unsigned int depth,
+                       unsigned int numExecutionThreads)
+{
+    const unsigned int channels = info.GetShape()[3];
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-0.1f, 0.1f);
+    std::vector<float> weights(channels * 3 * 3 * channels);
+    std::vector<float> bias(channels);
+    std::vector<float> inputData(info.GetNumElements());
+    for (auto* data : { &weights, &bias, &inputData })
+    {
+        for (auto& value : *data)
+        {
+            value = distribution(generator);
+        }
+    }
+
+    INetworkPtr network = CreateMultiBranchNetwork(info, numBranches, depth, weights, bias);
+
+    // One thread per kernel, so that only the branches executing at the same time make use of the other cores.
+    IRuntime::CreationOptions runtimeOptions;
+    runtimeOptions.m_BackendOptions.emplace_back(BackendOptions("CpuRef", { { "NumberOfThreads", 1u } }));
+    IRuntimePtr runtime = IRuntime::Create(runtimeOptions);
+    IOptimizedNetworkPtr optNet = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec());
+
+    NetworkId networkId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined,
+                                         false, ProfilingDetailsMethod::Undefined, false, 1,
+                                         numExecutionThreads);
+    if (runtime->LoadNetwork(networkId, std::move(optNet), errorMessage, networkProperties) != Status::Success)
+    {
+        throw RuntimeException("BranchesBenchmark: failed to load the network: " + errorMessage);
+    }
+
+    TensorInfo inputInfo = info;
+    inputInfo.SetConstant(true);
+    std::vector<float> outputData(info.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(info, outputData.data()) } };
+
+    return TimeAverageMs(options, [&]()
+    {
+        runtime->EnqueueWorkload(networkId, inputTensors, outputTensors);
+    });
+}
+
+void Compare(const MicroBenchmarkOptions& options, const TensorInfo& info, unsigned int numBranches, unsigned int depth)
+{
+    const TensorShape& shape = info.GetShape();
+    const std::string caseName = std::to_string(numBranches) + " branches of " + std::to_string(depth)
+                                 + " conv3x3 + ReLU, " + std::to_string(shape[1]) + "x" + std::to_string(shape[2])
+                                 + "x" + std::to_string(shape[3]);
+
+    const double serialMs = TimeInferenceMs(options, info, numBranches, depth, 1);
+    const double parallelMs = TimeInferenceMs(options, info, numBranches, depth, numBranches);
+    PrintComparison(caseName, "serial", serialMs, std::to_string(numBranches) + " threads", parallelMs);
+}
+
+} // anonymous namespace
+
+void RunBranchesBenchmark(const MicroBenchmarkOptions& options)
+{
+    Compare(options, TensorInfo({ 1, 28, 28, 16 }, DataType::Float32), 2, 3);
+    Compare(options, TensorInfo({ 1, 28, 28, 16 }, DataType::Float32), 4, 3);
+    Compare(options, TensorInfo({ 1, 14, 14, 32 }, DataType::Float32), 8, 2);
+}
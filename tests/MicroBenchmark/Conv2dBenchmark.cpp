@@ -0,0 +1,99 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MicroBenchmarkUtils.hpp"
+
+#include <reference/workloads/ConvGemmImpl.hpp>
+#include <reference/workloads/ConvImpl.hpp>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct Conv2dCase
+{
+    std::string m_Name;
+    armnn::DataLayout m_DataLayout;
+    unsigned int m_InputChannels;
+    unsigned int m_InputSize;
+    unsigned int m_OutputChannels;
+    unsigned int m_FilterSize;
+    unsigned int m_Stride;
+};
+
+armnn::TensorShape MakeShape(armnn::DataLayout dataLayout,
+                             unsigned int n, unsigned int c, unsigned int h, unsigned int w)
+{
+    return dataLayout == armnn::DataLayout::NHWC ? armnn::TensorShape({ n, h, w, c })
+                                                 : armnn::TensorShape({ n, c, h, w });
+}
+
+void RunCase(const Conv2dCase& c, const MicroBenchmarkOptions& options)
+{
+    using namespace armnn;
+
+    // "Same" padding.
+    const unsigned int padding    = c.m_FilterSize / 2;
+    const unsigned int outputSize = (c.m_InputSize + 2 * padding - c.m_FilterSize) / c.m_Stride + 1;
+
+    const TensorShape inputShape  = MakeShape(c.m_DataLayout, 1, c.m_InputChannels, c.m_InputSize, c.m_InputSize);
+    const TensorShape outputShape = MakeShape(c.m_DataLayout, 1, c.m_OutputChannels, outputSize, outputSize);
+    const TensorShape filterShape = MakeShape(c.m_DataLayout, c.m_OutputChannels, c.m_InputChannels,
+                                              c.m_FilterSize, c.m_FilterSize);
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> input(inputShape.GetNumElements());
+    std::vector<float> filter(filterShape.GetNumElements());
+    std::vector<float> bias(c.m_OutputChannels);
+    std::vector<float> output(outputShape.GetNumElements());
+    for (auto* data : { &input, &filter, &bias })
+    {
+        for (auto& value : *data)
+        {
+            value = distribution(generator);
+        }
+    }
+
+    double loopMs = TimeAverageMs(options, [&]()
+    {
+        Float32Decoder inputDecoder(input.data());
+        Float32Decoder filterDecoder(filter.data());
+        Float32Decoder biasDecoder(bias.data());
+        Float32Encoder outputEncoder(output.data());
+        Convolve(inputShape, inputDecoder, outputShape, outputEncoder, filterShape, filterDecoder,
+                 true, &biasDecoder, c.m_DataLayout, padding, padding, c.m_Stride, c.m_Stride, 1, 1);
+    });
+
+    // Packing is included in the timing, as it is done on each execution when the weights are not constant.
+    double gemmMs = TimeAverageMs(options, [&]()
+    {
+        std::vector<float> packedFilter = PackConvolutionFilter(filterShape, filter.data(), c.m_DataLayout);
+        ConvolveGemm(inputShape, input.data(), outputShape, output.data(), filterShape, packedFilter.data(),
+                     bias.data(), c.m_DataLayout, padding, padding, c.m_Stride, c.m_Stride, 1, 1);
+    });
+
+    PrintComparison(c.m_Name, "Convolve", loopMs, "ConvolveGemm", gemmMs);
+}
+
+} // anonymous namespace
+
+void RunConv2dBenchmark(const MicroBenchmarkOptions& options)
+{
+    const std::vector<Conv2dCase> cases
+    {
+        { "3x3 NHWC 56x56x64 -> 64",   armnn::DataLayout::NHWC,  64, 56,  64, 3, 1 },
+        { "3x3 NCHW 56x56x64 -> 64",   armnn::DataLayout::NCHW,  64, 56,  64, 3, 1 },
+        { "1x1 NHWC 28x28x128 -> 256", armnn::DataLayout::NHWC, 128, 28, 256, 1, 1 },
+        { "3x3/2 NHWC 112x112x32 -> 64", armnn::DataLayout::NHWC, 32, 112, 64, 3, 2 },
+        { "5x5 NHWC 14x14x256 -> 256", armnn::DataLayout::NHWC, 256, 14, 256, 5, 1 }
+    };
+
+    for (const auto& c : cases)
+    {
+        RunCase(c, options);
+    }
+}
@@ -0,0 +1,103 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MicroBenchmarkUtils.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+/// A chain of numLayers alternating Add and Sub layers which each combine the previous result with the input of the
+/// network, on a tensor small enough for the time spent dispatching the workloads to dominate.
+INetworkPtr CreateElementwiseChainNetwork(const TensorInfo& info, unsigned int numLayers)
+{
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input = network->AddInputLayer(0);
+    input->GetOutputSlot(0).SetTensorInfo(info);
+
+    IConnectableLayer* previous = input;
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        const BinaryOperation operation = i % 2 == 0 ? BinaryOperation::Add : BinaryOperation::Sub;
+        IConnectableLayer* layer = network->AddElementwiseBinaryLayer(operation);
+        previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+        input->GetOutputSlot(0).Connect(layer->GetInputSlot(1));
+        layer->GetOutputSlot(0).SetTensorInfo(info);
+        previous = layer;
+    }
+    previous->GetOutputSlot(0).Connect(network->AddOutputLayer(0)->GetInputSlot(0));
+    return network;
+}
+
+/// Times one inference of the chain on CpuRef, through EnqueueWorkload with tensors or with an execution binding.
+double TimeInferenceMs(const MicroBenchmarkOptions& options,
+                       const TensorInfo& info,
+                       unsigned int numLayers,
+                       bool useExecutionBinding)
+{
+    INetworkPtr network = CreateElementwiseChainNetwork(info, numLayers);
+
+    // CpuRef only fuses the chain into a single layer when asked to, so there is one workload per layer to time.
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkPtr optNet = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec());
+
+    NetworkId networkId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(false, MemorySource::Undefined, MemorySource::Undefined);
+    if (runtime->LoadNetwork(networkId, std::move(optNet), errorMessage, networkProperties) != Status::Success)
+    {
+        throw RuntimeException("DispatchBenchmark: failed to load the network: " + errorMessage);
+    }
+
+    TensorInfo inputInfo = info;
+    inputInfo.SetConstant(true);
+    std::vector<float> inputData(info.GetNumElements(), 0.5f);
+    std::vector<float> outputData(info.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(info, outputData.data()) } };
+
+    if (useExecutionBinding)
+    {
+        auto executionBinding = runtime->CreateExecutionBinding(networkId, inputTensors, outputTensors);
+        return TimeAverageMs(options, [&]()
+        {
+            runtime->EnqueueWorkload(*executionBinding);
+        });
+    }
+
+    return TimeAverageMs(options, [&]()
+    {
+        runtime->EnqueueWorkload(networkId, inputTensors, outputTensors);
+    });
+}
+
+void Compare(const MicroBenchmarkOptions& options, const TensorInfo& info, unsigned int numLayers)
+{
+    const std::string caseName = std::to_string(numLayers) + " layer elementwise chain, "
+                                 + std::to_string(info.GetNumElements()) + " elements";
+
+    const double tensorsMs = TimeInferenceMs(options, info, numLayers, false);
+    const double bindingMs = TimeInferenceMs(options, info, numLayers, true);
+    PrintComparison(caseName, "tensors", tensorsMs, "execution binding", bindingMs);
+
+    std::cout << "    time per layer          " << std::setprecision(3)
+              << tensorsMs * 1000.0 / numLayers << " us before, "
+              << bindingMs * 1000.0 / numLayers << " us after\n";
+}
+
+} // anonymous namespace
+
+void RunDispatchBenchmark(const MicroBenchmarkOptions& options)
+{
+    Compare(options, TensorInfo({ 1, 16 }, DataType::Float32), 500);
+    Compare(options, TensorInfo({ 1, 1024 }, DataType::Float32), 500);
+}
@@ -0,0 +1,206 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MicroBenchmarkUtils.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+IConnectableLayer* AddConstant(INetwork& network, const TensorInfo& info, std::vector<float>& storage, float value)
+{
+    storage.assign(info.GetNumElements(), value);
+    IConnectableLayer* constant = network.AddConstantLayer(ConstTensor(info, storage));
+    constant->GetOutputSlot(0).SetTensorInfo(info);
+    return constant;
+}
+
+IConnectableLayer* AddBinary(INetwork& network,
+                             BinaryOperation operation,
+                             IConnectableLayer* input0,
+                             IConnectableLayer* input1,
+                             const TensorInfo& outputInfo)
+{
+    IConnectableLayer* layer = network.AddElementwiseBinaryLayer(operation);
+    input0->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(layer->GetInputSlot(1));
+    layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    return layer;
+}
+
+IConnectableLayer* AddMean(INetwork& network, IConnectableLayer* input, const TensorInfo& outputInfo)
+{
+    IConnectableLayer* layer = network.AddMeanLayer(MeanDescriptor({ 2 }, true));
+    input->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+    layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    return layer;
+}
+
+/// LayerNorm over the last dimension as converters emit it: Mean, Sub, Mul, Mean, Add, Rsqrt, Mul, Mul, Add. The
+/// last five layers become a single fused one; the Sub is used three times and the Mul feeds a Mean, so they stay.
+/// Without computeStatistics, the mean and the variance are inputs 1 and 2 of the network instead, leaving only the
+/// elementwise layers, which all become a single fused one.
+INetworkPtr CreateLayerNormNetwork(const TensorInfo& info,
+                                   std::vector<std::vector<float>>& constants,
+                                   bool computeStatistics)
+{
+    const TensorShape& shape = info.GetShape();
+    const TensorInfo statisticsInfo({ shape[0], shape[1], 1 }, DataType::Float32);
+    const TensorInfo parameterInfo({ 1, 1, shape[2] }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo scalarInfo({ 1, 1, 1 }, DataType::Float32, 0.0f, 0, true);
+    constants.resize(3);
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* x = network->AddInputLayer(0);
+    x->GetOutputSlot(0).SetTensorInfo(info);
+
+    IConnectableLayer* mean = computeStatistics ? AddMean(*network, x, statisticsInfo) : network->AddInputLayer(1);
+    mean->GetOutputSlot(0).SetTensorInfo(statisticsInfo);
+    IConnectableLayer* centred  = AddBinary(*network, BinaryOperation::Sub, x, mean, info);
+
+    IConnectableLayer* variance = nullptr;
+    if (computeStatistics)
+    {
+        IConnectableLayer* squared = AddBinary(*network, BinaryOperation::Mul, centred, centred, info);
+        variance = AddMean(*network, squared, statisticsInfo);
+    }
+    else
+    {
+        variance = network->AddInputLayer(2);
+        variance->GetOutputSlot(0).SetTensorInfo(statisticsInfo);
+    }
+
+    IConnectableLayer* shifted  = AddBinary(*network, BinaryOperation::Add, variance,
+                                            AddConstant(*network, scalarInfo, constants[0], 1e-5f), statisticsInfo);
+    IConnectableLayer* rstd     = network->AddElementwiseUnaryLayer(
+                                      ElementwiseUnaryDescriptor(UnaryOperation::Rsqrt));
+    shifted->GetOutputSlot(0).Connect(rstd->GetInputSlot(0));
+    rstd->GetOutputSlot(0).SetTensorInfo(statisticsInfo);
+    IConnectableLayer* normed   = AddBinary(*network, BinaryOperation::Mul, centred, rstd, info);
+    IConnectableLayer* scaled   = AddBinary(*network, BinaryOperation::Mul, normed,
+                                            AddConstant(*network, parameterInfo, constants[1], 0.9f), info);
+    IConnectableLayer* biased   = AddBinary(*network, BinaryOperation::Add, scaled,
+                                            AddConstant(*network, parameterInfo, constants[2], 0.1f), info);
+    biased->GetOutputSlot(0).Connect(network->AddOutputLayer(0)->GetInputSlot(0));
+    return network;
+}
+
+/// The tanh approximation of GELU, 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))): eight elementwise
+/// layers which become a single fused one.
+INetworkPtr CreateGeluNetwork(const TensorInfo& info, std::vector<std::vector<float>>& constants)
+{
+    const TensorInfo scalarInfo({ 1, 1, 1 }, DataType::Float32, 0.0f, 0, true);
+    constants.resize(3);
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* x = network->AddInputLayer(0);
+    x->GetOutputSlot(0).SetTensorInfo(info);
+
+    ActivationDescriptor tanhDescriptor;
+    tanhDescriptor.m_Function = ActivationFunction::TanH;
+    tanhDescriptor.m_A = 1.0f;
+    tanhDescriptor.m_B = 0.7978845608f;
+
+    IConnectableLayer* squared = AddBinary(*network, BinaryOperation::Mul, x, x, info);
+    IConnectableLayer* cubed   = AddBinary(*network, BinaryOperation::Mul, squared, x, info);
+    IConnectableLayer* term    = AddBinary(*network, BinaryOperation::Mul, cubed,
+                                           AddConstant(*network, scalarInfo, constants[0], 0.044715f), info);
+    IConnectableLayer* inner   = AddBinary(*network, BinaryOperation::Add, x, term, info);
+    IConnectableLayer* tanh    = network->AddActivationLayer(tanhDescriptor);
+    inner->GetOutputSlot(0).Connect(tanh->GetInputSlot(0));
+    tanh->GetOutputSlot(0).SetTensorInfo(info);
+    IConnectableLayer* onePlus = AddBinary(*network, BinaryOperation::Add, tanh,
+                                           AddConstant(*network, scalarInfo, constants[1], 1.0f), info);
+    IConnectableLayer* half    = AddBinary(*network, BinaryOperation::Mul, x,
+                                           AddConstant(*network, scalarInfo, constants[2], 0.5f), info);
+    IConnectableLayer* gelu    = AddBinary(*network, BinaryOperation::Mul, half, onePlus, info);
+    gelu->GetOutputSlot(0).Connect(network->AddOutputLayer(0)->GetInputSlot(0));
+    return network;
+}
+
+/// Times EnqueueWorkload on CpuRef, with the elementwise chains of the network fused or not.
+template<typename CreateNetworkFunction>
+double TimeInferenceMs(const MicroBenchmarkOptions& options,
+                       const TensorInfo& info,
+                       unsigned int numInputs,
+                       CreateNetworkFunction&& createNetwork,
+                       bool fuseElementwise)
+{
+    std::vector<std::vector<float>> constants;
+    INetworkPtr network = createNetwork(info, constants);
+
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    OptimizerOptionsOpaque optimizerOptions;
+    optimizerOptions.AddModelOption(BackendOptions("CpuRef", { { "FuseElementwise", fuseElementwise } }));
+    IOptimizedNetworkPtr optNet = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec(),
+                                           optimizerOptions);
+
+    NetworkId networkId;
+    if (runtime->LoadNetwork(networkId, std::move(optNet)) != Status::Success)
+    {
+        throw RuntimeException("ElementwiseFusionBenchmark: failed to load the network");
+    }
+
+    std::vector<std::vector<float>> inputData(numInputs);
+    InputTensors inputTensors;
+    for (LayerBindingId id = 0; id < static_cast<LayerBindingId>(numInputs); ++id)
+    {
+        TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, id);
+        inputInfo.SetConstant(true);
+
+        std::vector<float>& data = inputData[static_cast<size_t>(id)];
+        data.resize(inputInfo.GetNumElements());
+        for (unsigned int i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<float>(i % 97) * 0.05f + 0.1f;
+        }
+        inputTensors.push_back({ id, ConstTensor(inputInfo, data.data()) });
+    }
+
+    std::vector<float> outputData(info.GetNumElements());
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+
+    return TimeAverageMs(options, [&]()
+    {
+        runtime->EnqueueWorkload(networkId, inputTensors, outputTensors);
+    });
+}
+
+template<typename CreateNetworkFunction>
+void Compare(const MicroBenchmarkOptions& options,
+             const std::string& caseName,
+             const TensorInfo& info,
+             unsigned int numInputs,
+             CreateNetworkFunction&& createNetwork)
+{
+    const double unfusedMs = TimeInferenceMs(options, info, numInputs, createNetwork, false);
+    const double fusedMs = TimeInferenceMs(options, info, numInputs, createNetwork, true);
+    PrintComparison(caseName, "one layer per operation", unfusedMs, "fused chains", fusedMs);
+}
+
+} // anonymous namespace
+
+void RunElementwiseFusionBenchmark(const MicroBenchmarkOptions& options)
+{
+    const TensorInfo layerNormInfo({ 1, 128, 768 }, DataType::Float32);
+    Compare(options, "LayerNorm 1x128x768", layerNormInfo, 1,
+            [](const TensorInfo& info, std::vector<std::vector<float>>& constants)
+            {
+                return CreateLayerNormNetwork(info, constants, true);
+            });
+    Compare(options, "LayerNorm 1x128x768, mean and variance given", layerNormInfo, 3,
+            [](const TensorInfo& info, std::vector<std::vector<float>>& constants)
+            {
+                return CreateLayerNormNetwork(info, constants, false);
+            });
+    Compare(options, "GELU 1x128x3072", TensorInfo({ 1, 128, 3072 }, DataType::Float32), 1, CreateGeluNetwork);
+}
@@ -0,0 +1,95 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MicroBenchmarkUtils.hpp"
+
+#include <cxxopts.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+struct MicroBenchmark
+{
+    std::string m_Name;
+    std::string m_Description;
+    void (*m_Run)(const MicroBenchmarkOptions&);
+};
+
+const std::vector<MicroBenchmark> microBenchmarks
+{
+    {"conv2d", "Float32 Conv2d: generic Convolve loop versus im2col/GEMM", RunConv2dBenchmark},
+    {"qconv2d", "QAsymmU8 Conv2d: dequantised Convolve loop versus integer only kernels",
+     RunQuantizedConv2dBenchmark},
+    {"threads", "CpuRef intra-operator multithreading: kernel times for 1, 2, 4, ... threads",
+     RunThreadScalingBenchmark},
+    {"optimizer", "Optimizer::Pass on large graphs: re-sorting loop versus worklist", RunOptimizerBenchmark},
+    {"eltwise", "LayerNorm and GELU subgraphs: one layer per elementwise operation versus fused chains",
+     RunElementwiseFusionBenchmark},
+    {"dispatch", "500 layer elementwise chain: EnqueueWorkload with tensors versus an execution binding",
+     RunDispatchBenchmark},
+    {"branches", "Multi-branch convolution network: serial versus parallel execution of the branches",
+     RunBranchesBenchmark}
+};
+
+void PrintBenchmarks()
+{
+    std::cout << "Available benchmarks:\n";
+    for (const auto& benchmark : microBenchmarks)
+    {
+        std::cout << std::left << std::setw(24) << benchmark.m_Name << benchmark.m_Description << "\n";
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options options("MicroBenchmark", "Times reference backend kernels and runtime overheads");
+
+    options.add_options()
+        ("b, benchmark", "Benchmark name, do not specify to run all benchmarks", cxxopts::value<std::string>())
+        ("i, iterations", "Number of timed iterations",
+         cxxopts::value<unsigned int>()->default_value("10"))
+        ("w, warmup", "Number of warmup iterations",
+         cxxopts::value<unsigned int>()->default_value("2"))
+        ("h,help", "Display usage information");
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help"))
+    {
+        std::cout << options.help() << std::endl;
+        PrintBenchmarks();
+        return EXIT_SUCCESS;
+    }
+
+    MicroBenchmarkOptions benchmarkOptions;
+    benchmarkOptions.m_Iterations = std::max(1u, result["iterations"].as<unsigned int>());
+    benchmarkOptions.m_WarmupIterations = result["warmup"].as<unsigned int>();
+
+    std::string benchmarkName;
+    if (result.count("benchmark"))
+    {
+        benchmarkName = result["benchmark"].as<std::string>();
+    }
+
+    bool found = false;
+    for (const auto& benchmark : microBenchmarks)
+    {
+        if (benchmarkName.empty() || benchmark.m_Name == benchmarkName)
+        {
+            std::cout << "\nBenchmark: " << benchmark.m_Name << "\n";
+            std::cout << "===============================================\n";
+            benchmark.m_Run(benchmarkOptions);
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        std::cout << "Benchmark name not found\n";
+        PrintBenchmarks();
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
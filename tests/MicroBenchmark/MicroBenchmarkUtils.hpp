@@ -0,0 +1,58 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+struct MicroBenchmarkOptions
+{
+    unsigned int m_Iterations = 10;
+    unsigned int m_WarmupIterations = 2;
+};
+
+/// Runs the given function the configured number of warmup and timed iterations and returns the average duration
+/// of a timed iteration in milliseconds.
+template<typename Function>
+double TimeAverageMs(const MicroBenchmarkOptions& options, Function&& function)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    for (unsigned int i = 0; i < options.m_WarmupIterations; ++i)
+    {
+        function();
+    }
+
+    auto start = Clock::now();
+    for (unsigned int i = 0; i < options.m_Iterations; ++i)
+    {
+        function();
+    }
+    std::chrono::duration<double, std::milli> duration = Clock::now() - start;
+    return duration.count() / static_cast<double>(options.m_Iterations);
+}
+
+inline void PrintComparison(const std::string& caseName,
+                            const std::string& baselineName,
+                            double baselineMs,
+                            const std::string& candidateName,
+                            double candidateMs)
+{
+    std::cout << caseName << "\n"
+              << "    " << std::left << std::setw(24) << baselineName << std::fixed << std::setprecision(3)
+              << baselineMs << " ms\n"
+              << "    " << std::left << std::setw(24) << candidateName << candidateMs << " ms\n"
+              << "    speedup                 " << std::setprecision(2) << baselineMs / candidateMs << "x\n";
+}
+
+// Benchmarks available to the MicroBenchmark executable.
+void RunBranchesBenchmark(const MicroBenchmarkOptions& options);
+void RunConv2dBenchmark(const MicroBenchmarkOptions& options);
+void RunDispatchBenchmark(const MicroBenchmarkOptions& options);
+void RunElementwiseFusionBenchmark(const MicroBenchmarkOptions& options);
+void RunOptimizerBenchmark(const MicroBenchmarkOptions& options);
+void RunQuantizedConv2dBenchmark(const MicroBenchmarkOptions& options);
+void RunThreadScalingBenchmark(const MicroBenchmarkOptions& options);
@@ -0,0 +1,173 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MicroBenchmarkUtils.hpp"
+
+#include <Graph.hpp>
+#include <Observable.hpp>
+#include <Optimizer.hpp>
+#include <optimizations/All.hpp>
+
+#include <armnn/backends/TensorHandle.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+std::shared_ptr<ConstTensorHandle> MakeConstant(const TensorInfo& info, float value)
+{
+    std::vector<float> data(info.GetNumElements(), value);
+    return std::make_shared<ScopedTensorHandle>(ConstTensor(info, data));
+}
+
+/// Builds a chain of the given number of blocks, each made of Conv2d (with constant weights and no bias),
+/// BatchNormalization, ReLu and two Reshapes which cancel out, so that every block gives both optimizations something
+/// to do: 6 layers per block before optimization, 4 after (weights, bias, Conv2d and ReLu).
+std::unique_ptr<Graph> CreateGraph(unsigned int numBlocks)
+{
+    const TensorInfo info({ 1, 8, 8, 16 }, DataType::Float32);
+    const TensorInfo flatInfo({ 1, 64, 16 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 16, 1, 1, 16 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo channelInfo({ 16 }, DataType::Float32, 0.0f, 0, true);
+
+    Convolution2dDescriptor convDescriptor;
+    convDescriptor.m_DataLayout = DataLayout::NHWC;
+    BatchNormalizationDescriptor batchNormDescriptor;
+    batchNormDescriptor.m_DataLayout = DataLayout::NHWC;
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    auto graph = std::make_unique<Graph>();
+    Layer* previous = graph->AddLayer<InputLayer>(0, "input");
+    previous->GetOutputSlot(0).SetTensorInfo(info);
+
+    auto connect = [&previous](Layer* layer, const TensorInfo& outputInfo)
+    {
+        previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+        layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+        previous = layer;
+    };
+
+    for (unsigned int i = 0; i < numBlocks; ++i)
+    {
+        const std::string suffix = std::to_string(i);
+
+        auto weights = graph->AddLayer<ConstantLayer>(("weights" + suffix).c_str());
+        weights->m_LayerOutput = MakeConstant(weightsInfo, 0.5f);
+        weights->GetOutputSlot(0).SetTensorInfo(weightsInfo);
+
+        auto conv = graph->AddLayer<Convolution2dLayer>(convDescriptor, ("conv" + suffix).c_str());
+        connect(conv, info);
+        weights->GetOutputSlot(0).Connect(conv->GetInputSlot(1));
+
+        auto batchNorm = graph->AddLayer<BatchNormalizationLayer>(batchNormDescriptor, ("bn" + suffix).c_str());
+        batchNorm->m_Mean = MakeConstant(channelInfo, 0.1f);
+        batchNorm->m_Variance = MakeConstant(channelInfo, 1.0f);
+        batchNorm->m_Beta = MakeConstant(channelInfo, 0.2f);
+        batchNorm->m_Gamma = MakeConstant(channelInfo, 2.0f);
+        connect(batchNorm, info);
+
+        connect(graph->AddLayer<ActivationLayer>(activationDescriptor, ("relu" + suffix).c_str()), info);
+        connect(graph->AddLayer<ReshapeLayer>(ReshapeDescriptor{ flatInfo.GetShape() },
+                                              ("flatten" + suffix).c_str()), flatInfo);
+        connect(graph->AddLayer<ReshapeLayer>(ReshapeDescriptor{ info.GetShape() },
+                                              ("unflatten" + suffix).c_str()), info);
+    }
+
+    auto output = graph->AddLayer<OutputLayer>(0, "output");
+    previous->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    return graph;
+}
+
+/// Optimizer::Pass as it was before it kept a worklist: the graph is sorted again in every iteration, and the loop
+/// goes back to the end of the list whenever a layer is erased.
+void LegacyPass(Graph& graph, const Optimizer::Optimizations& optimizations)
+{
+    AddedLayerObservable addedLayerObservable(graph);
+    ErasedLayerNamesObservable erasedLayerNamesObservable(graph);
+
+    auto it = graph.TopologicalSort().end();
+    while (it != graph.TopologicalSort().begin())
+    {
+        --it;
+        for (auto&& optimization : optimizations)
+        {
+            optimization->Run(graph, **it);
+
+            bool layerErased = false;
+            if ((*it)->IsOutputUnconnected())
+            {
+                auto next = std::next(graph.GetPosInGraph(**it));
+                graph.EraseLayer(it);
+                it = next;
+                layerErased = true;
+            }
+
+            for (auto& erasedLayerName : erasedLayerNamesObservable)
+            {
+                for (auto& addedLayer : addedLayerObservable)
+                {
+                    addedLayer->AddRelatedLayerName(erasedLayerName);
+                }
+            }
+            erasedLayerNamesObservable.Clear();
+            addedLayerObservable.Clear();
+
+            if (layerErased)
+            {
+                break;
+            }
+        }
+    }
+}
+
+/// Times the given pass alone: a fresh graph is built before every iteration, outside of the timed region.
+template<typename PassFunction>
+double TimePassMs(const MicroBenchmarkOptions& options, unsigned int numBlocks, PassFunction&& pass)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    auto optimizations = MakeOptimizations(optimizations::FuseBatchNormIntoConvolution2DFloat32(),
+                                           optimizations::OptimizeConsecutiveReshapes());
+
+    for (unsigned int i = 0; i < options.m_WarmupIterations; ++i)
+    {
+        auto graph = CreateGraph(numBlocks);
+        pass(*graph, optimizations);
+    }
+
+    std::chrono::duration<double, std::milli> duration(0);
+    for (unsigned int i = 0; i < options.m_Iterations; ++i)
+    {
+        auto graph = CreateGraph(numBlocks);
+        auto start = Clock::now();
+        pass(*graph, optimizations);
+        duration += Clock::now() - start;
+
+        if (graph->GetNumLayers() != numBlocks * 4 + 2)
+        {
+            throw RuntimeException("OptimizerBenchmark: the graph was not fully optimized");
+        }
+    }
+    return duration.count() / static_cast<double>(options.m_Iterations);
+}
+
+} // anonymous namespace
+
+void RunOptimizerBenchmark(const MicroBenchmarkOptions& options)
+{
+    for (unsigned int numBlocks : { 100u, 500u, 1000u })
+    {
+        const double legacyMs = TimePassMs(options, numBlocks, LegacyPass);
+        const double passMs = TimePassMs(options, numBlocks, Optimizer::Pass);
+
+        PrintComparison("Conv2d + BatchNorm + ReLu + 2 Reshape, " + std::to_string(numBlocks * 6 + 2) + " layers",
+                        "re-sorting loop", legacyMs, "worklist", passMs);
+    }
+}
@@ -0,0 +1,103 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MicroBenchmarkUtils.hpp"
+
+#include <reference/workloads/ConvImpl.hpp>
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/Encoders.hpp>
+#include <reference/workloads/QuantizedConvImpl.hpp>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct QuantizedConv2dCase
+{
+    std::string m_Name;
+    unsigned int m_InputChannels;
+    unsigned int m_InputSize;
+    unsigned int m_OutputChannels;
+    unsigned int m_FilterSize;
+    bool m_Depthwise;
+};
+
+void RunCase(const QuantizedConv2dCase& c, const MicroBenchmarkOptions& options)
+{
+    using namespace armnn;
+
+    // NHWC, stride 1 and "same" padding.
+    const unsigned int padding = c.m_FilterSize / 2;
+    const TensorShape weightsShape = c.m_Depthwise ?
+        TensorShape({ 1, c.m_FilterSize, c.m_FilterSize, c.m_OutputChannels }) :
+        TensorShape({ c.m_OutputChannels, c.m_FilterSize, c.m_FilterSize, c.m_InputChannels });
+
+    const TensorInfo inputInfo({ 1, c.m_InputSize, c.m_InputSize, c.m_InputChannels }, DataType::QAsymmU8, 0.05f, 128);
+    const TensorInfo weightsInfo(weightsShape, DataType::QAsymmU8, 0.01f, 127, true);
+    const TensorInfo biasInfo({ c.m_OutputChannels }, DataType::Signed32, 0.05f * 0.01f, 0, true);
+    const TensorInfo outputInfo({ 1, c.m_InputSize, c.m_InputSize, c.m_OutputChannels },
+                                DataType::QAsymmU8, 0.5f, 128);
+
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<uint8_t> input(inputInfo.GetNumElements());
+    std::vector<uint8_t> weights(weightsInfo.GetNumElements());
+    std::vector<int32_t> bias(c.m_OutputChannels);
+    std::vector<uint8_t> output(outputInfo.GetNumElements());
+    for (auto* data : { &input, &weights })
+    {
+        for (auto& value : *data)
+        {
+            value = static_cast<uint8_t>(distribution(generator));
+        }
+    }
+    for (auto& value : bias)
+    {
+        value = distribution(generator) - 128;
+    }
+
+    double floatMs = TimeAverageMs(options, [&]()
+    {
+        auto inputDecoder   = MakeDecoder<float>(inputInfo, input.data());
+        auto weightsDecoder = MakeDecoder<float>(weightsInfo, weights.data());
+        auto biasDecoder    = MakeDecoder<float>(biasInfo, bias.data());
+        auto outputEncoder  = MakeEncoder<float>(outputInfo, output.data());
+        Convolve(inputInfo.GetShape(), *inputDecoder, outputInfo.GetShape(), *outputEncoder, weightsShape,
+                 *weightsDecoder, true, biasDecoder.get(), DataLayout::NHWC, padding, padding, 1, 1, 1, 1,
+                 c.m_Depthwise);
+    });
+
+    // The weights are treated as constant, so they are prepared once outside of the timed loop, as the workloads do.
+    const QuantizedConvOutputStage outputStage(inputInfo, weightsInfo, outputInfo, c.m_OutputChannels);
+    const std::vector<int16_t> preparedWeights =
+        c.m_Depthwise ? PrepareQuantizedDepthwiseWeights(weightsInfo, weights.data())
+                      : PrepareQuantizedConvolutionWeights(weightsInfo, weights.data(), DataLayout::NHWC);
+
+    double integerMs = TimeAverageMs(options, [&]()
+    {
+        QuantizedConvolve(inputInfo, input.data(), outputInfo, output.data(), weightsShape, preparedWeights.data(),
+                          bias.data(), outputStage, DataLayout::NHWC, padding, padding, 1, 1, 1, 1, c.m_Depthwise);
+    });
+
+    PrintComparison(c.m_Name, "Convolve (dequantised)", floatMs, "QuantizedConvolve", integerMs);
+}
+
+} // anonymous namespace
+
+void RunQuantizedConv2dBenchmark(const MicroBenchmarkOptions& options)
+{
+    const std::vector<QuantizedConv2dCase> cases
+    {
+        { "QAsymmU8 3x3 NHWC 56x56x64 -> 64",       64, 56,  64, 3, false },
+        { "QAsymmU8 1x1 NHWC 28x28x128 -> 256",    128, 28, 256, 1, false },
+        { "QAsymmU8 depthwise 3x3 NHWC 56x56x128", 128, 56, 128, 3, true }
+    };
+
+    for (const auto& c : cases)
+    {
+        RunCase(c, options);
+    }
+}
@@ -0,0 +1,170 @@
+//
+// Copyright © 2024 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MicroBenchmarkUtils.hpp"
+
+#include <reference/workloads/ConvGemmImpl.hpp>
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/ElementwiseFunction.hpp>
+#include <reference/workloads/Encoders.hpp>
+#include <reference/workloads/FullyConnected.hpp>
+#include <reference/workloads/Pooling2d.hpp>
+#include <reference/workloads/QuantizedConvImpl.hpp>
+#include <reference/workloads/RefTaskPool.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct ScalingCase
+{
+    std::string m_Name;
+    std::function<void()> m_Run;
+};
+
+std::vector<float> RandomFloats(unsigned int size)
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> values(size);
+    for (auto& value : values)
+    {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+} // anonymous namespace
+
+void RunThreadScalingBenchmark(const MicroBenchmarkOptions& options)
+{
+    using namespace armnn;
+
+    // Float32 3x3 NHWC convolution through the im2col/GEMM kernel.
+    const TensorShape convInputShape({ 1, 56, 56, 64 });
+    const TensorShape convFilterShape({ 64, 3, 3, 64 });
+    const TensorShape convOutputShape({ 1, 56, 56, 64 });
+    const std::vector<float> convInput = RandomFloats(convInputShape.GetNumElements());
+    const std::vector<float> convFilter = RandomFloats(convFilterShape.GetNumElements());
+    const std::vector<float> convBias = RandomFloats(64);
+    const std::vector<float> packedFilter = PackConvolutionFilter(convFilterShape, convFilter.data(), DataLayout::NHWC);
+    std::vector<float> convOutput(convOutputShape.GetNumElements());
+
+    // The same convolution through the integer only kernel.
+    const TensorInfo qInputInfo(convInputShape, DataType::QAsymmU8, 0.05f, 128);
+    const TensorInfo qFilterInfo(convFilterShape, DataType::QAsymmU8, 0.01f, 127, true);
+    const TensorInfo qOutputInfo(convOutputShape, DataType::QAsymmU8, 0.5f, 128);
+    std::vector<uint8_t> qInput(convInputShape.GetNumElements());
+    std::vector<uint8_t> qFilter(convFilterShape.GetNumElements());
+    std::transform(convInput.begin(), convInput.end(), qInput.begin(),
+                   [](float value) { return static_cast<uint8_t>(value * 127.0f + 128.0f); });
+    std::transform(convFilter.begin(), convFilter.end(), qFilter.begin(),
+                   [](float value) { return static_cast<uint8_t>(value * 127.0f + 127.0f); });
+    const QuantizedConvOutputStage outputStage(qInputInfo, qFilterInfo, qOutputInfo, 64);
+    const std::vector<int16_t> preparedFilter =
+        PrepareQuantizedConvolutionWeights(qFilterInfo, qFilter.data(), DataLayout::NHWC);
+    std::vector<uint8_t> qOutput(convOutputShape.GetNumElements());
+
+    // Float32 fully connected with a batch of one.
+    const TensorInfo fcInputInfo({ 1, 2048 }, DataType::Float32);
+    const TensorInfo fcWeightsInfo({ 1000, 2048 }, DataType::Float32);
+    const TensorInfo fcOutputInfo({ 1, 1000 }, DataType::Float32);
+    const std::vector<float> fcInput = RandomFloats(fcInputInfo.GetNumElements());
+    const std::vector<float> fcWeights = RandomFloats(fcWeightsInfo.GetNumElements());
+    std::vector<float> fcOutput(fcOutputInfo.GetNumElements());
+
+    // Float32 3x3 stride 2 max pooling.
+    Pooling2dDescriptor poolDescriptor;
+    poolDescriptor.m_PoolType = PoolingAlgorithm::Max;
+    poolDescriptor.m_PoolWidth = 3;
+    poolDescriptor.m_PoolHeight = 3;
+    poolDescriptor.m_StrideX = 2;
+    poolDescriptor.m_StrideY = 2;
+    poolDescriptor.m_DataLayout = DataLayout::NHWC;
+    const TensorInfo poolInputInfo({ 1, 112, 112, 64 }, DataType::Float32);
+    const TensorInfo poolOutputInfo({ 1, 55, 55, 64 }, DataType::Float32);
+    const std::vector<float> poolInput = RandomFloats(poolInputInfo.GetNumElements());
+    std::vector<float> poolOutput(poolOutputInfo.GetNumElements());
+
+    // Float32 addition of a per channel bias, broadcast over a 112x112x64 NHWC tensor.
+    const TensorShape addInputShape({ 1, 112, 112, 64 });
+    const TensorShape addBiasShape({ 1, 1, 1, 64 });
+    const TensorInfo addInputInfo(addInputShape, DataType::Float32);
+    const TensorInfo addBiasInfo(addBiasShape, DataType::Float32);
+    const std::vector<float> addInput = RandomFloats(addInputShape.GetNumElements());
+    const std::vector<float> addBias = RandomFloats(addBiasShape.GetNumElements());
+    std::vector<float> addOutput(addInputShape.GetNumElements());
+
+    const std::vector<ScalingCase> cases
+    {
+        { "Float32 ConvolveGemm 3x3 NHWC 56x56x64 -> 64", [&]()
+            {
+                ConvolveGemm(convInputShape, convInput.data(), convOutputShape, convOutput.data(), convFilterShape,
+                             packedFilter.data(), convBias.data(), DataLayout::NHWC, 1, 1, 1, 1, 1, 1);
+            }
+        },
+        { "QAsymmU8 QuantizedConvolve 3x3 NHWC 56x56x64 -> 64", [&]()
+            {
+                QuantizedConvolve(qInputInfo, qInput.data(), qOutputInfo, qOutput.data(), convFilterShape,
+                                  preparedFilter.data(), nullptr, outputStage, DataLayout::NHWC,
+                                  1, 1, 1, 1, 1, 1, false);
+            }
+        },
+        { "Float32 FullyConnected 2048 -> 1000", [&]()
+            {
+                auto inputDecoder = MakeDecoder<float>(fcInputInfo, fcInput.data());
+                auto weightsDecoder = MakeDecoder<float>(fcWeightsInfo, fcWeights.data());
+                auto outputEncoder = MakeEncoder<float>(fcOutputInfo, fcOutput.data());
+                FullyConnected(fcInputInfo.GetShape(), *inputDecoder, fcOutputInfo.GetShape(), *outputEncoder,
+                               fcWeightsInfo.GetShape(), *weightsDecoder, nullptr, false, 2048, true);
+            }
+        },
+        { "Float32 Pooling2d max 3x3/2 NHWC 112x112x64", [&]()
+            {
+                auto inputDecoder = MakeDecoder<float>(poolInputInfo, poolInput.data());
+                auto outputEncoder = MakeEncoder<float>(poolOutputInfo, poolOutput.data());
+                Pooling2d(*inputDecoder, *outputEncoder, poolInputInfo, poolOutputInfo, poolDescriptor);
+            }
+        },
+        { "Float32 ElementwiseBinary add, broadcast 112x112x64 + 64", [&]()
+            {
+                auto inputDecoder = MakeDecoder<float>(addInputInfo, addInput.data());
+                auto biasDecoder = MakeDecoder<float>(addBiasInfo, addBias.data());
+                auto outputEncoder = MakeEncoder<float>(addInputInfo, addOutput.data());
+                ElementwiseBinaryFunction<std::plus<float>>(addInputShape, addBiasShape, addInputShape,
+                                                            *inputDecoder, *biasDecoder, *outputEncoder);
+            }
+        }
+    };
+
+    std::vector<unsigned int> threadCounts;
+    const unsigned int maxThreads = std::max(4u, std::thread::hardware_concurrency());
+    for (unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        threadCounts.push_back(numThreads);
+    }
+
+    RefTaskPool& pool = RefTaskPool::Get();
+    const unsigned int originalThreads = pool.GetNumberOfThreads();
+    for (const auto& c : cases)
+    {
+        std::cout << c.m_Name << "\n";
+        double singleThreadMs = 0.0;
+        for (unsigned int numThreads : threadCounts)
+        {
+            pool.SetNumberOfThreads(numThreads);
+            const double ms = TimeAverageMs(options, c.m_Run);
+            singleThreadMs = numThreads == 1 ? ms : singleThreadMs;
+            std::cout << "    " << std::right << std::setw(2) << numThreads << " threads  " << std::fixed
+                      << std::setprecision(3) << std::setw(10) << ms << " ms  speedup " << std::setprecision(2)
+                      << singleThreadMs / ms << "x\n";
+        }
+    }
+    pool.SetNumberOfThreads(originalThreads);
+}